@@ -0,0 +1,375 @@
+/* bench.c
+ * agent, 14/Oct/2026
+ */
+
+/* CRC RevEng: arbitrary-precision CRC calculator and algorithm finder
+ * Copyright (C) 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018,
+ * 2019, 2020, 2021, 2022  Gregory Cook
+ *
+ * This file is part of CRC RevEng.
+ *
+ * CRC RevEng is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * CRC RevEng is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with CRC RevEng.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/* 2026-10-14: added prev and prevch workloads
+ * 2026-10-14: started bench.c, benchmark harness
+ */
+
+/* This program is built by `make bench' and linked with the library
+ * objects.  It times fixed workloads, drawn from a fixed pseudo-random
+ * sequence so that every run and every build sees the same data, and
+ * prints one JSON object per line on stdout:
+ *
+ *   ptcrc, pcrc  CRC throughput by width, in ns/byte
+ *   prev, prevch reflection of a message, whole or by character size
+ *   scan         the -s preset scan over every preset of a width
+ *   brute        a brute force search, in candidate generators/s
+ *   engini       solving Init and XorOut for a given generator
+ *   filtop       file ingest through stdio, in ns/byte
+ *   buftop       file ingest from memory, as with MMAP, in ns/byte
+ *   build        the configuration, and with MMAP the peak RSS
+ *
+ * Times are processor time from clock().  Each workload is repeated
+ * until it has run for BSECS seconds.
+ */
+
+#ifdef MMAP
+#  define _POSIX_C_SOURCE 200112L
+#endif /* MMAP */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#ifdef MMAP
+#  include <sys/resource.h>
+#endif /* MMAP */
+#include "reveng.h"
+
+/* least processor time to spend on each workload */
+#define BSECS 0.5
+
+/* length of messages for the throughput workloads */
+#define BBYTES 65536UL
+
+/* number of samples given to the searches */
+#define BSAMP 4
+
+/* whether the size of a bmp_t is a compile-time constant */
+#if defined PRESETS || defined BMPMACRO
+#  define BMACRO 1
+#else
+#  define BMACRO 0
+#endif
+
+static unsigned long brand(void);
+static double btime(clock_t start);
+static poly_t bdata(unsigned long count);
+static poly_t bsamp(const model_t *model, const ptab_t *tab, unsigned long count);
+static void bgen(model_t *model, const char *spoly, const char *init, const char *xorout);
+static void bcrc(void);
+static void brev(void);
+static void bscan(void);
+static void bsrch(void);
+static void bread(void);
+static void bbuild(void);
+
+static unsigned long seed = 1UL;	/* state of brand() */
+
+int
+main(int argc, char *argv[]) {
+	/* Runs each workload in turn. */
+	SETBMP();
+	bcrc();
+	brev();
+	bscan();
+	bsrch();
+	bread();
+	bbuild();
+	return(EXIT_SUCCESS);
+}
+
+static unsigned long
+brand(void) {
+	/* Returns the next byte of a fixed pseudo-random sequence, from
+	 * a 32-bit linear congruential generator.
+	 */
+	seed = (seed * 1103515245UL + 12345UL) & 0xffffffffUL;
+	return(seed >> 16 & 0xffUL);
+}
+
+static double
+btime(clock_t start) {
+	/* Returns the processor time in seconds since start. */
+	return((double) (clock() - start) / CLOCKS_PER_SEC);
+}
+
+static poly_t
+bdata(unsigned long count) {
+	/* Returns a message of count bytes from brand(). */
+	unsigned char *buffer;
+	unsigned long iter;
+	poly_t result;
+
+	if(!(buffer = (unsigned char *) malloc(count ? count : 1UL)))
+		uerror("cannot allocate memory for benchmark data");
+	for(iter = 0UL; iter < count; ++iter)
+		buffer[iter] = (unsigned char) brand();
+	result = buftop(buffer, count, 0, 8);
+	free(buffer);
+	return(result);
+}
+
+static poly_t
+bsamp(const model_t *model, const ptab_t *tab, unsigned long count) {
+	/* Returns a codeword of count message bytes from brand(),
+	 * followed by their CRC under model, a big-endian model whose
+	 * engine is tab.
+	 */
+	poly_t result, crc;
+
+	result = bdata(count);
+	crc = ptcrc(result, tab, model->init, model->xorout, P_MULXN);
+	psum(&result, crc, plen(result));
+	pfree(&crc);
+	return(result);
+}
+
+static void
+bgen(model_t *model, const char *spoly, const char *init, const char *xorout) {
+	/* Sets model to the big-endian model with the given parameters,
+	 * in hexadecimal of whole digits.
+	 */
+	mfree(model);
+	model->spoly = strtop(spoly, 0, 4);
+	model->init = strtop(init, 0, 4);
+	model->xorout = strtop(xorout, 0, 4);
+	model->flags = P_BE;
+}
+
+static void
+bcrc(void) {
+	/* Times the table-driven engine and pcrc() on one message at
+	 * each of several widths.
+	 */
+	static const char *const spolys[] = {
+		"07", "1021", "04c11db7", "42f0e1eba9ea3693",
+		"0000000000000000000000000000008b", NULL
+	};
+	const char *const *sptr;
+	poly_t message, spoly, init = PZERO, crc;
+	ptab_t tab = PTZERO;
+	unsigned long reps;
+	clock_t start;
+	double secs;
+
+	message = bdata(BBYTES);
+	for(sptr = spolys; *sptr; ++sptr) {
+		spoly = strtop(*sptr, 0, 4);
+		palloc(&init, plen(spoly));
+		ptinit(&tab, spoly);
+		for(reps = 0UL, start = clock(); (secs = btime(start)) < BSECS; ++reps) {
+			crc = ptcrc(message, &tab, init, init, P_MULXN);
+			pfree(&crc);
+		}
+		printf("{\"bench\": \"ptcrc\", \"width\": %lu, \"bytes\": %lu, \"reps\": %lu, \"ns_per_byte\": %.3f}\n",
+			plen(spoly), BBYTES, reps, secs * 1e9 / ((double) reps * BBYTES));
+		for(reps = 0UL, start = clock(); (secs = btime(start)) < BSECS; ++reps) {
+			crc = pcrc(message, spoly, init, init, P_MULXN, NULL);
+			pfree(&crc);
+		}
+		printf("{\"bench\": \"pcrc\", \"width\": %lu, \"bytes\": %lu, \"reps\": %lu, \"ns_per_byte\": %.3f}\n",
+			plen(spoly), BBYTES, reps, secs * 1e9 / ((double) reps * BBYTES));
+		pfree(&spoly);
+	}
+	ptfree(&tab);
+	pfree(&init);
+	pfree(&message);
+}
+
+static void
+brev(void) {
+	/* Times prev() and prevch() on one message, the latter at
+	 * several character sizes.
+	 */
+	static const int sizes[] = {8, 16, 32, 12, 0};
+	const int *iptr;
+	poly_t message;
+	unsigned long reps;
+	clock_t start;
+	double secs;
+
+	message = bdata(BBYTES);
+	for(reps = 0UL, start = clock(); (secs = btime(start)) < BSECS; ++reps)
+		prev(&message);
+	printf("{\"bench\": \"prev\", \"bytes\": %lu, \"reps\": %lu, \"ns_per_byte\": %.3f}\n",
+		BBYTES, reps, secs * 1e9 / ((double) reps * BBYTES));
+	for(iptr = sizes; *iptr; ++iptr) {
+		for(reps = 0UL, start = clock(); (secs = btime(start)) < BSECS; ++reps)
+			prevch(&message, *iptr);
+		printf("{\"bench\": \"prevch\", \"bperhx\": %d, \"bytes\": %lu, \"reps\": %lu, \"ns_per_byte\": %.3f}\n",
+			*iptr, BBYTES, reps, secs * 1e9 / ((double) reps * BBYTES));
+	}
+	pfree(&message);
+}
+
+static void
+bscan(void) {
+	/* Times the -s preset scan, as in cli.c, of samples that match
+	 * no preset, so that every preset of the width is tried in both
+	 * endiannesses.
+	 */
+	poly_t samples[BSAMP], crc;
+	const mprep_t *pgrp;
+	unsigned long reps, tried = 0UL;
+	int iter, psets, pass, flags;
+	clock_t start;
+	double secs;
+
+	if(!mcount())
+		return;
+	for(iter = 0; iter < BSAMP; ++iter)
+		samples[iter] = bdata(64UL);
+	/* the first call builds the index */
+	mgroup(&pgrp, 32UL, P_BE);
+	for(reps = 0UL, start = clock(); (secs = btime(start)) < BSECS; ++reps) {
+		flags = P_BE;
+		tried = 0UL;
+		for(pass = 0; pass < 2; ++pass) {
+			psets = mgroup(&pgrp, 32UL, flags);
+			for(; psets; --psets, ++pgrp, ++tried) {
+				for(iter = 0; iter < BSAMP; ++iter) {
+					crc = ptcrc(samples[iter], &pgrp->tab, pgrp->model.init, pgrp->xorout, 0);
+					pfree(&crc);
+				}
+			}
+			flags ^= P_REFIN | P_REFOUT;
+			for(iter = 0; iter < BSAMP; ++iter)
+				prevch(samples + iter, 8);
+		}
+	}
+	printf("{\"bench\": \"scan\", \"width\": 32, \"samples\": %d, \"presets\": %lu, \"reps\": %lu, \"us_per_scan\": %.3f}\n",
+		BSAMP, tried, reps, secs * 1e6 / (double) reps);
+	for(iter = 0; iter < BSAMP; ++iter)
+		pfree(samples + iter);
+}
+
+static void
+bsrch(void) {
+	/* Times a brute force search of width 16 and the solution of
+	 * Init and XorOut by engini() at width 32, through reveng().
+	 */
+	model_t model = MZERO, guess = MZERO, *mptr, *candmods;
+	poly_t samples[BSAMP];
+	ptab_t tab = PTZERO;
+	rctx_t ctx = RZERO;
+	unsigned long reps, found = 0UL;
+	int iter;
+	clock_t start;
+	double secs;
+
+	/* CRC-16/IBM-3740 */
+	bgen(&model, "1021", "ffff", "0000");
+	ptinit(&tab, model.spoly);
+	for(iter = 0; iter < BSAMP; ++iter)
+		samples[iter] = bsamp(&model, &tab, 8UL);
+	palloc(&guess.spoly, 16UL);
+	palloc(&guess.init, 16UL);
+	palloc(&guess.xorout, 16UL);
+	guess.flags = P_BE;
+	for(reps = 0UL, start = clock(); (secs = btime(start)) < BSECS; ++reps) {
+		mptr = candmods = reveng(&guess, guess.spoly, 0, BSAMP, samples, &ctx);
+		for(found = 0UL; mptr && plen(mptr->spoly); ++found)
+			mfree(mptr++);
+		free(candmods);
+	}
+	printf("{\"bench\": \"brute\", \"width\": 16, \"samples\": %d, \"candidates\": %lu, \"models\": %lu, \"reps\": %lu, \"cand_per_sec\": %.0f}\n",
+		BSAMP, 1UL << 15, found, reps, (double) (1UL << 15) * (double) reps / secs);
+	for(iter = 0; iter < BSAMP; ++iter)
+		pfree(samples + iter);
+	mfree(&guess);
+
+	/* CRC-32/BZIP2, with the generator given as by -p */
+	bgen(&model, "04c11db7", "ffffffff", "ffffffff");
+	ptinit(&tab, model.spoly);
+	for(iter = 0; iter < BSAMP; ++iter)
+		samples[iter] = bsamp(&model, &tab, 256UL);
+	mcpy(&guess, &model);
+	palloc(&guess.init, 32UL);
+	palloc(&guess.xorout, 32UL);
+	for(reps = 0UL, start = clock(); (secs = btime(start)) < BSECS; ++reps) {
+		mptr = candmods = reveng(&guess, guess.spoly, R_HAVEP, BSAMP, samples, &ctx);
+		for(found = 0UL; mptr && plen(mptr->spoly); ++found)
+			mfree(mptr++);
+		free(candmods);
+	}
+	printf("{\"bench\": \"engini\", \"width\": 32, \"samples\": %d, \"models\": %lu, \"reps\": %lu, \"us_per_solve\": %.3f}\n",
+		BSAMP, found, reps, secs * 1e6 / (double) reps);
+	for(iter = 0; iter < BSAMP; ++iter)
+		pfree(samples + iter);
+	mfree(&guess);
+	mfree(&model);
+	ptfree(&tab);
+}
+
+static void
+bread(void) {
+	/* Times the conversion of a file of BBYTES * 16 bytes, as
+	 * rdpoly() reads it, from a temporary file and from memory.
+	 */
+	const unsigned long count = BBYTES << 4;
+	unsigned char *buffer;
+	unsigned long iter, reps;
+	poly_t poly;
+	FILE *input;
+	clock_t start;
+	double secs;
+
+	if(!(buffer = (unsigned char *) malloc(count)))
+		uerror("cannot allocate memory for benchmark data");
+	for(iter = 0UL; iter < count; ++iter)
+		buffer[iter] = (unsigned char) brand();
+	if(!(input = tmpfile()) || fwrite(buffer, 1, count, input) != count)
+		uerror("cannot write benchmark file");
+	for(reps = 0UL, start = clock(); (secs = btime(start)) < BSECS; ++reps) {
+		rewind(input);
+		poly = filtop(input, count * 8UL, 0, 8);
+		pfree(&poly);
+	}
+	printf("{\"bench\": \"filtop\", \"bytes\": %lu, \"reps\": %lu, \"ns_per_byte\": %.3f}\n",
+		count, reps, secs * 1e9 / ((double) reps * count));
+	fclose(input);
+	for(reps = 0UL, start = clock(); (secs = btime(start)) < BSECS; ++reps) {
+		poly = buftop(buffer, count, 0, 8);
+		pfree(&poly);
+	}
+	printf("{\"bench\": \"buftop\", \"bytes\": %lu, \"reps\": %lu, \"ns_per_byte\": %.3f}\n",
+		count, reps, secs * 1e9 / ((double) reps * count));
+	free(buffer);
+}
+
+static void
+bbuild(void) {
+	/* Reports the build configuration, so that runs of different
+	 * builds can be told apart, and with MMAP the peak RSS.
+	 */
+	long rss = -1L;
+#ifdef MMAP
+	struct rusage usage;
+
+	if(!getrusage(RUSAGE_SELF, &usage))
+		rss = (long) usage.ru_maxrss;
+#endif /* MMAP */
+	printf("{\"bench\": \"build\", \"version\": \"%s\", \"bmp_bit\": %d, \"bmpmacro\": %d, \"presets\": %d, \"peak_rss_kb\": %ld}\n",
+		VERSION, (int) BMP_BIT, BMACRO, mcount() != 0, rss);
+}
@@ -26,6 +26,7 @@
 #  include <stdio.h>
 #  include <stdlib.h>
 #else
+#  include <stddef.h>
 #  define FILE void
 #endif
 #include "reveng.h"
@@ -22,7 +22,29 @@
  * along with CRC RevEng.  If not, see <https://www.gnu.org/licenses/>.
  */
 
-/* 2020-08-14: changed project URL
+/* 2026-10-14: -n K/N parsed strictly
+ * 2026-10-14: -c -f -j prints the files before one it cannot read
+ * 2026-10-14: -R and -U hashes cover -M and -1
+ * 2026-10-14: preset matches only reported by the first shard of -n
+ * 2026-10-14: -K knows arguments by length and two hashes
+ * 2026-10-14: CRCs and echoes formatted into an output buffer
+ * 2026-10-14: added -O, trial division on an OpenCL device
+ * 2026-10-14: added -Z, generators listed from factors of the GCD
+ * 2026-10-14: added -U, session carried to searches with more arguments
+ * 2026-10-14: -c -f with -j splits one long file between threads
+ * 2026-10-14: -c -f with -j reads and checks files on several threads
+ * 2026-10-14: -c -f runs reflected CRCs LSB first on the octets read
+ * 2026-10-14: added -K, cache of preset verdicts for -s
+ * 2026-10-14: added -E, -T; progress reports give rate and ETA
+ * 2026-10-14: -c and -C use the baked engines of preset generators
+ * 2026-10-14: preset scan uses the mgroup() index
+ * 2026-10-14: added -C, batch calculation of records
+ * 2026-10-14: -c -f streams files through the CRC engine
+ * 2026-10-14: rdpoly() maps regular files, reads others with fread()
+ * 2026-10-14: added -n, -R
+ * 2026-10-14: added -j
+ * 2026-10-14: -c and -v calculate with table-driven engine
+ * 2020-08-14: changed project URL
  * 2019-12-07: -impqwx in any order; warn if LSB of poly unset
  * 2019-11-01: initialize optind, opterr
  * 2019-11-01: grow poly geometrically in rdpoly()
@@ -56,9 +78,24 @@
  * 2010-12-07: started cli
  */
 
+#ifdef MMAP
+#  define _POSIX_C_SOURCE 200112L
+#endif /* MMAP */
+
+#include <limits.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include "getopt.h"
+#ifdef MMAP
+#  include <fcntl.h>
+#  include <sys/types.h>
+#  include <sys/stat.h>
+#  include <sys/mman.h>
+#endif /* MMAP */
+#ifdef THREADS
+#  include <pthread.h>
+#endif /* THREADS */
 #ifdef _WIN32
 #  include <io.h>
 #  include <fcntl.h>
@@ -77,13 +114,115 @@
 #define BUFFER 32768
 #define GSCALE     4
 #define RECSMP     4
+#define CKLINE   256
+#define OBUFFER 65536
+#define SPLMIN 262144L
+#define PCHEAD  "reveng-presets 2\n"
+#define PCVERS  "reveng-presets "
+#define PCKEY     44
+#define PCREC     47
 
 static FILE *oread(const char *);
-static poly_t rdpoly(const char *, int, int);
+static poly_t rdpoly(const char *, int, int, pstrm_t *);
+static void calrec(const char *, int, const model_t *, const ptab_t *, int, int);
+#ifdef THREADS
+static int calpar(int, char **, const model_t *, const ptab_t *, int, int, int);
+static void *calwrk(void *);
+static void calfls(void);
+static int calspl(const char *, int);
+static void *calpce(void *);
+#endif /* THREADS */
+static unsigned long phash(unsigned long, const poly_t);
+static unsigned long pjhash(unsigned long, const poly_t);
+static int ckload(poly_t *, int *);
+static void cksave(const poly_t *);
+static char *ckline(FILE *);
+static poly_t ckpoly(const char *);
+static void ckput(FILE *, const char *, const poly_t);
+static int ssload(poly_t *, int);
+static void sssave(const poly_t *, int, int);
+static void ssgen(int, const poly_t);
+static void ssfree(void);
+static void cprog(const poly_t, int, unsigned long, void *);
+static void cstat(const rctx_t *, const char *, const poly_t);
+static void pcload(void);
+static int pcfind(const char *);
+static void pcadd(const char *, int);
+static int pccmp(const void *, const void *);
+static void pcsave(void);
+static void pcdrop(void);
+static void oline(const poly_t, int, int);
+static void oflush(void);
 static void usage(void);
 
 static const char *myname = "reveng"; /* name of our program */
 
+/* checkpoint state for -R */
+static const char *ckname = NULL;	/* checkpoint file, or NULL */
+static unsigned long ckhash = 0UL;	/* hash of the search arguments */
+static int ckpass = 0;			/* search pass in progress */
+static char **ckmods = NULL;		/* models found so far, as strings */
+static int ckmodc = -1;			/* number of models, -1 if not logging */
+
+#ifdef THREADS
+/* files, or pieces of one file, shared between the threads of calpar() */
+static struct {
+	char **names;		/* file arguments */
+	poly_t *regs;		/* register of each piece from zero */
+	long piece;		/* octets in each piece */
+	long octets;		/* octets in the file */
+	char **lines;		/* output of each file, or NULL until done */
+	const char **errors;	/* error reading each file, or NULL */
+	int count;		/* number of files, or pieces */
+	int next;		/* next file or piece to claim */
+	int shown;		/* files printed so far */
+	const model_t *model;	/* CRC parameters, as calrec() */
+	const ptab_t *tab;	/* engine shared by all threads */
+	int ibperhx, obperhx;	/* bits per input and output character */
+	pthread_mutex_t lock;	/* guards next, lines, errors and shown */
+	pthread_cond_t ready;	/* signalled as each file is done */
+} cpar;
+#endif /* THREADS */
+
+/* output buffer for CRCs and echoes.  Each line is formatted in place
+ * by ptostrto() and written with one fwrite(), or with obatch set,
+ * OBUFFER characters at a time.
+ */
+static char *obuf = NULL;		/* lines not yet written */
+static size_t olen = 0;			/* characters in obuf */
+static size_t osize = 0;		/* size of obuf */
+static int obatch = 0;			/* nonzero to write only when full */
+
+/* statistics stream for -T */
+static FILE *stfile = NULL;		/* JSON lines output, or NULL */
+
+/* preset verdict cache for -K.  Each record is a line of PCREC
+ * characters: in hex, the low 32 bits of the length of an argument,
+ * its FNV-1a and one-at-a-time hashes, and the same two hashes of a
+ * preset model; then 0 if the model's residue of the argument was
+ * zero or 1 if not.  The records follow PCHEAD in order, so the file
+ * can be searched where it lies.
+ */
+static const char *pcname = NULL;	/* cache file, or NULL */
+static char *pcold = NULL;		/* records read from the file */
+static unsigned long pcoldn = 0UL;	/* number of records read */
+static size_t pcsize = 0;		/* bytes mapped or read */
+static int pcmapd = 0;			/* nonzero if the file is mapped */
+static char *pcnew = NULL;		/* records added by this run */
+static unsigned long pcnewn = 0UL;	/* number of records added */
+static unsigned long pcnewa = 0UL;	/* number of records allocated */
+
+/* search session for -U.  For each pass, the GCD of the differences
+ * between the arguments and the generators solved are kept, so that
+ * a later search with more arguments takes up where this one ended.
+ */
+static const char *ssname = NULL;	/* session file, or NULL */
+static unsigned long sshash = 0UL;	/* hash of the search parameters */
+static poly_t ssgcd[2] = {PZERO, PZERO};	/* GCD of each pass */
+static poly_t *ssgens[2] = {NULL, NULL};	/* generators solved */
+static int ssgenc[2] = {0, 0};		/* number of generators */
+static int sssolv[2] = {0, 0};		/* nonzero if the pass was completed */
+
 int
 main(int argc, char *argv[]) {
 	/* Command-line interface for CRC RevEng.
@@ -97,10 +236,18 @@ main(int argc, char *argv[]) {
 	int rflags = 0, uflags = 0; /* search and UI flags */
 
 	unsigned long width = 0UL;
-	int c, mode = 0, args, psets, pass;
-	poly_t apoly, crc, qpoly = PZERO, *apolys, *pptr = NULL, *qptr = NULL;
-	model_t pset = model, *candmods, *mptr;
-	char *string = "", **nargv = &string;
+	int c, mode = 0, args, psets, pass, ckres = 0, ssolds = 0;
+	unsigned long shard, shards;
+	poly_t apoly, crc, qpoly = PZERO, spoly = PZERO, *apolys, *pptr = NULL, *qptr = NULL;
+	ptab_t tab = PTZERO;
+	pstrm_t strm = PSZERO;
+	rctx_t ctx = RZERO;
+	model_t *candmods, *mptr;
+	const mprep_t *pgrp;
+	char *string = "", **nargv = &string, *end;
+	char pckey[PCREC * 2];
+	unsigned long *akeys = NULL, mkey = 0UL, mkey2 = 0UL;
+	int fail, hit = 0;
 
 	myname = argv[0];
 
@@ -118,7 +265,7 @@ main(int argc, char *argv[]) {
 	SETBMP();
 
 	do {
-		c=getopt(argc, argv, "?1A:BDFGLMP:SVXa:bcdefhi:k:lm:p:q:rstuvw:x:yz");
+		c=getopt(argc, argv, "?1A:BCDE:FGK:LMOP:R:ST:U:VXZa:bcdefhi:j:k:lm:n:p:q:rstuvw:x:yz");
 		switch(c) {
 			case '1': /* 1  skip equivalent forms */
 				model.flags |= P_EXHST;
@@ -144,6 +291,7 @@ main(int argc, char *argv[]) {
 				model.flags |= P_RTJUST;
 				break;
 			case 'c': /* c  calculate CRC */
+			case 'C': /* C  calculate CRCs of records */
 			case 'D': /* D  list primary model names */
 			case 'd': /* d  dump CRC model */
 			case 'e': /* e  echo arguments */
@@ -155,6 +303,12 @@ main(int argc, char *argv[]) {
 				}
 				mode = c;
 				break;
+			case 'E': /* E: trial factors between progress reports */
+				if(!(ctx.every = strtoul(optarg, NULL, 0))) {
+					fprintf(stderr,"%s: argument to -E must be a positive number\n", myname);
+					exit(EXIT_FAILURE);
+				}
+				break;
 			case 'F': /* F  skip preset model check pass */
 #ifndef ALWPCK
 				uflags |= C_NOPCK;
@@ -177,6 +331,12 @@ main(int argc, char *argv[]) {
 				pptr = &model.init;
 				rflags |= R_HAVEI;
 				goto ipqx;
+			case 'j': /* j: number of search or file threads */
+#ifdef THREADS
+				if((ctx.threads = atoi(optarg)) < 1)
+					ctx.threads = 1;
+#endif
+				break;
 			case 'k': /* k: polynomial in Koopman notation */
 			case 'P': /* P: reversed polynomial */
 				pfree(&model.spoly);
@@ -214,6 +374,21 @@ main(int argc, char *argv[]) {
 			case 'M': /* M  non-augmenting algorithm */
 				model.flags &= ~P_MULXN;
 				break;
+			case 'n': /* n: search shard K of N */
+				/* digits only, so no sign, space or trailing junk */
+				shard = shards = 0UL;
+				if(strspn(optarg, "0123456789")) {
+					shard = strtoul(optarg, &end, 10);
+					if(*end == '/' && strspn(end + 1, "0123456789"))
+						shards = strtoul(end + 1, &end, 10);
+				}
+				if(!shards || *end || shard < 1UL || shard > shards || shards > 0x7FFFFFFFUL) {
+					fprintf(stderr,"%s: argument to -n must be K/N, with 1 <= K <= N\n", myname);
+					exit(EXIT_FAILURE);
+				}
+				ctx.shard = shard - 1UL;
+				ctx.shards = shards;
+				break;
 			case 'p': /* p: polynomial */
 				pptr = &model.spoly;
 				rflags &= ~R_HAVEQ;
@@ -236,9 +411,34 @@ ipqx:
 				rflags &= ~R_HAVEP;
 				rflags |= R_HAVEQ;
 				goto ipqx;
+			case 'K': /* K: preset verdict cache */
+				pcname = optarg;
+				break;
+			case 'R': /* R: checkpoint file */
+				ckname = optarg;
+				break;
 			case 'S': /* s  space between output characters */
 				model.flags |= P_SPACE;
 				break;
+			case 'O': /* O: offload search to OpenCL device */
+				ctx.offload = 1;
+				break;
+			case 'U': /* U: search session file */
+				ssname = optarg;
+				break;
+			case 'Z': /* Z: factorise the GCD */
+				ctx.sieve = 1;
+				break;
+			case 'T': /* T: search statistics file */
+				if(stfile && stfile != stdout)
+					fclose(stfile);
+				if(!strcmp(optarg, "-"))
+					stfile = stdout;
+				else if(!(stfile = fopen(optarg, "a"))) {
+					fprintf(stderr,"%s: cannot open %s for writing\n", myname, optarg);
+					exit(EXIT_FAILURE);
+				}
+				break;
 			case 'V': /* v  reverse algorithm */
 				/* Distinct from the -v switch as the
 				 * user will have to reverse his or her
@@ -313,6 +513,7 @@ ipqx:
 
 			/* fall through: */
 		case 'c': /* c  calculate CRC */
+		case 'C': /* C  calculate CRCs of records */
 
 			/* validate inputs */
 			/* if(plen(model.spoly) == 0) {
@@ -327,26 +528,52 @@ ipqx:
 			if(model.flags & P_REFOUT)
 				prev(&model.xorout);
 
+			/* prepare the engine once for all arguments */
+			mtinit(&tab, model.spoly);
+			if(mode == 'c' && uflags & C_INFILE && model.flags & P_REFIN)
+				ptrinit(&tab);
+
+			if(mode == 'C') {
+				/* read records from the files, or standard input */
+				obatch = 1;
+				atexit(oflush);
+				if(optind == argc)
+					calrec("-", uflags & C_INFILE, &model, &tab, ibperhx, obperhx);
+				for(; optind < argc; ++optind)
+					calrec(argv[optind], uflags & C_INFILE, &model, &tab, ibperhx, obperhx);
+			}
+#ifdef THREADS
+			if(mode == 'c' && uflags & C_INFILE && ctx.threads > 1
+				&& calpar(argc - optind, argv + optind, &model, &tab, ibperhx, obperhx, ctx.threads))
+				optind = argc;
+#endif /* THREADS */
 			for(; optind < argc; ++optind) {
-				if(uflags & C_INFILE)
-					apoly = rdpoly(argv[optind], model.flags, ibperhx);
-				else
-					apoly = strtop(argv[optind], model.flags, ibperhx);
+				if(uflags & C_INFILE && mode == 'c') {
+					/* stream the file through the engine */
+					ptbegin(&strm, &tab, model.init, model.flags);
+					rdpoly(argv[optind], model.flags, ibperhx, &strm);
+					crc = ptfinal(&strm, model.xorout);
+				} else {
+					if(uflags & C_INFILE)
+						apoly = rdpoly(argv[optind], model.flags, ibperhx, NULL);
+					else
+						apoly = strtop(argv[optind], model.flags, ibperhx);
 
-				if(mode == 'v')
-					prev(&apoly);
+					if(mode == 'v')
+						prev(&apoly);
 
-				crc = pcrc(apoly, model.spoly, model.init, model.xorout, model.flags, 0);
+					crc = ptcrc(apoly, &tab, model.init, model.xorout, model.flags);
+					pfree(&apoly);
+				}
 
 				if(mode == 'v')
 					prev(&crc);
 
-				string = ptostr(crc, model.flags, obperhx);
-				puts(string);
-				free(string);
+				oline(crc, model.flags, obperhx);
 				pfree(&crc);
-				pfree(&apoly);
 			}
+			oflush();
+			ptfree(&tab);
 			break;
 		case 'D': /* D  dump all models */
 			args = mcount();
@@ -371,14 +598,12 @@ ipqx:
 		case 'e': /* e  echo arguments */
 			for(; optind < argc; ++optind) {
 				if(uflags & C_INFILE)
-					apoly = rdpoly(argv[optind], model.flags, ibperhx);
+					apoly = rdpoly(argv[optind], model.flags, ibperhx, NULL);
 				else
 					apoly = strtop(argv[optind], model.flags, ibperhx);
 
 				psum(&apoly, model.init, 0UL);
-				string = ptostr(apoly, model.flags, obperhx);
-				puts(string);
-				free(string);
+				oline(apoly, model.flags, obperhx);
 				pfree(&apoly);
 			}
 			break;
@@ -421,7 +646,7 @@ ipqx:
 
 			for(pptr = apolys; optind < argc; ++optind) {
 				if(uflags & C_INFILE)
-					*pptr++ = rdpoly(argv[optind], model.flags, ibperhx);
+					*pptr++ = rdpoly(argv[optind], model.flags, ibperhx, NULL);
 				else
 					*pptr++ = strtop(argv[optind], model.flags, ibperhx);
 			}
@@ -435,40 +660,68 @@ ipqx:
 
 			/* scan against preset models */
 			if(~uflags & C_NOPCK) {
+				if(pcname) {
+					pcload();
+					if(!(akeys = malloc(args * 2 * sizeof(unsigned long))))
+						uerror("cannot allocate memory for argument hashes");
+				}
 				pass = 0;
 				do {
-					psets = mcount();
-					while(psets) {
-						mbynum(&pset, --psets);
-						/* skip if different width, or refin or refout don't match */
-						if(plen(pset.spoly) != width || (model.flags ^ pset.flags) & (P_REFIN | P_REFOUT))
-							continue;
+					if(akeys)
+						for(qptr = apolys; qptr < pptr; ++qptr) {
+							akeys[(qptr - apolys) << 1] = phash(2166136261UL, *qptr);
+							akeys[(qptr - apolys) << 1 | 1] = pjhash(0UL, *qptr);
+						}
+					psets = mgroup(&pgrp, width, model.flags);
+					for(; psets; --psets, ++pgrp) {
 						/* skip if the preset doesn't match specified parameters */
-						if(rflags & R_HAVEP && pcmp(&model.spoly, &pset.spoly))
+						if(rflags & R_HAVEP && pcmp(&model.spoly, &pgrp->model.spoly))
 							continue;
-						if(rflags & R_HAVEI && psncmp(&model.init, &pset.init))
+						if(rflags & R_HAVEI && psncmp(&model.init, &pgrp->model.init))
 							continue;
-						if(rflags & R_HAVEX && psncmp(&model.xorout, &pset.xorout))
+						if(rflags & R_HAVEX && psncmp(&model.xorout, &pgrp->model.xorout))
 							continue;
-						apoly = pclone(pset.xorout);
-						if(pset.flags & P_REFOUT)
-							prev(&apoly);
+						if(akeys) {
+							mkey = phash(2166136261UL, pgrp->model.spoly);
+							mkey = phash(mkey, pgrp->model.init);
+							mkey = phash(mkey, pgrp->model.xorout);
+							mkey = (mkey ^ (pgrp->model.flags & (P_REFIN | P_REFOUT))) * 16777619UL & 0xffffffffUL;
+							mkey2 = pjhash(0UL, pgrp->model.spoly);
+							mkey2 = pjhash(mkey2, pgrp->model.init);
+							mkey2 = pjhash(mkey2, pgrp->model.xorout);
+							mkey2 = (mkey2 + (pgrp->model.flags & (P_REFIN | P_REFOUT))) * 1025UL & 0xffffffffUL;
+						}
+						/* most presets fail on the first argument.
+						 * A cached failure is taken as read; a
+						 * cached success is checked again.  An
+						 * argument is known by its length and
+						 * two independent 32-bit hashes.
+						 */
 						for(qptr = apolys; qptr < pptr; ++qptr) {
-							crc = pcrc(*qptr, pset.spoly, pset.init, apoly, 0, 0);
-							if(ptst(crc)) {
-								pfree(&crc);
+							if(akeys) {
+								sprintf(pckey, "%08lx %08lx %08lx %08lx %08lx", plen(*qptr) & 0xffffffffUL,
+									akeys[(qptr - apolys) << 1], akeys[(qptr - apolys) << 1 | 1], mkey, mkey2);
+								if((hit = pcfind(pckey)) == '1')
+									break;
+							}
+							crc = ptcrc(*qptr, &pgrp->tab, pgrp->model.init, pgrp->xorout, 0);
+							fail = ptst(crc);
+							pfree(&crc);
+							if(akeys && !hit)
+								pcadd(pckey, fail);
+							if(fail)
 								break;
-							} else
-								pfree(&crc);
 						}
-						pfree(&apoly);
 						if(qptr == pptr) {
-							/* the selected model solved all arguments */
-							ufound(&pset);
+							/* the selected model solved all arguments.
+							 * Every shard stops here, but only the
+							 * first reports it.
+							 */
+							if(!ctx.shard)
+								ufound(&pgrp->model);
 							uflags |= C_RESULT;
 						}
 					}
-					mfree(&pset);
 
 					/* toggle refIn/refOut and reflect arguments */
 					if(~rflags & R_HAVERI) {
@@ -477,6 +730,10 @@ ipqx:
 							prevch(qptr, ibperhx);
 					}
 				} while(~rflags & R_HAVERI && ++pass < 2);
+				if(akeys) {
+					pcsave();
+					free(akeys);
+				}
 			}
 			if(uflags & C_RESULT) {
 				for(qptr = apolys; qptr < pptr; ++qptr)
@@ -490,8 +747,78 @@ ipqx:
 			if(!(model.flags & P_REFIN) != !(model.flags & P_REFOUT))
 				uerror("cannot search for crossed-endian models");
 			pass = 0;
-			do {
-				mptr = candmods = reveng(&model, qpoly, rflags, args, apolys);
+			if(ckname && ssname)
+				uerror("cannot combine -R with -U");
+			if(ckname || ssname) {
+				/* identify the search by its parameters and by
+				 * every flag that changes the models found
+				 */
+				ckhash = phash(2166136261UL, model.spoly);
+				ckhash = phash(ckhash, model.init);
+				ckhash = phash(ckhash, model.xorout);
+				ckhash = phash(ckhash, qpoly);
+				ckhash = (ckhash ^ (model.flags & (P_REFIN | P_REFOUT | P_MULXN | P_RTJUST | P_EXHST))) * 16777619UL & 0xffffffffUL;
+				ckhash = (ckhash ^ (rflags & (R_HAVEP | R_HAVEI | R_HAVERI | R_HAVERO | R_HAVEX | R_HAVEQ))) * 16777619UL & 0xffffffffUL;
+				ckhash = (ckhash ^ ctx.shard) * 16777619UL & 0xffffffffUL;
+				ckhash = (ckhash ^ ctx.shards) * 16777619UL & 0xffffffffUL;
+				sshash = ckhash;
+				/* and by its arguments */
+				for(qptr = apolys; qptr < pptr; ++qptr)
+					ckhash = phash(ckhash, *qptr);
+			}
+			/* take up the last session, bringing its arguments first */
+			if(ssname)
+				ssolds = ssload(apolys, args);
+			if(ckname) {
+				ckmodc = 0;
+				/* resume from the point last saved */
+				if((ckres = ckload(&spoly, &pass)) && ckmodc)
+					uflags |= C_RESULT;
+				if(ckres == 1) {
+					if(pass && ~rflags & R_HAVERI) {
+						model.flags ^= P_REFIN | P_REFOUT;
+						for(qptr = apolys; qptr < pptr; ++qptr)
+							prevch(qptr, ibperhx);
+					}
+					/* swap in the resume point */
+					apoly = model.spoly;
+					model.spoly = spoly;
+					spoly = apoly;
+				}
+			}
+			ctx.prog = cprog;
+			ctx.data = &ctx;
+			if(ckres != 2) do {
+				ckpass = pass;
+				if(ssname) {
+					/* which arguments are new, and what the
+					 * old ones left to search
+					 */
+					ctx.olds = ssolds;
+					ctx.gcd = ssgcd + pass;
+					ctx.gpolys = ssgens[pass];
+					ctx.gens = ssolds && sssolv[pass] ? ssgenc[pass] : -1;
+				}
+				mptr = candmods = reveng(&model, qpoly, rflags, args, apolys, &ctx);
+				cstat(&ctx, "end", model.spoly);
+				if(ssname) {
+					/* keep the generators solved for next time */
+					while(ssgenc[pass])
+						pfree(ssgens[pass] + --ssgenc[pass]);
+					for(; mptr && plen(mptr->spoly); ++mptr)
+						ssgen(pass, mptr->spoly);
+					mptr = candmods;
+					/* without a GCD there was nothing to search */
+					sssolv[pass] = candmods && ctx.status == R_OK && plen(ssgcd[pass]);
+				}
+				if(ckres == 1) {
+					/* later passes start where asked */
+					apoly = model.spoly;
+					model.spoly = spoly;
+					spoly = apoly;
+					pfree(&spoly);
+					ckres = 0;
+				}
 				if(mptr && plen(mptr->spoly))
 					uflags |= C_RESULT;
 				while(mptr && plen(mptr->spoly)) {
@@ -509,6 +836,17 @@ ipqx:
 						prevch(qptr, ibperhx);
 				}
 			} while(~rflags & R_HAVERI && ++pass < 2);
+			if(ckname) {
+				/* record the search as complete */
+				cksave(NULL);
+				while(ckmodc)
+					free(ckmods[--ckmodc]);
+				free(ckmods);
+			}
+			if(ssname) {
+				sssave(apolys, args, ~rflags & R_HAVERI ? 2 : 1);
+				ssfree();
+			}
 			for(qptr = apolys; qptr < pptr; ++qptr)
 				pfree(qptr);
 			free(apolys);
@@ -532,7 +870,13 @@ ufound(const model_t *model) {
 	/* generated models will be canonical */
 	string = mtostr(model);
 	puts(string);
-	free(string);
+	/* log the model for the checkpoint file */
+	if(ckmodc >= 0) {
+		if(!(ckmods = realloc(ckmods, (ckmodc + 1) * sizeof(char *))))
+			uerror("cannot reallocate checkpoint model list");
+		ckmods[ckmodc++] = string;
+	} else
+		free(string);
 }
 
 void
@@ -547,6 +891,9 @@ uprog(const poly_t gpoly, int flags, unsigned long seq) {
 	/* Callback function to report search progress */
 	char *string;
 
+	/* Save the search state at each report */
+	if(ckname)
+		cksave(&gpoly);
 	/* Suppress first report in CLI */
 	if(!seq)
 		return;
@@ -559,45 +906,157 @@ uprog(const poly_t gpoly, int flags, unsigned long seq) {
 	free(string);
 }
 
+static void
+cprog(const poly_t gpoly, int flags, unsigned long seq, void *data) {
+	/* Search progress callback.  Reports as uprog() does, then the
+	 * rate of the search and the time left, and writes the
+	 * statistics to the -T file.
+	 */
+	const rctx_t *ctx = (const rctx_t *) data;
+	const rstat_t *stat = &ctx->stat;
+	double secs;
+	unsigned long left;
+
+	uprog(gpoly, flags, seq);
+	if(seq) {
+		secs = stat->wall[R_SSRCH] > 0.0 ? stat->wall[R_SSRCH] : stat->cpu[R_SSRCH];
+		fprintf(stderr, "%s: tested %lu factors", myname, stat->factors);
+		if(secs > 0.0)
+			fprintf(stderr, ", %.3g/s", stat->factors / secs);
+		fprintf(stderr, ", %.2f%% of range", stat->done * 100.0);
+		if(stat->done > 0.0 && secs > 0.0) {
+			left = (unsigned long) (secs * (1.0 - stat->done) / stat->done + 0.5);
+			fprintf(stderr, ", ETA %lu:%02lu:%02lu",
+				left / 3600UL, left / 60UL % 60UL, left % 60UL);
+		}
+		fputc('\n', stderr);
+	}
+	cstat(ctx, "progress", gpoly);
+}
+
+static void
+cstat(const rctx_t *ctx, const char *event, const poly_t gpoly) {
+	/* Writes the statistics of ctx to the -T file, if any, as one
+	 * JSON object on a line.  gpoly is the next trial factor.
+	 */
+	static const char *const stages[R_STAGES] = {"gcd", "search", "solve"};
+	const rstat_t *stat = &ctx->stat;
+	char *string;
+	int i;
+
+	if(!stfile)
+		return;
+	string = ptostr(gpoly, P_RTJUST, 4);
+	fprintf(stfile, "{\"event\": \"%s\", \"pass\": %d, \"poly\": \"0x%s\", "
+		"\"factors\": %lu, \"divs\": %lu, \"cands\": %lu, \"solves\": %lu, "
+		"\"rejects\": %lu, \"models\": %lu, \"done\": %.6f",
+		event, ckpass, string, stat->factors, stat->divs, stat->cands,
+		stat->solves, stat->rejects, stat->models, stat->done);
+	free(string);
+	for(i = 0; i < R_STAGES; ++i)
+		fprintf(stfile, ", \"cpu_%s\": %.3f, \"wall_%s\": %.0f",
+			stages[i], stat->cpu[i], stages[i], stat->wall[i]);
+	fputs("}\n", stfile);
+	fflush(stfile);
+}
+
 static poly_t
-rdpoly(const char *name, int flags, int bperhx) {
-	/* read poly from file in chunks and report errors */
+rdpoly(const char *name, int flags, int bperhx, pstrm_t *strm) {
+	/* read poly from file and report errors.  If MMAP is defined,
+	 * regular files are mapped and converted in one pass; other
+	 * files are read in chunks of whole characters.  If strm is
+	 * not NULL, the chunks are passed to ptupdate() instead and
+	 * an empty poly is returned.
+	 */
 
 	poly_t apoly = PZERO, chunk = PZERO;
 	unsigned long total = 0UL, a, b;
+	unsigned char *buffer;
+	size_t size, got;
+	int step, done = 0;
 	FILE *input;
+#ifdef MMAP
+	struct stat st;
+	unsigned char *map;
+	size_t mlen;
+#endif /* MMAP */
+
+	/* read a whole number of characters per chunk */
+	step = bperhx > 0 ? (bperhx + CHAR_BIT - 1) / CHAR_BIT : 1;
+	size = BUFFER / CHAR_BIT;
+	size -= size % step;
 
 	input = oread(name);
-	while(!feof(input) && !ferror(input)) {
-		chunk = filtop(input, BUFFER, flags, bperhx);
-		if((total += plen(chunk)) < plen(chunk)) {
-			fprintf(stderr, "%s: %s: file too long", myname, name);
+#ifdef MMAP
+	/* streams read through a small buffer, so that the mapping
+	 * does not add the whole file to the resident set
+	 */
+	if(!strm && input != stdin && !fstat(fileno(input), &st) && S_ISREG(st.st_mode) && st.st_size > 0) {
+		if(st.st_size > (off_t) (~0UL / CHAR_BIT)) {
+			fprintf(stderr, "%s: %s: file too long\n", myname, name);
 			exit(EXIT_FAILURE);
 		}
-		if(total > plen(apoly)) {
-			/* Grow apoly geometrically */
-			/* Find a = power of two not greater than total */
-			/* 0 < b <= total */
-			b = total & ~(total >> 1);
-			do {
-				a = b;
-			} while(b &= (b - 1UL));
-			/* 0 < a <= total */
-			/* Add quanta to a until it equals or exceeds total */
-			if(!(b = a >> GSCALE))
-				a = total;
-			else while(a && a < total)
-				a += b;
-			/* a == 0 on overflow */
-			if(!a)
-				a = ~0UL;
-			/* Allocate a bits to apoly */
-			praloc(&apoly, a);
+		mlen = (size_t) st.st_size;
+		map = (unsigned char *) mmap(NULL, mlen, PROT_READ, MAP_PRIVATE, fileno(input), (off_t) 0);
+		if(map != (unsigned char *) MAP_FAILED) {
+			posix_madvise(map, mlen, POSIX_MADV_SEQUENTIAL);
+			apoly = buftop(map, (unsigned long) mlen, flags, bperhx);
+			munmap(map, mlen);
+			done = 1;
+		}
+	}
+	/* a stream is read once, front to back */
+	if(strm && input != stdin)
+		posix_fadvise(fileno(input), (off_t) 0, (off_t) 0, POSIX_FADV_SEQUENTIAL);
+#endif /* MMAP */
+	if(!done) {
+		if(!(buffer = malloc(size)))
+			uerror("cannot allocate file buffer");
+		while((got = fread(buffer, 1, size, input)) > 0) {
+			if(strm && bperhx == 8) {
+				/* octets go to the engine as they are */
+				ptrupdate(strm, buffer, (unsigned long) got);
+				if(got < size)
+					break;
+				continue;
+			}
+			chunk = buftop(buffer, (unsigned long) got, flags, bperhx);
+			if(strm)
+				ptupdate(strm, chunk);
+			else {
+				if((total += plen(chunk)) < plen(chunk)) {
+					fprintf(stderr, "%s: %s: file too long", myname, name);
+					exit(EXIT_FAILURE);
+				}
+				if(total > plen(apoly)) {
+					/* Grow apoly geometrically */
+					/* Find a = power of two not greater than total */
+					/* 0 < b <= total */
+					b = total & ~(total >> 1);
+					do {
+						a = b;
+					} while(b &= (b - 1UL));
+					/* 0 < a <= total */
+					/* Add quanta to a until it equals or exceeds total */
+					if(!(b = a >> GSCALE))
+						a = total;
+					else while(a && a < total)
+						a += b;
+					/* a == 0 on overflow */
+					if(!a)
+						a = ~0UL;
+					/* Allocate a bits to apoly */
+					praloc(&apoly, a);
+				}
+				psum(&apoly, chunk, total - plen(chunk));
+			}
+			pfree(&chunk);
+			if(got < size)
+				break;
 		}
-		psum(&apoly, chunk, total - plen(chunk));
-		pfree(&chunk);
+		free(buffer);
+		praloc(&apoly, total);
 	}
-	praloc(&apoly, total);
 
 	if(ferror(input)) {
 		fprintf(stderr,"%s: %s: error condition on file\n", myname, name);
@@ -614,6 +1073,69 @@ rdpoly(const char *name, int flags, int bperhx) {
 	return(apoly);
 }
 
+static void
+calrec(const char *name, int binary, const model_t *model, const ptab_t *tab, int ibperhx, int obperhx) {
+	/* Calculate and print the CRC of each record in file name, with
+	 * the engine in tab and the parameters of model.  If binary is
+	 * nonzero, each record is a four-octet big-endian count of
+	 * characters followed by the characters; otherwise each line is
+	 * a record, read as if it were a STRING argument.
+	 */
+
+	poly_t apoly, crc;
+	unsigned char head[4], *buffer = NULL;
+	size_t size = 0, len, count;
+	int c;
+	FILE *input;
+
+	input = oread(name);
+	for(;;) {
+		if(binary) {
+			if(!(len = fread(head, 1, 4, input)))
+				break;
+			count = len < 4 ? 0 : (size_t) head[0] << 24 | (size_t) head[1] << 16
+				| (size_t) head[2] << 8 | (size_t) head[3];
+			if(count >= size
+				&& !(buffer = realloc(buffer, size = count + 1)))
+				uerror("cannot allocate memory for record");
+			if(len < 4 || fread(buffer, 1, count, input) < count) {
+				fprintf(stderr,"%s: %s: truncated record\n", myname, name);
+				exit(EXIT_FAILURE);
+			}
+			apoly = buftop(buffer, (unsigned long) count, model->flags, ibperhx);
+		} else {
+			/* read a line into buffer, without its newline */
+			for(len = 0; (c = getc(input)) != EOF && c != '\n'; buffer[len++] = (unsigned char) c)
+				if(len + 1 >= size
+					&& !(buffer = realloc(buffer, size += CKLINE)))
+					uerror("cannot allocate memory for record");
+			if(c == EOF && !len)
+				break;
+			if(len + 1 >= size
+				&& !(buffer = realloc(buffer, size += CKLINE)))
+				uerror("cannot allocate memory for record");
+			buffer[len] = '\0';
+			apoly = strtop((const char *) buffer, model->flags, ibperhx);
+		}
+		crc = ptcrc(apoly, tab, model->init, model->xorout, model->flags);
+		oline(crc, model->flags, obperhx);
+		pfree(&crc);
+		pfree(&apoly);
+	}
+	free(buffer);
+
+	if(ferror(input)) {
+		fprintf(stderr,"%s: %s: error condition on file\n", myname, name);
+		exit(EXIT_FAILURE);
+	}
+	if(input == stdin)
+		clearerr(input);
+	else if(fclose(input)) {
+		fprintf(stderr,"%s: %s: error closing file\n", myname, name);
+		exit(EXIT_FAILURE);
+	}
+}
+
 static FILE *
 oread(const char *name) {
 	/* open file for reading and report errors */
@@ -629,6 +1151,842 @@ oread(const char *name) {
 	return(handle);
 }
 
+#ifdef THREADS
+static int
+calpar(int count, char **names, const model_t *model, const ptab_t *tab, int ibperhx, int obperhx, int threads) {
+	/* Calculate and print the CRCs of count files, as the -c -f
+	 * loop in main() would, on up to threads further threads.
+	 * Files are claimed in argument order by whichever thread is
+	 * free and the lines are printed in argument order as they
+	 * become ready.  If a file cannot be read, the lines of the
+	 * files before it are printed and then the error is reported.
+	 * A single file is split by calspl() instead.
+	 * Returns zero, having done nothing, if there are fewer than
+	 * two files or one is standard input.
+	 */
+	pthread_t *tids;
+	char *line;
+	int i, started = 0;
+
+	if(count == 1) {
+		cpar.model = model;
+		cpar.tab = tab;
+		cpar.ibperhx = ibperhx;
+		cpar.obperhx = obperhx;
+		return(calspl(*names, threads));
+	}
+	if(count < 2)
+		return(0);
+	for(i = 0; i < count; ++i)
+		if(*names[i] == '-' && names[i][1] == '\0')
+			return(0);
+	if(threads > count)
+		threads = count;
+	if(!(tids = malloc(threads * sizeof(pthread_t)))
+		|| !(cpar.lines = calloc(count, sizeof(char *)))
+		|| !(cpar.errors = calloc(count, sizeof(const char *))))
+		uerror("cannot allocate memory for file threads");
+	cpar.names = names;
+	cpar.count = count;
+	cpar.next = cpar.shown = 0;
+	cpar.model = model;
+	cpar.tab = tab;
+	cpar.ibperhx = ibperhx;
+	cpar.obperhx = obperhx;
+	if(pthread_mutex_init(&cpar.lock, NULL) || pthread_cond_init(&cpar.ready, NULL))
+		uerror("cannot initialise file threads");
+	/* if a thread stops on an error, what is ready is printed */
+	atexit(calfls);
+	while(started < threads && !pthread_create(tids + started, NULL, calwrk, NULL))
+		++started;
+	if(!started)
+		calwrk(NULL);
+
+	pthread_mutex_lock(&cpar.lock);
+	while(cpar.shown < count) {
+		while(!(line = cpar.lines[cpar.shown]) && !cpar.errors[cpar.shown])
+			pthread_cond_wait(&cpar.ready, &cpar.lock);
+		if(!line) {
+			pthread_mutex_unlock(&cpar.lock);
+			fprintf(stderr, "%s: %s: %s\n", myname, names[cpar.shown], cpar.errors[cpar.shown]);
+			exit(EXIT_FAILURE);
+		}
+		cpar.lines[cpar.shown++] = NULL;
+		pthread_mutex_unlock(&cpar.lock);
+		puts(line);
+		free(line);
+		pthread_mutex_lock(&cpar.lock);
+	}
+	pthread_mutex_unlock(&cpar.lock);
+	for(i = 0; i < started; ++i)
+		pthread_join(tids[i], NULL);
+	pthread_cond_destroy(&cpar.ready);
+	pthread_mutex_destroy(&cpar.lock);
+	free(cpar.lines);
+	cpar.lines = NULL;
+	free(cpar.errors);
+	cpar.errors = NULL;
+	free(tids);
+	return(1);
+}
+
+static void *
+calwrk(void *unused) {
+	/* Thread entry point for calpar().  Streams each file claimed
+	 * through the engine and posts its output line, reading it as
+	 * rdpoly() would.  If the file cannot be read, posts the error
+	 * instead and stops the threads claiming further files.
+	 */
+	pstrm_t strm = PSZERO;
+	poly_t crc, chunk;
+	unsigned char *buffer;
+	const char *error;
+	char *line;
+	size_t size, got;
+	int i, step;
+	FILE *input;
+
+	step = cpar.ibperhx > 0 ? (cpar.ibperhx + CHAR_BIT - 1) / CHAR_BIT : 1;
+	size = BUFFER / CHAR_BIT;
+	size -= size % step;
+	if(!(buffer = malloc(size)))
+		uerror("cannot allocate file buffer");
+	for(;;) {
+		pthread_mutex_lock(&cpar.lock);
+		i = cpar.next < cpar.count ? cpar.next++ : -1;
+		pthread_mutex_unlock(&cpar.lock);
+		if(i < 0)
+			break;
+		line = NULL;
+		if(!(input = fopen(cpar.names[i], "rb")))
+			error = "cannot open for reading";
+		else {
+#ifdef MMAP
+			posix_fadvise(fileno(input), (off_t) 0, (off_t) 0, POSIX_FADV_SEQUENTIAL);
+#endif /* MMAP */
+			ptbegin(&strm, cpar.tab, cpar.model->init, cpar.model->flags);
+			while((got = fread(buffer, 1, size, input)) > 0) {
+				if(cpar.ibperhx == 8)
+					ptrupdate(&strm, buffer, (unsigned long) got);
+				else {
+					chunk = buftop(buffer, (unsigned long) got, cpar.model->flags, cpar.ibperhx);
+					ptupdate(&strm, chunk);
+					pfree(&chunk);
+				}
+				if(got < size)
+					break;
+			}
+			crc = ptfinal(&strm, cpar.model->xorout);
+			error = ferror(input) ? "error condition on file" : NULL;
+			if(fclose(input) && !error)
+				error = "error closing file";
+			if(!error)
+				line = ptostr(crc, cpar.model->flags, cpar.obperhx);
+			pfree(&crc);
+		}
+		pthread_mutex_lock(&cpar.lock);
+		if(error) {
+			cpar.errors[i] = error;
+			cpar.next = cpar.count;
+		} else
+			cpar.lines[i] = line;
+		pthread_cond_signal(&cpar.ready);
+		pthread_mutex_unlock(&cpar.lock);
+	}
+	free(buffer);
+	return(NULL);
+}
+
+static int
+calspl(const char *name, int threads) {
+	/* Calculate and print the CRC of file name, as calpar() would,
+	 * by dividing it into equal pieces of whole characters, one per
+	 * thread.  Each piece is divided from a zero register and the
+	 * registers are joined in order by pcomb().  Returns zero,
+	 * having done nothing, if name is standard input, is not a
+	 * regular file, is too short to be worth dividing or if the
+	 * model does not augment the message.
+	 */
+	const model_t *model = cpar.model;
+	pthread_t *tids;
+	poly_t crc = PZERO, none = PZERO, next;
+	unsigned long plenb;
+	long step;
+	int i, started = 0;
+	FILE *input;
+#ifdef MMAP
+	struct stat st;
+
+	if(stat(name, &st) || !S_ISREG(st.st_mode))
+		return(0);
+#endif /* MMAP */
+
+	if((*name == '-' && name[1] == '\0') || ~model->flags & P_MULXN
+		|| cpar.ibperhx <= 0)
+		return(0);
+	step = (cpar.ibperhx + CHAR_BIT - 1) / CHAR_BIT;
+	input = oread(name);
+	if(fseek(input, 0L, SEEK_END) || (cpar.octets = ftell(input)) < 0L)
+		cpar.octets = 0L;
+	fclose(input);
+	if(cpar.octets / SPLMIN < threads)
+		threads = (int) (cpar.octets / SPLMIN);
+	if(threads < 2 || (unsigned long) (cpar.octets / step) > ~0UL / (unsigned long) cpar.ibperhx)
+		return(0);
+
+	cpar.piece = cpar.octets / step / threads * step;
+	cpar.count = threads;
+	cpar.next = 0;
+	cpar.names = (char **) &name;
+	if(!(tids = malloc(threads * sizeof(pthread_t)))
+		|| !(cpar.regs = calloc(threads, sizeof(poly_t))))
+		uerror("cannot allocate memory for file threads");
+	if(pthread_mutex_init(&cpar.lock, NULL))
+		uerror("cannot initialise file threads");
+	while(started < threads && !pthread_create(tids + started, NULL, calpce, NULL))
+		++started;
+	if(!started)
+		calpce(NULL);
+	for(i = 0; i < started; ++i)
+		pthread_join(tids[i], NULL);
+	pthread_mutex_destroy(&cpar.lock);
+
+	/* crc(A.B) = reg(B) + reg(A) * x^len(B) from a zero register */
+	pcpy(&crc, model->init);
+	praloc(&crc, plen(model->spoly));
+	for(i = 0; i < threads; ++i) {
+		plenb = (unsigned long) ((i < threads - 1 ? cpar.piece : cpar.octets - cpar.piece * i) / step)
+			* (unsigned long) cpar.ibperhx;
+		next = pcomb(crc, cpar.regs[i], plenb, model->spoly, none, none);
+		pfree(&crc);
+		pfree(cpar.regs + i);
+		crc = next;
+	}
+	psum(&crc, model->xorout, 0UL);
+	oline(crc, model->flags, cpar.obperhx);
+	pfree(&crc);
+	free(cpar.regs);
+	cpar.regs = NULL;
+	free(tids);
+	return(1);
+}
+
+static void *
+calpce(void *unused) {
+	/* Thread entry point for calspl().  Divides each piece claimed
+	 * from a zero register and stores the result.
+	 */
+	pstrm_t strm = PSZERO;
+	poly_t zero = PZERO, none = PZERO, chunk;
+	unsigned char *buffer;
+	long start, left;
+	size_t size, got;
+	int i, step;
+	FILE *input;
+
+	step = (cpar.ibperhx + CHAR_BIT - 1) / CHAR_BIT;
+	size = BUFFER / CHAR_BIT;
+	size -= size % step;
+	if(!(buffer = malloc(size)))
+		uerror("cannot allocate file buffer");
+	palloc(&zero, plen(cpar.model->spoly));
+	for(;;) {
+		pthread_mutex_lock(&cpar.lock);
+		i = cpar.next < cpar.count ? cpar.next++ : -1;
+		pthread_mutex_unlock(&cpar.lock);
+		if(i < 0)
+			break;
+		start = cpar.piece * i;
+		left = i < cpar.count - 1 ? cpar.piece : cpar.octets - start;
+		input = oread(*cpar.names);
+#ifdef MMAP
+		posix_fadvise(fileno(input), (off_t) start, (off_t) left, POSIX_FADV_SEQUENTIAL);
+#endif /* MMAP */
+		if(fseek(input, start, SEEK_SET)) {
+			fprintf(stderr,"%s: %s: cannot seek in file\n", myname, *cpar.names);
+			exit(EXIT_FAILURE);
+		}
+		ptbegin(&strm, cpar.tab, zero, cpar.model->flags);
+		while(left > 0L && (got = fread(buffer, 1, left < (long) size ? (size_t) left : size, input)) > 0) {
+			left -= (long) got;
+			if(cpar.ibperhx == 8)
+				ptrupdate(&strm, buffer, (unsigned long) got);
+			else {
+				chunk = buftop(buffer, (unsigned long) got, cpar.model->flags, cpar.ibperhx);
+				ptupdate(&strm, chunk);
+				pfree(&chunk);
+			}
+		}
+		if(ferror(input) || left > 0L) {
+			fprintf(stderr,"%s: %s: error condition on file\n", myname, *cpar.names);
+			exit(EXIT_FAILURE);
+		}
+		fclose(input);
+		cpar.regs[i] = ptfinal(&strm, none);
+	}
+	pfree(&zero);
+	free(buffer);
+	return(NULL);
+}
+
+static void
+calfls(void) {
+	/* atexit() handler for calpar().  If a thread exits on an error
+	 * it could not post, such as running out of memory, prints the
+	 * lines ready in order before the failing file.
+	 */
+	if(!cpar.lines)
+		return;
+	pthread_mutex_lock(&cpar.lock);
+	while(cpar.shown < cpar.count && cpar.lines[cpar.shown])
+		puts(cpar.lines[cpar.shown++]);
+	pthread_mutex_unlock(&cpar.lock);
+}
+#endif /* THREADS */
+
+static unsigned long
+phash(unsigned long hash, const poly_t poly) {
+	/* Returns hash updated with the length and terms of poly,
+	 * using the 32-bit FNV-1a function.
+	 */
+	unsigned long len = plen(poly), i;
+	int octet = 0;
+
+	for(i = 0UL; i < 32UL; i += 8UL)
+		hash = (hash ^ (len >> i & 0xffUL)) * 16777619UL & 0xffffffffUL;
+	for(i = 0UL; i < len; ++i) {
+		octet = octet << 1 | pcoeff(poly, i);
+		if((i & 7UL) == 7UL || i == len - 1UL) {
+			hash = (hash ^ (unsigned long) octet) * 16777619UL & 0xffffffffUL;
+			octet = 0;
+		}
+	}
+	return(hash);
+}
+
+static unsigned long
+pjhash(unsigned long hash, const poly_t poly) {
+	/* Returns hash updated with the length and terms of poly,
+	 * using Jenkins's one-at-a-time function, which shares no
+	 * structure with phash().  The final mix is applied each time.
+	 */
+	unsigned long len = plen(poly), i;
+	int octet = 0;
+
+	for(i = 0UL; i < 32UL; i += 8UL) {
+		hash = (hash + (len >> i & 0xffUL)) & 0xffffffffUL;
+		hash = (hash + (hash << 10)) & 0xffffffffUL;
+		hash ^= hash >> 6;
+	}
+	for(i = 0UL; i < len; ++i) {
+		octet = octet << 1 | pcoeff(poly, i);
+		if((i & 7UL) == 7UL || i == len - 1UL) {
+			hash = (hash + (unsigned long) octet) & 0xffffffffUL;
+			hash = (hash + (hash << 10)) & 0xffffffffUL;
+			hash ^= hash >> 6;
+			octet = 0;
+		}
+	}
+	hash = (hash + (hash << 3)) & 0xffffffffUL;
+	hash ^= hash >> 11;
+	return((hash + (hash << 15)) & 0xffffffffUL);
+}
+
+static int
+ckload(poly_t *start, int *pass) {
+	/* Reads the checkpoint file named by -R, if it exists, and
+	 * reprints the models it holds.  Returns 0 if there is no
+	 * file, 1 if the search should resume at *start on *pass, or
+	 * 2 if the search is already complete.
+	 */
+	FILE *input;
+	char *line;
+	unsigned long hash = 0UL;
+	int ret = 0;
+
+	if(!(input = fopen(ckname, "r")))
+		return(0);
+	if(!(line = ckline(input)) || strcmp(line, "reveng-checkpoint 1")) {
+		fprintf(stderr, "%s: %s: not a checkpoint file\n", myname, ckname);
+		exit(EXIT_FAILURE);
+	}
+	free(line);
+	while((line = ckline(input))) {
+		if(!strncmp(line, "hash ", 5)) {
+			hash = strtoul(line + 5, NULL, 16);
+			if(hash != ckhash) {
+				fprintf(stderr, "%s: %s: checkpoint is for a different search\n", myname, ckname);
+				exit(EXIT_FAILURE);
+			}
+		} else if(!strncmp(line, "pass ", 5))
+			*pass = atoi(line + 5);
+		else if(!strcmp(line, "done"))
+			ret = 2;
+		else if(!strncmp(line, "next ", 5)) {
+			pfree(start);
+			*start = ckpoly(line + 5);
+			ret = 1;
+		} else if(!strncmp(line, "found ", 6)) {
+			puts(line + 6);
+			if(!(ckmods = realloc(ckmods, (ckmodc + 1) * sizeof(char *))))
+				uerror("cannot reallocate checkpoint model list");
+			/* keep the model string, less the keyword */
+			memmove(line, line + 6, strlen(line + 6) + 1);
+			ckmods[ckmodc++] = line;
+			continue;
+		}
+		free(line);
+	}
+	if(ferror(input) || fclose(input) || !ret || hash != ckhash) {
+		fprintf(stderr, "%s: %s: checkpoint file is incomplete\n", myname, ckname);
+		exit(EXIT_FAILURE);
+	}
+	return(ret);
+}
+
+static void
+cksave(const poly_t *next) {
+	/* Writes the search state to the checkpoint file named by -R.
+	 * If next is NULL, the search is recorded as complete,
+	 * otherwise it resumes at *next.  The state is written to a
+	 * temporary file which then replaces the checkpoint.
+	 */
+	FILE *output;
+	char *temp;
+	int i;
+
+	if(!(temp = malloc(strlen(ckname) + 5)))
+		uerror("cannot allocate memory for file name");
+	strcat(strcpy(temp, ckname), ".new");
+	if(!(output = fopen(temp, "w"))) {
+		fprintf(stderr, "%s: %s: cannot open for writing\n", myname, temp);
+		exit(EXIT_FAILURE);
+	}
+	fprintf(output, "reveng-checkpoint 1\nhash %08lx\npass %d\n", ckhash, ckpass);
+	if(next)
+		ckput(output, "next", *next);
+	else
+		fputs("done\n", output);
+	for(i = 0; i < ckmodc; ++i)
+		fprintf(output, "found %s\n", ckmods[i]);
+	if(ferror(output) || fclose(output)) {
+		fprintf(stderr, "%s: %s: error writing checkpoint\n", myname, temp);
+		exit(EXIT_FAILURE);
+	}
+	/* rename() may not replace an existing file */
+	if(rename(temp, ckname) && (remove(ckname) || rename(temp, ckname))) {
+		fprintf(stderr, "%s: %s: cannot replace checkpoint\n", myname, ckname);
+		exit(EXIT_FAILURE);
+	}
+	free(temp);
+}
+
+static void
+pcload(void) {
+	/* Reads the preset verdict cache named by -K, if it exists.
+	 * If MMAP is defined the file is mapped, otherwise it is read
+	 * into memory whole.
+	 */
+	FILE *input;
+	long size;
+	char *buffer;
+
+	if(!(input = fopen(pcname, "rb")))
+		return;
+	if(fseek(input, 0L, SEEK_END) || (size = ftell(input)) < 0L || fseek(input, 0L, SEEK_SET)) {
+		fprintf(stderr, "%s: %s: cannot read preset cache\n", myname, pcname);
+		exit(EXIT_FAILURE);
+	}
+	pcsize = (size_t) size;
+	if(pcsize < sizeof(PCHEAD) - 1) {
+		fprintf(stderr, "%s: %s: not a preset cache file\n", myname, pcname);
+		exit(EXIT_FAILURE);
+	}
+#ifdef MMAP
+	buffer = (char *) mmap(NULL, pcsize, PROT_READ, MAP_PRIVATE, fileno(input), (off_t) 0);
+	if(buffer != (char *) MAP_FAILED) {
+		pcmapd = 1;
+		pcold = buffer;
+	}
+#endif /* MMAP */
+	if(!pcmapd) {
+		if(!(buffer = malloc(pcsize)))
+			uerror("cannot allocate memory for preset cache");
+		if(fread(buffer, 1, pcsize, input) != pcsize) {
+			fprintf(stderr, "%s: %s: cannot read preset cache\n", myname, pcname);
+			exit(EXIT_FAILURE);
+		}
+		pcold = buffer;
+	}
+	fclose(input);
+	if(memcmp(pcold, PCVERS, sizeof(PCVERS) - 1)) {
+		fprintf(stderr, "%s: %s: not a preset cache file\n", myname, pcname);
+		exit(EXIT_FAILURE);
+	}
+	if(memcmp(pcold, PCHEAD, sizeof(PCHEAD) - 1)) {
+		/* a cache of another version is replaced */
+		pcdrop();
+		return;
+	}
+	if((pcsize - (sizeof(PCHEAD) - 1)) % PCREC) {
+		fprintf(stderr, "%s: %s: not a preset cache file\n", myname, pcname);
+		exit(EXIT_FAILURE);
+	}
+	pcoldn = (unsigned long) ((pcsize - (sizeof(PCHEAD) - 1)) / PCREC);
+}
+
+static int
+pcfind(const char *key) {
+	/* Returns the verdict character of the cached record with key,
+	 * or 0 if there is none.
+	 */
+	const char *recs, *rec;
+	unsigned long lo = 0UL, hi = pcoldn, mid;
+	int cmp;
+
+	if(!pcold)
+		return(0);
+	recs = pcold + sizeof(PCHEAD) - 1;
+	while(lo < hi) {
+		mid = lo + (hi - lo) / 2UL;
+		rec = recs + mid * PCREC;
+		if(!(cmp = memcmp(rec, key, PCKEY)))
+			return(rec[PCKEY + 1]);
+		if(cmp < 0)
+			lo = mid + 1UL;
+		else
+			hi = mid;
+	}
+	return(0);
+}
+
+static void
+pcadd(const char *key, int fail) {
+	/* Adds a record of key and verdict to those to be saved. */
+	char *rptr;
+
+	if(pcnewn == pcnewa) {
+		pcnewa = pcnewa ? pcnewa << 1 : 64UL;
+		if(!(rptr = realloc(pcnew, pcnewa * PCREC)))
+			uerror("cannot reallocate preset cache records");
+		pcnew = rptr;
+	}
+	rptr = pcnew + pcnewn++ * PCREC;
+	memcpy(rptr, key, PCKEY);
+	rptr[PCKEY] = ' ';
+	rptr[PCKEY + 1] = fail ? '1' : '0';
+	rptr[PCKEY + 2] = '\n';
+}
+
+static int
+pccmp(const void *a, const void *b) {
+	/* qsort() comparison function for cache records */
+	return(memcmp(a, b, PCKEY));
+}
+
+static void
+pcsave(void) {
+	/* Merges the records added by this run into the preset cache
+	 * named by -K.  As in cksave(), the cache is written to a
+	 * temporary file which then replaces it.
+	 */
+	FILE *output;
+	char *temp;
+	const char *oldp = "", *olde, *newp, *newe;
+	int cmp;
+
+	if(!pcnewn) {
+		pcdrop();
+		return;
+	}
+	if(pcold)
+		oldp = pcold + sizeof(PCHEAD) - 1;
+	olde = oldp + pcoldn * PCREC;
+	newp = pcnew;
+	newe = pcnew + pcnewn * PCREC;
+	qsort(pcnew, (size_t) pcnewn, PCREC, pccmp);
+	if(!(temp = malloc(strlen(pcname) + 5)))
+		uerror("cannot allocate memory for file name");
+	strcat(strcpy(temp, pcname), ".new");
+	if(!(output = fopen(temp, "wb"))) {
+		fprintf(stderr, "%s: %s: cannot open for writing\n", myname, temp);
+		exit(EXIT_FAILURE);
+	}
+	fputs(PCHEAD, output);
+	while(oldp < olde || newp < newe) {
+		cmp = oldp == olde ? 1 : newp == newe ? -1 : memcmp(oldp, newp, PCKEY);
+		if(cmp < 0) {
+			fwrite(oldp, 1, PCREC, output);
+			oldp += PCREC;
+		} else {
+			fwrite(newp, 1, PCREC, output);
+			/* an argument given twice yields a duplicate */
+			if(!cmp)
+				oldp += PCREC;
+			do
+				newp += PCREC;
+			while(newp < newe && !memcmp(newp, newp - PCREC, PCKEY));
+		}
+	}
+	if(ferror(output) || fclose(output)) {
+		fprintf(stderr, "%s: %s: error writing preset cache\n", myname, temp);
+		exit(EXIT_FAILURE);
+	}
+	pcdrop();
+	free(pcnew);
+	pcnew = NULL;
+	pcnewn = pcnewa = 0UL;
+	/* rename() may not replace an existing file */
+	if(rename(temp, pcname) && (remove(pcname) || rename(temp, pcname))) {
+		fprintf(stderr, "%s: %s: cannot replace preset cache\n", myname, pcname);
+		exit(EXIT_FAILURE);
+	}
+	free(temp);
+}
+
+static void
+pcdrop(void) {
+	/* Unmaps or frees the records read by pcload(), if any. */
+#ifdef MMAP
+	if(pcmapd)
+		munmap(pcold, pcsize);
+	else
+#endif /* MMAP */
+		free(pcold);
+	pcold = NULL;
+	pcoldn = 0UL;
+	pcmapd = 0;
+}
+
+static char *
+ckline(FILE *input) {
+	/* Returns the next line of input, without its newline, in a
+	 * newly allocated string, or NULL at the end of the file.
+	 */
+	char *line = NULL;
+	size_t size = 0, len = 0;
+
+	do {
+		if(!(line = realloc(line, size += CKLINE)))
+			uerror("cannot allocate memory for checkpoint line");
+		if(!fgets(line + len, (int) (size - len), input)) {
+			if(!len) {
+				free(line);
+				return(NULL);
+			}
+			break;
+		}
+		len += strlen(line + len);
+	} while(!len || line[len - 1] != '\n');
+	if(len && line[len - 1] == '\n')
+		line[--len] = '\0';
+	return(line);
+}
+
+static poly_t
+ckpoly(const char *ptr) {
+	/* Returns the poly written by ckput() after a keyword: its
+	 * length in terms, then its value in right-justified
+	 * hexadecimal.
+	 */
+	poly_t poly;
+	unsigned long len;
+	char *end;
+
+	len = strtoul(ptr, &end, 10);
+	while(*end == ' ')
+		++end;
+	poly = strtop(end, 0, 4);
+	pright(&poly, len);
+	return(poly);
+}
+
+static void
+ckput(FILE *output, const char *key, const poly_t poly) {
+	/* Writes poly to output on a line starting with key, in the
+	 * form that ckpoly() reads.
+	 */
+	char *string;
+
+	string = ptostr(poly, P_RTJUST, 4);
+	fprintf(output, "%s %lu 0x%s\n", key, plen(poly), string);
+	free(string);
+}
+
+static int
+ssload(poly_t *apolys, int args) {
+	/* Reads the session file named by -U, if it exists.  The
+	 * arguments it records are brought to the front of apolys, in
+	 * its order, and their number is returned.  Returns 0 and
+	 * starts the session afresh if there is no file, or if an
+	 * argument it records is no longer given.
+	 */
+	FILE *input;
+	char *line;
+	unsigned long hash = 0UL, key, *keys;
+	poly_t swap;
+	int olds = 0, pass = 0, lost = 0, i;
+
+	if(!(input = fopen(ssname, "r")))
+		return(0);
+	if(!(line = ckline(input)) || strcmp(line, "reveng-session 1")) {
+		fprintf(stderr, "%s: %s: not a session file\n", myname, ssname);
+		exit(EXIT_FAILURE);
+	}
+	free(line);
+	if(!(keys = malloc((args + 1) * sizeof(unsigned long))))
+		uerror("cannot allocate memory for argument hashes");
+	for(i = 0; i < args; ++i)
+		keys[i] = phash(2166136261UL, apolys[i]);
+	while((line = ckline(input))) {
+		if(!strncmp(line, "hash ", 5)) {
+			hash = strtoul(line + 5, NULL, 16);
+			if(hash != sshash) {
+				fprintf(stderr, "%s: %s: session is for a different search\n", myname, ssname);
+				exit(EXIT_FAILURE);
+			}
+		} else if(!strncmp(line, "arg ", 4)) {
+			key = strtoul(line + 4, NULL, 16);
+			for(i = olds; i < args && keys[i] != key; ++i)
+				;
+			if(i == args)
+				lost = 1;
+			else {
+				keys[i] = keys[olds];
+				keys[olds] = key;
+				swap = apolys[i];
+				apolys[i] = apolys[olds];
+				apolys[olds++] = swap;
+			}
+		} else if(!strncmp(line, "pass ", 5))
+			pass = atoi(line + 5) ? 1 : 0;
+		else if(!strncmp(line, "gcd ", 4)) {
+			pfree(ssgcd + pass);
+			ssgcd[pass] = ckpoly(line + 4);
+		} else if(!strncmp(line, "gen ", 4)) {
+			swap = ckpoly(line + 4);
+			ssgen(pass, swap);
+			pfree(&swap);
+		} else if(!strcmp(line, "solved"))
+			sssolv[pass] = 1;
+		free(line);
+	}
+	free(keys);
+	if(ferror(input) || fclose(input) || hash != sshash) {
+		fprintf(stderr, "%s: %s: session file is incomplete\n", myname, ssname);
+		exit(EXIT_FAILURE);
+	}
+	if(lost) {
+		fprintf(stderr, "%s: %s: arguments have been removed, starting afresh\n", myname, ssname);
+		ssfree();
+		return(0);
+	}
+	return(olds);
+}
+
+static void
+sssave(const poly_t *apolys, int args, int passes) {
+	/* Writes the session of the first passes passes of the search
+	 * on apolys to the file named by -U.  As with cksave(), a
+	 * temporary file replaces the session file.
+	 */
+	FILE *output;
+	char *temp;
+	int pass, i;
+
+	if(!(temp = malloc(strlen(ssname) + 5)))
+		uerror("cannot allocate memory for file name");
+	strcat(strcpy(temp, ssname), ".new");
+	if(!(output = fopen(temp, "w"))) {
+		fprintf(stderr, "%s: %s: cannot open for writing\n", myname, temp);
+		exit(EXIT_FAILURE);
+	}
+	fprintf(output, "reveng-session 1\nhash %08lx\n", sshash);
+	for(i = 0; i < args; ++i)
+		fprintf(output, "arg %08lx\n", phash(2166136261UL, apolys[i]));
+	for(pass = 0; pass < passes; ++pass) {
+		fprintf(output, "pass %d\n", pass);
+		if(plen(ssgcd[pass]))
+			ckput(output, "gcd", ssgcd[pass]);
+		for(i = 0; i < ssgenc[pass]; ++i)
+			ckput(output, "gen", ssgens[pass][i]);
+		if(sssolv[pass])
+			fputs("solved\n", output);
+	}
+	if(ferror(output) || fclose(output)) {
+		fprintf(stderr, "%s: %s: error writing session\n", myname, temp);
+		exit(EXIT_FAILURE);
+	}
+	if(rename(temp, ssname) && (remove(ssname) || rename(temp, ssname))) {
+		fprintf(stderr, "%s: %s: cannot replace session\n", myname, ssname);
+		exit(EXIT_FAILURE);
+	}
+	free(temp);
+}
+
+static void
+ssgen(int pass, const poly_t gpoly) {
+	/* Adds a copy of gpoly to the generators of pass, unless it
+	 * is there already.
+	 */
+	int i;
+
+	for(i = 0; i < ssgenc[pass]; ++i)
+		if(!pcmp(ssgens[pass] + i, &gpoly))
+			return;
+	if(!(ssgens[pass] = realloc(ssgens[pass], (ssgenc[pass] + 1) * sizeof(poly_t))))
+		uerror("cannot reallocate session generator list");
+	ssgens[pass][ssgenc[pass]++] = pclone(gpoly);
+}
+
+static void
+ssfree(void) {
+	/* Frees the session and clears it. */
+	int pass;
+
+	for(pass = 0; pass < 2; ++pass) {
+		while(ssgenc[pass])
+			pfree(ssgens[pass] + --ssgenc[pass]);
+		free(ssgens[pass]);
+		ssgens[pass] = NULL;
+		pfree(ssgcd + pass);
+		sssolv[pass] = 0;
+	}
+}
+
+static void
+oline(const poly_t poly, int flags, int bperhx) {
+	/* Writes poly in hexadecimal as a line of standard output,
+	 * through the output buffer.  See ptostr().
+	 */
+	size_t size = (size_t) ptosize(poly, flags, bperhx);
+	char *end;
+
+	if(!size)
+		return;
+	if(olen + size + 1 > osize) {
+		oflush();
+		if(size + 1 > osize) {
+			osize = size + 1 > OBUFFER ? size + 1 : OBUFFER;
+			if(!(obuf = (char *) realloc(obuf, osize)))
+				uerror("cannot allocate output buffer");
+		}
+	}
+	end = ptostrto(obuf + olen, poly, flags, bperhx);
+	*end++ = '\n';
+	olen = (size_t) (end - obuf);
+	if(!obatch || olen >= OBUFFER)
+		oflush();
+}
+
+static void
+oflush(void) {
+	/* Writes out the output buffer. */
+	if(olen)
+		fwrite(obuf, 1, olen, stdout);
+	olen = 0;
+}
+
 static void
 usage(void) {
 	/* print usage if asked, or if syntax incorrect */
@@ -637,20 +1995,28 @@ usage(void) {
 			"Usage:\t");
 	fputs(myname, stderr);
 	fprintf(stderr,
-			"\t-cdDesvhu? [-1bBfFGlLMrStVXyz]\n"
-			"\t[-a BITS] [-A OBITS] [-i INIT] [-k KPOLY] [-m MODEL] [-p POLY]\n"
-			"\t[-p POLY] [-P RPOLY] [-q QPOLY] [-w WIDTH] [-x XOROUT] [STRING...]\n"
+			"\t-cCdDesvhu? [-1bBfFGlLMOrStVXyzZ]\n"
+			"\t[-a BITS] [-A OBITS] [-E FACTORS] [-i INIT] [-j THREADS] [-k KPOLY]\n"
+			"\t[-K FILE] [-m MODEL] [-n K/N] [-p POLY] [-P RPOLY] [-q QPOLY]\n"
+			"\t[-R FILE] [-T FILE] [-U FILE] [-w WIDTH] [-x XOROUT] [STRING...]\n"
 			"Options:\n"
 			"\t-a BITS\t\tbits per character (1 to %d)\n"
 			"\t-A OBITS\tbits per output character (1 to %d)\n"
+			"\t-E FACTORS\ttrial factors between progress reports\n"
 			"\t-i INIT\t\tinitial register value\n"
+			"\t-j THREADS\tnumber of search or file threads\n"
 			"\t-k KPOLY\tgenerator in Koopman notation (implies WIDTH)\n"
+			"\t-K FILE\t\tcache preset model checks in FILE\n"
 			"\t-m MODEL\tpreset CRC algorithm\n"
+			"\t-n K/N\t\tsearch shard K of N\n"
 			"\t-p POLY\t\tgenerator or search range start polynomial\n"
 			"\t-P RPOLY\treversed generator polynomial (implies WIDTH)\n",
 			BMP_BIT, BMP_BIT);
 	fprintf(stderr,
 			"\t-q QPOLY\tsearch range end polynomial\n"
+			"\t-R FILE\t\tsave search state to FILE, or resume from it\n"
+			"\t-T FILE\t\tappend search statistics to FILE (- for stdout)\n"
+			"\t-U FILE\t\tcarry the search to FILE, adding new STRINGs\n"
 			"\t-w WIDTH\tregister size, in bits\n"
 			"\t-x XOROUT\tfinal register XOR value\n"
 			"Modifier switches:\n"
@@ -661,13 +2027,14 @@ usage(void) {
 			"\t-M non-augmenting algorithm\t-r right-justified output\n"
 			"\t-S print spaces between chars\t-t left-justified output\n"
 			"\t-V reverse algorithm only\t-X print uppercase hexadecimal\n"
-			"\t-y low bytes first in files\t-z raw binary STRINGs\n");
+			"\t-y low bytes first in files\t-z raw binary STRINGs\n"
+			"\t-O search on OpenCL device\t-Z factorise search divisor\n");
 	fprintf(stderr,
 			"Mode switches:\n"
-			"\t-c calculate CRCs\t\t-d dump algorithm parameters\n"
-			"\t-D list preset algorithms\t-e echo (and reformat) input\n"
-			"\t-s search for algorithm\t\t-v calculate reversed CRCs\n"
-			"\t-h | -u | -? show this help\n"
+			"\t-c calculate CRCs\t\t-C calculate CRCs of records\n"
+			"\t-d dump algorithm parameters\t-D list preset algorithms\n"
+			"\t-e echo (and reformat) input\t-s search for algorithm\n"
+			"\t-v calculate reversed CRCs\t-h | -u | -? show this help\n"
 			"\n"
 			"Copyright (C) 2010, 2011, 2012, 2013, 2014,\n"
 			"\t      2015, 2016, 2017, 2018, 2019, 2020, 2021, 2022  Gregory Cook\n"
@@ -0,0 +1,263 @@
+/* clmul.c
+ * agent, 14/Oct/2026
+ */
+
+/* CRC RevEng: arbitrary-precision CRC calculator and algorithm finder
+ * Copyright (C) 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018,
+ * 2019, 2020, 2021, 2022  Gregory Cook
+ *
+ * This file is part of CRC RevEng.
+ *
+ * CRC RevEng is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * CRC RevEng is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with CRC RevEng.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/* 2026-10-14: kernels only compiled when BMP_BIT is the constant 64
+ * 2026-10-14: added clmrev(), SSSE3 and NEON bit reversal kernels
+ * 2026-10-14: started clmul.c, PCLMULQDQ and PMULL folding kernels
+ */
+
+/* The functions in this file are only compiled in full if CLMUL is
+ * defined, BMP_BIT is the constant 64 (so PRESETS or BMPMACRO is also
+ * defined) and the compiler targets x86-64 or AArch64 Linux.
+ * Elsewhere clmcpu() always reports the instructions missing and
+ * poly.c uses the portable engines.  The kernels assume a 64-bit
+ * bmp_t, and ptinit() also checks BMP_BIT == 64 at run time.
+ *
+ * Within a 128-bit fold value, and in the keys table, bit i of each
+ * word is the coefficient of x^i.  A pair of message words {w0, w1}
+ * therefore stands for w0 * x^64 + w1, which matches the MSB-first
+ * order of the poly_t bitmap.
+ *
+ * keys[] holds x^d mod G for, in order,
+ *   d = 512, 576, 384, 448, 256, 320, 128, 192
+ * so that each pair is the (low, high) multiplier for folding a 128-bit
+ * lane a further 512, 384, 256 or 128 bits.
+ *
+ * clmrev() reverses the bits of each byte with a table lookup per
+ * nibble (PSHUFB) or RBIT, then the bytes of each group with a byte
+ * shuffle.  Both targets are little-endian, so the bytes of a group of
+ * a word are adjacent in memory.
+ */
+
+#include <stdio.h>
+
+#include "reveng.h"
+
+/* BMP_BIT is 0 here if it is not a compile-time constant */
+#if defined CLMUL && BMP_BIT == 64
+#  if defined __GNUC__ && defined __x86_64__
+#    define CLM_X86 1
+#    include <cpuid.h>
+#    include <emmintrin.h>
+#    include <tmmintrin.h>
+#    include <wmmintrin.h>
+#  elif defined __GNUC__ && defined __aarch64__ && defined __linux__
+#    define CLM_A64 1
+#    include <arm_neon.h>
+#    include <sys/auxv.h>
+#    include <asm/hwcap.h>
+#  endif
+#endif /* CLMUL, BMP_BIT */
+
+#if defined CLM_X86
+
+/* fold a lane a by the multipliers in k */
+#  define FOLD(a, k) _mm_xor_si128(_mm_clmulepi64_si128((a), (k), 0x00), \
+				_mm_clmulepi64_si128((a), (k), 0x11))
+/* load two message words, first word high */
+#  define LOAD(p) _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *) (p)), 0x4e)
+
+int
+clmcpu(void) {
+	/* Returns nonzero if the processor has PCLMULQDQ. */
+	unsigned int a = 0U, b = 0U, c = 0U, d = 0U;
+
+	if(!__get_cpuid(1U, &a, &b, &c, &d))
+		return(0);
+	return((c & bit_PCLMUL) && (d & bit_SSE2));
+}
+
+__attribute__((target("pclmul,sse2")))
+void
+clmfld(bmp_t *fold, const bmp_t *keys, const bmp_t *words, unsigned long count, bmp_t init) {
+	/* Folds count words (a nonzero multiple of 8) into a 128-bit
+	 * value congruent to them, modulo the generator whose constants
+	 * are in keys, after adding init to the first word.  The result
+	 * is stored as two words in fold[], high word first.
+	 */
+	__m128i k, a0, a1, a2, a3;
+	bmp_t out[2];
+
+	a0 = _mm_xor_si128(LOAD(words), _mm_slli_si128(_mm_loadl_epi64((const __m128i *) &init), 8));
+	a1 = LOAD(words + 2);
+	a2 = LOAD(words + 4);
+	a3 = LOAD(words + 6);
+	k = _mm_loadu_si128((const __m128i *) keys);
+	for(words += 8, count -= 8UL; count; words += 8, count -= 8UL) {
+		a0 = _mm_xor_si128(FOLD(a0, k), LOAD(words));
+		a1 = _mm_xor_si128(FOLD(a1, k), LOAD(words + 2));
+		a2 = _mm_xor_si128(FOLD(a2, k), LOAD(words + 4));
+		a3 = _mm_xor_si128(FOLD(a3, k), LOAD(words + 6));
+	}
+	/* bring the lanes together */
+	a3 = _mm_xor_si128(a3, FOLD(a0, _mm_loadu_si128((const __m128i *) (keys + 2))));
+	a3 = _mm_xor_si128(a3, FOLD(a1, _mm_loadu_si128((const __m128i *) (keys + 4))));
+	a3 = _mm_xor_si128(a3, FOLD(a2, _mm_loadu_si128((const __m128i *) (keys + 6))));
+	_mm_storeu_si128((__m128i *) out, a3);
+	fold[0] = out[1];
+	fold[1] = out[0];
+}
+
+__attribute__((target("ssse3")))
+unsigned long
+clmrev(bmp_t *words, unsigned long count, int bits) {
+	/* Reverses each group of bits bits (8, 16, 32 or 64) in each of
+	 * the first count words, in place, and returns the number of
+	 * words done: an even number, or zero if the processor lacks
+	 * SSSE3 or bits is not supported.
+	 */
+	static const signed char bswap[4][16] = {
+		{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+		{1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14},
+		{3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12},
+		{7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8}
+	};
+	unsigned long iter;
+	__m128i lo, hi, mask, shuf, v;
+	int sel;
+
+	/* unlike CPUID, which may trap to a hypervisor, this reads
+	 * flags gathered at startup and is cheap on every call
+	 */
+	if(BMP_BIT != 64 || !__builtin_cpu_supports("ssse3"))
+		return(0UL);
+	switch(bits) {
+		case 8:  sel = 0; break;
+		case 16: sel = 1; break;
+		case 32: sel = 2; break;
+		case 64: sel = 3; break;
+		default: return(0UL);
+	}
+	/* reversed nibbles, for the high and low halves of each byte */
+	lo = _mm_setr_epi8(0x00, 0x80, 0x40, 0xc0, 0x20, 0xa0, 0x60, 0xe0,
+		0x10, 0x90, 0x50, 0xd0, 0x30, 0xb0, 0x70, 0xf0);
+	hi = _mm_srli_epi16(lo, 4);
+	hi = _mm_and_si128(hi, _mm_set1_epi8(0x0f));
+	mask = _mm_set1_epi8(0x0f);
+	shuf = _mm_loadu_si128((const __m128i *) bswap[sel]);
+	count &= ~1UL;
+	for(iter = 0UL; iter < count; iter += 2UL) {
+		v = _mm_loadu_si128((const __m128i *) (words + iter));
+		v = _mm_or_si128(_mm_shuffle_epi8(lo, _mm_and_si128(v, mask)),
+			_mm_shuffle_epi8(hi, _mm_and_si128(_mm_srli_epi16(v, 4), mask)));
+		_mm_storeu_si128((__m128i *) (words + iter), _mm_shuffle_epi8(v, shuf));
+	}
+	return(count);
+}
+
+#elif defined CLM_A64
+
+/* fold a lane a by the multipliers at p */
+#  define FOLD(a, p) veorq_u64(pmull(vgetq_lane_u64((a), 0), (p)[0]), \
+				pmull(vgetq_lane_u64((a), 1), (p)[1]))
+/* load two message words, first word high */
+#  define LOAD(p) vextq_u64(vld1q_u64((const uint64_t *) (p)), vld1q_u64((const uint64_t *) (p)), 1)
+
+__attribute__((target("+crypto")))
+static uint64x2_t
+pmull(bmp_t a, bmp_t b) {
+	/* Returns the 128-bit carry-less product of a and b. */
+	return(vreinterpretq_u64_p128(vmull_p64((poly64_t) a, (poly64_t) b)));
+}
+
+int
+clmcpu(void) {
+	/* Returns nonzero if the processor has PMULL. */
+	return((getauxval(AT_HWCAP) & HWCAP_PMULL) != 0UL);
+}
+
+__attribute__((target("+crypto")))
+void
+clmfld(bmp_t *fold, const bmp_t *keys, const bmp_t *words, unsigned long count, bmp_t init) {
+	/* Folds count words (a nonzero multiple of 8) into a 128-bit
+	 * value congruent to them, modulo the generator whose constants
+	 * are in keys, after adding init to the first word.  The result
+	 * is stored as two words in fold[], high word first.
+	 */
+	uint64x2_t a0, a1, a2, a3;
+
+	a0 = veorq_u64(LOAD(words), vcombine_u64(vcreate_u64(0U), vcreate_u64((uint64_t) init)));
+	a1 = LOAD(words + 2);
+	a2 = LOAD(words + 4);
+	a3 = LOAD(words + 6);
+	for(words += 8, count -= 8UL; count; words += 8, count -= 8UL) {
+		a0 = veorq_u64(FOLD(a0, keys), LOAD(words));
+		a1 = veorq_u64(FOLD(a1, keys), LOAD(words + 2));
+		a2 = veorq_u64(FOLD(a2, keys), LOAD(words + 4));
+		a3 = veorq_u64(FOLD(a3, keys), LOAD(words + 6));
+	}
+	/* bring the lanes together */
+	a3 = veorq_u64(a3, FOLD(a0, keys + 2));
+	a3 = veorq_u64(a3, FOLD(a1, keys + 4));
+	a3 = veorq_u64(a3, FOLD(a2, keys + 6));
+	fold[0] = (bmp_t) vgetq_lane_u64(a3, 1);
+	fold[1] = (bmp_t) vgetq_lane_u64(a3, 0);
+}
+
+unsigned long
+clmrev(bmp_t *words, unsigned long count, int bits) {
+	/* Reverses each group of bits bits (8, 16, 32 or 64) in each of
+	 * the first count words, in place, and returns the number of
+	 * words done: an even number, or zero if bits is not supported.
+	 */
+	unsigned long iter;
+	uint8x16_t v;
+
+	if(BMP_BIT != 64 || (bits != 8 && bits != 16 && bits != 32 && bits != 64))
+		return(0UL);
+	count &= ~1UL;
+	for(iter = 0UL; iter < count; iter += 2UL) {
+		v = vrbitq_u8(vld1q_u8((const uint8_t *) (words + iter)));
+		if(bits == 16)
+			v = vrev16q_u8(v);
+		else if(bits == 32)
+			v = vrev32q_u8(v);
+		else if(bits == 64)
+			v = vrev64q_u8(v);
+		vst1q_u8((uint8_t *) (words + iter), v);
+	}
+	return(count);
+}
+
+#else /* CLM_X86, CLM_A64 */
+
+int
+clmcpu(void) {
+	/* Returns nonzero if carry-less multiply is available. */
+	return(0);
+}
+
+void
+clmfld(bmp_t *fold, const bmp_t *keys, const bmp_t *words, unsigned long count, bmp_t init) {
+	/* Never called, as clmcpu() returns zero. */
+	fold[0] = fold[1] = BMP_C(0);
+}
+
+unsigned long
+clmrev(bmp_t *words, unsigned long count, int bits) {
+	/* Reverses no words; the caller does them all. */
+	return(0UL);
+}
+
+#endif /* CLM_X86, CLM_A64 */
@@ -31,18 +31,25 @@
  *					 *
  *****************************************/
 
-/* A type to contain polynomial coefficient bitmaps.
- * Can be changed to 'unsigned long long' for some extended compilers.
- * Adjust BMP_C(), BMP_BIT and BMP_SUB below if this is changed.
+/* A type to contain polynomial coefficient bitmaps, and a macro that
+ * creates an appropriate numeric constant for bmp_t.
+ * The type can be changed to 'unsigned long long' for some extended
+ * compilers, in which case change UL to ULL.
+ * Adjust BMP_BIT and BMP_SUB below if the type is changed.
+ * If BMP_BIT is predefined as 32, for instance with -DBMP_BIT=32, and
+ * unsigned long is wider, then unsigned int is used instead.
  */
 
-#define BMP_T unsigned long
+#include <limits.h>
 
-/* Creates an appropriate numeric constant for bmp_t.
- * If the underlying type is 'unsigned long long', change UL to ULL.
- */
-
-#define BMP_C(n) (n##UL)
+#if defined BMP_BIT && BMP_BIT == 32 && ULONG_MAX >> 31 != 1UL && \
+    UINT_MAX >> 31 == 1U
+#  define BMP_T unsigned int
+#  define BMP_C(n) (n##U)
+#else /* BMP_BIT */
+#  define BMP_T unsigned long
+#  define BMP_C(n) (n##UL)
+#endif /* BMP_BIT */
 
 /* Define BMPMACRO to turn the definitions of the size of a bmp_t into
  * compile-time constants.  This improves efficiency but makes the code
@@ -65,21 +72,41 @@
 /* #define PRESETS  1 */
 
 /* Macros defining the size of a bmp_t.
- * Their values only matter if PRESETS and/or BMPMACRO are defined, in
- * which case edit the macros below to suit your architecture.
+ * Their values only matter if PRESETS and/or BMPMACRO are defined.
+ * By default they follow the width of unsigned long, 64 bits on LP64
+ * hosts and 32 bits elsewhere.  Define BMP_BIT as 32 on the command
+ * line to keep 32-bit words on an LP64 host; BMP_SUB then follows.
+ * If BMP_T is changed, or unsigned long has some other width, edit the
+ * macros below to suit your architecture.  bmptst checks them when
+ * reveng is built.
  * Otherwise, BMP_BIT and BMP_SUB will be redefined as aliases of bmpbit
  * and bmpsub, global objects initialised at run time.
  */
 
+#ifndef BMP_BIT
+#  if ULONG_MAX >> 31 >> 31 >> 1 == 1UL
+
 /* Size in bits of a bmp_t.  Not necessarily a power of two. */
 
-#define BMP_BIT   32
+#    define BMP_BIT   64
+#  else /* ULONG_MAX */
+#    define BMP_BIT   32
+#  endif /* ULONG_MAX */
+#endif /* BMP_BIT */
 
 /* The highest power of two that is strictly less than BMP_BIT.
  * Initialises the index of a binary search for set bits in a bmp_t.
  */
 
-#define BMP_SUB   16
+#ifndef BMP_SUB
+#  if BMP_BIT > 64
+#    define BMP_SUB   64
+#  elif BMP_BIT > 32
+#    define BMP_SUB   32
+#  else /* BMP_BIT */
+#    define BMP_SUB   16
+#  endif /* BMP_BIT */
+#endif /* BMP_SUB */
 
 /*****************************************
  *					 *
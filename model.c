@@ -22,7 +22,8 @@
  * along with CRC RevEng.  If not, see <https://www.gnu.org/licenses/>.
  */
 
-/* 2018-12-17: mnovel() clears class flags
+/* 2026-10-14: mtostr() allocates with pmalloc(), in the reveng() ledger
+ * 2018-12-17: mnovel() clears class flags
  * 2017-02-19: revised residue calculation for crossed-endian models
  * 2017-02-05: added magic field
  * 2016-02-22: split off preset.c
@@ -122,7 +123,7 @@ mtostr(const model_t *model) {
 		+ (checkstr && *checkstr ? strlen(checkstr) : 6)
 		+ (magicstr && *magicstr ? strlen(magicstr) : 6)
 		+ (model->name && *model->name ? 2 + strlen(model->name) : 6);
-	if((string = malloc(size))) {
+	if((string = pmalloc(size))) {
 		sprintf(strbuf, "\"%s\"", model->name);
 		sprintf(string,
 				"width=%lu  "
@@ -144,11 +145,11 @@ mtostr(const model_t *model) {
 				magicstr && *magicstr ? magicstr : "(none)",
 				(model->name && *model->name) ? strbuf : "(none)");
 	}
-	free(polystr);
-	free(initstr);
-	free(xorotstr);
-	free(checkstr);
-	free(magicstr);
+	pmfree(polystr);
+	pmfree(initstr);
+	pmfree(xorotstr);
+	pmfree(checkstr);
+	pmfree(magicstr);
 	if(!string)
 		uerror("cannot allocate memory for model description");
 	return(string);
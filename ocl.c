@@ -0,0 +1,287 @@
+/* ocl.c
+ * agent, 14/Oct/2026
+ */
+
+/* CRC RevEng: arbitrary-precision CRC calculator and algorithm finder
+ * Copyright (C) 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018,
+ * 2019, 2020, 2021, 2022  Gregory Cook
+ *
+ * This file is part of CRC RevEng.
+ *
+ * CRC RevEng is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * CRC RevEng is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with CRC RevEng.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/* 2026-10-14: started ocl.c, trial division on an OpenCL device
+ */
+
+/* The functions in this file are only compiled in full if OPENCL is
+ * defined, by `make opencl'.  Elsewhere oclopen() always reports no
+ * device and reveng() searches on the host alone.
+ *
+ * The device holds the GCD of the differences as 32-bit words, first
+ * term in the top bit of the first word, and divides it by a run of
+ * trial factors per work item.  A trial factor of flen terms, with its
+ * top term chopped as in a poly_t divisor, is held in a ulong with its
+ * first term in bit flen - 1, so trial factors of up to 64 terms can
+ * be offloaded.  The trial factors of a launch are given as the even
+ * factor preceding each chunk of per odd factors; work item i divides
+ * by odd factor i % per after chunk i / per.  Each item sets one byte
+ * of the result, nonzero if its factor divides the GCD, and everything
+ * else is left to the host.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#ifdef OPENCL
+#  define CL_TARGET_OPENCL_VERSION 120
+#  ifdef __APPLE__
+#    include <OpenCL/opencl.h>
+#  else
+#    include <CL/cl.h>
+#  endif
+#endif /* OPENCL */
+
+#include "reveng.h"
+
+#ifdef OPENCL
+
+/* Work items per launch, at most, to keep under watchdog timeouts */
+#define OCL_MAXN 4194304UL
+
+struct ocl {
+	cl_context context;
+	cl_command_queue queue;
+	cl_program program;
+	cl_kernel kernel;
+	cl_mem work;		/* GCD words */
+	cl_mem base;		/* chunk bases of the launch */
+	cl_mem hits;		/* result bytes of the launch */
+	unsigned long nbase;	/* capacity of base, in chunks */
+	unsigned long nhits;	/* capacity of hits, in bytes */
+	cl_ulong *starts;	/* host copy of base */
+};
+
+static const char oclsrc[] =
+	"__kernel void\n"
+	"ocltry(__global const uint *work, const uint words, const uint tail,\n"
+	"	const uint flen, __global const ulong *base, const uint per,\n"
+	"	__global uchar *hits) {\n"
+	"	const size_t id = get_global_id(0);\n"
+	"	const ulong f = base[id / per] + 2UL * (id % per) + 1UL;\n"
+	"	const ulong mask = flen < 64U ? (1UL << flen) - 1UL : ~0UL;\n"
+	"	const uint sh = flen - 1U;\n"
+	"	ulong reg = 0UL;\n"
+	"	uint w, b, bits, word;\n"
+	"\n"
+	"	for(w = 0U; w < words; ++w) {\n"
+	"		word = work[w];\n"
+	"		bits = w + 1U < words ? 32U : tail;\n"
+	"		for(b = 0U; b < bits; ++b) {\n"
+	"			const ulong top = reg >> sh;\n"
+	"			reg = ((reg << 1) | (ulong) (word >> (31U - b) & 1U)) & mask;\n"
+	"			reg ^= f & (0UL - top);\n"
+	"		}\n"
+	"	}\n"
+	"	hits[id] = reg == 0UL;\n"
+	"}\n";
+
+static void oclrel(ocl_t *ocl);
+
+ocl_t *
+oclopen(const poly_t pwork, unsigned long flen) {
+	/* Prepares the first OpenCL device found to divide pwork by
+	 * trial factors of flen terms.  Returns NULL if there is no
+	 * device, if it cannot be set up, or if flen is out of range.
+	 * pwork must be CLEAN.
+	 */
+	ocl_t *ocl;
+	cl_platform_id platform;
+	cl_device_id device;
+	cl_uint nplat = 0U, *words, nw, tail, len = (cl_uint) flen;
+	cl_int err;
+	const char *src = oclsrc;
+	unsigned long nwords, iter;
+
+	if(!flen || flen > 64UL || !plen(pwork))
+		return(NULL);
+	if(clGetPlatformIDs(1, &platform, &nplat) != CL_SUCCESS || !nplat)
+		return(NULL);
+	if(clGetDeviceIDs(platform, CL_DEVICE_TYPE_GPU, 1, &device, NULL) != CL_SUCCESS
+		&& clGetDeviceIDs(platform, CL_DEVICE_TYPE_ALL, 1, &device, NULL) != CL_SUCCESS)
+		return(NULL);
+	if(!(ocl = (ocl_t *) calloc(1, sizeof(ocl_t))))
+		return(NULL);
+
+	/* pack the GCD into words, first term highest */
+	nwords = (plen(pwork) + 31UL) >> 5;
+	tail = (cl_uint) (plen(pwork) - ((nwords - 1UL) << 5));
+	if(!(words = (cl_uint *) calloc(nwords, sizeof(cl_uint)))) {
+		free(ocl);
+		return(NULL);
+	}
+	for(iter = 0UL; iter < plen(pwork); ++iter)
+		if(pcoeff(pwork, iter))
+			words[iter >> 5] |= (cl_uint) 1U << (31 - (iter & 31UL));
+
+	ocl->context = clCreateContext(NULL, 1, &device, NULL, NULL, &err);
+	if(err != CL_SUCCESS)
+		goto ofail;
+	ocl->queue = clCreateCommandQueue(ocl->context, device, 0, &err);
+	if(err != CL_SUCCESS)
+		goto ofail;
+	ocl->program = clCreateProgramWithSource(ocl->context, 1, &src, NULL, &err);
+	if(err != CL_SUCCESS
+		|| clBuildProgram(ocl->program, 1, &device, NULL, NULL, NULL) != CL_SUCCESS)
+		goto ofail;
+	ocl->kernel = clCreateKernel(ocl->program, "ocltry", &err);
+	if(err != CL_SUCCESS)
+		goto ofail;
+	ocl->work = clCreateBuffer(ocl->context, CL_MEM_READ_ONLY | CL_MEM_COPY_HOST_PTR,
+		nwords * sizeof(cl_uint), words, &err);
+	if(err != CL_SUCCESS)
+		goto ofail;
+	free(words);
+	nw = (cl_uint) nwords;
+	if(clSetKernelArg(ocl->kernel, 0, sizeof(cl_mem), &ocl->work) != CL_SUCCESS
+		|| clSetKernelArg(ocl->kernel, 1, sizeof(cl_uint), &nw) != CL_SUCCESS
+		|| clSetKernelArg(ocl->kernel, 2, sizeof(cl_uint), &tail) != CL_SUCCESS
+		|| clSetKernelArg(ocl->kernel, 3, sizeof(cl_uint), &len) != CL_SUCCESS) {
+		oclrel(ocl);
+		return(NULL);
+	}
+	return(ocl);
+
+ofail:
+	free(words);
+	oclrel(ocl);
+	return(NULL);
+}
+
+int
+ocldiv(ocl_t *ocl, const poly_t *starts, unsigned long count, unsigned long per, unsigned char *hits) {
+	/* Divides the GCD by the per odd trial factors following each
+	 * of the count even factors in starts, on the device, and sets
+	 * hits[i * per + j] nonzero if factor j after starts[i] divides
+	 * it.  Returns nonzero if the device fails.
+	 * The polys in starts must have the length passed to oclopen().
+	 */
+	cl_int err;
+	cl_uint cper = (cl_uint) per;
+	unsigned long iter, tidx, step, total = count * per;
+	size_t global;
+
+	if(!count)
+		return(0);
+	if(!per || per > OCL_MAXN)
+		return(1);
+	if(count > (step = OCL_MAXN / per)) {
+		/* launch in parts small enough for the device */
+		for(iter = 0UL; iter < count; iter += step)
+			if(ocldiv(ocl, starts + iter, count - iter < step ? count - iter : step, per, hits + iter * per))
+				return(1);
+		return(0);
+	}
+
+	if(count > ocl->nbase) {
+		if(ocl->base)
+			clReleaseMemObject(ocl->base);
+		free(ocl->starts);
+		ocl->base = NULL;
+		ocl->nbase = 0UL;
+		if(!(ocl->starts = (cl_ulong *) malloc(count * sizeof(cl_ulong))))
+			return(1);
+		ocl->base = clCreateBuffer(ocl->context, CL_MEM_READ_ONLY, count * sizeof(cl_ulong), NULL, &err);
+		if(err != CL_SUCCESS) {
+			ocl->base = NULL;
+			return(1);
+		}
+		ocl->nbase = count;
+	}
+	if(total > ocl->nhits) {
+		if(ocl->hits)
+			clReleaseMemObject(ocl->hits);
+		ocl->hits = NULL;
+		ocl->nhits = 0UL;
+		ocl->hits = clCreateBuffer(ocl->context, CL_MEM_WRITE_ONLY, total, NULL, &err);
+		if(err != CL_SUCCESS) {
+			ocl->hits = NULL;
+			return(1);
+		}
+		ocl->nhits = total;
+	}
+	for(iter = 0UL; iter < count; ++iter) {
+		ocl->starts[iter] = 0U;
+		for(tidx = 0UL; tidx < plen(starts[iter]); ++tidx)
+			ocl->starts[iter] = ocl->starts[iter] << 1 | (cl_ulong) pcoeff(starts[iter], tidx);
+	}
+	global = (size_t) total;
+	return(clEnqueueWriteBuffer(ocl->queue, ocl->base, CL_TRUE, 0, count * sizeof(cl_ulong), ocl->starts, 0, NULL, NULL) != CL_SUCCESS
+		|| clSetKernelArg(ocl->kernel, 4, sizeof(cl_mem), &ocl->base) != CL_SUCCESS
+		|| clSetKernelArg(ocl->kernel, 5, sizeof(cl_uint), &cper) != CL_SUCCESS
+		|| clSetKernelArg(ocl->kernel, 6, sizeof(cl_mem), &ocl->hits) != CL_SUCCESS
+		|| clEnqueueNDRangeKernel(ocl->queue, ocl->kernel, 1, NULL, &global, NULL, 0, NULL, NULL) != CL_SUCCESS
+		|| clEnqueueReadBuffer(ocl->queue, ocl->hits, CL_TRUE, 0, total, hits, 0, NULL, NULL) != CL_SUCCESS);
+}
+
+void
+oclfree(ocl_t *ocl) {
+	/* Releases the device prepared by oclopen(), if any. */
+	if(ocl)
+		oclrel(ocl);
+}
+
+static void
+oclrel(ocl_t *ocl) {
+	/* Releases what oclopen() and ocldiv() have set up in ocl,
+	 * and ocl itself.
+	 */
+	if(ocl->hits)
+		clReleaseMemObject(ocl->hits);
+	if(ocl->base)
+		clReleaseMemObject(ocl->base);
+	if(ocl->work)
+		clReleaseMemObject(ocl->work);
+	if(ocl->kernel)
+		clReleaseKernel(ocl->kernel);
+	if(ocl->program)
+		clReleaseProgram(ocl->program);
+	if(ocl->queue)
+		clReleaseCommandQueue(ocl->queue);
+	if(ocl->context)
+		clReleaseContext(ocl->context);
+	free(ocl->starts);
+	free(ocl);
+}
+
+#else
+
+ocl_t *
+oclopen(const poly_t pwork, unsigned long flen) {
+	/* Without OPENCL there is no device. */
+	return(NULL);
+}
+
+int
+ocldiv(ocl_t *ocl, const poly_t *starts, unsigned long count, unsigned long per, unsigned char *hits) {
+	/* Without OPENCL the device always fails. */
+	return(1);
+}
+
+void
+oclfree(ocl_t *ocl) {
+	/* Without OPENCL there is nothing to release. */
+}
+
+#endif /* OPENCL */
@@ -22,7 +22,24 @@
  * along with CRC RevEng.  If not, see <https://www.gnu.org/licenses/>.
  */
 
-/* 2021-12-24: added pcoeff()
+/* 2026-10-14: added plopen(), pmalloc() and co., a ledger of storage
+ *	       freed when reveng() traps an error
+ * 2026-10-14: primitives counted in the profile build
+ * 2026-10-14: added ptosize(), ptostrto(), hex into caller's buffer,
+ *	       whole words at a time
+ * 2026-10-14: added pmul(), pfactor(), factorisation over GF(2)
+ * 2026-10-14: added pxpow(), pcomb(), CRC of catenated messages
+ * 2026-10-14: added ptrinit(), ptrupdate(), LSB-first engine for octets
+ * 2026-10-14: prev(), prevch() reverse whole words in parallel
+ * 2026-10-14: wide divisors divide a byte at a time by table
+ * 2026-10-14: added ptbake(), engine from precomputed tables
+ * 2026-10-14: added ptbegin(), ptupdate(), ptfinal(), incremental CRC
+ * 2026-10-14: added buftop(), reads binary data from memory
+ * 2026-10-14: added pcrcto(); pbdiv() takes work storage
+ * 2026-10-14: added pbdiv(), bit-sliced trial division
+ * 2026-10-14: ptcrc() folds long messages with carry-less multiply
+ * 2026-10-14: added table-driven CRC engine ptinit(), ptcrc(), ptfree()
+ * 2021-12-24: added pcoeff()
  * 2019-11-07: reviewed poly class defs and function entry conditions
  * 2019-04-29: added quotient argument to pcrc(), pmod()
  * 2017-11-28: added braces, redundant statement skipped in prev()
@@ -87,11 +104,66 @@
 #include <limits.h>
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
+#ifdef THREADS
+#  include <pthread.h>
+#endif /* THREADS */
 #include "reveng.h"
 
+/* A ledger of storage, holding each block allocated through it and
+ * not yet freed in an open-addressed table.
+ */
+struct plog {
+	struct plog *outer;	/* ledger in use when this one was opened */
+	void **slots;		/* table of blocks, NULL where empty */
+	unsigned long size;	/* number of slots, zero or a power of two */
+	unsigned long count;	/* number of blocks held */
+#ifdef THREADS
+	pthread_mutex_t lock;	/* guards slots, size and count */
+#endif /* THREADS */
+};
+
+#ifdef THREADS
+#  define PLLOCK(log) pthread_mutex_lock(&(log)->lock)
+#  define PLUNLOCK(log) pthread_mutex_unlock(&(log)->lock)
+#else
+#  define PLLOCK(log)
+#  define PLUNLOCK(log)
+#endif /* THREADS */
+
 static bmp_t getwrd(const poly_t poly, unsigned long iter);
 static bmp_t rev(bmp_t accu, int bits);
+static bmp_t revgrp(bmp_t accu, int bits);
+static poly_t tbcrc(const poly_t message, const ptab_t *tab, const poly_t init, const poly_t xorout, int flags);
+static void twinit(ptab_t *tab);
+static poly_t twcrc(const poly_t message, const ptab_t *tab, const poly_t init, int flags);
 static void prhex(char **spp, bmp_t bits, int flags, int bperhx);
+static unsigned long pxsize(const poly_t poly, int flags, int bperhx, unsigned long *start, unsigned long *end);
+static char *pxsubsto(char *string, const poly_t poly, int flags, int bperhx, unsigned long start, unsigned long end);
+static void pclear(poly_t *poly, unsigned long length);
+static poly_t pmulm(const poly_t a, const poly_t b, const poly_t divisor);
+static void plead(poly_t *poly);
+static poly_t pfred(const poly_t a, const poly_t f);
+static poly_t pfsqr(const poly_t a, const poly_t f);
+static void pfadd(poly_t *a, const poly_t b);
+static poly_t pfgcd(const poly_t a, const poly_t b);
+static void pfedf(poly_t **dest, unsigned long *count, poly_t *rest, const poly_t g, unsigned long deg, unsigned long *seed);
+static void pfpush(poly_t **dest, unsigned long *count, const poly_t factor);
+static plog_t *plwho(const void *block);
+static unsigned long plhash(const plog_t *log, const void *block);
+static unsigned long plfind(const plog_t *log, const void *block);
+static int plgrow(plog_t *log, unsigned long count);
+static void plput(plog_t *log, void *block);
+static void pldel(plog_t *log, const void *block);
+#ifdef THREADS
+static void plinit(void);
+
+static pthread_key_t plkey;	/* ledger of each thread */
+static pthread_once_t plonce = PTHREAD_ONCE_INIT;
+static int plkok = 0;		/* nonzero if plkey was created */
+#else
+static plog_t *plcur = NULL;	/* ledger in use */
+#endif /* THREADS */
 
 static const poly_t pzero = PZERO;
 
@@ -130,6 +202,15 @@ static const poly_t pzero = PZERO;
 #  define LOFS(var) ((int) ((var) % BMP_BIT))
 #endif
 
+/* most words in each entry of a wide remainder table */
+#define TWSIZE 32UL
+
+/* shortest message for which pcrc() builds a wide remainder table */
+#define TWMIN 8192UL
+
+/* fewest words that prev() and prevch() offer to clmrev() */
+#define RVMIN 1024UL
+
 poly_t
 filtop(FILE *input, unsigned long length, int flags, int bperhx) {
 	/* reads binary data from input into a poly_t until EOF or until
@@ -183,6 +264,82 @@ filtop(FILE *input, unsigned long length, int flags, int bperhx) {
 	return(poly);
 }
 
+poly_t
+buftop(const unsigned char *buffer, unsigned long count, int flags, int bperhx) {
+	/* reads binary data from count characters at buffer into a
+	 * poly_t, exactly as filtop() would read the same characters
+	 * from a file.  A trailing group of fewer than
+	 * ceil(bperhx / CHAR_BIT) characters is ignored.  When bperhx
+	 * is 8 and P_REFIN is clear, whole words are assembled at a time.
+	 * The returned poly_t is CLEAN.
+	 */
+
+	bmp_t accu = BMP_C(0);
+	bmp_t mask = bperhx == BMP_BIT ? ~BMP_C(0) : (BMP_C(1) << bperhx) - BMP_C(1);
+	unsigned long length, iter, idx, words;
+	int cmask = ~(~0 << CHAR_BIT), c;
+	int step, count_c, ofs, j;
+	poly_t poly = PZERO;
+	if(bperhx <= 0 || bperhx > BMP_BIT) return(poly);
+
+	step = (bperhx + CHAR_BIT - 1) / CHAR_BIT;
+	length = count / step;
+	if(length > ~0UL / (unsigned long) bperhx)
+		length = ~0UL / (unsigned long) bperhx;
+	length *= (unsigned long) bperhx;
+	palloc(&poly, length); /* >= 0 */
+
+	if(bperhx == 8 && CHAR_BIT == 8 && !(BMP_BIT & 31) && ~flags & P_REFIN) {
+		/* one octet per character, first octet most significant.
+		 * Each 32-bit group is loaded big-endian, which compilers
+		 * turn into a word load and a byte swap.
+		 */
+		words = length / BMP_BIT;
+		for(idx = 0UL; idx < words; ++idx) {
+			accu = BMP_C(0);
+			for(j = 0; j < BMP_BIT; j += 32, buffer += 4)
+				accu = (accu << 16 << 16)
+					| (bmp_t) buffer[0] << 24 | (bmp_t) buffer[1] << 16
+					| (bmp_t) buffer[2] << 8 | (bmp_t) buffer[3];
+			poly.bitmap[idx] = accu;
+		}
+		if((iter = length % BMP_BIT)) {
+			accu = BMP_C(0);
+			for(j = 0; j < (int) iter; j += 8)
+				accu = (accu << 8) | (bmp_t) *buffer++;
+			poly.bitmap[idx] = accu << (BMP_BIT - (int) iter);
+		}
+		return(poly);
+	}
+
+	for(iter = 0UL, count_c = 0; iter < length; ++buffer) {
+		c = *buffer;
+		if(flags & P_LTLBYT)
+			accu |= (bmp_t) (c & cmask) << count_c;
+		else
+			accu = (accu << CHAR_BIT) | (bmp_t) (c & cmask);
+		count_c += CHAR_BIT;
+		if(count_c >= bperhx) {
+			/* the low bperhx bits of accu contain bits of the poly.*/
+			iter += bperhx;
+			count_c = 0;
+			if(flags & P_REFIN)
+				accu = rev(accu, bperhx);
+			accu &= mask;
+
+			/* iter >= bperhx > 0 */
+			idx = IDX(iter - 1UL);
+			ofs = OFS(iter - 1UL);
+			poly.bitmap[idx] |= accu << ofs;
+			if(ofs + bperhx > BMP_BIT) {
+				poly.bitmap[idx-1] |= accu >> (BMP_BIT - ofs);
+			}
+			accu = BMP_C(0); /* only needed for P_LTLBYT */
+		}
+	}
+	return(poly);
+}
+
 poly_t
 strtop(const char *string, int flags, int bperhx) {
 	/* Converts a hex or character string to a poly_t.
@@ -320,6 +477,30 @@ ptostr(const poly_t poly, int flags, int bperhx) {
 	return(pxsubs(poly, flags, bperhx, 0UL, poly.length));
 }
 
+unsigned long
+ptosize(const poly_t poly, int flags, int bperhx) {
+	/* Returns the number of characters, including the trailing
+	 * null, that ptostrto() writes for poly, or 0 if bperhx is out
+	 * of range.
+	 */
+	unsigned long start = 0UL, end = poly.length;
+
+	return(pxsize(poly, flags, bperhx, &start, &end));
+}
+
+char *
+ptostrto(char *dest, const poly_t poly, int flags, int bperhx) {
+	/* As ptostr(), but writes the string into dest, which must
+	 * have room for ptosize() characters, and returns a pointer to
+	 * its trailing null, or NULL if bperhx is out of range.
+	 */
+	unsigned long start = 0UL, end = poly.length;
+
+	if(!pxsize(poly, flags, bperhx, &start, &end))
+		return(NULL);
+	return(pxsubsto(dest, poly, flags, bperhx, start, end));
+}
+
 char *
 pxsubs(const poly_t poly, int flags, int bperhx, unsigned long start, unsigned long end) {
 	/* Returns a malloc()-ed string containing a hexadecimal
@@ -334,61 +515,14 @@ pxsubs(const poly_t poly, int flags, int bperhx, unsigned long start, unsigned l
 	 * If end exceeds the length of poly then zero bits are appended
 	 * to make up the difference, in which case poly must be CLEAN.
 	 */
-	char *string, *sptr;
-	unsigned long size, iter;
-	bmp_t accu;
-	bmp_t mask = bperhx == BMP_BIT ? ~BMP_C(0) : (BMP_C(1) << bperhx) - BMP_C(1);
-	int cperhx, part;
-
-	if(bperhx <= 0 || bperhx > BMP_BIT) return(NULL);
-
-	if(start > poly.length) start = poly.length;
-	if(end > poly.length) end = poly.length;
-	if(end < start) end = start;
-
-	cperhx = (bperhx + 3) >> 2;
-	if(flags & P_SPACE) ++cperhx;
-
-	size = (end - start + bperhx - 1UL) / bperhx;
-	size *= cperhx;
-	if(!size || ~flags & P_SPACE) ++size; /* for trailing null */
+	char *string;
+	unsigned long size;
 
-	if(!(sptr = string = (char *) malloc(size)))
+	if(!(size = pxsize(poly, flags, bperhx, &start, &end)))
+		return(NULL);
+	if(!(string = (char *) pmalloc(size)))
 		uerror("cannot allocate memory for string");
-
-	size = end - start;
-	part = (int) size % bperhx;
-	if(part && flags & P_RTJUST) {
-		iter = start + part;
-		accu = getwrd(poly, iter - 1UL) & ((BMP_C(1) << part) - BMP_C(1));
-		if(flags & P_REFOUT)
-			/* best to reverse over bperhx rather than part, I think
-			 * e.g. converting a 7-bit poly to 8-bit little-endian hex
-			 */
-			accu = rev(accu, bperhx);
-		prhex(&sptr, accu, flags, bperhx);
-		if(flags & P_SPACE && size > iter) *sptr++ = ' ';
-	} else {
-		iter = start;
-	}
-
-	while((iter+=bperhx) <= end) {
-		accu = getwrd(poly, iter - 1UL) & mask;
-		if(flags & P_REFOUT)
-			accu = rev(accu, bperhx);
-		prhex(&sptr, accu, flags, bperhx);
-		if(flags & P_SPACE && size > iter) *sptr++ = ' ';
-	}
-
-	if(part && ~flags & P_RTJUST) {
-		accu = getwrd(poly, end - 1UL);
-		if(flags & P_REFOUT)
-			accu = rev(accu, part);
-		else
-			accu = accu << (bperhx - part) & mask;
-		prhex(&sptr, accu, flags, bperhx);
-	}
-	*sptr = '\0';
+	pxsubsto(string, poly, flags, bperhx, start, end);
 	return(string);
 }
 
@@ -654,6 +788,8 @@ pshift(poly_t *dest, const poly_t src, unsigned long head, unsigned long start,
 	 */
 
 	unsigned long length, fulllength, size, fullsize, iter, idx, datidx;
+	PF_BEGIN;
+
 	/* condition inputs; end, head and tail may be any value */
 	if(end < start) end = start;
 
@@ -708,6 +844,7 @@ pshift(poly_t *dest, const poly_t src, unsigned long head, unsigned long start,
 	/* call praloc to shrink poly if required */
 	if(dest->length > fulllength)
 		praloc(dest, fulllength);
+	PF_END(PF_PSHIFT, end - start, 0);
 }
 
 void
@@ -726,6 +863,8 @@ ppaste(poly_t *dest, const poly_t src, unsigned long skip, unsigned long seek, u
 	bmp_t mask;
 	unsigned long seekidx, endidx, iter;
 	int seekofs;
+	PF_BEGIN;
+
 	if(end < seek) end = seek;
 	if(fulllength < end) fulllength = end;
 
@@ -768,6 +907,7 @@ ppaste(poly_t *dest, const poly_t src, unsigned long skip, unsigned long seek, u
 	/* shrink poly if required */
 	if(dest->length > fulllength)
 		praloc(dest, fulllength);
+	PF_END(PF_PPASTE, end - seek, 0);
 }
 
 void
@@ -788,6 +928,7 @@ psum(poly_t *dest, const poly_t src, unsigned long ofs) {
 	 * src and dest must be CLEAN.
 	 */
 	unsigned long fulllength, idx, iter, end;
+	PF_BEGIN;
 
 	fulllength = ofs + src.length;
 	if(fulllength > dest->length)
@@ -800,6 +941,7 @@ psum(poly_t *dest, const poly_t src, unsigned long ofs) {
 	end = BMP_BIT - 1UL + src.length;
 	for(; iter < end; iter += BMP_BIT, ++idx)
 		dest->bitmap[idx] ^= getwrd(src, iter);
+	PF_END(PF_PSUM, src.length, 0);
 }
 
 void
@@ -807,9 +949,8 @@ prev(poly_t *poly) {
 	/* Reverse or reciprocate a polynomial.
 	 * On exit, poly is CLEAN.
 	 */
-	unsigned long leftidx = 0UL, rightidx = SIZE(poly->length);
+	unsigned long leftidx = 0UL, rightidx = SIZE(poly->length), size = rightidx;
 	unsigned long ofs = LOFS(BMP_BIT - LOFS(poly->length));
-	unsigned long fulllength = poly->length + ofs;
 	bmp_t accu;
 
 	if(ofs) {
@@ -818,21 +959,32 @@ prev(poly_t *poly) {
 			*poly->bitmap = rev(*poly->bitmap >> ofs, (int) poly->length) << ofs;
 			return;
 		}
-
-		/* claim remaining bits of last word (as we use public function pshift()) */
-		poly->length = fulllength;
+		/* the unused bits of the last word are cleared */
+		poly->bitmap[size - 1UL] &= ~BMP_C(0) << ofs;
 	}
 
 	/* reverse and swap words in the array, leaving it right-justified */
-	while(leftidx < rightidx) {
+	if(BMP_SUB << 1 == BMP_BIT && size >= RVMIN) {
+		/* long polys are swapped, then reversed in place */
+		while(leftidx < rightidx) {
+			accu = poly->bitmap[--rightidx];
+			poly->bitmap[rightidx] = poly->bitmap[leftidx];
+			poly->bitmap[leftidx++] = accu;
+		}
+		for(leftidx = clmrev(poly->bitmap, size, BMP_BIT); leftidx < size; ++leftidx)
+			poly->bitmap[leftidx] = revgrp(poly->bitmap[leftidx], BMP_BIT);
+	} else while(leftidx < rightidx) {
 		/* rightidx > 0 */
 		accu = rev(poly->bitmap[--rightidx], BMP_BIT);
 		poly->bitmap[rightidx] = rev(poly->bitmap[leftidx], BMP_BIT);
 		poly->bitmap[leftidx++] = accu;
 	}
 	/* shift polynomial to left edge if required */
-	if(ofs)
-		pshift(poly, *poly, 0UL, ofs, fulllength, 0UL);
+	if(ofs) {
+		for(leftidx = 0UL; leftidx + 1UL < size; ++leftidx)
+			poly->bitmap[leftidx] = poly->bitmap[leftidx] << ofs | poly->bitmap[leftidx + 1UL] >> (BMP_BIT - ofs);
+		poly->bitmap[leftidx] <<= ofs;
+	}
 }
 
 void
@@ -847,6 +999,16 @@ prevch(poly_t *poly, int bperhx) {
 		return;
 	if(poly->length % bperhx)
 		praloc(poly, bperhx - (poly->length % bperhx) + poly->length);
+	/* groups of a power of two bits lie within words, and
+	 * are reversed a word at a time
+	 */
+	if(BMP_SUB << 1 == BMP_BIT && !(bperhx & (bperhx - 1))) {
+		ofs = SIZE(poly->length);
+		idx = ofs >= RVMIN ? clmrev(poly->bitmap, ofs, bperhx) : 0UL;
+		for(; idx < ofs; ++idx)
+			poly->bitmap[idx] = revgrp(poly->bitmap[idx], bperhx);
+		return;
+	}
 	mask = ~BMP_C(0) >> (BMP_BIT - bperhx);
 	for(iter = (unsigned long) (bperhx - 1); iter < poly->length; iter += bperhx) {
 		accu = getwrd(*poly, iter) & mask;
@@ -933,17 +1095,33 @@ pcrc(const poly_t message, const poly_t divisor, const poly_t init, const poly_t
 	 * If all inputs are CLEAN then the returned poly_t is CLEAN.
 	 * On exit, quotient is CLEAN unless it is NULL.
 	 */
+	poly_t result = PZERO;
+
+	pcrcto(&result, message, divisor, init, xorout, flags, quotient);
+	return(result);
+}
+
+void
+pcrcto(poly_t *dest, const poly_t message, const poly_t divisor, const poly_t init, const poly_t xorout, int flags, poly_t *quotient) {
+	/* As pcrc(), but places the remainder in dest, reusing its
+	 * storage, and reuses the storage of quotient.  dest and
+	 * quotient must not be any of the other arguments.  A single
+	 * word remainder, and a quotient of unchanging length, do not
+	 * reallocate their storage.
+	 */
 	unsigned long max = 0UL, iter, ofs, resiter;
 	bmp_t probe, rem, dvsr, quot = BMP_C(0), *qptr, *rptr, *sptr;
 	const bmp_t *bptr, *eptr;
-	poly_t result = PZERO;
+	poly_t result = *dest;
+	ptab_t tab = PTZERO;
+	PF_BEGIN;
 
 	if(flags & P_MULXN)
 		max = message.length;
 	else if(message.length > divisor.length)
 		max = message.length - divisor.length;
 	if(quotient)
-		palloc(quotient, max);
+		pclear(quotient, max);
 	bptr=message.bitmap;
 	eptr=message.bitmap+SIZE(message.length);
 	qptr=quotient ? quotient->bitmap : NULL;
@@ -988,17 +1166,28 @@ pcrc(const poly_t message, const poly_t divisor, const poly_t init, const poly_t
 			/* max < message.length */
 			rem ^= *bptr >> OFS(BMP_BIT - 1UL + max);
 		if(init.length > max && init.length - max > divisor.length) {
-			palloc(&result, init.length - max);
+			praloc(&result, init.length - max);
 			*result.bitmap = rem;
 		} else if(divisor.length) {
-			palloc(&result, divisor.length);
+			praloc(&result, divisor.length);
 			*result.bitmap = rem;
-		}
+		} else
+			praloc(&result, 0UL);
+	} else if(!qptr && !(BMP_BIT & 7) && max >= TWMIN
+		&& init.length <= divisor.length
+		&& SIZE(divisor.length) <= TWSIZE) {
+		/* long message, wide divisor: a table built for this
+		 * call pays for itself
+		 */
+		ptinit(&tab, divisor);
+		pfree(&result);
+		result = twcrc(message, &tab, init, flags);
+		ptfree(&tab);
 	} else {
 		/* allocate maximum size plus one word for shifted divisors and one word containing zero.
 		 * This also ensures that result[1] exists
 		 */
-		palloc(&result, (init.length > divisor.length ? init.length : divisor.length) + (unsigned long) (BMP_BIT << 1));
+		pclear(&result, (init.length > divisor.length ? init.length : divisor.length) + (unsigned long) (BMP_BIT << 1));
 		/*if there is content in init, there will be an extra word in result to clear it */
 		psum(&result, init, 0UL);
 		if(max)
@@ -1039,9 +1228,214 @@ pcrc(const poly_t message, const poly_t divisor, const poly_t init, const poly_t
 		pshift(&result, result, 0UL, ofs, (init.length > max + divisor.length ? init.length - max - divisor.length : 0UL) + divisor.length + ofs, 0UL);
 	}
 	psum(&result, xorout, 0UL);
+	*dest = result;
+	PF_END(PF_PCRC, message.length, 0);
+}
+
+poly_t
+pxpow(unsigned long power, const poly_t divisor) {
+	/* Returns x^power modulo divisor, a chopped generator
+	 * polynomial (see pcrc()), as a remainder of the same length.
+	 * The power is built by repeated squaring, one term of power at
+	 * a time, so the work grows with the number of bits in power
+	 * and not with power itself.
+	 * divisor must be CLEAN.  The returned poly_t is CLEAN.
+	 */
+	poly_t result = PZERO, step = PZERO, next;
+	unsigned long dlen = divisor.length, probe = ~(~0UL >> 1);
+
+	if(!dlen)
+		return(result);
+	/* result = 1 */
+	palloc(&result, dlen);
+	result.bitmap[IDX(dlen - 1UL)] |= BMP_C(1) << OFS(dlen - 1UL);
+	palloc(&step, dlen + 1UL);
+	for(; probe; probe >>= 1) {
+		if(ptst(result)) {
+			next = pmulm(result, result, divisor);
+			pfree(&result);
+			result = next;
+		}
+		if(power & probe) {
+			/* multiply by x: divide the remainder followed by 0 */
+			pclear(&step, dlen + 1UL);
+			psum(&step, result, 0UL);
+			pcrcto(&result, step, divisor, pzero, pzero, 0, NULL);
+		}
+	}
+	pfree(&step);
+	return(result);
+}
+
+poly_t
+pcomb(const poly_t crca, const poly_t crcb, unsigned long lenb, const poly_t divisor, const poly_t init, const poly_t xorout) {
+	/* Returns the CRC of message A followed by message B, given
+	 * crca, the CRC of A, crcb, the CRC of B, and lenb, the number
+	 * of terms in B.  The CRCs are as pcrc() returns them with
+	 * divisor, init, xorout and P_MULXN set in flags, before any
+	 * reflection of the result; neither message is needed.  As
+	 *   crc(A.B) = crc(B) + (crc(A) + xorout + init) * x^lenb,
+	 * the cost is that of pxpow(), whatever the lengths of A and B.
+	 * All inputs must be CLEAN.  The returned poly_t is CLEAN.
+	 */
+	poly_t reg = PZERO, xpow, result;
+
+	palloc(&reg, divisor.length);
+	psum(&reg, crca, 0UL);
+	psum(&reg, xorout, 0UL);
+	psum(&reg, init, 0UL);
+	praloc(&reg, divisor.length);
+	xpow = pxpow(lenb, divisor);
+	result = pmulm(reg, xpow, divisor);
+	psum(&result, crcb, 0UL);
+	praloc(&result, divisor.length);
+	pfree(&xpow);
+	pfree(&reg);
 	return(result);
 }
 
+poly_t
+pmul(const poly_t a, const poly_t b) {
+	/* Returns the product of a and b, of plen(a) + plen(b) - 1
+	 * terms, or the empty poly if either is empty.
+	 * a and b must be CLEAN.  The returned poly_t is CLEAN.
+	 */
+	poly_t prod = PZERO;
+	unsigned long iter;
+
+	if(!a.length || !b.length)
+		return(prod);
+	palloc(&prod, a.length + b.length - 1UL);
+	for(iter = 0UL; iter < a.length; ++iter)
+		if(pcoeff(a, iter))
+			psum(&prod, b, iter);
+	return(prod);
+}
+
+unsigned long
+pfactor(poly_t **dest, const poly_t poly, unsigned long maxdeg) {
+	/* Factorises poly over GF(2), finding its irreducible factors
+	 * of degree maxdeg or less.  Places in *dest a new array of
+	 * the factors, each repeated as often as it divides poly, in
+	 * order of degree with equal factors adjacent, and returns
+	 * their number.  Factors of degree d are the divisors of
+	 * x^(2^d) + x not removed at a lower degree (distinct degree
+	 * factorisation); where several share a degree they are split
+	 * by the trace map (equal degree factorisation), from a fixed
+	 * sequence of trial polys.  The work grows with maxdeg and
+	 * with the square of the length of poly.
+	 * poly must be NORMALISED, and so has no factor x.  On exit
+	 * the factors are NORMALISED.  *dest is NULL if there are none.
+	 */
+	poly_t rest = pclone(poly), xpow = PZERO, term = PZERO, next, gcd;
+	unsigned long count = 0UL, seed = 1UL, deg;
+
+	*dest = NULL;
+	if(plen(rest) < 2UL) {
+		pfree(&rest);
+		return(0UL);
+	}
+	/* term = x; xpow = x mod rest */
+	palloc(&term, 2UL);
+	*term.bitmap = ~(~BMP_C(0) >> 1);
+	xpow = pfred(term, rest);
+	for(deg = 1UL; deg <= maxdeg && plen(rest) > deg << 1; ++deg) {
+		/* xpow = x^(2^deg) mod rest */
+		next = pfsqr(xpow, rest);
+		pfree(&xpow);
+		xpow = next;
+		next = pclone(xpow);
+		pfadd(&next, term);
+		gcd = pfgcd(rest, next);
+		pfree(&next);
+		if(plen(gcd) > 1UL) {
+			/* gcd is the product of the factors of degree deg */
+			pfedf(dest, &count, &rest, gcd, deg, &seed);
+			next = pfred(xpow, rest);
+			pfree(&xpow);
+			xpow = next;
+		}
+		pfree(&gcd);
+	}
+	/* the factors left are longer than deg terms, so if rest is
+	 * shorter than deg << 1 terms it is irreducible
+	 */
+	if(plen(rest) > 1UL && plen(rest) - 1UL <= maxdeg)
+		pfpush(dest, &count, rest);
+	pfree(&term);
+	pfree(&xpow);
+	pfree(&rest);
+	return(count);
+}
+
+bmp_t
+pbdiv(const poly_t dividend, const poly_t divisor, unsigned long lanes, poly_t *work) {
+	/* Divides dividend by lanes chopped generator polynomials at
+	 * once, one in each bit of a bmp_t.  Lane j (bit j, from the
+	 * least significant) divides by divisor with its + 1 term set
+	 * and the next log2(lanes) terms replaced by the binary value
+	 * of j, i.e. by the jth of lanes consecutive odd polynomials.
+	 * Returns a mask with bit j set if lane j divides dividend.
+	 * lanes must be a power of two no greater than BMP_BIT, and
+	 * plen(divisor) > log2(lanes).
+	 * The register slices form a ring, so the terms are never
+	 * shifted; the taps are doubled up to be indexed from the
+	 * ring's head.
+	 * The registers are kept in the storage of work, which the
+	 * caller frees, or if work is NULL in temporary storage.
+	 */
+	unsigned long len = divisor.length, iter, head = 0UL, k, p;
+	bmp_t *reg, *taps, *tptr, top, word = BMP_C(0), probe = BMP_C(0), nz = BMP_C(0), lbit;
+	const bmp_t *bptr = dividend.bitmap;
+	poly_t temp = PZERO;
+	PF_BEGIN;
+
+	if(!work)
+		work = &temp;
+	praloc(work, 3UL * len * BMP_BIT);
+	reg = work->bitmap;
+	taps = reg + len;
+
+	/* taps[k] holds the coefficient of x^(len-1-k) in each lane */
+	for(k = 0UL; k < len; ++k) {
+		reg[k] = BMP_C(0);
+		taps[k] = pcoeff(divisor, k) ? ~BMP_C(0) : BMP_C(0);
+	}
+	taps[len - 1UL] = ~BMP_C(0);
+	for(p = 1UL; (1UL << p) <= lanes; ++p) {
+		for(k = 0UL, lbit = BMP_C(0); k < lanes; ++k)
+			if(k & (1UL << (p - 1UL)))
+				lbit |= BMP_C(1) << k;
+		taps[len - 1UL - p] = lbit;
+	}
+	for(k = 0UL; k < len; ++k)
+		taps[len + k] = taps[k];
+
+	/* Feed each term of dividend through the registers, highest first */
+	for(iter = 0UL; iter < dividend.length; ++iter, probe >>= 1) {
+		if(!probe) {
+			probe = ~(~BMP_C(0) >> 1);
+			word = *bptr++;
+		}
+		top = reg[head] ^ ((word & probe) ? ~BMP_C(0) : BMP_C(0));
+		reg[head] = BMP_C(0);
+		if(++head == len)
+			head = 0UL;
+		/* slot k now holds the term of x^(len-1-((k-head) mod len)) */
+		tptr = taps + len - head;
+		for(k = 0UL; k < len; ++k)
+			reg[k] ^= top & tptr[k];
+	}
+	for(k = 0UL; k < len; ++k)
+		nz |= reg[k];
+	pfree(&temp);
+
+	if(lanes < (unsigned long) BMP_BIT)
+		nz |= ~BMP_C(0) << lanes;
+	PF_END(PF_PBDIV, dividend.length, 0);
+	return(~nz);
+}
+
 int
 piter(poly_t *poly) {
 	/* Replace poly with the 'next' polynomial of equal length.
@@ -1059,6 +1453,286 @@ piter(poly_t *poly) {
 	return(*bptr != BMP_C(0));
 }
 
+void
+ptinit(ptab_t *tab, const poly_t divisor) {
+	/* Prepares tab to calculate CRCs with divisor, a chopped
+	 * generator polynomial (see pcrc()).  A table of the remainders
+	 * of each byte value is built so that ptcrc() can divide a byte
+	 * at a time.  Each remainder takes one bitmap word, or as many
+	 * as divisor needs if it is wider; above TWSIZE words ptcrc()
+	 * defers to pcrc().  If CLMUL is defined and the
+	 * processor can multiply carry-less, folding constants are
+	 * also computed for long messages.
+	 * tab must equal PTZERO or have been prepared by ptinit().
+	 * divisor must be CLEAN.
+	 */
+	bmp_t accu, dvsr, probe = ~(~BMP_C(0) >> 1);
+	int i, j;
+#ifdef CLMUL
+	/* powers of x to reduce, see clmul.c */
+	static const unsigned long kexp[8] = {
+		512UL, 576UL, 384UL, 448UL, 256UL, 320UL, 128UL, 192UL
+	};
+	poly_t xpow = PZERO, rem;
+#endif /* CLMUL */
+
+	pcpy(&tab->divisor, divisor);
+	pmfree(tab->store);
+	pmfree(tab->rtable);
+	tab->table = tab->keys = tab->store = tab->rtable = NULL;
+	if(BMP_BIT & 7)
+		return;
+	if(divisor.length > (unsigned long) BMP_BIT) {
+		twinit(tab);
+		return;
+	}
+	if(!(tab->store = (bmp_t *) pmalloc((256 + 8) * sizeof(bmp_t))))
+		uerror("cannot allocate memory for CRC table");
+	dvsr = divisor.length ? *divisor.bitmap : BMP_C(0);
+	for(i = 0; i < 256; ++i) {
+		accu = (bmp_t) i << (BMP_BIT - 8);
+		for(j = 0; j < 8; ++j)
+			accu = (accu & probe) ? (accu << 1) ^ dvsr : accu << 1;
+		tab->store[i] = accu;
+	}
+	tab->table = tab->store;
+
+#ifdef CLMUL
+	if(BMP_BIT != 64 || !divisor.length || !clmcpu())
+		return;
+	for(i = 0; i < 8; ++i) {
+		/* x^kexp[i] mod the generator, right-justified */
+		palloc(&xpow, kexp[i] + 1UL);
+		*xpow.bitmap = probe;
+		rem = pcrc(xpow, divisor, pzero, pzero, 0, NULL);
+		tab->store[256 + i] = *rem.bitmap >> (BMP_BIT - divisor.length);
+		pfree(&rem);
+	}
+	pfree(&xpow);
+	tab->keys = tab->store + 256;
+#endif /* CLMUL */
+}
+
+void
+ptbake(ptab_t *tab, const poly_t divisor, const bmp_t *table, const bmp_t *keys) {
+	/* As ptinit(), but uses a remainder table and folding
+	 * constants computed in advance, as by relink.pl for the
+	 * presets.  table and keys are not copied and must outlive
+	 * tab.  divisor must fit in one bitmap word and be CLEAN.
+	 */
+	pcpy(&tab->divisor, divisor);
+	pmfree(tab->store);
+	pmfree(tab->rtable);
+	tab->store = tab->rtable = NULL;
+	tab->table = table;
+	tab->keys = NULL;
+#ifdef CLMUL
+	if(BMP_BIT == 64 && divisor.length && clmcpu())
+		tab->keys = keys;
+#endif /* CLMUL */
+}
+
+void
+ptfree(ptab_t *tab) {
+	/* Frees the divisor and tables of tab and sets tab equal to
+	 * PTZERO.
+	 */
+	pfree(&tab->divisor);
+	pmfree(tab->store);
+	pmfree(tab->rtable);
+	tab->table = tab->keys = tab->store = tab->rtable = NULL;
+}
+
+poly_t
+ptcrc(const poly_t message, const ptab_t *tab, const poly_t init, const poly_t xorout, int flags) {
+	/* Equivalent to pcrc(message, tab->divisor, init, xorout, flags,
+	 * NULL), but divides a byte at a time if tab has a table and
+	 * init fits in one bitmap word or, for a wide divisor, is no
+	 * longer than the divisor, which is no longer than the message.
+	 * All inputs must be CLEAN.
+	 * If all inputs are CLEAN then the returned poly_t is CLEAN.
+	 */
+	poly_t result;
+#ifdef CLMUL
+	poly_t fold, tail, rem;
+	bmp_t words[2];
+	unsigned long count;
+#endif /* CLMUL */
+	PF_BEGIN;
+
+#ifdef CLMUL
+	if(tab->keys && init.length <= (unsigned long) BMP_BIT
+		&& message.length > (unsigned long) BMP_BIT << 5) {
+		/* Fold all but the last word, in blocks of eight words,
+		 * into a remainder that stands in for init on the rest.
+		 * fold and tail are views into storage not obtained
+		 * from palloc() and must not be freed.
+		 */
+		count = (message.length / BMP_BIT - 1UL) & ~7UL;
+		clmfld(words, tab->keys, message.bitmap, count, init.length ? *init.bitmap : BMP_C(0));
+		fold.length = (unsigned long) BMP_BIT << 1;
+		fold.bitmap = words;
+		rem = tbcrc(fold, tab, pzero, pzero, P_MULXN);
+		tail.length = message.length - count * BMP_BIT;
+		tail.bitmap = message.bitmap + count;
+		result = tbcrc(tail, tab, rem, xorout, flags);
+		pfree(&rem);
+		PF_END(PF_PTCRC, message.length, 0);
+		return(result);
+	}
+#endif /* CLMUL */
+	result = tbcrc(message, tab, init, xorout, flags);
+	PF_END(PF_PTCRC, message.length, 0);
+	return(result);
+}
+
+void
+ptbegin(pstrm_t *strm, const ptab_t *tab, const poly_t init, int flags) {
+	/* Starts an incremental CRC calculation in strm, using the
+	 * engine in tab, init and flags as ptcrc() would.  The message
+	 * is then passed to ptupdate() in consecutive chunks and the
+	 * CRC is obtained from ptfinal().  strm references tab, which
+	 * must outlive the calculation.
+	 * strm must equal PSZERO or have been finished by ptfinal().
+	 * init must be CLEAN.
+	 */
+	strm->tab = tab;
+	pcpy(&strm->reg, init);
+	praloc(&strm->hold, 0UL);
+	strm->flags = flags;
+	/* a reflected, augmenting CRC can take octets as they are */
+	strm->refl = tab->rtable && flags & P_REFIN && flags & P_MULXN
+		&& init.length == tab->divisor.length;
+	strm->rreg = strm->refl ? rev(*init.bitmap >> (BMP_BIT - init.length), (int) init.length) : BMP_C(0);
+}
+
+void
+ptupdate(pstrm_t *strm, const poly_t chunk) {
+	/* Appends chunk to the message of strm.  The chunks may have
+	 * any length.  Storage held by strm does not grow with the
+	 * message; unless P_MULXN is set, the last terms, as many as
+	 * the divisor has, are held back until ptfinal().
+	 * chunk must be CLEAN.
+	 */
+	poly_t reg, view;
+	unsigned long dlen = strm->tab->divisor.length, lead, idx, size;
+
+	if(strm->refl) {
+		/* bring the register back into MSB-first form */
+		*strm->reg.bitmap = rev(strm->rreg, (int) dlen) << (BMP_BIT - dlen);
+		strm->refl = 0;
+	}
+	if(strm->flags & P_MULXN) {
+		reg = ptcrc(chunk, strm->tab, strm->reg, pzero, P_MULXN);
+		pfree(&strm->reg);
+		strm->reg = reg;
+		return;
+	}
+	psum(&strm->hold, chunk, strm->hold.length);
+	if(strm->hold.length <= dlen || strm->hold.length - dlen < (unsigned long) BMP_BIT)
+		return;
+	/* divide the whole words before the last dlen terms.
+	 * view points into hold and must not be freed.
+	 */
+	lead = (strm->hold.length - dlen) / BMP_BIT;
+	view.length = lead * BMP_BIT;
+	view.bitmap = strm->hold.bitmap;
+	reg = ptcrc(view, strm->tab, strm->reg, pzero, P_MULXN);
+	pfree(&strm->reg);
+	strm->reg = reg;
+	size = SIZE(strm->hold.length);
+	for(idx = 0UL; idx + lead < size; ++idx)
+		strm->hold.bitmap[idx] = strm->hold.bitmap[idx + lead];
+	praloc(&strm->hold, strm->hold.length - view.length);
+}
+
+poly_t
+ptfinal(pstrm_t *strm, const poly_t xorout) {
+	/* Returns the CRC of the message passed to ptupdate() since
+	 * ptbegin(), after adding xorout, and frees the storage of
+	 * strm.  The result equals that of ptcrc() on the whole
+	 * message.
+	 * xorout must be CLEAN.
+	 */
+	poly_t result;
+
+	if(strm->refl) {
+		*strm->reg.bitmap = rev(strm->rreg, (int) strm->reg.length) << (BMP_BIT - strm->reg.length);
+		strm->refl = 0;
+	}
+	result = ptcrc(strm->hold, strm->tab, strm->reg, xorout, strm->flags);
+	pfree(&strm->reg);
+	pfree(&strm->hold);
+	return(result);
+}
+
+void
+ptrinit(ptab_t *tab) {
+	/* Adds to tab, prepared by ptinit() or ptbake(), the tables
+	 * ptrupdate() needs to calculate reflected CRCs LSB first,
+	 * one for each octet of a bitmap word.  Table k holds the
+	 * reflected remainder of each octet followed by k zero octets.
+	 * Does nothing unless the divisor fits in one bitmap word.
+	 */
+	const unsigned long slice = (unsigned long) BMP_BIT >> 3, dlen = tab->divisor.length;
+	unsigned long i, k;
+	bmp_t rdvsr, accu;
+	int j;
+
+	if(tab->rtable || BMP_BIT & 7 || !dlen || dlen > (unsigned long) BMP_BIT)
+		return;
+	if(!(tab->rtable = (bmp_t *) pmalloc((slice << 8) * sizeof(bmp_t))))
+		uerror("cannot allocate memory for CRC table");
+	rdvsr = rev(*tab->divisor.bitmap >> (BMP_BIT - dlen), (int) dlen);
+	for(i = 0UL; i < 256UL; ++i) {
+		accu = (bmp_t) i;
+		for(j = 0; j < 8; ++j)
+			accu = (accu & BMP_C(1)) ? (accu >> 1) ^ rdvsr : accu >> 1;
+		tab->rtable[i] = accu;
+	}
+	for(k = 1UL; k < slice; ++k)
+		for(i = 0UL; i < 256UL; ++i) {
+			accu = tab->rtable[((k - 1UL) << 8) + i];
+			tab->rtable[(k << 8) + i] = (accu >> 8) ^ tab->rtable[accu & 0xff];
+		}
+}
+
+void
+ptrupdate(pstrm_t *strm, const unsigned char *buffer, unsigned long count) {
+	/* Appends count octets at buffer to the message of strm, as
+	 * ptupdate(strm, buftop(buffer, count, strm->flags, 8)) would.
+	 * If the model is reflected and augmenting and the engine was
+	 * extended by ptrinit(), the CRC is calculated LSB first on the
+	 * octets as they are, a bitmap word of octets at a time, and
+	 * the data are never reflected.
+	 */
+	const unsigned long slice = (unsigned long) BMP_BIT >> 3;
+	const bmp_t *const rtab = strm->tab->rtable;
+	bmp_t reg = strm->rreg, accu;
+	unsigned long k;
+	poly_t chunk;
+
+	if(!strm->refl) {
+		chunk = buftop(buffer, count, strm->flags, 8);
+		ptupdate(strm, chunk);
+		pfree(&chunk);
+		return;
+	}
+	/* the first octet of each word meets the low end of the
+	 * register, and passes the most zero octets
+	 */
+	for(; count >= slice; count -= slice, buffer += slice) {
+		for(k = 0UL; k < slice; ++k)
+			reg ^= (bmp_t) (buffer[k] & 0xff) << (k << 3);
+		for(accu = BMP_C(0), k = 0UL; k < slice; ++k)
+			accu ^= rtab[((slice - 1UL - k) << 8) + (reg >> (k << 3) & 0xff)];
+		reg = accu;
+	}
+	for(; count; --count)
+		reg = (reg >> 8) ^ rtab[(reg ^ *buffer++) & 0xff];
+	strm->rreg = reg;
+}
+
 void
 palloc(poly_t *poly, unsigned long length) {
 	/* Replaces poly with a CLEAN object of the specified length,
@@ -1068,18 +1742,23 @@ palloc(poly_t *poly, unsigned long length) {
 	 * On exit, poly is CLEAN.
 	 */
 	unsigned long size = SIZE(length);
+	PF_BEGIN;
 
 	poly->length = 0UL;
-	free(poly->bitmap);
+	pmfree(poly->bitmap);
 	poly->bitmap = NULL;
-	if(!length) return;
+	if(!length) {
+		PF_END(PF_PALLOC, 0, 0);
+		return;
+	}
 	if(!size)
 		size = IDX(length) + 1UL;
-	poly->bitmap = (bmp_t *) calloc(size, sizeof(bmp_t));
+	poly->bitmap = (bmp_t *) pcalloc(size, sizeof(bmp_t));
 	if(poly->bitmap) {
 		poly->length = length;
 	} else
 		uerror("cannot allocate memory for poly");
+	PF_END(PF_PALLOC, length, size * sizeof(bmp_t));
 }
 
 void
@@ -1092,7 +1771,7 @@ pfree(poly_t *poly) {
 	/* palloc(poly, 0UL); */
 
 	poly->length = 0UL;
-	free(poly->bitmap);
+	pmfree(poly->bitmap);
 	poly->bitmap = NULL;
 }
 
@@ -1102,12 +1781,18 @@ praloc(poly_t *poly, unsigned long length) {
 	 * zeroes if necessary.
 	 * On exit, poly is CLEAN.
 	 */
-	unsigned long oldsize, size = SIZE(length);
-	if(!poly) return;
+	unsigned long oldsize, iter, size = SIZE(length);
+	PF_BEGIN;
+
+	if(!poly) {
+		PF_END(PF_PRALOC, 0, 0);
+		return;
+	}
 	if(!length) {
 		poly->length = 0UL;
-		free(poly->bitmap);
+		pmfree(poly->bitmap);
 		poly->bitmap = NULL;
+		PF_END(PF_PRALOC, 0, 0);
 		return;
 	}
 	if(!size)
@@ -1117,7 +1802,7 @@ praloc(poly_t *poly, unsigned long length) {
 	oldsize = SIZE(poly->length);
 	if(oldsize != size)
 		/* reallocate if array pointer is null or array resized */
-		poly->bitmap = (bmp_t *) realloc((void *)poly->bitmap, size * sizeof(bmp_t));
+		poly->bitmap = (bmp_t *) prealloc((void *)poly->bitmap, size * sizeof(bmp_t));
 	if(poly->bitmap) {
 		if(poly->length < length) {
 			/* poly->length >= 0, length > 0, size > 0.
@@ -1125,8 +1810,8 @@ praloc(poly_t *poly, unsigned long length) {
 			 */
 			if(LOFS(poly->length))
 				poly->bitmap[oldsize - 1UL] &= ~(~BMP_C(0) >> LOFS(poly->length));
-			while(oldsize < size)
-				poly->bitmap[oldsize++] = BMP_C(0);
+			for(iter = oldsize; iter < size; ++iter)
+				poly->bitmap[iter] = BMP_C(0);
 		} else if(LOFS(length))
 			/* poly->length >= length > 0.
 			 * poly shrunk. clear new last word
@@ -1135,6 +1820,7 @@ praloc(poly_t *poly, unsigned long length) {
 		poly->length = length;
 	} else
 		uerror("cannot reallocate memory for poly");
+	PF_END(PF_PRALOC, length, oldsize != size ? size * sizeof(bmp_t) : 0UL);
 }
 
 int
@@ -1174,8 +1860,363 @@ pcoeff(const poly_t poly, unsigned long idx) {
 	return((int) (getwrd(poly, idx) & BMP_C(1)));
 }
 
+plog_t *
+plopen(void) {
+	/* Opens a ledger and makes it that of the calling thread, in
+	 * front of the one in use, which plclose() restores.  Until
+	 * then pmalloc(), pcalloc() and prealloc() enter each new
+	 * block in it, and pmfree() strikes each block it frees from
+	 * it or from the ledgers behind it.  Returns NULL if there is
+	 * no memory.
+	 */
+	plog_t *log;
+
+	if(!(log = (plog_t *) malloc(sizeof(plog_t))))
+		return(NULL);
+	log->outer = plget();
+	log->slots = NULL;
+	log->size = log->count = 0UL;
+#ifdef THREADS
+	if(pthread_mutex_init(&log->lock, NULL)) {
+		free(log);
+		return(NULL);
+	}
+#endif /* THREADS */
+	plset(log);
+	return(log);
+}
+
+void
+plclose(plog_t *log, int drop) {
+	/* Closes log and makes the ledger behind it that of the
+	 * calling thread.  If drop is nonzero, every block still held
+	 * in log is freed.  Otherwise the blocks pass to the ledger
+	 * behind, or are forgotten if there is none or no memory to
+	 * hold them.  No other thread may be using log.
+	 */
+	plog_t *outer;
+	unsigned long i;
+
+	if(!log)
+		return;
+	outer = log->outer;
+	if(drop) {
+		for(i = 0UL; i < log->size; ++i)
+			free(log->slots[i]);
+	} else if(outer && log->count) {
+		PLLOCK(outer);
+		if(plgrow(outer, outer->count + log->count))
+			for(i = 0UL; i < log->size; ++i)
+				if(log->slots[i])
+					plput(outer, log->slots[i]);
+		PLUNLOCK(outer);
+	}
+	free(log->slots);
+#ifdef THREADS
+	pthread_mutex_destroy(&log->lock);
+#endif /* THREADS */
+	free(log);
+	plset(outer);
+}
+
+plog_t *
+plget(void) {
+	/* Returns the ledger of the calling thread, or NULL. */
+#ifdef THREADS
+	if(pthread_once(&plonce, plinit) || !plkok)
+		return(NULL);
+	return((plog_t *) pthread_getspecific(plkey));
+#else
+	return(plcur);
+#endif /* THREADS */
+}
+
+void
+plset(plog_t *log) {
+	/* Makes log, which may be NULL, the ledger of the calling
+	 * thread, so that a search worker enters its blocks in the
+	 * ledger of the call it serves.
+	 */
+#ifdef THREADS
+	if(!pthread_once(&plonce, plinit) && plkok)
+		pthread_setspecific(plkey, log);
+#else
+	plcur = log;
+#endif /* THREADS */
+}
+
+void
+plkeep(const void *block) {
+	/* Strikes block, which may be NULL, from the ledger holding it
+	 * without freeing it, so that it outlives the ledger.
+	 */
+	plog_t *log;
+
+	if(block && (log = plwho(block))) {
+		pldel(log, block);
+		PLUNLOCK(log);
+	}
+}
+
+void *
+pmalloc(size_t size) {
+	/* As malloc(), entering the block in the calling thread's
+	 * ledger, if any.
+	 */
+	return(prealloc(NULL, size));
+}
+
+void *
+pcalloc(size_t count, size_t size) {
+	/* As calloc(), entering the block in the calling thread's
+	 * ledger, if any.
+	 */
+	plog_t *log;
+	void *block = NULL;
+
+	if(!(log = plwho(NULL)))
+		return(calloc(count, size));
+	if(plgrow(log, log->count + 1UL) && (block = calloc(count, size)))
+		plput(log, block);
+	PLUNLOCK(log);
+	return(block);
+}
+
+void *
+prealloc(void *block, size_t size) {
+	/* As realloc().  A new block is entered in the calling
+	 * thread's ledger, if any; a block held in a ledger is
+	 * replaced there by its new address.  Storage that was not
+	 * entered stays out.  Returns NULL, leaving block as it was,
+	 * if there is no memory.
+	 */
+	plog_t *log;
+	void *next = NULL;
+
+	if(!(log = plwho(block)))
+		return(realloc(block, size));
+	if(plgrow(log, log->count + 1UL)) {
+		if(block)
+			pldel(log, block);
+		if((next = realloc(block, size)))
+			plput(log, next);
+		else if(block)
+			plput(log, block);
+	}
+	PLUNLOCK(log);
+	return(next);
+}
+
+void
+pmfree(void *block) {
+	/* As free(), striking block from the ledger holding it. */
+	plkeep(block);
+	free(block);
+}
+
 /* Private functions */
 
+static void
+pclear(poly_t *poly, unsigned long length) {
+	/* Sets poly to length zero terms, reusing its storage if it
+	 * is the right size.
+	 * On exit, poly is CLEAN.
+	 */
+	unsigned long idx;
+
+	praloc(poly, length);
+	for(idx = 0UL; idx < SIZE(length); ++idx)
+		poly->bitmap[idx] = BMP_C(0);
+}
+
+static poly_t
+pmulm(const poly_t a, const poly_t b, const poly_t divisor) {
+	/* Returns the product of a and b modulo divisor, a chopped
+	 * generator polynomial (see pcrc()).  a and b are remainders
+	 * as long as divisor.  The product is formed by shifting and
+	 * adding b, then divided by pcrc() as pmod() does.
+	 * All inputs must be CLEAN.  The returned poly_t is CLEAN.
+	 */
+	poly_t prod = PZERO, result;
+	unsigned long dlen = divisor.length, iter;
+
+	if(!dlen)
+		return(prod);
+	palloc(&prod, (dlen << 1) - 1UL);
+	for(iter = 0UL; iter < dlen && iter < a.length; ++iter)
+		if(pcoeff(a, iter))
+			psum(&prod, b, iter);
+	praloc(&prod, (dlen << 1) - 1UL);
+	result = pcrc(prod, divisor, pzero, pzero, 0, NULL);
+	pfree(&prod);
+	return(result);
+}
+
+static void
+plead(poly_t *poly) {
+	/* Removes the leading zero terms of poly, leaving the trailing
+	 * ones, so that its value is unchanged.
+	 * poly must be CLEAN.
+	 */
+	unsigned long first = pfirst(*poly);
+	poly_t sub;
+
+	if(!first)
+		return;
+	sub = psubs(*poly, 0UL, first, poly->length, 0UL);
+	pfree(poly);
+	*poly = sub;
+}
+
+static poly_t
+pfred(const poly_t a, const poly_t f) {
+	/* Returns a modulo f, without leading zeroes, for pfactor().
+	 * a must be CLEAN and f NORMALISED.
+	 */
+	poly_t rem;
+
+	if(plen(a) < plen(f))
+		rem = pclone(a);
+	else
+		rem = pmod(a, f, NULL);
+	plead(&rem);
+	return(rem);
+}
+
+static poly_t
+pfsqr(const poly_t a, const poly_t f) {
+	/* Returns the square of a modulo f.  Over GF(2) the square has
+	 * the terms of a spread out, term i going to term 2i.
+	 * a must be CLEAN and without leading zeroes, f NORMALISED.
+	 */
+	poly_t sq = PZERO, rem;
+	unsigned long iter;
+
+	if(!a.length)
+		return(sq);
+	palloc(&sq, (a.length << 1) - 1UL);
+	for(iter = 0UL; iter < a.length; ++iter)
+		if(pcoeff(a, iter))
+			sq.bitmap[IDX(iter << 1)] |= BMP_C(1) << OFS(iter << 1);
+	rem = pfred(sq, f);
+	pfree(&sq);
+	return(rem);
+}
+
+static void
+pfadd(poly_t *a, const poly_t b) {
+	/* Adds b to a, least significant terms aligned.
+	 * a and b must be CLEAN.
+	 */
+	poly_t sum;
+
+	if(plen(*a) >= plen(b))
+		psum(a, b, plen(*a) - plen(b));
+	else {
+		sum = pclone(b);
+		psum(&sum, *a, plen(b) - plen(*a));
+		pfree(a);
+		*a = sum;
+	}
+}
+
+static poly_t
+pfgcd(const poly_t a, const poly_t b) {
+	/* Returns the greatest common divisor of a and b, NORMALISED.
+	 * As pnorm() removes factors of x, one of a and b must have
+	 * a + 1 term.  a and b must be CLEAN.
+	 */
+	poly_t u = pclone(a), v = pclone(b), rem;
+
+	pnorm(&u);
+	pnorm(&v);
+	if(plen(u) < plen(v)) {
+		rem = u;
+		u = v;
+		v = rem;
+	}
+	while(plen(v)) {
+		/* plen(u) >= plen(v), as pmod() requires */
+		rem = pmod(u, v, NULL);
+		pnorm(&rem);
+		pfree(&u);
+		u = v;
+		v = rem;
+	}
+	return(u);
+}
+
+static void
+pfedf(poly_t **dest, unsigned long *count, poly_t *rest, const poly_t g, unsigned long deg, unsigned long *seed) {
+	/* Splits g, a product of distinct irreducible factors of deg
+	 * degrees, for pfactor().  Each factor is added to *dest as
+	 * often as it divides *rest, and divided out of *rest.  A
+	 * trial poly a taken from *seed maps under
+	 *   T(a) = a + a^2 + a^4 + ... + a^(2^(deg-1))  mod g
+	 * to 0 modulo some of the factors and 1 modulo the others,
+	 * so gcd(g, T(a)) divides g about half the time.
+	 */
+	poly_t trial = PZERO, trace, power, next, part, cof = PZERO, rem;
+	unsigned long iter, j;
+
+	if(plen(g) - 1UL == deg) {
+		/* g is irreducible */
+		for(;;) {
+			rem = pmod(*rest, g, &cof);
+			iter = ptst(rem);
+			pfree(&rem);
+			if(iter)
+				break;
+			pnorm(&cof);
+			pfree(rest);
+			*rest = cof;
+			cof = pzero;
+			pfpush(dest, count, g);
+		}
+		pfree(&cof);
+		return;
+	}
+	for(;;) {
+		palloc(&trial, plen(g) - 1UL);
+		for(iter = 0UL; iter < trial.length; ++iter) {
+			*seed = (*seed * 69069UL + 1UL) & 0xffffffffUL;
+			if(*seed & 0x80000000UL)
+				trial.bitmap[IDX(iter)] |= BMP_C(1) << OFS(iter);
+		}
+		plead(&trial);
+		trace = pclone(trial);
+		power = pclone(trial);
+		for(j = 1UL; j < deg; ++j) {
+			next = pfsqr(power, g);
+			pfree(&power);
+			power = next;
+			pfadd(&trace, power);
+		}
+		pfree(&power);
+		part = pfgcd(g, trace);
+		pfree(&trace);
+		if(plen(part) > 1UL && plen(part) < plen(g))
+			break;
+		pfree(&part);
+	}
+	pfree(&trial);
+	rem = pmod(g, part, &cof);
+	pfree(&rem);
+	pnorm(&cof);
+	pfedf(dest, count, rest, part, deg, seed);
+	pfedf(dest, count, rest, cof, deg, seed);
+	pfree(&part);
+	pfree(&cof);
+}
+
+static void
+pfpush(poly_t **dest, unsigned long *count, const poly_t factor) {
+	/* Appends a copy of factor to the array *dest of *count polys. */
+	if(!(*dest = (poly_t *) prealloc(*dest, (*count + 1UL) * sizeof(poly_t))))
+		uerror("cannot reallocate factor list");
+	(*dest)[(*count)++] = pclone(factor);
+}
+
 static bmp_t
 getwrd(const poly_t poly, unsigned long iter) {
 	/* Fetch unaligned word from poly where LSB of result is
@@ -1187,6 +2228,7 @@ getwrd(const poly_t poly, unsigned long iter) {
 	bmp_t accu = BMP_C(0);
 	unsigned long idx, size;
 	int ofs;
+	PF_BEGIN;
 
 	idx = IDX(iter);
 	ofs = OFS(iter);
@@ -1196,9 +2238,149 @@ getwrd(const poly_t poly, unsigned long iter) {
 		accu |= poly.bitmap[idx] >> ofs;
 	if(idx && idx <= size && ofs > 0)
 		accu |= poly.bitmap[idx - 1UL] << (BMP_BIT - ofs);
+	PF_END(PF_GETWRD, BMP_BIT, 0);
 	return(accu);
 }
 
+static poly_t
+tbcrc(const poly_t message, const ptab_t *tab, const poly_t init, const poly_t xorout, int flags) {
+	/* Table-driven division for ptcrc(), which see. */
+	unsigned long max = 0UL, iter, dlen = tab->divisor.length;
+	bmp_t rem, dvsr, probe = ~(~BMP_C(0) >> 1);
+	const bmp_t *bptr = message.bitmap, *eptr = message.bitmap + SIZE(message.length);
+	const bmp_t *const table = tab->table;
+	poly_t result = PZERO;
+	int ofs;
+
+	if(table && dlen > (unsigned long) BMP_BIT && init.length <= dlen
+		&& (flags & P_MULXN || message.length >= dlen)) {
+		result = twcrc(message, tab, init, flags);
+		psum(&result, xorout, 0UL);
+		return(result);
+	}
+	if(!table || dlen > (unsigned long) BMP_BIT || init.length > (unsigned long) BMP_BIT)
+		return(pcrc(message, tab->divisor, init, xorout, flags, NULL));
+
+	if(flags & P_MULXN)
+		max = message.length;
+	else if(message.length > dlen)
+		max = message.length - dlen;
+	rem = init.length ? *init.bitmap : BMP_C(0);
+	dvsr = dlen ? *tab->divisor.bitmap : BMP_C(0);
+
+	/* as pcrc(), each message word is added to the register as
+	 * its first bit is reached
+	 */
+	for(iter = max; iter >= (unsigned long) BMP_BIT; iter -= BMP_BIT) {
+		rem ^= *bptr++;
+		for(ofs = BMP_BIT; ofs; ofs -= 8)
+			rem = (rem << 8) ^ table[rem >> (BMP_BIT - 8)];
+	}
+	if(iter) {
+		/* 0 < iter < BMP_BIT */
+		rem ^= *bptr++;
+		for(; iter >= 8UL; iter -= 8UL)
+			rem = (rem << 8) ^ table[rem >> (BMP_BIT - 8)];
+		for(; iter; --iter)
+			rem = (rem & probe) ? (rem << 1) ^ dvsr : rem << 1;
+	}
+	if(bptr < eptr)
+		/* max < message.length */
+		rem ^= *bptr >> OFS(BMP_BIT - 1UL + max);
+	if(init.length > max && init.length - max > dlen) {
+		palloc(&result, init.length - max);
+		*result.bitmap = rem;
+	} else if(dlen) {
+		palloc(&result, dlen);
+		*result.bitmap = rem;
+	}
+	psum(&result, xorout, 0UL);
+	return(result);
+}
+
+static void
+twinit(ptab_t *tab) {
+	/* Builds the remainder table of tab for a divisor wider than
+	 * one bitmap word, SIZE(divisor.length) words per entry, if
+	 * that is at most TWSIZE.  Factored from ptinit().
+	 */
+	const unsigned long dlen = tab->divisor.length, size = SIZE(dlen);
+	const bmp_t *const dptr = tab->divisor.bitmap;
+	bmp_t *ent, probe = ~(~BMP_C(0) >> 1), top;
+	unsigned long idx;
+	int i, j;
+
+	if(size > TWSIZE)
+		return;
+	if(!(tab->store = (bmp_t *) pcalloc(size << 8, sizeof(bmp_t))))
+		uerror("cannot allocate memory for CRC table");
+	for(i = 0, ent = tab->store; i < 256; ++i, ent += size) {
+		*ent = (bmp_t) i << (BMP_BIT - 8);
+		for(j = 0; j < 8; ++j) {
+			top = *ent & probe;
+			for(idx = 0UL; idx + 1UL < size; ++idx)
+				ent[idx] = ent[idx] << 1 | ent[idx + 1UL] >> (BMP_BIT - 1);
+			ent[idx] <<= 1;
+			if(top)
+				for(idx = 0UL; idx < size; ++idx)
+					ent[idx] ^= dptr[idx];
+		}
+	}
+	tab->table = tab->store;
+}
+
+static poly_t
+twcrc(const poly_t message, const ptab_t *tab, const poly_t init, int flags) {
+	/* Table-driven division for divisors wider than one bitmap
+	 * word.  Equivalent to pcrc(message, tab->divisor, init, pzero,
+	 * flags, NULL) where tab has a table from twinit(), init is
+	 * no longer than the divisor and the message no shorter,
+	 * unless P_MULXN is set.
+	 * All inputs must be CLEAN.
+	 * If all inputs are CLEAN then the returned poly_t is CLEAN.
+	 */
+	const unsigned long dlen = tab->divisor.length, size = SIZE(dlen);
+	const bmp_t *const dptr = tab->divisor.bitmap, *ent;
+	unsigned long max = 0UL, iter, idx;
+	bmp_t *reg, probe = ~(~BMP_C(0) >> 1), top;
+	poly_t result = PZERO;
+
+	if(flags & P_MULXN)
+		max = message.length;
+	else if(message.length > dlen)
+		max = message.length - dlen;
+	palloc(&result, dlen);
+	psum(&result, init, 0UL);
+	reg = result.bitmap;
+
+	/* the register holds the remainder left-justified, so the
+	 * next byte of the message meets its leading byte
+	 */
+	for(iter = 0UL; iter + 8UL <= max; iter += 8UL) {
+		top = (*reg >> (BMP_BIT - 8) ^ message.bitmap[IDX(iter)] >> (OFS(iter) - 7)) & BMP_C(0xff);
+		for(idx = 0UL; idx + 1UL < size; ++idx)
+			reg[idx] = reg[idx] << 8 | reg[idx + 1UL] >> (BMP_BIT - 8);
+		reg[idx] <<= 8;
+		ent = tab->table + (unsigned long) top * size;
+		for(idx = 0UL; idx < size; ++idx)
+			reg[idx] ^= ent[idx];
+	}
+	for(; iter < max; ++iter) {
+		top = (*reg ^ message.bitmap[IDX(iter)] << LOFS(iter)) & probe;
+		for(idx = 0UL; idx + 1UL < size; ++idx)
+			reg[idx] = reg[idx] << 1 | reg[idx + 1UL] >> (BMP_BIT - 1);
+		reg[idx] <<= 1;
+		if(top)
+			for(idx = 0UL; idx < size; ++idx)
+				reg[idx] ^= dptr[idx];
+	}
+	/* add the last dlen terms of the message */
+	for(; iter < message.length; ++iter)
+		if(message.bitmap[IDX(iter)] >> OFS(iter) & BMP_C(1))
+			reg[IDX(iter - max)] ^= BMP_C(1) << OFS(iter - max);
+	return(result);
+}
+
 static bmp_t
 rev(bmp_t accu, int bits) {
 	/* Returns the bitmap word argument with the given number of
@@ -1248,6 +2430,113 @@ rev(bmp_t accu, int bits) {
 	return(result);
 }
 
+static bmp_t
+revgrp(bmp_t accu, int bits) {
+	/* Returns the bitmap word argument with each group of the
+	 * given number of bits reversed in place.  BMP_BIT and bits
+	 * must be powers of two, bits no greater than BMP_BIT.
+	 * Swaps the halves of every field of 2^k bits in turn, all
+	 * fields at once, down to single bits.
+	 */
+	bmp_t mask = ~BMP_C(0);
+	int shift = BMP_BIT;
+
+	while(shift >>= 1) {
+		/* mask selects the low half of each field */
+		mask ^= mask << shift;
+		if(shift < bits)
+			accu = (accu >> shift & mask) | (accu & mask) << shift;
+	}
+	return(accu);
+}
+
+static unsigned long
+pxsize(const poly_t poly, int flags, int bperhx, unsigned long *start, unsigned long *end) {
+	/* Clips *start and *end to poly for pxsubsto() and returns the
+	 * size of the string it writes, including the trailing null, or
+	 * 0 if bperhx is out of range.
+	 */
+	unsigned long size;
+	int cperhx;
+
+	if(bperhx <= 0 || bperhx > BMP_BIT) return(0UL);
+
+	if(*start > poly.length) *start = poly.length;
+	if(*end > poly.length) *end = poly.length;
+	if(*end < *start) *end = *start;
+
+	cperhx = (bperhx + 3) >> 2;
+	if(flags & P_SPACE) ++cperhx;
+
+	size = (*end - *start + bperhx - 1UL) / bperhx;
+	size *= cperhx;
+	if(!size || ~flags & P_SPACE) ++size; /* for trailing null */
+	return(size);
+}
+
+static char *
+pxsubsto(char *string, const poly_t poly, int flags, int bperhx, unsigned long start, unsigned long end) {
+	/* Writes the string of pxsubs() into string, with start and end
+	 * clipped by pxsize(), and returns a pointer to its trailing
+	 * null.  Unless spaced or reflected, whole words of hex digits
+	 * are the same as the characters read off the bitmap, so runs of
+	 * them are written BMP_BIT bits at a time.
+	 */
+	char *sptr = string;
+	unsigned long size, iter, run;
+	bmp_t accu;
+	bmp_t mask = bperhx == BMP_BIT ? ~BMP_C(0) : (BMP_C(1) << bperhx) - BMP_C(1);
+	int part;
+
+	size = end - start;
+	part = (int) size % bperhx;
+	if(part && flags & P_RTJUST) {
+		iter = start + part;
+		accu = getwrd(poly, iter - 1UL) & ((BMP_C(1) << part) - BMP_C(1));
+		if(flags & P_REFOUT)
+			/* best to reverse over bperhx rather than part, I think
+			 * e.g. converting a 7-bit poly to 8-bit little-endian hex
+			 */
+			accu = rev(accu, bperhx);
+		prhex(&sptr, accu, flags, bperhx);
+		if(flags & P_SPACE && size > iter) *sptr++ = ' ';
+	} else {
+		iter = start;
+	}
+
+	if(!(bperhx & 3) && !(flags & (P_SPACE | P_REFOUT))) {
+		/* the whole words, BMP_BIT bits at a time */
+		run = (end - iter) / bperhx * bperhx;
+		for(; run >= (unsigned long) BMP_BIT; run -= BMP_BIT) {
+			iter += BMP_BIT;
+			prhex(&sptr, getwrd(poly, iter - 1UL), flags, BMP_BIT);
+		}
+		if(run) {
+			iter += run;
+			prhex(&sptr, getwrd(poly, iter - 1UL) & ((BMP_C(1) << run) - BMP_C(1)), flags, (int) run);
+		}
+	}
+
+	while((iter+=bperhx) <= end) {
+		accu = getwrd(poly, iter - 1UL) & mask;
+		if(flags & P_REFOUT)
+			accu = rev(accu, bperhx);
+		prhex(&sptr, accu, flags, bperhx);
+		if(flags & P_SPACE && size > iter) *sptr++ = ' ';
+	}
+
+	if(part && ~flags & P_RTJUST) {
+		accu = getwrd(poly, end - 1UL);
+		if(flags & P_REFOUT)
+			accu = rev(accu, part);
+		else
+			accu = accu << (bperhx - part) & mask;
+		prhex(&sptr, accu, flags, bperhx);
+	}
+	*sptr = '\0';
+	return(sptr);
+}
+
 static void
 prhex(char **spp, bmp_t bits, int flags, int bperhx) {
 	/* Appends a hexadecimal string representing the bperhx least
@@ -1265,3 +2554,115 @@ prhex(char **spp, bmp_t bits, int flags, int bperhx) {
 		*(*spp)++ = hex[(bits >> bperhx & BMP_C(0xf)) | upper];
 	}
 }
+
+static plog_t *
+plwho(const void *block) {
+	/* Returns the ledger holding block, searching outwards from
+	 * that of the calling thread, or if block is NULL, the ledger
+	 * of the calling thread.  The ledger is returned locked.
+	 * Returns NULL if there is none.
+	 */
+	plog_t *log;
+
+	for(log = plget(); log; log = log->outer) {
+		PLLOCK(log);
+		if(!block || (log->size && log->slots[plfind(log, block)]))
+			return(log);
+		PLUNLOCK(log);
+	}
+	return(NULL);
+}
+
+static unsigned long
+plhash(const plog_t *log, const void *block) {
+	/* Returns the slot of log where a search for block begins.
+	 * C89 has no integer type sure to hold a pointer, so the
+	 * bytes of its representation are hashed.
+	 */
+	unsigned char rep[sizeof(const void *)];
+	unsigned long hash = 2166136261UL;
+	size_t i;
+
+	memcpy(rep, &block, sizeof(rep));
+	for(i = 0; i < sizeof(rep); ++i)
+		hash = ((hash ^ rep[i]) * 16777619UL) & 0xffffffffUL;
+	return((hash ^ hash >> 16) & (log->size - 1UL));
+}
+
+static unsigned long
+plfind(const plog_t *log, const void *block) {
+	/* Returns the slot of log holding block or, if block is not
+	 * held, the empty slot where it would go.  log->size > 0.
+	 */
+	unsigned long i;
+
+	for(i = plhash(log, block); log->slots[i] && log->slots[i] != block; i = (i + 1UL) & (log->size - 1UL))
+		;
+	return(i);
+}
+
+static int
+plgrow(plog_t *log, unsigned long count) {
+	/* Makes room in log for count blocks, keeping at least half of
+	 * its slots empty.  Returns zero if there is no memory.
+	 */
+	void **old = log->slots;
+	unsigned long size = log->size ? log->size : 64UL, osize = log->size, i;
+
+	while(size >> 1 < count)
+		size <<= 1;
+	if(size == osize)
+		return(1);
+	if(!(log->slots = (void **) calloc(size, sizeof(void *)))) {
+		log->slots = old;
+		return(0);
+	}
+	log->size = size;
+	for(i = 0UL; i < osize; ++i)
+		if(old[i])
+			log->slots[plfind(log, old[i])] = old[i];
+	free(old);
+	return(1);
+}
+
+static void
+plput(plog_t *log, void *block) {
+	/* Enters block in log, which has room for it. */
+	unsigned long i = plfind(log, block);
+
+	if(!log->slots[i]) {
+		log->slots[i] = block;
+		++log->count;
+	}
+}
+
+static void
+pldel(plog_t *log, const void *block) {
+	/* Strikes block from log, moving back the blocks after it so
+	 * that each can still be found from the slot it hashes to.
+	 */
+	unsigned long mask = log->size - 1UL, i, j, home;
+
+	i = plfind(log, block);
+	if(!log->slots[i])
+		return;
+	log->slots[i] = NULL;
+	--log->count;
+	for(j = (i + 1UL) & mask; log->slots[j]; j = (j + 1UL) & mask) {
+		/* leave the block at j if it hashes into (i, j] */
+		home = plhash(log, log->slots[j]);
+		if(((j - home) & mask) < ((j - i) & mask))
+			continue;
+		log->slots[i] = log->slots[j];
+		log->slots[j] = NULL;
+		i = j;
+	}
+}
+
+#ifdef THREADS
+static void
+plinit(void) {
+	/* Creates the key of each thread's ledger. */
+	plkok = !pthread_key_create(&plkey, NULL);
+}
+#endif /* THREADS */
@@ -22,7 +22,15 @@
  * along with CRC RevEng.  If not, see <https://www.gnu.org/licenses/>.
  */
 
-/* 2022-08-27: added alias CRC-16/BLUETOOTH
+/* 2026-10-14: preset index struck from the reveng() ledger when published
+ * 2026-10-14: pretst checks pfactor() against pmul()
+ * 2026-10-14: pretst checks pcomb() and pxpow() against pcrc()
+ * 2026-10-14: pretst checks streamed CRCs against ptcrc()
+ * 2026-10-14: pretst checks pbdiv() against pcrc() on each generator
+ * 2026-10-14: baked CRC tables of the presets, added mtinit()
+ * 2026-10-14: added mgroup(), presets indexed by width and reflection
+ * 2026-10-14: pretst checks the CRC engines against each preset
+ * 2022-08-27: added alias CRC-16/BLUETOOTH
  * 2022-08-24: added CRC=64/REDIS
  * 2022-05-08: added CRC-16/M17
  * 2022-01-11: added CRC-32/MEF, CRC-64/MS
@@ -76,6 +84,9 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#ifdef THREADS
+#  include <pthread.h>
+#endif /* THREADS */
 #include "reveng.h"
 
 /* Private declarations */
@@ -99,6 +110,13 @@ struct malias {
 	const struct mpreset *const model;	/* corresponding model */
 };
 
+struct mbaked {
+	const unsigned long width;		/* width of CRC algorithm */
+	const bmp_t spoly;			/* polynomial with highest-order term removed */
+	const bmp_t table[256];			/* byte-wise remainder table, as ptinit() */
+	const bmp_t keys[8];			/* folding constants, as ptinit() */
+};
+
 #ifdef PRESETS
 #  if BMP_BIT < 32
 #    error config.h: BMP_BIT must be an integer constant macro to compile presets
@@ -831,6 +849,2386 @@ static const struct malias aliases[] = {
 };
 #    define NALIASES 185
 
+/* CRC engines of the generators in models[] up to 32 bits wide,
+ * sorted by width and polynomial.
+ */
+#    define BT(x) (BMP_C(x) << (BMP_BIT - 32))
+
+/* BEGIN AUTO-GENERATED TABLES */
+static const struct mbaked baked[] = {
+	{ 3UL, BT(0x60000000), {
+		BT(0x00000000), BT(0x60000000), BT(0xc0000000), BT(0xa0000000), BT(0xe0000000), BT(0x80000000), BT(0x20000000), BT(0x40000000),
+		BT(0xa0000000), BT(0xc0000000), BT(0x60000000), BT(0x00000000), BT(0x40000000), BT(0x20000000), BT(0x80000000), BT(0xe0000000),
+		BT(0x20000000), BT(0x40000000), BT(0xe0000000), BT(0x80000000), BT(0xc0000000), BT(0xa0000000), BT(0x00000000), BT(0x60000000),
+		BT(0x80000000), BT(0xe0000000), BT(0x40000000), BT(0x20000000), BT(0x60000000), BT(0x00000000), BT(0xa0000000), BT(0xc0000000),
+		BT(0x40000000), BT(0x20000000), BT(0x80000000), BT(0xe0000000), BT(0xa0000000), BT(0xc0000000), BT(0x60000000), BT(0x00000000),
+		BT(0xe0000000), BT(0x80000000), BT(0x20000000), BT(0x40000000), BT(0x00000000), BT(0x60000000), BT(0xc0000000), BT(0xa0000000),
+		BT(0x60000000), BT(0x00000000), BT(0xa0000000), BT(0xc0000000), BT(0x80000000), BT(0xe0000000), BT(0x40000000), BT(0x20000000),
+		BT(0xc0000000), BT(0xa0000000), BT(0x00000000), BT(0x60000000), BT(0x20000000), BT(0x40000000), BT(0xe0000000), BT(0x80000000),
+		BT(0x80000000), BT(0xe0000000), BT(0x40000000), BT(0x20000000), BT(0x60000000), BT(0x00000000), BT(0xa0000000), BT(0xc0000000),
+		BT(0x20000000), BT(0x40000000), BT(0xe0000000), BT(0x80000000), BT(0xc0000000), BT(0xa0000000), BT(0x00000000), BT(0x60000000),
+		BT(0xa0000000), BT(0xc0000000), BT(0x60000000), BT(0x00000000), BT(0x40000000), BT(0x20000000), BT(0x80000000), BT(0xe0000000),
+		BT(0x00000000), BT(0x60000000), BT(0xc0000000), BT(0xa0000000), BT(0xe0000000), BT(0x80000000), BT(0x20000000), BT(0x40000000),
+		BT(0xc0000000), BT(0xa0000000), BT(0x00000000), BT(0x60000000), BT(0x20000000), BT(0x40000000), BT(0xe0000000), BT(0x80000000),
+		BT(0x60000000), BT(0x00000000), BT(0xa0000000), BT(0xc0000000), BT(0x80000000), BT(0xe0000000), BT(0x40000000), BT(0x20000000),
+		BT(0xe0000000), BT(0x80000000), BT(0x20000000), BT(0x40000000), BT(0x00000000), BT(0x60000000), BT(0xc0000000), BT(0xa0000000),
+		BT(0x40000000), BT(0x20000000), BT(0x80000000), BT(0xe0000000), BT(0xa0000000), BT(0xc0000000), BT(0x60000000), BT(0x00000000),
+		BT(0x60000000), BT(0x00000000), BT(0xa0000000), BT(0xc0000000), BT(0x80000000), BT(0xe0000000), BT(0x40000000), BT(0x20000000),
+		BT(0xc0000000), BT(0xa0000000), BT(0x00000000), BT(0x60000000), BT(0x20000000), BT(0x40000000), BT(0xe0000000), BT(0x80000000),
+		BT(0x40000000), BT(0x20000000), BT(0x80000000), BT(0xe0000000), BT(0xa0000000), BT(0xc0000000), BT(0x60000000), BT(0x00000000),
+		BT(0xe0000000), BT(0x80000000), BT(0x20000000), BT(0x40000000), BT(0x00000000), BT(0x60000000), BT(0xc0000000), BT(0xa0000000),
+		BT(0x20000000), BT(0x40000000), BT(0xe0000000), BT(0x80000000), BT(0xc0000000), BT(0xa0000000), BT(0x00000000), BT(0x60000000),
+		BT(0x80000000), BT(0xe0000000), BT(0x40000000), BT(0x20000000), BT(0x60000000), BT(0x00000000), BT(0xa0000000), BT(0xc0000000),
+		BT(0x00000000), BT(0x60000000), BT(0xc0000000), BT(0xa0000000), BT(0xe0000000), BT(0x80000000), BT(0x20000000), BT(0x40000000),
+		BT(0xa0000000), BT(0xc0000000), BT(0x60000000), BT(0x00000000), BT(0x40000000), BT(0x20000000), BT(0x80000000), BT(0xe0000000),
+		BT(0xe0000000), BT(0x80000000), BT(0x20000000), BT(0x40000000), BT(0x00000000), BT(0x60000000), BT(0xc0000000), BT(0xa0000000),
+		BT(0x40000000), BT(0x20000000), BT(0x80000000), BT(0xe0000000), BT(0xa0000000), BT(0xc0000000), BT(0x60000000), BT(0x00000000),
+		BT(0xc0000000), BT(0xa0000000), BT(0x00000000), BT(0x60000000), BT(0x20000000), BT(0x40000000), BT(0xe0000000), BT(0x80000000),
+		BT(0x60000000), BT(0x00000000), BT(0xa0000000), BT(0xc0000000), BT(0x80000000), BT(0xe0000000), BT(0x40000000), BT(0x20000000),
+		BT(0xa0000000), BT(0xc0000000), BT(0x60000000), BT(0x00000000), BT(0x40000000), BT(0x20000000), BT(0x80000000), BT(0xe0000000),
+		BT(0x00000000), BT(0x60000000), BT(0xc0000000), BT(0xa0000000), BT(0xe0000000), BT(0x80000000), BT(0x20000000), BT(0x40000000),
+		BT(0x80000000), BT(0xe0000000), BT(0x40000000), BT(0x20000000), BT(0x60000000), BT(0x00000000), BT(0xa0000000), BT(0xc0000000),
+		BT(0x20000000), BT(0x40000000), BT(0xe0000000), BT(0x80000000), BT(0xc0000000), BT(0xa0000000), BT(0x00000000), BT(0x60000000)
+	}, {
+		BMP_C(0x00000002), BMP_C(0x00000004), BMP_C(0x00000005), BMP_C(0x00000001),
+		BMP_C(0x00000006), BMP_C(0x00000007), BMP_C(0x00000004), BMP_C(0x00000003)
+	}},
+	{ 4UL, BT(0x30000000), {
+		BT(0x00000000), BT(0x30000000), BT(0x60000000), BT(0x50000000), BT(0xc0000000), BT(0xf0000000), BT(0xa0000000), BT(0x90000000),
+		BT(0xb0000000), BT(0x80000000), BT(0xd0000000), BT(0xe0000000), BT(0x70000000), BT(0x40000000), BT(0x10000000), BT(0x20000000),
+		BT(0x50000000), BT(0x60000000), BT(0x30000000), BT(0x00000000), BT(0x90000000), BT(0xa0000000), BT(0xf0000000), BT(0xc0000000),
+		BT(0xe0000000), BT(0xd0000000), BT(0x80000000), BT(0xb0000000), BT(0x20000000), BT(0x10000000), BT(0x40000000), BT(0x70000000),
+		BT(0xa0000000), BT(0x90000000), BT(0xc0000000), BT(0xf0000000), BT(0x60000000), BT(0x50000000), BT(0x00000000), BT(0x30000000),
+		BT(0x10000000), BT(0x20000000), BT(0x70000000), BT(0x40000000), BT(0xd0000000), BT(0xe0000000), BT(0xb0000000), BT(0x80000000),
+		BT(0xf0000000), BT(0xc0000000), BT(0x90000000), BT(0xa0000000), BT(0x30000000), BT(0x00000000), BT(0x50000000), BT(0x60000000),
+		BT(0x40000000), BT(0x70000000), BT(0x20000000), BT(0x10000000), BT(0x80000000), BT(0xb0000000), BT(0xe0000000), BT(0xd0000000),
+		BT(0x70000000), BT(0x40000000), BT(0x10000000), BT(0x20000000), BT(0xb0000000), BT(0x80000000), BT(0xd0000000), BT(0xe0000000),
+		BT(0xc0000000), BT(0xf0000000), BT(0xa0000000), BT(0x90000000), BT(0x00000000), BT(0x30000000), BT(0x60000000), BT(0x50000000),
+		BT(0x20000000), BT(0x10000000), BT(0x40000000), BT(0x70000000), BT(0xe0000000), BT(0xd0000000), BT(0x80000000), BT(0xb0000000),
+		BT(0x90000000), BT(0xa0000000), BT(0xf0000000), BT(0xc0000000), BT(0x50000000), BT(0x60000000), BT(0x30000000), BT(0x00000000),
+		BT(0xd0000000), BT(0xe0000000), BT(0xb0000000), BT(0x80000000), BT(0x10000000), BT(0x20000000), BT(0x70000000), BT(0x40000000),
+		BT(0x60000000), BT(0x50000000), BT(0x00000000), BT(0x30000000), BT(0xa0000000), BT(0x90000000), BT(0xc0000000), BT(0xf0000000),
+		BT(0x80000000), BT(0xb0000000), BT(0xe0000000), BT(0xd0000000), BT(0x40000000), BT(0x70000000), BT(0x20000000), BT(0x10000000),
+		BT(0x30000000), BT(0x00000000), BT(0x50000000), BT(0x60000000), BT(0xf0000000), BT(0xc0000000), BT(0x90000000), BT(0xa0000000),
+		BT(0xe0000000), BT(0xd0000000), BT(0x80000000), BT(0xb0000000), BT(0x20000000), BT(0x10000000), BT(0x40000000), BT(0x70000000),
+		BT(0x50000000), BT(0x60000000), BT(0x30000000), BT(0x00000000), BT(0x90000000), BT(0xa0000000), BT(0xf0000000), BT(0xc0000000),
+		BT(0xb0000000), BT(0x80000000), BT(0xd0000000), BT(0xe0000000), BT(0x70000000), BT(0x40000000), BT(0x10000000), BT(0x20000000),
+		BT(0x00000000), BT(0x30000000), BT(0x60000000), BT(0x50000000), BT(0xc0000000), BT(0xf0000000), BT(0xa0000000), BT(0x90000000),
+		BT(0x40000000), BT(0x70000000), BT(0x20000000), BT(0x10000000), BT(0x80000000), BT(0xb0000000), BT(0xe0000000), BT(0xd0000000),
+		BT(0xf0000000), BT(0xc0000000), BT(0x90000000), BT(0xa0000000), BT(0x30000000), BT(0x00000000), BT(0x50000000), BT(0x60000000),
+		BT(0x10000000), BT(0x20000000), BT(0x70000000), BT(0x40000000), BT(0xd0000000), BT(0xe0000000), BT(0xb0000000), BT(0x80000000),
+		BT(0xa0000000), BT(0x90000000), BT(0xc0000000), BT(0xf0000000), BT(0x60000000), BT(0x50000000), BT(0x00000000), BT(0x30000000),
+		BT(0x90000000), BT(0xa0000000), BT(0xf0000000), BT(0xc0000000), BT(0x50000000), BT(0x60000000), BT(0x30000000), BT(0x00000000),
+		BT(0x20000000), BT(0x10000000), BT(0x40000000), BT(0x70000000), BT(0xe0000000), BT(0xd0000000), BT(0x80000000), BT(0xb0000000),
+		BT(0xc0000000), BT(0xf0000000), BT(0xa0000000), BT(0x90000000), BT(0x00000000), BT(0x30000000), BT(0x60000000), BT(0x50000000),
+		BT(0x70000000), BT(0x40000000), BT(0x10000000), BT(0x20000000), BT(0xb0000000), BT(0x80000000), BT(0xd0000000), BT(0xe0000000),
+		BT(0x30000000), BT(0x00000000), BT(0x50000000), BT(0x60000000), BT(0xf0000000), BT(0xc0000000), BT(0x90000000), BT(0xa0000000),
+		BT(0x80000000), BT(0xb0000000), BT(0xe0000000), BT(0xd0000000), BT(0x40000000), BT(0x70000000), BT(0x20000000), BT(0x10000000),
+		BT(0x60000000), BT(0x50000000), BT(0x00000000), BT(0x30000000), BT(0xa0000000), BT(0x90000000), BT(0xc0000000), BT(0xf0000000),
+		BT(0xd0000000), BT(0xe0000000), BT(0xb0000000), BT(0x80000000), BT(0x10000000), BT(0x20000000), BT(0x70000000), BT(0x40000000)
+	}, {
+		BMP_C(0x00000004), BMP_C(0x0000000c), BMP_C(0x0000000a), BMP_C(0x0000000d),
+		BMP_C(0x00000002), BMP_C(0x00000006), BMP_C(0x00000005), BMP_C(0x0000000f)
+	}},
+	{ 5UL, BT(0x28000000), {
+		BT(0x00000000), BT(0x28000000), BT(0x50000000), BT(0x78000000), BT(0xa0000000), BT(0x88000000), BT(0xf0000000), BT(0xd8000000),
+		BT(0x68000000), BT(0x40000000), BT(0x38000000), BT(0x10000000), BT(0xc8000000), BT(0xe0000000), BT(0x98000000), BT(0xb0000000),
+		BT(0xd0000000), BT(0xf8000000), BT(0x80000000), BT(0xa8000000), BT(0x70000000), BT(0x58000000), BT(0x20000000), BT(0x08000000),
+		BT(0xb8000000), BT(0x90000000), BT(0xe8000000), BT(0xc0000000), BT(0x18000000), BT(0x30000000), BT(0x48000000), BT(0x60000000),
+		BT(0x88000000), BT(0xa0000000), BT(0xd8000000), BT(0xf0000000), BT(0x28000000), BT(0x00000000), BT(0x78000000), BT(0x50000000),
+		BT(0xe0000000), BT(0xc8000000), BT(0xb0000000), BT(0x98000000), BT(0x40000000), BT(0x68000000), BT(0x10000000), BT(0x38000000),
+		BT(0x58000000), BT(0x70000000), BT(0x08000000), BT(0x20000000), BT(0xf8000000), BT(0xd0000000), BT(0xa8000000), BT(0x80000000),
+		BT(0x30000000), BT(0x18000000), BT(0x60000000), BT(0x48000000), BT(0x90000000), BT(0xb8000000), BT(0xc0000000), BT(0xe8000000),
+		BT(0x38000000), BT(0x10000000), BT(0x68000000), BT(0x40000000), BT(0x98000000), BT(0xb0000000), BT(0xc8000000), BT(0xe0000000),
+		BT(0x50000000), BT(0x78000000), BT(0x00000000), BT(0x28000000), BT(0xf0000000), BT(0xd8000000), BT(0xa0000000), BT(0x88000000),
+		BT(0xe8000000), BT(0xc0000000), BT(0xb8000000), BT(0x90000000), BT(0x48000000), BT(0x60000000), BT(0x18000000), BT(0x30000000),
+		BT(0x80000000), BT(0xa8000000), BT(0xd0000000), BT(0xf8000000), BT(0x20000000), BT(0x08000000), BT(0x70000000), BT(0x58000000),
+		BT(0xb0000000), BT(0x98000000), BT(0xe0000000), BT(0xc8000000), BT(0x10000000), BT(0x38000000), BT(0x40000000), BT(0x68000000),
+		BT(0xd8000000), BT(0xf0000000), BT(0x88000000), BT(0xa0000000), BT(0x78000000), BT(0x50000000), BT(0x28000000), BT(0x00000000),
+		BT(0x60000000), BT(0x48000000), BT(0x30000000), BT(0x18000000), BT(0xc0000000), BT(0xe8000000), BT(0x90000000), BT(0xb8000000),
+		BT(0x08000000), BT(0x20000000), BT(0x58000000), BT(0x70000000), BT(0xa8000000), BT(0x80000000), BT(0xf8000000), BT(0xd0000000),
+		BT(0x70000000), BT(0x58000000), BT(0x20000000), BT(0x08000000), BT(0xd0000000), BT(0xf8000000), BT(0x80000000), BT(0xa8000000),
+		BT(0x18000000), BT(0x30000000), BT(0x48000000), BT(0x60000000), BT(0xb8000000), BT(0x90000000), BT(0xe8000000), BT(0xc0000000),
+		BT(0xa0000000), BT(0x88000000), BT(0xf0000000), BT(0xd8000000), BT(0x00000000), BT(0x28000000), BT(0x50000000), BT(0x78000000),
+		BT(0xc8000000), BT(0xe0000000), BT(0x98000000), BT(0xb0000000), BT(0x68000000), BT(0x40000000), BT(0x38000000), BT(0x10000000),
+		BT(0xf8000000), BT(0xd0000000), BT(0xa8000000), BT(0x80000000), BT(0x58000000), BT(0x70000000), BT(0x08000000), BT(0x20000000),
+		BT(0x90000000), BT(0xb8000000), BT(0xc0000000), BT(0xe8000000), BT(0x30000000), BT(0x18000000), BT(0x60000000), BT(0x48000000),
+		BT(0x28000000), BT(0x00000000), BT(0x78000000), BT(0x50000000), BT(0x88000000), BT(0xa0000000), BT(0xd8000000), BT(0xf0000000),
+		BT(0x40000000), BT(0x68000000), BT(0x10000000), BT(0x38000000), BT(0xe0000000), BT(0xc8000000), BT(0xb0000000), BT(0x98000000),
+		BT(0x48000000), BT(0x60000000), BT(0x18000000), BT(0x30000000), BT(0xe8000000), BT(0xc0000000), BT(0xb8000000), BT(0x90000000),
+		BT(0x20000000), BT(0x08000000), BT(0x70000000), BT(0x58000000), BT(0x80000000), BT(0xa8000000), BT(0xd0000000), BT(0xf8000000),
+		BT(0x98000000), BT(0xb0000000), BT(0xc8000000), BT(0xe0000000), BT(0x38000000), BT(0x10000000), BT(0x68000000), BT(0x40000000),
+		BT(0xf0000000), BT(0xd8000000), BT(0xa0000000), BT(0x88000000), BT(0x50000000), BT(0x78000000), BT(0x00000000), BT(0x28000000),
+		BT(0xc0000000), BT(0xe8000000), BT(0x90000000), BT(0xb8000000), BT(0x60000000), BT(0x48000000), BT(0x30000000), BT(0x18000000),
+		BT(0xa8000000), BT(0x80000000), BT(0xf8000000), BT(0xd0000000), BT(0x08000000), BT(0x20000000), BT(0x58000000), BT(0x70000000),
+		BT(0x10000000), BT(0x38000000), BT(0x40000000), BT(0x68000000), BT(0xb0000000), BT(0x98000000), BT(0xe0000000), BT(0xc8000000),
+		BT(0x78000000), BT(0x50000000), BT(0x28000000), BT(0x00000000), BT(0xd8000000), BT(0xf0000000), BT(0x88000000), BT(0xa0000000)
+	}, {
+		BMP_C(0x0000001b), BMP_C(0x00000003), BMP_C(0x0000000e), BMP_C(0x0000001d),
+		BMP_C(0x0000000d), BMP_C(0x00000011), BMP_C(0x00000010), BMP_C(0x0000000a)
+	}},
+	{ 5UL, BT(0x48000000), {
+		BT(0x00000000), BT(0x48000000), BT(0x90000000), BT(0xd8000000), BT(0x68000000), BT(0x20000000), BT(0xf8000000), BT(0xb0000000),
+		BT(0xd0000000), BT(0x98000000), BT(0x40000000), BT(0x08000000), BT(0xb8000000), BT(0xf0000000), BT(0x28000000), BT(0x60000000),
+		BT(0xe8000000), BT(0xa0000000), BT(0x78000000), BT(0x30000000), BT(0x80000000), BT(0xc8000000), BT(0x10000000), BT(0x58000000),
+		BT(0x38000000), BT(0x70000000), BT(0xa8000000), BT(0xe0000000), BT(0x50000000), BT(0x18000000), BT(0xc0000000), BT(0x88000000),
+		BT(0x98000000), BT(0xd0000000), BT(0x08000000), BT(0x40000000), BT(0xf0000000), BT(0xb8000000), BT(0x60000000), BT(0x28000000),
+		BT(0x48000000), BT(0x00000000), BT(0xd8000000), BT(0x90000000), BT(0x20000000), BT(0x68000000), BT(0xb0000000), BT(0xf8000000),
+		BT(0x70000000), BT(0x38000000), BT(0xe0000000), BT(0xa8000000), BT(0x18000000), BT(0x50000000), BT(0x88000000), BT(0xc0000000),
+		BT(0xa0000000), BT(0xe8000000), BT(0x30000000), BT(0x78000000), BT(0xc8000000), BT(0x80000000), BT(0x58000000), BT(0x10000000),
+		BT(0x78000000), BT(0x30000000), BT(0xe8000000), BT(0xa0000000), BT(0x10000000), BT(0x58000000), BT(0x80000000), BT(0xc8000000),
+		BT(0xa8000000), BT(0xe0000000), BT(0x38000000), BT(0x70000000), BT(0xc0000000), BT(0x88000000), BT(0x50000000), BT(0x18000000),
+		BT(0x90000000), BT(0xd8000000), BT(0x00000000), BT(0x48000000), BT(0xf8000000), BT(0xb0000000), BT(0x68000000), BT(0x20000000),
+		BT(0x40000000), BT(0x08000000), BT(0xd0000000), BT(0x98000000), BT(0x28000000), BT(0x60000000), BT(0xb8000000), BT(0xf0000000),
+		BT(0xe0000000), BT(0xa8000000), BT(0x70000000), BT(0x38000000), BT(0x88000000), BT(0xc0000000), BT(0x18000000), BT(0x50000000),
+		BT(0x30000000), BT(0x78000000), BT(0xa0000000), BT(0xe8000000), BT(0x58000000), BT(0x10000000), BT(0xc8000000), BT(0x80000000),
+		BT(0x08000000), BT(0x40000000), BT(0x98000000), BT(0xd0000000), BT(0x60000000), BT(0x28000000), BT(0xf0000000), BT(0xb8000000),
+		BT(0xd8000000), BT(0x90000000), BT(0x48000000), BT(0x00000000), BT(0xb0000000), BT(0xf8000000), BT(0x20000000), BT(0x68000000),
+		BT(0xf0000000), BT(0xb8000000), BT(0x60000000), BT(0x28000000), BT(0x98000000), BT(0xd0000000), BT(0x08000000), BT(0x40000000),
+		BT(0x20000000), BT(0x68000000), BT(0xb0000000), BT(0xf8000000), BT(0x48000000), BT(0x00000000), BT(0xd8000000), BT(0x90000000),
+		BT(0x18000000), BT(0x50000000), BT(0x88000000), BT(0xc0000000), BT(0x70000000), BT(0x38000000), BT(0xe0000000), BT(0xa8000000),
+		BT(0xc8000000), BT(0x80000000), BT(0x58000000), BT(0x10000000), BT(0xa0000000), BT(0xe8000000), BT(0x30000000), BT(0x78000000),
+		BT(0x68000000), BT(0x20000000), BT(0xf8000000), BT(0xb0000000), BT(0x00000000), BT(0x48000000), BT(0x90000000), BT(0xd8000000),
+		BT(0xb8000000), BT(0xf0000000), BT(0x28000000), BT(0x60000000), BT(0xd0000000), BT(0x98000000), BT(0x40000000), BT(0x08000000),
+		BT(0x80000000), BT(0xc8000000), BT(0x10000000), BT(0x58000000), BT(0xe8000000), BT(0xa0000000), BT(0x78000000), BT(0x30000000),
+		BT(0x50000000), BT(0x18000000), BT(0xc0000000), BT(0x88000000), BT(0x38000000), BT(0x70000000), BT(0xa8000000), BT(0xe0000000),
+		BT(0x88000000), BT(0xc0000000), BT(0x18000000), BT(0x50000000), BT(0xe0000000), BT(0xa8000000), BT(0x70000000), BT(0x38000000),
+		BT(0x58000000), BT(0x10000000), BT(0xc8000000), BT(0x80000000), BT(0x30000000), BT(0x78000000), BT(0xa0000000), BT(0xe8000000),
+		BT(0x60000000), BT(0x28000000), BT(0xf0000000), BT(0xb8000000), BT(0x08000000), BT(0x40000000), BT(0x98000000), BT(0xd0000000),
+		BT(0xb0000000), BT(0xf8000000), BT(0x20000000), BT(0x68000000), BT(0xd8000000), BT(0x90000000), BT(0x48000000), BT(0x00000000),
+		BT(0x10000000), BT(0x58000000), BT(0x80000000), BT(0xc8000000), BT(0x78000000), BT(0x30000000), BT(0xe8000000), BT(0xa0000000),
+		BT(0xc0000000), BT(0x88000000), BT(0x50000000), BT(0x18000000), BT(0xa8000000), BT(0xe0000000), BT(0x38000000), BT(0x70000000),
+		BT(0xf8000000), BT(0xb0000000), BT(0x68000000), BT(0x20000000), BT(0x90000000), BT(0xd8000000), BT(0x00000000), BT(0x48000000),
+		BT(0x28000000), BT(0x60000000), BT(0xb8000000), BT(0xf0000000), BT(0x40000000), BT(0x08000000), BT(0xd0000000), BT(0x98000000)
+	}, {
+		BMP_C(0x0000000c), BMP_C(0x00000019), BMP_C(0x0000001e), BMP_C(0x00000003),
+		BMP_C(0x0000001a), BMP_C(0x00000013), BMP_C(0x00000010), BMP_C(0x00000012)
+	}},
+	{ 5UL, BT(0xa8000000), {
+		BT(0x00000000), BT(0xa8000000), BT(0xf8000000), BT(0x50000000), BT(0x58000000), BT(0xf0000000), BT(0xa0000000), BT(0x08000000),
+		BT(0xb0000000), BT(0x18000000), BT(0x48000000), BT(0xe0000000), BT(0xe8000000), BT(0x40000000), BT(0x10000000), BT(0xb8000000),
+		BT(0xc8000000), BT(0x60000000), BT(0x30000000), BT(0x98000000), BT(0x90000000), BT(0x38000000), BT(0x68000000), BT(0xc0000000),
+		BT(0x78000000), BT(0xd0000000), BT(0x80000000), BT(0x28000000), BT(0x20000000), BT(0x88000000), BT(0xd8000000), BT(0x70000000),
+		BT(0x38000000), BT(0x90000000), BT(0xc0000000), BT(0x68000000), BT(0x60000000), BT(0xc8000000), BT(0x98000000), BT(0x30000000),
+		BT(0x88000000), BT(0x20000000), BT(0x70000000), BT(0xd8000000), BT(0xd0000000), BT(0x78000000), BT(0x28000000), BT(0x80000000),
+		BT(0xf0000000), BT(0x58000000), BT(0x08000000), BT(0xa0000000), BT(0xa8000000), BT(0x00000000), BT(0x50000000), BT(0xf8000000),
+		BT(0x40000000), BT(0xe8000000), BT(0xb8000000), BT(0x10000000), BT(0x18000000), BT(0xb0000000), BT(0xe0000000), BT(0x48000000),
+		BT(0x70000000), BT(0xd8000000), BT(0x88000000), BT(0x20000000), BT(0x28000000), BT(0x80000000), BT(0xd0000000), BT(0x78000000),
+		BT(0xc0000000), BT(0x68000000), BT(0x38000000), BT(0x90000000), BT(0x98000000), BT(0x30000000), BT(0x60000000), BT(0xc8000000),
+		BT(0xb8000000), BT(0x10000000), BT(0x40000000), BT(0xe8000000), BT(0xe0000000), BT(0x48000000), BT(0x18000000), BT(0xb0000000),
+		BT(0x08000000), BT(0xa0000000), BT(0xf0000000), BT(0x58000000), BT(0x50000000), BT(0xf8000000), BT(0xa8000000), BT(0x00000000),
+		BT(0x48000000), BT(0xe0000000), BT(0xb0000000), BT(0x18000000), BT(0x10000000), BT(0xb8000000), BT(0xe8000000), BT(0x40000000),
+		BT(0xf8000000), BT(0x50000000), BT(0x00000000), BT(0xa8000000), BT(0xa0000000), BT(0x08000000), BT(0x58000000), BT(0xf0000000),
+		BT(0x80000000), BT(0x28000000), BT(0x78000000), BT(0xd0000000), BT(0xd8000000), BT(0x70000000), BT(0x20000000), BT(0x88000000),
+		BT(0x30000000), BT(0x98000000), BT(0xc8000000), BT(0x60000000), BT(0x68000000), BT(0xc0000000), BT(0x90000000), BT(0x38000000),
+		BT(0xe0000000), BT(0x48000000), BT(0x18000000), BT(0xb0000000), BT(0xb8000000), BT(0x10000000), BT(0x40000000), BT(0xe8000000),
+		BT(0x50000000), BT(0xf8000000), BT(0xa8000000), BT(0x00000000), BT(0x08000000), BT(0xa0000000), BT(0xf0000000), BT(0x58000000),
+		BT(0x28000000), BT(0x80000000), BT(0xd0000000), BT(0x78000000), BT(0x70000000), BT(0xd8000000), BT(0x88000000), BT(0x20000000),
+		BT(0x98000000), BT(0x30000000), BT(0x60000000), BT(0xc8000000), BT(0xc0000000), BT(0x68000000), BT(0x38000000), BT(0x90000000),
+		BT(0xd8000000), BT(0x70000000), BT(0x20000000), BT(0x88000000), BT(0x80000000), BT(0x28000000), BT(0x78000000), BT(0xd0000000),
+		BT(0x68000000), BT(0xc0000000), BT(0x90000000), BT(0x38000000), BT(0x30000000), BT(0x98000000), BT(0xc8000000), BT(0x60000000),
+		BT(0x10000000), BT(0xb8000000), BT(0xe8000000), BT(0x40000000), BT(0x48000000), BT(0xe0000000), BT(0xb0000000), BT(0x18000000),
+		BT(0xa0000000), BT(0x08000000), BT(0x58000000), BT(0xf0000000), BT(0xf8000000), BT(0x50000000), BT(0x00000000), BT(0xa8000000),
+		BT(0x90000000), BT(0x38000000), BT(0x68000000), BT(0xc0000000), BT(0xc8000000), BT(0x60000000), BT(0x30000000), BT(0x98000000),
+		BT(0x20000000), BT(0x88000000), BT(0xd8000000), BT(0x70000000), BT(0x78000000), BT(0xd0000000), BT(0x80000000), BT(0x28000000),
+		BT(0x58000000), BT(0xf0000000), BT(0xa0000000), BT(0x08000000), BT(0x00000000), BT(0xa8000000), BT(0xf8000000), BT(0x50000000),
+		BT(0xe8000000), BT(0x40000000), BT(0x10000000), BT(0xb8000000), BT(0xb0000000), BT(0x18000000), BT(0x48000000), BT(0xe0000000),
+		BT(0xa8000000), BT(0x00000000), BT(0x50000000), BT(0xf8000000), BT(0xf0000000), BT(0x58000000), BT(0x08000000), BT(0xa0000000),
+		BT(0x18000000), BT(0xb0000000), BT(0xe0000000), BT(0x48000000), BT(0x40000000), BT(0xe8000000), BT(0xb8000000), BT(0x10000000),
+		BT(0x60000000), BT(0xc8000000), BT(0x98000000), BT(0x30000000), BT(0x38000000), BT(0x90000000), BT(0xc0000000), BT(0x68000000),
+		BT(0xd0000000), BT(0x78000000), BT(0x28000000), BT(0x80000000), BT(0x88000000), BT(0x20000000), BT(0x70000000), BT(0xd8000000)
+	}, {
+		BMP_C(0x00000004), BMP_C(0x0000001f), BMP_C(0x00000019), BMP_C(0x0000000d),
+		BMP_C(0x00000002), BMP_C(0x00000015), BMP_C(0x00000016), BMP_C(0x0000001c)
+	}},
+	{ 6UL, BT(0x0c000000), {
+		BT(0x00000000), BT(0x0c000000), BT(0x18000000), BT(0x14000000), BT(0x30000000), BT(0x3c000000), BT(0x28000000), BT(0x24000000),
+		BT(0x60000000), BT(0x6c000000), BT(0x78000000), BT(0x74000000), BT(0x50000000), BT(0x5c000000), BT(0x48000000), BT(0x44000000),
+		BT(0xc0000000), BT(0xcc000000), BT(0xd8000000), BT(0xd4000000), BT(0xf0000000), BT(0xfc000000), BT(0xe8000000), BT(0xe4000000),
+		BT(0xa0000000), BT(0xac000000), BT(0xb8000000), BT(0xb4000000), BT(0x90000000), BT(0x9c000000), BT(0x88000000), BT(0x84000000),
+		BT(0x8c000000), BT(0x80000000), BT(0x94000000), BT(0x98000000), BT(0xbc000000), BT(0xb0000000), BT(0xa4000000), BT(0xa8000000),
+		BT(0xec000000), BT(0xe0000000), BT(0xf4000000), BT(0xf8000000), BT(0xdc000000), BT(0xd0000000), BT(0xc4000000), BT(0xc8000000),
+		BT(0x4c000000), BT(0x40000000), BT(0x54000000), BT(0x58000000), BT(0x7c000000), BT(0x70000000), BT(0x64000000), BT(0x68000000),
+		BT(0x2c000000), BT(0x20000000), BT(0x34000000), BT(0x38000000), BT(0x1c000000), BT(0x10000000), BT(0x04000000), BT(0x08000000),
+		BT(0x14000000), BT(0x18000000), BT(0x0c000000), BT(0x00000000), BT(0x24000000), BT(0x28000000), BT(0x3c000000), BT(0x30000000),
+		BT(0x74000000), BT(0x78000000), BT(0x6c000000), BT(0x60000000), BT(0x44000000), BT(0x48000000), BT(0x5c000000), BT(0x50000000),
+		BT(0xd4000000), BT(0xd8000000), BT(0xcc000000), BT(0xc0000000), BT(0xe4000000), BT(0xe8000000), BT(0xfc000000), BT(0xf0000000),
+		BT(0xb4000000), BT(0xb8000000), BT(0xac000000), BT(0xa0000000), BT(0x84000000), BT(0x88000000), BT(0x9c000000), BT(0x90000000),
+		BT(0x98000000), BT(0x94000000), BT(0x80000000), BT(0x8c000000), BT(0xa8000000), BT(0xa4000000), BT(0xb0000000), BT(0xbc000000),
+		BT(0xf8000000), BT(0xf4000000), BT(0xe0000000), BT(0xec000000), BT(0xc8000000), BT(0xc4000000), BT(0xd0000000), BT(0xdc000000),
+		BT(0x58000000), BT(0x54000000), BT(0x40000000), BT(0x4c000000), BT(0x68000000), BT(0x64000000), BT(0x70000000), BT(0x7c000000),
+		BT(0x38000000), BT(0x34000000), BT(0x20000000), BT(0x2c000000), BT(0x08000000), BT(0x04000000), BT(0x10000000), BT(0x1c000000),
+		BT(0x28000000), BT(0x24000000), BT(0x30000000), BT(0x3c000000), BT(0x18000000), BT(0x14000000), BT(0x00000000), BT(0x0c000000),
+		BT(0x48000000), BT(0x44000000), BT(0x50000000), BT(0x5c000000), BT(0x78000000), BT(0x74000000), BT(0x60000000), BT(0x6c000000),
+		BT(0xe8000000), BT(0xe4000000), BT(0xf0000000), BT(0xfc000000), BT(0xd8000000), BT(0xd4000000), BT(0xc0000000), BT(0xcc000000),
+		BT(0x88000000), BT(0x84000000), BT(0x90000000), BT(0x9c000000), BT(0xb8000000), BT(0xb4000000), BT(0xa0000000), BT(0xac000000),
+		BT(0xa4000000), BT(0xa8000000), BT(0xbc000000), BT(0xb0000000), BT(0x94000000), BT(0x98000000), BT(0x8c000000), BT(0x80000000),
+		BT(0xc4000000), BT(0xc8000000), BT(0xdc000000), BT(0xd0000000), BT(0xf4000000), BT(0xf8000000), BT(0xec000000), BT(0xe0000000),
+		BT(0x64000000), BT(0x68000000), BT(0x7c000000), BT(0x70000000), BT(0x54000000), BT(0x58000000), BT(0x4c000000), BT(0x40000000),
+		BT(0x04000000), BT(0x08000000), BT(0x1c000000), BT(0x10000000), BT(0x34000000), BT(0x38000000), BT(0x2c000000), BT(0x20000000),
+		BT(0x3c000000), BT(0x30000000), BT(0x24000000), BT(0x28000000), BT(0x0c000000), BT(0x00000000), BT(0x14000000), BT(0x18000000),
+		BT(0x5c000000), BT(0x50000000), BT(0x44000000), BT(0x48000000), BT(0x6c000000), BT(0x60000000), BT(0x74000000), BT(0x78000000),
+		BT(0xfc000000), BT(0xf0000000), BT(0xe4000000), BT(0xe8000000), BT(0xcc000000), BT(0xc0000000), BT(0xd4000000), BT(0xd8000000),
+		BT(0x9c000000), BT(0x90000000), BT(0x84000000), BT(0x88000000), BT(0xac000000), BT(0xa0000000), BT(0xb4000000), BT(0xb8000000),
+		BT(0xb0000000), BT(0xbc000000), BT(0xa8000000), BT(0xa4000000), BT(0x80000000), BT(0x8c000000), BT(0x98000000), BT(0x94000000),
+		BT(0xd0000000), BT(0xdc000000), BT(0xc8000000), BT(0xc4000000), BT(0xe0000000), BT(0xec000000), BT(0xf8000000), BT(0xf4000000),
+		BT(0x70000000), BT(0x7c000000), BT(0x68000000), BT(0x64000000), BT(0x40000000), BT(0x4c000000), BT(0x58000000), BT(0x54000000),
+		BT(0x10000000), BT(0x1c000000), BT(0x08000000), BT(0x04000000), BT(0x20000000), BT(0x2c000000), BT(0x38000000), BT(0x34000000)
+	}, {
+		BMP_C(0x0000000c), BMP_C(0x00000018), BMP_C(0x00000003), BMP_C(0x00000006),
+		BMP_C(0x00000010), BMP_C(0x00000020), BMP_C(0x00000004), BMP_C(0x00000008)
+	}},
+	{ 6UL, BT(0x1c000000), {
+		BT(0x00000000), BT(0x1c000000), BT(0x38000000), BT(0x24000000), BT(0x70000000), BT(0x6c000000), BT(0x48000000), BT(0x54000000),
+		BT(0xe0000000), BT(0xfc000000), BT(0xd8000000), BT(0xc4000000), BT(0x90000000), BT(0x8c000000), BT(0xa8000000), BT(0xb4000000),
+		BT(0xdc000000), BT(0xc0000000), BT(0xe4000000), BT(0xf8000000), BT(0xac000000), BT(0xb0000000), BT(0x94000000), BT(0x88000000),
+		BT(0x3c000000), BT(0x20000000), BT(0x04000000), BT(0x18000000), BT(0x4c000000), BT(0x50000000), BT(0x74000000), BT(0x68000000),
+		BT(0xa4000000), BT(0xb8000000), BT(0x9c000000), BT(0x80000000), BT(0xd4000000), BT(0xc8000000), BT(0xec000000), BT(0xf0000000),
+		BT(0x44000000), BT(0x58000000), BT(0x7c000000), BT(0x60000000), BT(0x34000000), BT(0x28000000), BT(0x0c000000), BT(0x10000000),
+		BT(0x78000000), BT(0x64000000), BT(0x40000000), BT(0x5c000000), BT(0x08000000), BT(0x14000000), BT(0x30000000), BT(0x2c000000),
+		BT(0x98000000), BT(0x84000000), BT(0xa0000000), BT(0xbc000000), BT(0xe8000000), BT(0xf4000000), BT(0xd0000000), BT(0xcc000000),
+		BT(0x54000000), BT(0x48000000), BT(0x6c000000), BT(0x70000000), BT(0x24000000), BT(0x38000000), BT(0x1c000000), BT(0x00000000),
+		BT(0xb4000000), BT(0xa8000000), BT(0x8c000000), BT(0x90000000), BT(0xc4000000), BT(0xd8000000), BT(0xfc000000), BT(0xe0000000),
+		BT(0x88000000), BT(0x94000000), BT(0xb0000000), BT(0xac000000), BT(0xf8000000), BT(0xe4000000), BT(0xc0000000), BT(0xdc000000),
+		BT(0x68000000), BT(0x74000000), BT(0x50000000), BT(0x4c000000), BT(0x18000000), BT(0x04000000), BT(0x20000000), BT(0x3c000000),
+		BT(0xf0000000), BT(0xec000000), BT(0xc8000000), BT(0xd4000000), BT(0x80000000), BT(0x9c000000), BT(0xb8000000), BT(0xa4000000),
+		BT(0x10000000), BT(0x0c000000), BT(0x28000000), BT(0x34000000), BT(0x60000000), BT(0x7c000000), BT(0x58000000), BT(0x44000000),
+		BT(0x2c000000), BT(0x30000000), BT(0x14000000), BT(0x08000000), BT(0x5c000000), BT(0x40000000), BT(0x64000000), BT(0x78000000),
+		BT(0xcc000000), BT(0xd0000000), BT(0xf4000000), BT(0xe8000000), BT(0xbc000000), BT(0xa0000000), BT(0x84000000), BT(0x98000000),
+		BT(0xa8000000), BT(0xb4000000), BT(0x90000000), BT(0x8c000000), BT(0xd8000000), BT(0xc4000000), BT(0xe0000000), BT(0xfc000000),
+		BT(0x48000000), BT(0x54000000), BT(0x70000000), BT(0x6c000000), BT(0x38000000), BT(0x24000000), BT(0x00000000), BT(0x1c000000),
+		BT(0x74000000), BT(0x68000000), BT(0x4c000000), BT(0x50000000), BT(0x04000000), BT(0x18000000), BT(0x3c000000), BT(0x20000000),
+		BT(0x94000000), BT(0x88000000), BT(0xac000000), BT(0xb0000000), BT(0xe4000000), BT(0xf8000000), BT(0xdc000000), BT(0xc0000000),
+		BT(0x0c000000), BT(0x10000000), BT(0x34000000), BT(0x28000000), BT(0x7c000000), BT(0x60000000), BT(0x44000000), BT(0x58000000),
+		BT(0xec000000), BT(0xf0000000), BT(0xd4000000), BT(0xc8000000), BT(0x9c000000), BT(0x80000000), BT(0xa4000000), BT(0xb8000000),
+		BT(0xd0000000), BT(0xcc000000), BT(0xe8000000), BT(0xf4000000), BT(0xa0000000), BT(0xbc000000), BT(0x98000000), BT(0x84000000),
+		BT(0x30000000), BT(0x2c000000), BT(0x08000000), BT(0x14000000), BT(0x40000000), BT(0x5c000000), BT(0x78000000), BT(0x64000000),
+		BT(0xfc000000), BT(0xe0000000), BT(0xc4000000), BT(0xd8000000), BT(0x8c000000), BT(0x90000000), BT(0xb4000000), BT(0xa8000000),
+		BT(0x1c000000), BT(0x00000000), BT(0x24000000), BT(0x38000000), BT(0x6c000000), BT(0x70000000), BT(0x54000000), BT(0x48000000),
+		BT(0x20000000), BT(0x3c000000), BT(0x18000000), BT(0x04000000), BT(0x50000000), BT(0x4c000000), BT(0x68000000), BT(0x74000000),
+		BT(0xc0000000), BT(0xdc000000), BT(0xf8000000), BT(0xe4000000), BT(0xb0000000), BT(0xac000000), BT(0x88000000), BT(0x94000000),
+		BT(0x58000000), BT(0x44000000), BT(0x60000000), BT(0x7c000000), BT(0x28000000), BT(0x34000000), BT(0x10000000), BT(0x0c000000),
+		BT(0xb8000000), BT(0xa4000000), BT(0x80000000), BT(0x9c000000), BT(0xc8000000), BT(0xd4000000), BT(0xf0000000), BT(0xec000000),
+		BT(0x84000000), BT(0x98000000), BT(0xbc000000), BT(0xa0000000), BT(0xf4000000), BT(0xe8000000), BT(0xcc000000), BT(0xd0000000),
+		BT(0x64000000), BT(0x78000000), BT(0x5c000000), BT(0x40000000), BT(0x14000000), BT(0x08000000), BT(0x2c000000), BT(0x30000000)
+	}, {
+		BMP_C(0x0000000b), BMP_C(0x0000002c), BMP_C(0x00000015), BMP_C(0x00000013),
+		BMP_C(0x0000001c), BMP_C(0x00000037), BMP_C(0x00000010), BMP_C(0x00000007)
+	}},
+	{ 6UL, BT(0x64000000), {
+		BT(0x00000000), BT(0x64000000), BT(0xc8000000), BT(0xac000000), BT(0xf4000000), BT(0x90000000), BT(0x3c000000), BT(0x58000000),
+		BT(0x8c000000), BT(0xe8000000), BT(0x44000000), BT(0x20000000), BT(0x78000000), BT(0x1c000000), BT(0xb0000000), BT(0xd4000000),
+		BT(0x7c000000), BT(0x18000000), BT(0xb4000000), BT(0xd0000000), BT(0x88000000), BT(0xec000000), BT(0x40000000), BT(0x24000000),
+		BT(0xf0000000), BT(0x94000000), BT(0x38000000), BT(0x5c000000), BT(0x04000000), BT(0x60000000), BT(0xcc000000), BT(0xa8000000),
+		BT(0xf8000000), BT(0x9c000000), BT(0x30000000), BT(0x54000000), BT(0x0c000000), BT(0x68000000), BT(0xc4000000), BT(0xa0000000),
+		BT(0x74000000), BT(0x10000000), BT(0xbc000000), BT(0xd8000000), BT(0x80000000), BT(0xe4000000), BT(0x48000000), BT(0x2c000000),
+		BT(0x84000000), BT(0xe0000000), BT(0x4c000000), BT(0x28000000), BT(0x70000000), BT(0x14000000), BT(0xb8000000), BT(0xdc000000),
+		BT(0x08000000), BT(0x6c000000), BT(0xc0000000), BT(0xa4000000), BT(0xfc000000), BT(0x98000000), BT(0x34000000), BT(0x50000000),
+		BT(0x94000000), BT(0xf0000000), BT(0x5c000000), BT(0x38000000), BT(0x60000000), BT(0x04000000), BT(0xa8000000), BT(0xcc000000),
+		BT(0x18000000), BT(0x7c000000), BT(0xd0000000), BT(0xb4000000), BT(0xec000000), BT(0x88000000), BT(0x24000000), BT(0x40000000),
+		BT(0xe8000000), BT(0x8c000000), BT(0x20000000), BT(0x44000000), BT(0x1c000000), BT(0x78000000), BT(0xd4000000), BT(0xb0000000),
+		BT(0x64000000), BT(0x00000000), BT(0xac000000), BT(0xc8000000), BT(0x90000000), BT(0xf4000000), BT(0x58000000), BT(0x3c000000),
+		BT(0x6c000000), BT(0x08000000), BT(0xa4000000), BT(0xc0000000), BT(0x98000000), BT(0xfc000000), BT(0x50000000), BT(0x34000000),
+		BT(0xe0000000), BT(0x84000000), BT(0x28000000), BT(0x4c000000), BT(0x14000000), BT(0x70000000), BT(0xdc000000), BT(0xb8000000),
+		BT(0x10000000), BT(0x74000000), BT(0xd8000000), BT(0xbc000000), BT(0xe4000000), BT(0x80000000), BT(0x2c000000), BT(0x48000000),
+		BT(0x9c000000), BT(0xf8000000), BT(0x54000000), BT(0x30000000), BT(0x68000000), BT(0x0c000000), BT(0xa0000000), BT(0xc4000000),
+		BT(0x4c000000), BT(0x28000000), BT(0x84000000), BT(0xe0000000), BT(0xb8000000), BT(0xdc000000), BT(0x70000000), BT(0x14000000),
+		BT(0xc0000000), BT(0xa4000000), BT(0x08000000), BT(0x6c000000), BT(0x34000000), BT(0x50000000), BT(0xfc000000), BT(0x98000000),
+		BT(0x30000000), BT(0x54000000), BT(0xf8000000), BT(0x9c000000), BT(0xc4000000), BT(0xa0000000), BT(0x0c000000), BT(0x68000000),
+		BT(0xbc000000), BT(0xd8000000), BT(0x74000000), BT(0x10000000), BT(0x48000000), BT(0x2c000000), BT(0x80000000), BT(0xe4000000),
+		BT(0xb4000000), BT(0xd0000000), BT(0x7c000000), BT(0x18000000), BT(0x40000000), BT(0x24000000), BT(0x88000000), BT(0xec000000),
+		BT(0x38000000), BT(0x5c000000), BT(0xf0000000), BT(0x94000000), BT(0xcc000000), BT(0xa8000000), BT(0x04000000), BT(0x60000000),
+		BT(0xc8000000), BT(0xac000000), BT(0x00000000), BT(0x64000000), BT(0x3c000000), BT(0x58000000), BT(0xf4000000), BT(0x90000000),
+		BT(0x44000000), BT(0x20000000), BT(0x8c000000), BT(0xe8000000), BT(0xb0000000), BT(0xd4000000), BT(0x78000000), BT(0x1c000000),
+		BT(0xd8000000), BT(0xbc000000), BT(0x10000000), BT(0x74000000), BT(0x2c000000), BT(0x48000000), BT(0xe4000000), BT(0x80000000),
+		BT(0x54000000), BT(0x30000000), BT(0x9c000000), BT(0xf8000000), BT(0xa0000000), BT(0xc4000000), BT(0x68000000), BT(0x0c000000),
+		BT(0xa4000000), BT(0xc0000000), BT(0x6c000000), BT(0x08000000), BT(0x50000000), BT(0x34000000), BT(0x98000000), BT(0xfc000000),
+		BT(0x28000000), BT(0x4c000000), BT(0xe0000000), BT(0x84000000), BT(0xdc000000), BT(0xb8000000), BT(0x14000000), BT(0x70000000),
+		BT(0x20000000), BT(0x44000000), BT(0xe8000000), BT(0x8c000000), BT(0xd4000000), BT(0xb0000000), BT(0x1c000000), BT(0x78000000),
+		BT(0xac000000), BT(0xc8000000), BT(0x64000000), BT(0x00000000), BT(0x58000000), BT(0x3c000000), BT(0x90000000), BT(0xf4000000),
+		BT(0x5c000000), BT(0x38000000), BT(0x94000000), BT(0xf0000000), BT(0xa8000000), BT(0xcc000000), BT(0x60000000), BT(0x04000000),
+		BT(0xd0000000), BT(0xb4000000), BT(0x18000000), BT(0x7c000000), BT(0x24000000), BT(0x40000000), BT(0xec000000), BT(0x88000000)
+	}, {
+		BMP_C(0x0000002a), BMP_C(0x0000001a), BMP_C(0x00000025), BMP_C(0x00000026),
+		BMP_C(0x0000003d), BMP_C(0x0000001f), BMP_C(0x00000010), BMP_C(0x00000019)
+	}},
+	{ 6UL, BT(0x9c000000), {
+		BT(0x00000000), BT(0x9c000000), BT(0xa4000000), BT(0x38000000), BT(0xd4000000), BT(0x48000000), BT(0x70000000), BT(0xec000000),
+		BT(0x34000000), BT(0xa8000000), BT(0x90000000), BT(0x0c000000), BT(0xe0000000), BT(0x7c000000), BT(0x44000000), BT(0xd8000000),
+		BT(0x68000000), BT(0xf4000000), BT(0xcc000000), BT(0x50000000), BT(0xbc000000), BT(0x20000000), BT(0x18000000), BT(0x84000000),
+		BT(0x5c000000), BT(0xc0000000), BT(0xf8000000), BT(0x64000000), BT(0x88000000), BT(0x14000000), BT(0x2c000000), BT(0xb0000000),
+		BT(0xd0000000), BT(0x4c000000), BT(0x74000000), BT(0xe8000000), BT(0x04000000), BT(0x98000000), BT(0xa0000000), BT(0x3c000000),
+		BT(0xe4000000), BT(0x78000000), BT(0x40000000), BT(0xdc000000), BT(0x30000000), BT(0xac000000), BT(0x94000000), BT(0x08000000),
+		BT(0xb8000000), BT(0x24000000), BT(0x1c000000), BT(0x80000000), BT(0x6c000000), BT(0xf0000000), BT(0xc8000000), BT(0x54000000),
+		BT(0x8c000000), BT(0x10000000), BT(0x28000000), BT(0xb4000000), BT(0x58000000), BT(0xc4000000), BT(0xfc000000), BT(0x60000000),
+		BT(0x3c000000), BT(0xa0000000), BT(0x98000000), BT(0x04000000), BT(0xe8000000), BT(0x74000000), BT(0x4c000000), BT(0xd0000000),
+		BT(0x08000000), BT(0x94000000), BT(0xac000000), BT(0x30000000), BT(0xdc000000), BT(0x40000000), BT(0x78000000), BT(0xe4000000),
+		BT(0x54000000), BT(0xc8000000), BT(0xf0000000), BT(0x6c000000), BT(0x80000000), BT(0x1c000000), BT(0x24000000), BT(0xb8000000),
+		BT(0x60000000), BT(0xfc000000), BT(0xc4000000), BT(0x58000000), BT(0xb4000000), BT(0x28000000), BT(0x10000000), BT(0x8c000000),
+		BT(0xec000000), BT(0x70000000), BT(0x48000000), BT(0xd4000000), BT(0x38000000), BT(0xa4000000), BT(0x9c000000), BT(0x00000000),
+		BT(0xd8000000), BT(0x44000000), BT(0x7c000000), BT(0xe0000000), BT(0x0c000000), BT(0x90000000), BT(0xa8000000), BT(0x34000000),
+		BT(0x84000000), BT(0x18000000), BT(0x20000000), BT(0xbc000000), BT(0x50000000), BT(0xcc000000), BT(0xf4000000), BT(0x68000000),
+		BT(0xb0000000), BT(0x2c000000), BT(0x14000000), BT(0x88000000), BT(0x64000000), BT(0xf8000000), BT(0xc0000000), BT(0x5c000000),
+		BT(0x78000000), BT(0xe4000000), BT(0xdc000000), BT(0x40000000), BT(0xac000000), BT(0x30000000), BT(0x08000000), BT(0x94000000),
+		BT(0x4c000000), BT(0xd0000000), BT(0xe8000000), BT(0x74000000), BT(0x98000000), BT(0x04000000), BT(0x3c000000), BT(0xa0000000),
+		BT(0x10000000), BT(0x8c000000), BT(0xb4000000), BT(0x28000000), BT(0xc4000000), BT(0x58000000), BT(0x60000000), BT(0xfc000000),
+		BT(0x24000000), BT(0xb8000000), BT(0x80000000), BT(0x1c000000), BT(0xf0000000), BT(0x6c000000), BT(0x54000000), BT(0xc8000000),
+		BT(0xa8000000), BT(0x34000000), BT(0x0c000000), BT(0x90000000), BT(0x7c000000), BT(0xe0000000), BT(0xd8000000), BT(0x44000000),
+		BT(0x9c000000), BT(0x00000000), BT(0x38000000), BT(0xa4000000), BT(0x48000000), BT(0xd4000000), BT(0xec000000), BT(0x70000000),
+		BT(0xc0000000), BT(0x5c000000), BT(0x64000000), BT(0xf8000000), BT(0x14000000), BT(0x88000000), BT(0xb0000000), BT(0x2c000000),
+		BT(0xf4000000), BT(0x68000000), BT(0x50000000), BT(0xcc000000), BT(0x20000000), BT(0xbc000000), BT(0x84000000), BT(0x18000000),
+		BT(0x44000000), BT(0xd8000000), BT(0xe0000000), BT(0x7c000000), BT(0x90000000), BT(0x0c000000), BT(0x34000000), BT(0xa8000000),
+		BT(0x70000000), BT(0xec000000), BT(0xd4000000), BT(0x48000000), BT(0xa4000000), BT(0x38000000), BT(0x00000000), BT(0x9c000000),
+		BT(0x2c000000), BT(0xb0000000), BT(0x88000000), BT(0x14000000), BT(0xf8000000), BT(0x64000000), BT(0x5c000000), BT(0xc0000000),
+		BT(0x18000000), BT(0x84000000), BT(0xbc000000), BT(0x20000000), BT(0xcc000000), BT(0x50000000), BT(0x68000000), BT(0xf4000000),
+		BT(0x94000000), BT(0x08000000), BT(0x30000000), BT(0xac000000), BT(0x40000000), BT(0xdc000000), BT(0xe4000000), BT(0x78000000),
+		BT(0xa0000000), BT(0x3c000000), BT(0x04000000), BT(0x98000000), BT(0x74000000), BT(0xe8000000), BT(0xd0000000), BT(0x4c000000),
+		BT(0xfc000000), BT(0x60000000), BT(0x58000000), BT(0xc4000000), BT(0x28000000), BT(0xb4000000), BT(0x8c000000), BT(0x10000000),
+		BT(0xc8000000), BT(0x54000000), BT(0x6c000000), BT(0xf0000000), BT(0x1c000000), BT(0x80000000), BT(0xb8000000), BT(0x24000000)
+	}, {
+		BMP_C(0x00000035), BMP_C(0x0000000d), BMP_C(0x00000027), BMP_C(0x00000029),
+		BMP_C(0x00000010), BMP_C(0x00000020), BMP_C(0x00000004), BMP_C(0x00000008)
+	}},
+	{ 6UL, BT(0xbc000000), {
+		BT(0x00000000), BT(0xbc000000), BT(0xc4000000), BT(0x78000000), BT(0x34000000), BT(0x88000000), BT(0xf0000000), BT(0x4c000000),
+		BT(0x68000000), BT(0xd4000000), BT(0xac000000), BT(0x10000000), BT(0x5c000000), BT(0xe0000000), BT(0x98000000), BT(0x24000000),
+		BT(0xd0000000), BT(0x6c000000), BT(0x14000000), BT(0xa8000000), BT(0xe4000000), BT(0x58000000), BT(0x20000000), BT(0x9c000000),
+		BT(0xb8000000), BT(0x04000000), BT(0x7c000000), BT(0xc0000000), BT(0x8c000000), BT(0x30000000), BT(0x48000000), BT(0xf4000000),
+		BT(0x1c000000), BT(0xa0000000), BT(0xd8000000), BT(0x64000000), BT(0x28000000), BT(0x94000000), BT(0xec000000), BT(0x50000000),
+		BT(0x74000000), BT(0xc8000000), BT(0xb0000000), BT(0x0c000000), BT(0x40000000), BT(0xfc000000), BT(0x84000000), BT(0x38000000),
+		BT(0xcc000000), BT(0x70000000), BT(0x08000000), BT(0xb4000000), BT(0xf8000000), BT(0x44000000), BT(0x3c000000), BT(0x80000000),
+		BT(0xa4000000), BT(0x18000000), BT(0x60000000), BT(0xdc000000), BT(0x90000000), BT(0x2c000000), BT(0x54000000), BT(0xe8000000),
+		BT(0x38000000), BT(0x84000000), BT(0xfc000000), BT(0x40000000), BT(0x0c000000), BT(0xb0000000), BT(0xc8000000), BT(0x74000000),
+		BT(0x50000000), BT(0xec000000), BT(0x94000000), BT(0x28000000), BT(0x64000000), BT(0xd8000000), BT(0xa0000000), BT(0x1c000000),
+		BT(0xe8000000), BT(0x54000000), BT(0x2c000000), BT(0x90000000), BT(0xdc000000), BT(0x60000000), BT(0x18000000), BT(0xa4000000),
+		BT(0x80000000), BT(0x3c000000), BT(0x44000000), BT(0xf8000000), BT(0xb4000000), BT(0x08000000), BT(0x70000000), BT(0xcc000000),
+		BT(0x24000000), BT(0x98000000), BT(0xe0000000), BT(0x5c000000), BT(0x10000000), BT(0xac000000), BT(0xd4000000), BT(0x68000000),
+		BT(0x4c000000), BT(0xf0000000), BT(0x88000000), BT(0x34000000), BT(0x78000000), BT(0xc4000000), BT(0xbc000000), BT(0x00000000),
+		BT(0xf4000000), BT(0x48000000), BT(0x30000000), BT(0x8c000000), BT(0xc0000000), BT(0x7c000000), BT(0x04000000), BT(0xb8000000),
+		BT(0x9c000000), BT(0x20000000), BT(0x58000000), BT(0xe4000000), BT(0xa8000000), BT(0x14000000), BT(0x6c000000), BT(0xd0000000),
+		BT(0x70000000), BT(0xcc000000), BT(0xb4000000), BT(0x08000000), BT(0x44000000), BT(0xf8000000), BT(0x80000000), BT(0x3c000000),
+		BT(0x18000000), BT(0xa4000000), BT(0xdc000000), BT(0x60000000), BT(0x2c000000), BT(0x90000000), BT(0xe8000000), BT(0x54000000),
+		BT(0xa0000000), BT(0x1c000000), BT(0x64000000), BT(0xd8000000), BT(0x94000000), BT(0x28000000), BT(0x50000000), BT(0xec000000),
+		BT(0xc8000000), BT(0x74000000), BT(0x0c000000), BT(0xb0000000), BT(0xfc000000), BT(0x40000000), BT(0x38000000), BT(0x84000000),
+		BT(0x6c000000), BT(0xd0000000), BT(0xa8000000), BT(0x14000000), BT(0x58000000), BT(0xe4000000), BT(0x9c000000), BT(0x20000000),
+		BT(0x04000000), BT(0xb8000000), BT(0xc0000000), BT(0x7c000000), BT(0x30000000), BT(0x8c000000), BT(0xf4000000), BT(0x48000000),
+		BT(0xbc000000), BT(0x00000000), BT(0x78000000), BT(0xc4000000), BT(0x88000000), BT(0x34000000), BT(0x4c000000), BT(0xf0000000),
+		BT(0xd4000000), BT(0x68000000), BT(0x10000000), BT(0xac000000), BT(0xe0000000), BT(0x5c000000), BT(0x24000000), BT(0x98000000),
+		BT(0x48000000), BT(0xf4000000), BT(0x8c000000), BT(0x30000000), BT(0x7c000000), BT(0xc0000000), BT(0xb8000000), BT(0x04000000),
+		BT(0x20000000), BT(0x9c000000), BT(0xe4000000), BT(0x58000000), BT(0x14000000), BT(0xa8000000), BT(0xd0000000), BT(0x6c000000),
+		BT(0x98000000), BT(0x24000000), BT(0x5c000000), BT(0xe0000000), BT(0xac000000), BT(0x10000000), BT(0x68000000), BT(0xd4000000),
+		BT(0xf0000000), BT(0x4c000000), BT(0x34000000), BT(0x88000000), BT(0xc4000000), BT(0x78000000), BT(0x00000000), BT(0xbc000000),
+		BT(0x54000000), BT(0xe8000000), BT(0x90000000), BT(0x2c000000), BT(0x60000000), BT(0xdc000000), BT(0xa4000000), BT(0x18000000),
+		BT(0x3c000000), BT(0x80000000), BT(0xf8000000), BT(0x44000000), BT(0x08000000), BT(0xb4000000), BT(0xcc000000), BT(0x70000000),
+		BT(0x84000000), BT(0x38000000), BT(0x40000000), BT(0xfc000000), BT(0xb0000000), BT(0x0c000000), BT(0x74000000), BT(0xc8000000),
+		BT(0xec000000), BT(0x50000000), BT(0x28000000), BT(0x94000000), BT(0xd8000000), BT(0x64000000), BT(0x1c000000), BT(0xa0000000)
+	}, {
+		BMP_C(0x0000003e), BMP_C(0x00000026), BMP_C(0x0000000e), BMP_C(0x00000038),
+		BMP_C(0x0000000d), BMP_C(0x00000034), BMP_C(0x00000010), BMP_C(0x0000002f)
+	}},
+	{ 7UL, BT(0x12000000), {
+		BT(0x00000000), BT(0x12000000), BT(0x24000000), BT(0x36000000), BT(0x48000000), BT(0x5a000000), BT(0x6c000000), BT(0x7e000000),
+		BT(0x90000000), BT(0x82000000), BT(0xb4000000), BT(0xa6000000), BT(0xd8000000), BT(0xca000000), BT(0xfc000000), BT(0xee000000),
+		BT(0x32000000), BT(0x20000000), BT(0x16000000), BT(0x04000000), BT(0x7a000000), BT(0x68000000), BT(0x5e000000), BT(0x4c000000),
+		BT(0xa2000000), BT(0xb0000000), BT(0x86000000), BT(0x94000000), BT(0xea000000), BT(0xf8000000), BT(0xce000000), BT(0xdc000000),
+		BT(0x64000000), BT(0x76000000), BT(0x40000000), BT(0x52000000), BT(0x2c000000), BT(0x3e000000), BT(0x08000000), BT(0x1a000000),
+		BT(0xf4000000), BT(0xe6000000), BT(0xd0000000), BT(0xc2000000), BT(0xbc000000), BT(0xae000000), BT(0x98000000), BT(0x8a000000),
+		BT(0x56000000), BT(0x44000000), BT(0x72000000), BT(0x60000000), BT(0x1e000000), BT(0x0c000000), BT(0x3a000000), BT(0x28000000),
+		BT(0xc6000000), BT(0xd4000000), BT(0xe2000000), BT(0xf0000000), BT(0x8e000000), BT(0x9c000000), BT(0xaa000000), BT(0xb8000000),
+		BT(0xc8000000), BT(0xda000000), BT(0xec000000), BT(0xfe000000), BT(0x80000000), BT(0x92000000), BT(0xa4000000), BT(0xb6000000),
+		BT(0x58000000), BT(0x4a000000), BT(0x7c000000), BT(0x6e000000), BT(0x10000000), BT(0x02000000), BT(0x34000000), BT(0x26000000),
+		BT(0xfa000000), BT(0xe8000000), BT(0xde000000), BT(0xcc000000), BT(0xb2000000), BT(0xa0000000), BT(0x96000000), BT(0x84000000),
+		BT(0x6a000000), BT(0x78000000), BT(0x4e000000), BT(0x5c000000), BT(0x22000000), BT(0x30000000), BT(0x06000000), BT(0x14000000),
+		BT(0xac000000), BT(0xbe000000), BT(0x88000000), BT(0x9a000000), BT(0xe4000000), BT(0xf6000000), BT(0xc0000000), BT(0xd2000000),
+		BT(0x3c000000), BT(0x2e000000), BT(0x18000000), BT(0x0a000000), BT(0x74000000), BT(0x66000000), BT(0x50000000), BT(0x42000000),
+		BT(0x9e000000), BT(0x8c000000), BT(0xba000000), BT(0xa8000000), BT(0xd6000000), BT(0xc4000000), BT(0xf2000000), BT(0xe0000000),
+		BT(0x0e000000), BT(0x1c000000), BT(0x2a000000), BT(0x38000000), BT(0x46000000), BT(0x54000000), BT(0x62000000), BT(0x70000000),
+		BT(0x82000000), BT(0x90000000), BT(0xa6000000), BT(0xb4000000), BT(0xca000000), BT(0xd8000000), BT(0xee000000), BT(0xfc000000),
+		BT(0x12000000), BT(0x00000000), BT(0x36000000), BT(0x24000000), BT(0x5a000000), BT(0x48000000), BT(0x7e000000), BT(0x6c000000),
+		BT(0xb0000000), BT(0xa2000000), BT(0x94000000), BT(0x86000000), BT(0xf8000000), BT(0xea000000), BT(0xdc000000), BT(0xce000000),
+		BT(0x20000000), BT(0x32000000), BT(0x04000000), BT(0x16000000), BT(0x68000000), BT(0x7a000000), BT(0x4c000000), BT(0x5e000000),
+		BT(0xe6000000), BT(0xf4000000), BT(0xc2000000), BT(0xd0000000), BT(0xae000000), BT(0xbc000000), BT(0x8a000000), BT(0x98000000),
+		BT(0x76000000), BT(0x64000000), BT(0x52000000), BT(0x40000000), BT(0x3e000000), BT(0x2c000000), BT(0x1a000000), BT(0x08000000),
+		BT(0xd4000000), BT(0xc6000000), BT(0xf0000000), BT(0xe2000000), BT(0x9c000000), BT(0x8e000000), BT(0xb8000000), BT(0xaa000000),
+		BT(0x44000000), BT(0x56000000), BT(0x60000000), BT(0x72000000), BT(0x0c000000), BT(0x1e000000), BT(0x28000000), BT(0x3a000000),
+		BT(0x4a000000), BT(0x58000000), BT(0x6e000000), BT(0x7c000000), BT(0x02000000), BT(0x10000000), BT(0x26000000), BT(0x34000000),
+		BT(0xda000000), BT(0xc8000000), BT(0xfe000000), BT(0xec000000), BT(0x92000000), BT(0x80000000), BT(0xb6000000), BT(0xa4000000),
+		BT(0x78000000), BT(0x6a000000), BT(0x5c000000), BT(0x4e000000), BT(0x30000000), BT(0x22000000), BT(0x14000000), BT(0x06000000),
+		BT(0xe8000000), BT(0xfa000000), BT(0xcc000000), BT(0xde000000), BT(0xa0000000), BT(0xb2000000), BT(0x84000000), BT(0x96000000),
+		BT(0x2e000000), BT(0x3c000000), BT(0x0a000000), BT(0x18000000), BT(0x66000000), BT(0x74000000), BT(0x42000000), BT(0x50000000),
+		BT(0xbe000000), BT(0xac000000), BT(0x9a000000), BT(0x88000000), BT(0xf6000000), BT(0xe4000000), BT(0xd2000000), BT(0xc0000000),
+		BT(0x1c000000), BT(0x0e000000), BT(0x38000000), BT(0x2a000000), BT(0x54000000), BT(0x46000000), BT(0x70000000), BT(0x62000000),
+		BT(0x8c000000), BT(0x9e000000), BT(0xa8000000), BT(0xba000000), BT(0xc4000000), BT(0xd6000000), BT(0xe0000000), BT(0xf2000000)
+	}, {
+		BMP_C(0x00000010), BMP_C(0x00000052), BMP_C(0x00000008), BMP_C(0x00000029),
+		BMP_C(0x00000004), BMP_C(0x00000050), BMP_C(0x00000002), BMP_C(0x00000028)
+	}},
+	{ 7UL, BT(0x8a000000), {
+		BT(0x00000000), BT(0x8a000000), BT(0x9e000000), BT(0x14000000), BT(0xb6000000), BT(0x3c000000), BT(0x28000000), BT(0xa2000000),
+		BT(0xe6000000), BT(0x6c000000), BT(0x78000000), BT(0xf2000000), BT(0x50000000), BT(0xda000000), BT(0xce000000), BT(0x44000000),
+		BT(0x46000000), BT(0xcc000000), BT(0xd8000000), BT(0x52000000), BT(0xf0000000), BT(0x7a000000), BT(0x6e000000), BT(0xe4000000),
+		BT(0xa0000000), BT(0x2a000000), BT(0x3e000000), BT(0xb4000000), BT(0x16000000), BT(0x9c000000), BT(0x88000000), BT(0x02000000),
+		BT(0x8c000000), BT(0x06000000), BT(0x12000000), BT(0x98000000), BT(0x3a000000), BT(0xb0000000), BT(0xa4000000), BT(0x2e000000),
+		BT(0x6a000000), BT(0xe0000000), BT(0xf4000000), BT(0x7e000000), BT(0xdc000000), BT(0x56000000), BT(0x42000000), BT(0xc8000000),
+		BT(0xca000000), BT(0x40000000), BT(0x54000000), BT(0xde000000), BT(0x7c000000), BT(0xf6000000), BT(0xe2000000), BT(0x68000000),
+		BT(0x2c000000), BT(0xa6000000), BT(0xb2000000), BT(0x38000000), BT(0x9a000000), BT(0x10000000), BT(0x04000000), BT(0x8e000000),
+		BT(0x92000000), BT(0x18000000), BT(0x0c000000), BT(0x86000000), BT(0x24000000), BT(0xae000000), BT(0xba000000), BT(0x30000000),
+		BT(0x74000000), BT(0xfe000000), BT(0xea000000), BT(0x60000000), BT(0xc2000000), BT(0x48000000), BT(0x5c000000), BT(0xd6000000),
+		BT(0xd4000000), BT(0x5e000000), BT(0x4a000000), BT(0xc0000000), BT(0x62000000), BT(0xe8000000), BT(0xfc000000), BT(0x76000000),
+		BT(0x32000000), BT(0xb8000000), BT(0xac000000), BT(0x26000000), BT(0x84000000), BT(0x0e000000), BT(0x1a000000), BT(0x90000000),
+		BT(0x1e000000), BT(0x94000000), BT(0x80000000), BT(0x0a000000), BT(0xa8000000), BT(0x22000000), BT(0x36000000), BT(0xbc000000),
+		BT(0xf8000000), BT(0x72000000), BT(0x66000000), BT(0xec000000), BT(0x4e000000), BT(0xc4000000), BT(0xd0000000), BT(0x5a000000),
+		BT(0x58000000), BT(0xd2000000), BT(0xc6000000), BT(0x4c000000), BT(0xee000000), BT(0x64000000), BT(0x70000000), BT(0xfa000000),
+		BT(0xbe000000), BT(0x34000000), BT(0x20000000), BT(0xaa000000), BT(0x08000000), BT(0x82000000), BT(0x96000000), BT(0x1c000000),
+		BT(0xae000000), BT(0x24000000), BT(0x30000000), BT(0xba000000), BT(0x18000000), BT(0x92000000), BT(0x86000000), BT(0x0c000000),
+		BT(0x48000000), BT(0xc2000000), BT(0xd6000000), BT(0x5c000000), BT(0xfe000000), BT(0x74000000), BT(0x60000000), BT(0xea000000),
+		BT(0xe8000000), BT(0x62000000), BT(0x76000000), BT(0xfc000000), BT(0x5e000000), BT(0xd4000000), BT(0xc0000000), BT(0x4a000000),
+		BT(0x0e000000), BT(0x84000000), BT(0x90000000), BT(0x1a000000), BT(0xb8000000), BT(0x32000000), BT(0x26000000), BT(0xac000000),
+		BT(0x22000000), BT(0xa8000000), BT(0xbc000000), BT(0x36000000), BT(0x94000000), BT(0x1e000000), BT(0x0a000000), BT(0x80000000),
+		BT(0xc4000000), BT(0x4e000000), BT(0x5a000000), BT(0xd0000000), BT(0x72000000), BT(0xf8000000), BT(0xec000000), BT(0x66000000),
+		BT(0x64000000), BT(0xee000000), BT(0xfa000000), BT(0x70000000), BT(0xd2000000), BT(0x58000000), BT(0x4c000000), BT(0xc6000000),
+		BT(0x82000000), BT(0x08000000), BT(0x1c000000), BT(0x96000000), BT(0x34000000), BT(0xbe000000), BT(0xaa000000), BT(0x20000000),
+		BT(0x3c000000), BT(0xb6000000), BT(0xa2000000), BT(0x28000000), BT(0x8a000000), BT(0x00000000), BT(0x14000000), BT(0x9e000000),
+		BT(0xda000000), BT(0x50000000), BT(0x44000000), BT(0xce000000), BT(0x6c000000), BT(0xe6000000), BT(0xf2000000), BT(0x78000000),
+		BT(0x7a000000), BT(0xf0000000), BT(0xe4000000), BT(0x6e000000), BT(0xcc000000), BT(0x46000000), BT(0x52000000), BT(0xd8000000),
+		BT(0x9c000000), BT(0x16000000), BT(0x02000000), BT(0x88000000), BT(0x2a000000), BT(0xa0000000), BT(0xb4000000), BT(0x3e000000),
+		BT(0xb0000000), BT(0x3a000000), BT(0x2e000000), BT(0xa4000000), BT(0x06000000), BT(0x8c000000), BT(0x98000000), BT(0x12000000),
+		BT(0x56000000), BT(0xdc000000), BT(0xc8000000), BT(0x42000000), BT(0xe0000000), BT(0x6a000000), BT(0x7e000000), BT(0xf4000000),
+		BT(0xf6000000), BT(0x7c000000), BT(0x68000000), BT(0xe2000000), BT(0x40000000), BT(0xca000000), BT(0xde000000), BT(0x54000000),
+		BT(0x10000000), BT(0x9a000000), BT(0x8e000000), BT(0x04000000), BT(0xa6000000), BT(0x2c000000), BT(0x38000000), BT(0xb2000000)
+	}, {
+		BMP_C(0x0000004f), BMP_C(0x0000005b), BMP_C(0x00000040), BMP_C(0x00000045),
+		BMP_C(0x00000010), BMP_C(0x00000020), BMP_C(0x00000004), BMP_C(0x00000008)
+	}},
+	{ 7UL, BT(0x9e000000), {
+		BT(0x00000000), BT(0x9e000000), BT(0xa2000000), BT(0x3c000000), BT(0xda000000), BT(0x44000000), BT(0x78000000), BT(0xe6000000),
+		BT(0x2a000000), BT(0xb4000000), BT(0x88000000), BT(0x16000000), BT(0xf0000000), BT(0x6e000000), BT(0x52000000), BT(0xcc000000),
+		BT(0x54000000), BT(0xca000000), BT(0xf6000000), BT(0x68000000), BT(0x8e000000), BT(0x10000000), BT(0x2c000000), BT(0xb2000000),
+		BT(0x7e000000), BT(0xe0000000), BT(0xdc000000), BT(0x42000000), BT(0xa4000000), BT(0x3a000000), BT(0x06000000), BT(0x98000000),
+		BT(0xa8000000), BT(0x36000000), BT(0x0a000000), BT(0x94000000), BT(0x72000000), BT(0xec000000), BT(0xd0000000), BT(0x4e000000),
+		BT(0x82000000), BT(0x1c000000), BT(0x20000000), BT(0xbe000000), BT(0x58000000), BT(0xc6000000), BT(0xfa000000), BT(0x64000000),
+		BT(0xfc000000), BT(0x62000000), BT(0x5e000000), BT(0xc0000000), BT(0x26000000), BT(0xb8000000), BT(0x84000000), BT(0x1a000000),
+		BT(0xd6000000), BT(0x48000000), BT(0x74000000), BT(0xea000000), BT(0x0c000000), BT(0x92000000), BT(0xae000000), BT(0x30000000),
+		BT(0xce000000), BT(0x50000000), BT(0x6c000000), BT(0xf2000000), BT(0x14000000), BT(0x8a000000), BT(0xb6000000), BT(0x28000000),
+		BT(0xe4000000), BT(0x7a000000), BT(0x46000000), BT(0xd8000000), BT(0x3e000000), BT(0xa0000000), BT(0x9c000000), BT(0x02000000),
+		BT(0x9a000000), BT(0x04000000), BT(0x38000000), BT(0xa6000000), BT(0x40000000), BT(0xde000000), BT(0xe2000000), BT(0x7c000000),
+		BT(0xb0000000), BT(0x2e000000), BT(0x12000000), BT(0x8c000000), BT(0x6a000000), BT(0xf4000000), BT(0xc8000000), BT(0x56000000),
+		BT(0x66000000), BT(0xf8000000), BT(0xc4000000), BT(0x5a000000), BT(0xbc000000), BT(0x22000000), BT(0x1e000000), BT(0x80000000),
+		BT(0x4c000000), BT(0xd2000000), BT(0xee000000), BT(0x70000000), BT(0x96000000), BT(0x08000000), BT(0x34000000), BT(0xaa000000),
+		BT(0x32000000), BT(0xac000000), BT(0x90000000), BT(0x0e000000), BT(0xe8000000), BT(0x76000000), BT(0x4a000000), BT(0xd4000000),
+		BT(0x18000000), BT(0x86000000), BT(0xba000000), BT(0x24000000), BT(0xc2000000), BT(0x5c000000), BT(0x60000000), BT(0xfe000000),
+		BT(0x02000000), BT(0x9c000000), BT(0xa0000000), BT(0x3e000000), BT(0xd8000000), BT(0x46000000), BT(0x7a000000), BT(0xe4000000),
+		BT(0x28000000), BT(0xb6000000), BT(0x8a000000), BT(0x14000000), BT(0xf2000000), BT(0x6c000000), BT(0x50000000), BT(0xce000000),
+		BT(0x56000000), BT(0xc8000000), BT(0xf4000000), BT(0x6a000000), BT(0x8c000000), BT(0x12000000), BT(0x2e000000), BT(0xb0000000),
+		BT(0x7c000000), BT(0xe2000000), BT(0xde000000), BT(0x40000000), BT(0xa6000000), BT(0x38000000), BT(0x04000000), BT(0x9a000000),
+		BT(0xaa000000), BT(0x34000000), BT(0x08000000), BT(0x96000000), BT(0x70000000), BT(0xee000000), BT(0xd2000000), BT(0x4c000000),
+		BT(0x80000000), BT(0x1e000000), BT(0x22000000), BT(0xbc000000), BT(0x5a000000), BT(0xc4000000), BT(0xf8000000), BT(0x66000000),
+		BT(0xfe000000), BT(0x60000000), BT(0x5c000000), BT(0xc2000000), BT(0x24000000), BT(0xba000000), BT(0x86000000), BT(0x18000000),
+		BT(0xd4000000), BT(0x4a000000), BT(0x76000000), BT(0xe8000000), BT(0x0e000000), BT(0x90000000), BT(0xac000000), BT(0x32000000),
+		BT(0xcc000000), BT(0x52000000), BT(0x6e000000), BT(0xf0000000), BT(0x16000000), BT(0x88000000), BT(0xb4000000), BT(0x2a000000),
+		BT(0xe6000000), BT(0x78000000), BT(0x44000000), BT(0xda000000), BT(0x3c000000), BT(0xa2000000), BT(0x9e000000), BT(0x00000000),
+		BT(0x98000000), BT(0x06000000), BT(0x3a000000), BT(0xa4000000), BT(0x42000000), BT(0xdc000000), BT(0xe0000000), BT(0x7e000000),
+		BT(0xb2000000), BT(0x2c000000), BT(0x10000000), BT(0x8e000000), BT(0x68000000), BT(0xf6000000), BT(0xca000000), BT(0x54000000),
+		BT(0x64000000), BT(0xfa000000), BT(0xc6000000), BT(0x58000000), BT(0xbe000000), BT(0x20000000), BT(0x1c000000), BT(0x82000000),
+		BT(0x4e000000), BT(0xd0000000), BT(0xec000000), BT(0x72000000), BT(0x94000000), BT(0x0a000000), BT(0x36000000), BT(0xa8000000),
+		BT(0x30000000), BT(0xae000000), BT(0x92000000), BT(0x0c000000), BT(0xea000000), BT(0x74000000), BT(0x48000000), BT(0xd6000000),
+		BT(0x1a000000), BT(0x84000000), BT(0xb8000000), BT(0x26000000), BT(0xc0000000), BT(0x5e000000), BT(0x62000000), BT(0xfc000000)
+	}, {
+		BMP_C(0x00000051), BMP_C(0x00000004), BMP_C(0x00000040), BMP_C(0x00000001),
+		BMP_C(0x00000010), BMP_C(0x00000054), BMP_C(0x00000004), BMP_C(0x00000015)
+	}},
+	{ 8UL, BT(0x07000000), {
+		BT(0x00000000), BT(0x07000000), BT(0x0e000000), BT(0x09000000), BT(0x1c000000), BT(0x1b000000), BT(0x12000000), BT(0x15000000),
+		BT(0x38000000), BT(0x3f000000), BT(0x36000000), BT(0x31000000), BT(0x24000000), BT(0x23000000), BT(0x2a000000), BT(0x2d000000),
+		BT(0x70000000), BT(0x77000000), BT(0x7e000000), BT(0x79000000), BT(0x6c000000), BT(0x6b000000), BT(0x62000000), BT(0x65000000),
+		BT(0x48000000), BT(0x4f000000), BT(0x46000000), BT(0x41000000), BT(0x54000000), BT(0x53000000), BT(0x5a000000), BT(0x5d000000),
+		BT(0xe0000000), BT(0xe7000000), BT(0xee000000), BT(0xe9000000), BT(0xfc000000), BT(0xfb000000), BT(0xf2000000), BT(0xf5000000),
+		BT(0xd8000000), BT(0xdf000000), BT(0xd6000000), BT(0xd1000000), BT(0xc4000000), BT(0xc3000000), BT(0xca000000), BT(0xcd000000),
+		BT(0x90000000), BT(0x97000000), BT(0x9e000000), BT(0x99000000), BT(0x8c000000), BT(0x8b000000), BT(0x82000000), BT(0x85000000),
+		BT(0xa8000000), BT(0xaf000000), BT(0xa6000000), BT(0xa1000000), BT(0xb4000000), BT(0xb3000000), BT(0xba000000), BT(0xbd000000),
+		BT(0xc7000000), BT(0xc0000000), BT(0xc9000000), BT(0xce000000), BT(0xdb000000), BT(0xdc000000), BT(0xd5000000), BT(0xd2000000),
+		BT(0xff000000), BT(0xf8000000), BT(0xf1000000), BT(0xf6000000), BT(0xe3000000), BT(0xe4000000), BT(0xed000000), BT(0xea000000),
+		BT(0xb7000000), BT(0xb0000000), BT(0xb9000000), BT(0xbe000000), BT(0xab000000), BT(0xac000000), BT(0xa5000000), BT(0xa2000000),
+		BT(0x8f000000), BT(0x88000000), BT(0x81000000), BT(0x86000000), BT(0x93000000), BT(0x94000000), BT(0x9d000000), BT(0x9a000000),
+		BT(0x27000000), BT(0x20000000), BT(0x29000000), BT(0x2e000000), BT(0x3b000000), BT(0x3c000000), BT(0x35000000), BT(0x32000000),
+		BT(0x1f000000), BT(0x18000000), BT(0x11000000), BT(0x16000000), BT(0x03000000), BT(0x04000000), BT(0x0d000000), BT(0x0a000000),
+		BT(0x57000000), BT(0x50000000), BT(0x59000000), BT(0x5e000000), BT(0x4b000000), BT(0x4c000000), BT(0x45000000), BT(0x42000000),
+		BT(0x6f000000), BT(0x68000000), BT(0x61000000), BT(0x66000000), BT(0x73000000), BT(0x74000000), BT(0x7d000000), BT(0x7a000000),
+		BT(0x89000000), BT(0x8e000000), BT(0x87000000), BT(0x80000000), BT(0x95000000), BT(0x92000000), BT(0x9b000000), BT(0x9c000000),
+		BT(0xb1000000), BT(0xb6000000), BT(0xbf000000), BT(0xb8000000), BT(0xad000000), BT(0xaa000000), BT(0xa3000000), BT(0xa4000000),
+		BT(0xf9000000), BT(0xfe000000), BT(0xf7000000), BT(0xf0000000), BT(0xe5000000), BT(0xe2000000), BT(0xeb000000), BT(0xec000000),
+		BT(0xc1000000), BT(0xc6000000), BT(0xcf000000), BT(0xc8000000), BT(0xdd000000), BT(0xda000000), BT(0xd3000000), BT(0xd4000000),
+		BT(0x69000000), BT(0x6e000000), BT(0x67000000), BT(0x60000000), BT(0x75000000), BT(0x72000000), BT(0x7b000000), BT(0x7c000000),
+		BT(0x51000000), BT(0x56000000), BT(0x5f000000), BT(0x58000000), BT(0x4d000000), BT(0x4a000000), BT(0x43000000), BT(0x44000000),
+		BT(0x19000000), BT(0x1e000000), BT(0x17000000), BT(0x10000000), BT(0x05000000), BT(0x02000000), BT(0x0b000000), BT(0x0c000000),
+		BT(0x21000000), BT(0x26000000), BT(0x2f000000), BT(0x28000000), BT(0x3d000000), BT(0x3a000000), BT(0x33000000), BT(0x34000000),
+		BT(0x4e000000), BT(0x49000000), BT(0x40000000), BT(0x47000000), BT(0x52000000), BT(0x55000000), BT(0x5c000000), BT(0x5b000000),
+		BT(0x76000000), BT(0x71000000), BT(0x78000000), BT(0x7f000000), BT(0x6a000000), BT(0x6d000000), BT(0x64000000), BT(0x63000000),
+		BT(0x3e000000), BT(0x39000000), BT(0x30000000), BT(0x37000000), BT(0x22000000), BT(0x25000000), BT(0x2c000000), BT(0x2b000000),
+		BT(0x06000000), BT(0x01000000), BT(0x08000000), BT(0x0f000000), BT(0x1a000000), BT(0x1d000000), BT(0x14000000), BT(0x13000000),
+		BT(0xae000000), BT(0xa9000000), BT(0xa0000000), BT(0xa7000000), BT(0xb2000000), BT(0xb5000000), BT(0xbc000000), BT(0xbb000000),
+		BT(0x96000000), BT(0x91000000), BT(0x98000000), BT(0x9f000000), BT(0x8a000000), BT(0x8d000000), BT(0x84000000), BT(0x83000000),
+		BT(0xde000000), BT(0xd9000000), BT(0xd0000000), BT(0xd7000000), BT(0xc2000000), BT(0xc5000000), BT(0xcc000000), BT(0xcb000000),
+		BT(0xe6000000), BT(0xe1000000), BT(0xe8000000), BT(0xef000000), BT(0xfa000000), BT(0xfd000000), BT(0xf4000000), BT(0xf3000000)
+	}, {
+		BMP_C(0x00000010), BMP_C(0x00000037), BMP_C(0x00000008), BMP_C(0x00000098),
+		BMP_C(0x00000004), BMP_C(0x0000004c), BMP_C(0x00000002), BMP_C(0x00000026)
+	}},
+	{ 8UL, BT(0x1d000000), {
+		BT(0x00000000), BT(0x1d000000), BT(0x3a000000), BT(0x27000000), BT(0x74000000), BT(0x69000000), BT(0x4e000000), BT(0x53000000),
+		BT(0xe8000000), BT(0xf5000000), BT(0xd2000000), BT(0xcf000000), BT(0x9c000000), BT(0x81000000), BT(0xa6000000), BT(0xbb000000),
+		BT(0xcd000000), BT(0xd0000000), BT(0xf7000000), BT(0xea000000), BT(0xb9000000), BT(0xa4000000), BT(0x83000000), BT(0x9e000000),
+		BT(0x25000000), BT(0x38000000), BT(0x1f000000), BT(0x02000000), BT(0x51000000), BT(0x4c000000), BT(0x6b000000), BT(0x76000000),
+		BT(0x87000000), BT(0x9a000000), BT(0xbd000000), BT(0xa0000000), BT(0xf3000000), BT(0xee000000), BT(0xc9000000), BT(0xd4000000),
+		BT(0x6f000000), BT(0x72000000), BT(0x55000000), BT(0x48000000), BT(0x1b000000), BT(0x06000000), BT(0x21000000), BT(0x3c000000),
+		BT(0x4a000000), BT(0x57000000), BT(0x70000000), BT(0x6d000000), BT(0x3e000000), BT(0x23000000), BT(0x04000000), BT(0x19000000),
+		BT(0xa2000000), BT(0xbf000000), BT(0x98000000), BT(0x85000000), BT(0xd6000000), BT(0xcb000000), BT(0xec000000), BT(0xf1000000),
+		BT(0x13000000), BT(0x0e000000), BT(0x29000000), BT(0x34000000), BT(0x67000000), BT(0x7a000000), BT(0x5d000000), BT(0x40000000),
+		BT(0xfb000000), BT(0xe6000000), BT(0xc1000000), BT(0xdc000000), BT(0x8f000000), BT(0x92000000), BT(0xb5000000), BT(0xa8000000),
+		BT(0xde000000), BT(0xc3000000), BT(0xe4000000), BT(0xf9000000), BT(0xaa000000), BT(0xb7000000), BT(0x90000000), BT(0x8d000000),
+		BT(0x36000000), BT(0x2b000000), BT(0x0c000000), BT(0x11000000), BT(0x42000000), BT(0x5f000000), BT(0x78000000), BT(0x65000000),
+		BT(0x94000000), BT(0x89000000), BT(0xae000000), BT(0xb3000000), BT(0xe0000000), BT(0xfd000000), BT(0xda000000), BT(0xc7000000),
+		BT(0x7c000000), BT(0x61000000), BT(0x46000000), BT(0x5b000000), BT(0x08000000), BT(0x15000000), BT(0x32000000), BT(0x2f000000),
+		BT(0x59000000), BT(0x44000000), BT(0x63000000), BT(0x7e000000), BT(0x2d000000), BT(0x30000000), BT(0x17000000), BT(0x0a000000),
+		BT(0xb1000000), BT(0xac000000), BT(0x8b000000), BT(0x96000000), BT(0xc5000000), BT(0xd8000000), BT(0xff000000), BT(0xe2000000),
+		BT(0x26000000), BT(0x3b000000), BT(0x1c000000), BT(0x01000000), BT(0x52000000), BT(0x4f000000), BT(0x68000000), BT(0x75000000),
+		BT(0xce000000), BT(0xd3000000), BT(0xf4000000), BT(0xe9000000), BT(0xba000000), BT(0xa7000000), BT(0x80000000), BT(0x9d000000),
+		BT(0xeb000000), BT(0xf6000000), BT(0xd1000000), BT(0xcc000000), BT(0x9f000000), BT(0x82000000), BT(0xa5000000), BT(0xb8000000),
+		BT(0x03000000), BT(0x1e000000), BT(0x39000000), BT(0x24000000), BT(0x77000000), BT(0x6a000000), BT(0x4d000000), BT(0x50000000),
+		BT(0xa1000000), BT(0xbc000000), BT(0x9b000000), BT(0x86000000), BT(0xd5000000), BT(0xc8000000), BT(0xef000000), BT(0xf2000000),
+		BT(0x49000000), BT(0x54000000), BT(0x73000000), BT(0x6e000000), BT(0x3d000000), BT(0x20000000), BT(0x07000000), BT(0x1a000000),
+		BT(0x6c000000), BT(0x71000000), BT(0x56000000), BT(0x4b000000), BT(0x18000000), BT(0x05000000), BT(0x22000000), BT(0x3f000000),
+		BT(0x84000000), BT(0x99000000), BT(0xbe000000), BT(0xa3000000), BT(0xf0000000), BT(0xed000000), BT(0xca000000), BT(0xd7000000),
+		BT(0x35000000), BT(0x28000000), BT(0x0f000000), BT(0x12000000), BT(0x41000000), BT(0x5c000000), BT(0x7b000000), BT(0x66000000),
+		BT(0xdd000000), BT(0xc0000000), BT(0xe7000000), BT(0xfa000000), BT(0xa9000000), BT(0xb4000000), BT(0x93000000), BT(0x8e000000),
+		BT(0xf8000000), BT(0xe5000000), BT(0xc2000000), BT(0xdf000000), BT(0x8c000000), BT(0x91000000), BT(0xb6000000), BT(0xab000000),
+		BT(0x10000000), BT(0x0d000000), BT(0x2a000000), BT(0x37000000), BT(0x64000000), BT(0x79000000), BT(0x5e000000), BT(0x43000000),
+		BT(0xb2000000), BT(0xaf000000), BT(0x88000000), BT(0x95000000), BT(0xc6000000), BT(0xdb000000), BT(0xfc000000), BT(0xe1000000),
+		BT(0x5a000000), BT(0x47000000), BT(0x60000000), BT(0x7d000000), BT(0x2e000000), BT(0x33000000), BT(0x14000000), BT(0x09000000),
+		BT(0x7f000000), BT(0x62000000), BT(0x45000000), BT(0x58000000), BT(0x0b000000), BT(0x16000000), BT(0x31000000), BT(0x2c000000),
+		BT(0x97000000), BT(0x8a000000), BT(0xad000000), BT(0xb0000000), BT(0xe3000000), BT(0xfe000000), BT(0xd9000000), BT(0xc4000000)
+	}, {
+		BMP_C(0x00000004), BMP_C(0x00000061), BMP_C(0x00000017), BMP_C(0x00000019),
+		BMP_C(0x00000002), BMP_C(0x000000be), BMP_C(0x00000085), BMP_C(0x00000082)
+	}},
+	{ 8UL, BT(0x2f000000), {
+		BT(0x00000000), BT(0x2f000000), BT(0x5e000000), BT(0x71000000), BT(0xbc000000), BT(0x93000000), BT(0xe2000000), BT(0xcd000000),
+		BT(0x57000000), BT(0x78000000), BT(0x09000000), BT(0x26000000), BT(0xeb000000), BT(0xc4000000), BT(0xb5000000), BT(0x9a000000),
+		BT(0xae000000), BT(0x81000000), BT(0xf0000000), BT(0xdf000000), BT(0x12000000), BT(0x3d000000), BT(0x4c000000), BT(0x63000000),
+		BT(0xf9000000), BT(0xd6000000), BT(0xa7000000), BT(0x88000000), BT(0x45000000), BT(0x6a000000), BT(0x1b000000), BT(0x34000000),
+		BT(0x73000000), BT(0x5c000000), BT(0x2d000000), BT(0x02000000), BT(0xcf000000), BT(0xe0000000), BT(0x91000000), BT(0xbe000000),
+		BT(0x24000000), BT(0x0b000000), BT(0x7a000000), BT(0x55000000), BT(0x98000000), BT(0xb7000000), BT(0xc6000000), BT(0xe9000000),
+		BT(0xdd000000), BT(0xf2000000), BT(0x83000000), BT(0xac000000), BT(0x61000000), BT(0x4e000000), BT(0x3f000000), BT(0x10000000),
+		BT(0x8a000000), BT(0xa5000000), BT(0xd4000000), BT(0xfb000000), BT(0x36000000), BT(0x19000000), BT(0x68000000), BT(0x47000000),
+		BT(0xe6000000), BT(0xc9000000), BT(0xb8000000), BT(0x97000000), BT(0x5a000000), BT(0x75000000), BT(0x04000000), BT(0x2b000000),
+		BT(0xb1000000), BT(0x9e000000), BT(0xef000000), BT(0xc0000000), BT(0x0d000000), BT(0x22000000), BT(0x53000000), BT(0x7c000000),
+		BT(0x48000000), BT(0x67000000), BT(0x16000000), BT(0x39000000), BT(0xf4000000), BT(0xdb000000), BT(0xaa000000), BT(0x85000000),
+		BT(0x1f000000), BT(0x30000000), BT(0x41000000), BT(0x6e000000), BT(0xa3000000), BT(0x8c000000), BT(0xfd000000), BT(0xd2000000),
+		BT(0x95000000), BT(0xba000000), BT(0xcb000000), BT(0xe4000000), BT(0x29000000), BT(0x06000000), BT(0x77000000), BT(0x58000000),
+		BT(0xc2000000), BT(0xed000000), BT(0x9c000000), BT(0xb3000000), BT(0x7e000000), BT(0x51000000), BT(0x20000000), BT(0x0f000000),
+		BT(0x3b000000), BT(0x14000000), BT(0x65000000), BT(0x4a000000), BT(0x87000000), BT(0xa8000000), BT(0xd9000000), BT(0xf6000000),
+		BT(0x6c000000), BT(0x43000000), BT(0x32000000), BT(0x1d000000), BT(0xd0000000), BT(0xff000000), BT(0x8e000000), BT(0xa1000000),
+		BT(0xe3000000), BT(0xcc000000), BT(0xbd000000), BT(0x92000000), BT(0x5f000000), BT(0x70000000), BT(0x01000000), BT(0x2e000000),
+		BT(0xb4000000), BT(0x9b000000), BT(0xea000000), BT(0xc5000000), BT(0x08000000), BT(0x27000000), BT(0x56000000), BT(0x79000000),
+		BT(0x4d000000), BT(0x62000000), BT(0x13000000), BT(0x3c000000), BT(0xf1000000), BT(0xde000000), BT(0xaf000000), BT(0x80000000),
+		BT(0x1a000000), BT(0x35000000), BT(0x44000000), BT(0x6b000000), BT(0xa6000000), BT(0x89000000), BT(0xf8000000), BT(0xd7000000),
+		BT(0x90000000), BT(0xbf000000), BT(0xce000000), BT(0xe1000000), BT(0x2c000000), BT(0x03000000), BT(0x72000000), BT(0x5d000000),
+		BT(0xc7000000), BT(0xe8000000), BT(0x99000000), BT(0xb6000000), BT(0x7b000000), BT(0x54000000), BT(0x25000000), BT(0x0a000000),
+		BT(0x3e000000), BT(0x11000000), BT(0x60000000), BT(0x4f000000), BT(0x82000000), BT(0xad000000), BT(0xdc000000), BT(0xf3000000),
+		BT(0x69000000), BT(0x46000000), BT(0x37000000), BT(0x18000000), BT(0xd5000000), BT(0xfa000000), BT(0x8b000000), BT(0xa4000000),
+		BT(0x05000000), BT(0x2a000000), BT(0x5b000000), BT(0x74000000), BT(0xb9000000), BT(0x96000000), BT(0xe7000000), BT(0xc8000000),
+		BT(0x52000000), BT(0x7d000000), BT(0x0c000000), BT(0x23000000), BT(0xee000000), BT(0xc1000000), BT(0xb0000000), BT(0x9f000000),
+		BT(0xab000000), BT(0x84000000), BT(0xf5000000), BT(0xda000000), BT(0x17000000), BT(0x38000000), BT(0x49000000), BT(0x66000000),
+		BT(0xfc000000), BT(0xd3000000), BT(0xa2000000), BT(0x8d000000), BT(0x40000000), BT(0x6f000000), BT(0x1e000000), BT(0x31000000),
+		BT(0x76000000), BT(0x59000000), BT(0x28000000), BT(0x07000000), BT(0xca000000), BT(0xe5000000), BT(0x94000000), BT(0xbb000000),
+		BT(0x21000000), BT(0x0e000000), BT(0x7f000000), BT(0x50000000), BT(0x9d000000), BT(0xb2000000), BT(0xc3000000), BT(0xec000000),
+		BT(0xd8000000), BT(0xf7000000), BT(0x86000000), BT(0xa9000000), BT(0x64000000), BT(0x4b000000), BT(0x3a000000), BT(0x15000000),
+		BT(0x8f000000), BT(0xa0000000), BT(0xd1000000), BT(0xfe000000), BT(0x33000000), BT(0x1c000000), BT(0x6d000000), BT(0x42000000)
+	}, {
+		BMP_C(0x00000010), BMP_C(0x000000a2), BMP_C(0x00000008), BMP_C(0x00000051),
+		BMP_C(0x00000004), BMP_C(0x000000bf), BMP_C(0x00000002), BMP_C(0x000000c8)
+	}},
+	{ 8UL, BT(0x31000000), {
+		BT(0x00000000), BT(0x31000000), BT(0x62000000), BT(0x53000000), BT(0xc4000000), BT(0xf5000000), BT(0xa6000000), BT(0x97000000),
+		BT(0xb9000000), BT(0x88000000), BT(0xdb000000), BT(0xea000000), BT(0x7d000000), BT(0x4c000000), BT(0x1f000000), BT(0x2e000000),
+		BT(0x43000000), BT(0x72000000), BT(0x21000000), BT(0x10000000), BT(0x87000000), BT(0xb6000000), BT(0xe5000000), BT(0xd4000000),
+		BT(0xfa000000), BT(0xcb000000), BT(0x98000000), BT(0xa9000000), BT(0x3e000000), BT(0x0f000000), BT(0x5c000000), BT(0x6d000000),
+		BT(0x86000000), BT(0xb7000000), BT(0xe4000000), BT(0xd5000000), BT(0x42000000), BT(0x73000000), BT(0x20000000), BT(0x11000000),
+		BT(0x3f000000), BT(0x0e000000), BT(0x5d000000), BT(0x6c000000), BT(0xfb000000), BT(0xca000000), BT(0x99000000), BT(0xa8000000),
+		BT(0xc5000000), BT(0xf4000000), BT(0xa7000000), BT(0x96000000), BT(0x01000000), BT(0x30000000), BT(0x63000000), BT(0x52000000),
+		BT(0x7c000000), BT(0x4d000000), BT(0x1e000000), BT(0x2f000000), BT(0xb8000000), BT(0x89000000), BT(0xda000000), BT(0xeb000000),
+		BT(0x3d000000), BT(0x0c000000), BT(0x5f000000), BT(0x6e000000), BT(0xf9000000), BT(0xc8000000), BT(0x9b000000), BT(0xaa000000),
+		BT(0x84000000), BT(0xb5000000), BT(0xe6000000), BT(0xd7000000), BT(0x40000000), BT(0x71000000), BT(0x22000000), BT(0x13000000),
+		BT(0x7e000000), BT(0x4f000000), BT(0x1c000000), BT(0x2d000000), BT(0xba000000), BT(0x8b000000), BT(0xd8000000), BT(0xe9000000),
+		BT(0xc7000000), BT(0xf6000000), BT(0xa5000000), BT(0x94000000), BT(0x03000000), BT(0x32000000), BT(0x61000000), BT(0x50000000),
+		BT(0xbb000000), BT(0x8a000000), BT(0xd9000000), BT(0xe8000000), BT(0x7f000000), BT(0x4e000000), BT(0x1d000000), BT(0x2c000000),
+		BT(0x02000000), BT(0x33000000), BT(0x60000000), BT(0x51000000), BT(0xc6000000), BT(0xf7000000), BT(0xa4000000), BT(0x95000000),
+		BT(0xf8000000), BT(0xc9000000), BT(0x9a000000), BT(0xab000000), BT(0x3c000000), BT(0x0d000000), BT(0x5e000000), BT(0x6f000000),
+		BT(0x41000000), BT(0x70000000), BT(0x23000000), BT(0x12000000), BT(0x85000000), BT(0xb4000000), BT(0xe7000000), BT(0xd6000000),
+		BT(0x7a000000), BT(0x4b000000), BT(0x18000000), BT(0x29000000), BT(0xbe000000), BT(0x8f000000), BT(0xdc000000), BT(0xed000000),
+		BT(0xc3000000), BT(0xf2000000), BT(0xa1000000), BT(0x90000000), BT(0x07000000), BT(0x36000000), BT(0x65000000), BT(0x54000000),
+		BT(0x39000000), BT(0x08000000), BT(0x5b000000), BT(0x6a000000), BT(0xfd000000), BT(0xcc000000), BT(0x9f000000), BT(0xae000000),
+		BT(0x80000000), BT(0xb1000000), BT(0xe2000000), BT(0xd3000000), BT(0x44000000), BT(0x75000000), BT(0x26000000), BT(0x17000000),
+		BT(0xfc000000), BT(0xcd000000), BT(0x9e000000), BT(0xaf000000), BT(0x38000000), BT(0x09000000), BT(0x5a000000), BT(0x6b000000),
+		BT(0x45000000), BT(0x74000000), BT(0x27000000), BT(0x16000000), BT(0x81000000), BT(0xb0000000), BT(0xe3000000), BT(0xd2000000),
+		BT(0xbf000000), BT(0x8e000000), BT(0xdd000000), BT(0xec000000), BT(0x7b000000), BT(0x4a000000), BT(0x19000000), BT(0x28000000),
+		BT(0x06000000), BT(0x37000000), BT(0x64000000), BT(0x55000000), BT(0xc2000000), BT(0xf3000000), BT(0xa0000000), BT(0x91000000),
+		BT(0x47000000), BT(0x76000000), BT(0x25000000), BT(0x14000000), BT(0x83000000), BT(0xb2000000), BT(0xe1000000), BT(0xd0000000),
+		BT(0xfe000000), BT(0xcf000000), BT(0x9c000000), BT(0xad000000), BT(0x3a000000), BT(0x0b000000), BT(0x58000000), BT(0x69000000),
+		BT(0x04000000), BT(0x35000000), BT(0x66000000), BT(0x57000000), BT(0xc0000000), BT(0xf1000000), BT(0xa2000000), BT(0x93000000),
+		BT(0xbd000000), BT(0x8c000000), BT(0xdf000000), BT(0xee000000), BT(0x79000000), BT(0x48000000), BT(0x1b000000), BT(0x2a000000),
+		BT(0xc1000000), BT(0xf0000000), BT(0xa3000000), BT(0x92000000), BT(0x05000000), BT(0x34000000), BT(0x67000000), BT(0x56000000),
+		BT(0x78000000), BT(0x49000000), BT(0x1a000000), BT(0x2b000000), BT(0xbc000000), BT(0x8d000000), BT(0xde000000), BT(0xef000000),
+		BT(0x82000000), BT(0xb3000000), BT(0xe0000000), BT(0xd1000000), BT(0x46000000), BT(0x77000000), BT(0x24000000), BT(0x15000000),
+		BT(0x3b000000), BT(0x0a000000), BT(0x59000000), BT(0x68000000), BT(0xff000000), BT(0xce000000), BT(0x9d000000), BT(0xac000000)
+	}, {
+		BMP_C(0x00000010), BMP_C(0x00000054), BMP_C(0x00000008), BMP_C(0x0000002a),
+		BMP_C(0x00000004), BMP_C(0x00000015), BMP_C(0x00000002), BMP_C(0x00000092)
+	}},
+	{ 8UL, BT(0x39000000), {
+		BT(0x00000000), BT(0x39000000), BT(0x72000000), BT(0x4b000000), BT(0xe4000000), BT(0xdd000000), BT(0x96000000), BT(0xaf000000),
+		BT(0xf1000000), BT(0xc8000000), BT(0x83000000), BT(0xba000000), BT(0x15000000), BT(0x2c000000), BT(0x67000000), BT(0x5e000000),
+		BT(0xdb000000), BT(0xe2000000), BT(0xa9000000), BT(0x90000000), BT(0x3f000000), BT(0x06000000), BT(0x4d000000), BT(0x74000000),
+		BT(0x2a000000), BT(0x13000000), BT(0x58000000), BT(0x61000000), BT(0xce000000), BT(0xf7000000), BT(0xbc000000), BT(0x85000000),
+		BT(0x8f000000), BT(0xb6000000), BT(0xfd000000), BT(0xc4000000), BT(0x6b000000), BT(0x52000000), BT(0x19000000), BT(0x20000000),
+		BT(0x7e000000), BT(0x47000000), BT(0x0c000000), BT(0x35000000), BT(0x9a000000), BT(0xa3000000), BT(0xe8000000), BT(0xd1000000),
+		BT(0x54000000), BT(0x6d000000), BT(0x26000000), BT(0x1f000000), BT(0xb0000000), BT(0x89000000), BT(0xc2000000), BT(0xfb000000),
+		BT(0xa5000000), BT(0x9c000000), BT(0xd7000000), BT(0xee000000), BT(0x41000000), BT(0x78000000), BT(0x33000000), BT(0x0a000000),
+		BT(0x27000000), BT(0x1e000000), BT(0x55000000), BT(0x6c000000), BT(0xc3000000), BT(0xfa000000), BT(0xb1000000), BT(0x88000000),
+		BT(0xd6000000), BT(0xef000000), BT(0xa4000000), BT(0x9d000000), BT(0x32000000), BT(0x0b000000), BT(0x40000000), BT(0x79000000),
+		BT(0xfc000000), BT(0xc5000000), BT(0x8e000000), BT(0xb7000000), BT(0x18000000), BT(0x21000000), BT(0x6a000000), BT(0x53000000),
+		BT(0x0d000000), BT(0x34000000), BT(0x7f000000), BT(0x46000000), BT(0xe9000000), BT(0xd0000000), BT(0x9b000000), BT(0xa2000000),
+		BT(0xa8000000), BT(0x91000000), BT(0xda000000), BT(0xe3000000), BT(0x4c000000), BT(0x75000000), BT(0x3e000000), BT(0x07000000),
+		BT(0x59000000), BT(0x60000000), BT(0x2b000000), BT(0x12000000), BT(0xbd000000), BT(0x84000000), BT(0xcf000000), BT(0xf6000000),
+		BT(0x73000000), BT(0x4a000000), BT(0x01000000), BT(0x38000000), BT(0x97000000), BT(0xae000000), BT(0xe5000000), BT(0xdc000000),
+		BT(0x82000000), BT(0xbb000000), BT(0xf0000000), BT(0xc9000000), BT(0x66000000), BT(0x5f000000), BT(0x14000000), BT(0x2d000000),
+		BT(0x4e000000), BT(0x77000000), BT(0x3c000000), BT(0x05000000), BT(0xaa000000), BT(0x93000000), BT(0xd8000000), BT(0xe1000000),
+		BT(0xbf000000), BT(0x86000000), BT(0xcd000000), BT(0xf4000000), BT(0x5b000000), BT(0x62000000), BT(0x29000000), BT(0x10000000),
+		BT(0x95000000), BT(0xac000000), BT(0xe7000000), BT(0xde000000), BT(0x71000000), BT(0x48000000), BT(0x03000000), BT(0x3a000000),
+		BT(0x64000000), BT(0x5d000000), BT(0x16000000), BT(0x2f000000), BT(0x80000000), BT(0xb9000000), BT(0xf2000000), BT(0xcb000000),
+		BT(0xc1000000), BT(0xf8000000), BT(0xb3000000), BT(0x8a000000), BT(0x25000000), BT(0x1c000000), BT(0x57000000), BT(0x6e000000),
+		BT(0x30000000), BT(0x09000000), BT(0x42000000), BT(0x7b000000), BT(0xd4000000), BT(0xed000000), BT(0xa6000000), BT(0x9f000000),
+		BT(0x1a000000), BT(0x23000000), BT(0x68000000), BT(0x51000000), BT(0xfe000000), BT(0xc7000000), BT(0x8c000000), BT(0xb5000000),
+		BT(0xeb000000), BT(0xd2000000), BT(0x99000000), BT(0xa0000000), BT(0x0f000000), BT(0x36000000), BT(0x7d000000), BT(0x44000000),
+		BT(0x69000000), BT(0x50000000), BT(0x1b000000), BT(0x22000000), BT(0x8d000000), BT(0xb4000000), BT(0xff000000), BT(0xc6000000),
+		BT(0x98000000), BT(0xa1000000), BT(0xea000000), BT(0xd3000000), BT(0x7c000000), BT(0x45000000), BT(0x0e000000), BT(0x37000000),
+		BT(0xb2000000), BT(0x8b000000), BT(0xc0000000), BT(0xf9000000), BT(0x56000000), BT(0x6f000000), BT(0x24000000), BT(0x1d000000),
+		BT(0x43000000), BT(0x7a000000), BT(0x31000000), BT(0x08000000), BT(0xa7000000), BT(0x9e000000), BT(0xd5000000), BT(0xec000000),
+		BT(0xe6000000), BT(0xdf000000), BT(0x94000000), BT(0xad000000), BT(0x02000000), BT(0x3b000000), BT(0x70000000), BT(0x49000000),
+		BT(0x17000000), BT(0x2e000000), BT(0x65000000), BT(0x5c000000), BT(0xf3000000), BT(0xca000000), BT(0x81000000), BT(0xb8000000),
+		BT(0x3d000000), BT(0x04000000), BT(0x4f000000), BT(0x76000000), BT(0xd9000000), BT(0xe0000000), BT(0xab000000), BT(0x92000000),
+		BT(0xcc000000), BT(0xf5000000), BT(0xbe000000), BT(0x87000000), BT(0x28000000), BT(0x11000000), BT(0x5a000000), BT(0x63000000)
+	}, {
+		BMP_C(0x00000004), BMP_C(0x0000004e), BMP_C(0x000000e4), BMP_C(0x00000040),
+		BMP_C(0x00000002), BMP_C(0x00000027), BMP_C(0x00000072), BMP_C(0x00000020)
+	}},
+	{ 8UL, BT(0x49000000), {
+		BT(0x00000000), BT(0x49000000), BT(0x92000000), BT(0xdb000000), BT(0x6d000000), BT(0x24000000), BT(0xff000000), BT(0xb6000000),
+		BT(0xda000000), BT(0x93000000), BT(0x48000000), BT(0x01000000), BT(0xb7000000), BT(0xfe000000), BT(0x25000000), BT(0x6c000000),
+		BT(0xfd000000), BT(0xb4000000), BT(0x6f000000), BT(0x26000000), BT(0x90000000), BT(0xd9000000), BT(0x02000000), BT(0x4b000000),
+		BT(0x27000000), BT(0x6e000000), BT(0xb5000000), BT(0xfc000000), BT(0x4a000000), BT(0x03000000), BT(0xd8000000), BT(0x91000000),
+		BT(0xb3000000), BT(0xfa000000), BT(0x21000000), BT(0x68000000), BT(0xde000000), BT(0x97000000), BT(0x4c000000), BT(0x05000000),
+		BT(0x69000000), BT(0x20000000), BT(0xfb000000), BT(0xb2000000), BT(0x04000000), BT(0x4d000000), BT(0x96000000), BT(0xdf000000),
+		BT(0x4e000000), BT(0x07000000), BT(0xdc000000), BT(0x95000000), BT(0x23000000), BT(0x6a000000), BT(0xb1000000), BT(0xf8000000),
+		BT(0x94000000), BT(0xdd000000), BT(0x06000000), BT(0x4f000000), BT(0xf9000000), BT(0xb0000000), BT(0x6b000000), BT(0x22000000),
+		BT(0x2f000000), BT(0x66000000), BT(0xbd000000), BT(0xf4000000), BT(0x42000000), BT(0x0b000000), BT(0xd0000000), BT(0x99000000),
+		BT(0xf5000000), BT(0xbc000000), BT(0x67000000), BT(0x2e000000), BT(0x98000000), BT(0xd1000000), BT(0x0a000000), BT(0x43000000),
+		BT(0xd2000000), BT(0x9b000000), BT(0x40000000), BT(0x09000000), BT(0xbf000000), BT(0xf6000000), BT(0x2d000000), BT(0x64000000),
+		BT(0x08000000), BT(0x41000000), BT(0x9a000000), BT(0xd3000000), BT(0x65000000), BT(0x2c000000), BT(0xf7000000), BT(0xbe000000),
+		BT(0x9c000000), BT(0xd5000000), BT(0x0e000000), BT(0x47000000), BT(0xf1000000), BT(0xb8000000), BT(0x63000000), BT(0x2a000000),
+		BT(0x46000000), BT(0x0f000000), BT(0xd4000000), BT(0x9d000000), BT(0x2b000000), BT(0x62000000), BT(0xb9000000), BT(0xf0000000),
+		BT(0x61000000), BT(0x28000000), BT(0xf3000000), BT(0xba000000), BT(0x0c000000), BT(0x45000000), BT(0x9e000000), BT(0xd7000000),
+		BT(0xbb000000), BT(0xf2000000), BT(0x29000000), BT(0x60000000), BT(0xd6000000), BT(0x9f000000), BT(0x44000000), BT(0x0d000000),
+		BT(0x5e000000), BT(0x17000000), BT(0xcc000000), BT(0x85000000), BT(0x33000000), BT(0x7a000000), BT(0xa1000000), BT(0xe8000000),
+		BT(0x84000000), BT(0xcd000000), BT(0x16000000), BT(0x5f000000), BT(0xe9000000), BT(0xa0000000), BT(0x7b000000), BT(0x32000000),
+		BT(0xa3000000), BT(0xea000000), BT(0x31000000), BT(0x78000000), BT(0xce000000), BT(0x87000000), BT(0x5c000000), BT(0x15000000),
+		BT(0x79000000), BT(0x30000000), BT(0xeb000000), BT(0xa2000000), BT(0x14000000), BT(0x5d000000), BT(0x86000000), BT(0xcf000000),
+		BT(0xed000000), BT(0xa4000000), BT(0x7f000000), BT(0x36000000), BT(0x80000000), BT(0xc9000000), BT(0x12000000), BT(0x5b000000),
+		BT(0x37000000), BT(0x7e000000), BT(0xa5000000), BT(0xec000000), BT(0x5a000000), BT(0x13000000), BT(0xc8000000), BT(0x81000000),
+		BT(0x10000000), BT(0x59000000), BT(0x82000000), BT(0xcb000000), BT(0x7d000000), BT(0x34000000), BT(0xef000000), BT(0xa6000000),
+		BT(0xca000000), BT(0x83000000), BT(0x58000000), BT(0x11000000), BT(0xa7000000), BT(0xee000000), BT(0x35000000), BT(0x7c000000),
+		BT(0x71000000), BT(0x38000000), BT(0xe3000000), BT(0xaa000000), BT(0x1c000000), BT(0x55000000), BT(0x8e000000), BT(0xc7000000),
+		BT(0xab000000), BT(0xe2000000), BT(0x39000000), BT(0x70000000), BT(0xc6000000), BT(0x8f000000), BT(0x54000000), BT(0x1d000000),
+		BT(0x8c000000), BT(0xc5000000), BT(0x1e000000), BT(0x57000000), BT(0xe1000000), BT(0xa8000000), BT(0x73000000), BT(0x3a000000),
+		BT(0x56000000), BT(0x1f000000), BT(0xc4000000), BT(0x8d000000), BT(0x3b000000), BT(0x72000000), BT(0xa9000000), BT(0xe0000000),
+		BT(0xc2000000), BT(0x8b000000), BT(0x50000000), BT(0x19000000), BT(0xaf000000), BT(0xe6000000), BT(0x3d000000), BT(0x74000000),
+		BT(0x18000000), BT(0x51000000), BT(0x8a000000), BT(0xc3000000), BT(0x75000000), BT(0x3c000000), BT(0xe7000000), BT(0xae000000),
+		BT(0x3f000000), BT(0x76000000), BT(0xad000000), BT(0xe4000000), BT(0x52000000), BT(0x1b000000), BT(0xc0000000), BT(0x89000000),
+		BT(0xe5000000), BT(0xac000000), BT(0x77000000), BT(0x3e000000), BT(0x88000000), BT(0xc1000000), BT(0x1a000000), BT(0x53000000)
+	}, {
+		BMP_C(0x000000ba), BMP_C(0x0000002a), BMP_C(0x000000f8), BMP_C(0x00000038),
+		BMP_C(0x000000e3), BMP_C(0x00000020), BMP_C(0x000000f7), BMP_C(0x00000043)
+	}},
+	{ 8UL, BT(0x9b000000), {
+		BT(0x00000000), BT(0x9b000000), BT(0xad000000), BT(0x36000000), BT(0xc1000000), BT(0x5a000000), BT(0x6c000000), BT(0xf7000000),
+		BT(0x19000000), BT(0x82000000), BT(0xb4000000), BT(0x2f000000), BT(0xd8000000), BT(0x43000000), BT(0x75000000), BT(0xee000000),
+		BT(0x32000000), BT(0xa9000000), BT(0x9f000000), BT(0x04000000), BT(0xf3000000), BT(0x68000000), BT(0x5e000000), BT(0xc5000000),
+		BT(0x2b000000), BT(0xb0000000), BT(0x86000000), BT(0x1d000000), BT(0xea000000), BT(0x71000000), BT(0x47000000), BT(0xdc000000),
+		BT(0x64000000), BT(0xff000000), BT(0xc9000000), BT(0x52000000), BT(0xa5000000), BT(0x3e000000), BT(0x08000000), BT(0x93000000),
+		BT(0x7d000000), BT(0xe6000000), BT(0xd0000000), BT(0x4b000000), BT(0xbc000000), BT(0x27000000), BT(0x11000000), BT(0x8a000000),
+		BT(0x56000000), BT(0xcd000000), BT(0xfb000000), BT(0x60000000), BT(0x97000000), BT(0x0c000000), BT(0x3a000000), BT(0xa1000000),
+		BT(0x4f000000), BT(0xd4000000), BT(0xe2000000), BT(0x79000000), BT(0x8e000000), BT(0x15000000), BT(0x23000000), BT(0xb8000000),
+		BT(0xc8000000), BT(0x53000000), BT(0x65000000), BT(0xfe000000), BT(0x09000000), BT(0x92000000), BT(0xa4000000), BT(0x3f000000),
+		BT(0xd1000000), BT(0x4a000000), BT(0x7c000000), BT(0xe7000000), BT(0x10000000), BT(0x8b000000), BT(0xbd000000), BT(0x26000000),
+		BT(0xfa000000), BT(0x61000000), BT(0x57000000), BT(0xcc000000), BT(0x3b000000), BT(0xa0000000), BT(0x96000000), BT(0x0d000000),
+		BT(0xe3000000), BT(0x78000000), BT(0x4e000000), BT(0xd5000000), BT(0x22000000), BT(0xb9000000), BT(0x8f000000), BT(0x14000000),
+		BT(0xac000000), BT(0x37000000), BT(0x01000000), BT(0x9a000000), BT(0x6d000000), BT(0xf6000000), BT(0xc0000000), BT(0x5b000000),
+		BT(0xb5000000), BT(0x2e000000), BT(0x18000000), BT(0x83000000), BT(0x74000000), BT(0xef000000), BT(0xd9000000), BT(0x42000000),
+		BT(0x9e000000), BT(0x05000000), BT(0x33000000), BT(0xa8000000), BT(0x5f000000), BT(0xc4000000), BT(0xf2000000), BT(0x69000000),
+		BT(0x87000000), BT(0x1c000000), BT(0x2a000000), BT(0xb1000000), BT(0x46000000), BT(0xdd000000), BT(0xeb000000), BT(0x70000000),
+		BT(0x0b000000), BT(0x90000000), BT(0xa6000000), BT(0x3d000000), BT(0xca000000), BT(0x51000000), BT(0x67000000), BT(0xfc000000),
+		BT(0x12000000), BT(0x89000000), BT(0xbf000000), BT(0x24000000), BT(0xd3000000), BT(0x48000000), BT(0x7e000000), BT(0xe5000000),
+		BT(0x39000000), BT(0xa2000000), BT(0x94000000), BT(0x0f000000), BT(0xf8000000), BT(0x63000000), BT(0x55000000), BT(0xce000000),
+		BT(0x20000000), BT(0xbb000000), BT(0x8d000000), BT(0x16000000), BT(0xe1000000), BT(0x7a000000), BT(0x4c000000), BT(0xd7000000),
+		BT(0x6f000000), BT(0xf4000000), BT(0xc2000000), BT(0x59000000), BT(0xae000000), BT(0x35000000), BT(0x03000000), BT(0x98000000),
+		BT(0x76000000), BT(0xed000000), BT(0xdb000000), BT(0x40000000), BT(0xb7000000), BT(0x2c000000), BT(0x1a000000), BT(0x81000000),
+		BT(0x5d000000), BT(0xc6000000), BT(0xf0000000), BT(0x6b000000), BT(0x9c000000), BT(0x07000000), BT(0x31000000), BT(0xaa000000),
+		BT(0x44000000), BT(0xdf000000), BT(0xe9000000), BT(0x72000000), BT(0x85000000), BT(0x1e000000), BT(0x28000000), BT(0xb3000000),
+		BT(0xc3000000), BT(0x58000000), BT(0x6e000000), BT(0xf5000000), BT(0x02000000), BT(0x99000000), BT(0xaf000000), BT(0x34000000),
+		BT(0xda000000), BT(0x41000000), BT(0x77000000), BT(0xec000000), BT(0x1b000000), BT(0x80000000), BT(0xb6000000), BT(0x2d000000),
+		BT(0xf1000000), BT(0x6a000000), BT(0x5c000000), BT(0xc7000000), BT(0x30000000), BT(0xab000000), BT(0x9d000000), BT(0x06000000),
+		BT(0xe8000000), BT(0x73000000), BT(0x45000000), BT(0xde000000), BT(0x29000000), BT(0xb2000000), BT(0x84000000), BT(0x1f000000),
+		BT(0xa7000000), BT(0x3c000000), BT(0x0a000000), BT(0x91000000), BT(0x66000000), BT(0xfd000000), BT(0xcb000000), BT(0x50000000),
+		BT(0xbe000000), BT(0x25000000), BT(0x13000000), BT(0x88000000), BT(0x7f000000), BT(0xe4000000), BT(0xd2000000), BT(0x49000000),
+		BT(0x95000000), BT(0x0e000000), BT(0x38000000), BT(0xa3000000), BT(0x54000000), BT(0xcf000000), BT(0xf9000000), BT(0x62000000),
+		BT(0x8c000000), BT(0x17000000), BT(0x21000000), BT(0xba000000), BT(0x4d000000), BT(0xd6000000), BT(0xe0000000), BT(0x7b000000)
+	}, {
+		BMP_C(0x00000010), BMP_C(0x00000052), BMP_C(0x00000008), BMP_C(0x00000029),
+		BMP_C(0x00000004), BMP_C(0x000000d9), BMP_C(0x00000002), BMP_C(0x000000a1)
+	}},
+	{ 8UL, BT(0xa7000000), {
+		BT(0x00000000), BT(0xa7000000), BT(0xe9000000), BT(0x4e000000), BT(0x75000000), BT(0xd2000000), BT(0x9c000000), BT(0x3b000000),
+		BT(0xea000000), BT(0x4d000000), BT(0x03000000), BT(0xa4000000), BT(0x9f000000), BT(0x38000000), BT(0x76000000), BT(0xd1000000),
+		BT(0x73000000), BT(0xd4000000), BT(0x9a000000), BT(0x3d000000), BT(0x06000000), BT(0xa1000000), BT(0xef000000), BT(0x48000000),
+		BT(0x99000000), BT(0x3e000000), BT(0x70000000), BT(0xd7000000), BT(0xec000000), BT(0x4b000000), BT(0x05000000), BT(0xa2000000),
+		BT(0xe6000000), BT(0x41000000), BT(0x0f000000), BT(0xa8000000), BT(0x93000000), BT(0x34000000), BT(0x7a000000), BT(0xdd000000),
+		BT(0x0c000000), BT(0xab000000), BT(0xe5000000), BT(0x42000000), BT(0x79000000), BT(0xde000000), BT(0x90000000), BT(0x37000000),
+		BT(0x95000000), BT(0x32000000), BT(0x7c000000), BT(0xdb000000), BT(0xe0000000), BT(0x47000000), BT(0x09000000), BT(0xae000000),
+		BT(0x7f000000), BT(0xd8000000), BT(0x96000000), BT(0x31000000), BT(0x0a000000), BT(0xad000000), BT(0xe3000000), BT(0x44000000),
+		BT(0x6b000000), BT(0xcc000000), BT(0x82000000), BT(0x25000000), BT(0x1e000000), BT(0xb9000000), BT(0xf7000000), BT(0x50000000),
+		BT(0x81000000), BT(0x26000000), BT(0x68000000), BT(0xcf000000), BT(0xf4000000), BT(0x53000000), BT(0x1d000000), BT(0xba000000),
+		BT(0x18000000), BT(0xbf000000), BT(0xf1000000), BT(0x56000000), BT(0x6d000000), BT(0xca000000), BT(0x84000000), BT(0x23000000),
+		BT(0xf2000000), BT(0x55000000), BT(0x1b000000), BT(0xbc000000), BT(0x87000000), BT(0x20000000), BT(0x6e000000), BT(0xc9000000),
+		BT(0x8d000000), BT(0x2a000000), BT(0x64000000), BT(0xc3000000), BT(0xf8000000), BT(0x5f000000), BT(0x11000000), BT(0xb6000000),
+		BT(0x67000000), BT(0xc0000000), BT(0x8e000000), BT(0x29000000), BT(0x12000000), BT(0xb5000000), BT(0xfb000000), BT(0x5c000000),
+		BT(0xfe000000), BT(0x59000000), BT(0x17000000), BT(0xb0000000), BT(0x8b000000), BT(0x2c000000), BT(0x62000000), BT(0xc5000000),
+		BT(0x14000000), BT(0xb3000000), BT(0xfd000000), BT(0x5a000000), BT(0x61000000), BT(0xc6000000), BT(0x88000000), BT(0x2f000000),
+		BT(0xd6000000), BT(0x71000000), BT(0x3f000000), BT(0x98000000), BT(0xa3000000), BT(0x04000000), BT(0x4a000000), BT(0xed000000),
+		BT(0x3c000000), BT(0x9b000000), BT(0xd5000000), BT(0x72000000), BT(0x49000000), BT(0xee000000), BT(0xa0000000), BT(0x07000000),
+		BT(0xa5000000), BT(0x02000000), BT(0x4c000000), BT(0xeb000000), BT(0xd0000000), BT(0x77000000), BT(0x39000000), BT(0x9e000000),
+		BT(0x4f000000), BT(0xe8000000), BT(0xa6000000), BT(0x01000000), BT(0x3a000000), BT(0x9d000000), BT(0xd3000000), BT(0x74000000),
+		BT(0x30000000), BT(0x97000000), BT(0xd9000000), BT(0x7e000000), BT(0x45000000), BT(0xe2000000), BT(0xac000000), BT(0x0b000000),
+		BT(0xda000000), BT(0x7d000000), BT(0x33000000), BT(0x94000000), BT(0xaf000000), BT(0x08000000), BT(0x46000000), BT(0xe1000000),
+		BT(0x43000000), BT(0xe4000000), BT(0xaa000000), BT(0x0d000000), BT(0x36000000), BT(0x91000000), BT(0xdf000000), BT(0x78000000),
+		BT(0xa9000000), BT(0x0e000000), BT(0x40000000), BT(0xe7000000), BT(0xdc000000), BT(0x7b000000), BT(0x35000000), BT(0x92000000),
+		BT(0xbd000000), BT(0x1a000000), BT(0x54000000), BT(0xf3000000), BT(0xc8000000), BT(0x6f000000), BT(0x21000000), BT(0x86000000),
+		BT(0x57000000), BT(0xf0000000), BT(0xbe000000), BT(0x19000000), BT(0x22000000), BT(0x85000000), BT(0xcb000000), BT(0x6c000000),
+		BT(0xce000000), BT(0x69000000), BT(0x27000000), BT(0x80000000), BT(0xbb000000), BT(0x1c000000), BT(0x52000000), BT(0xf5000000),
+		BT(0x24000000), BT(0x83000000), BT(0xcd000000), BT(0x6a000000), BT(0x51000000), BT(0xf6000000), BT(0xb8000000), BT(0x1f000000),
+		BT(0x5b000000), BT(0xfc000000), BT(0xb2000000), BT(0x15000000), BT(0x2e000000), BT(0x89000000), BT(0xc7000000), BT(0x60000000),
+		BT(0xb1000000), BT(0x16000000), BT(0x58000000), BT(0xff000000), BT(0xc4000000), BT(0x63000000), BT(0x2d000000), BT(0x8a000000),
+		BT(0x28000000), BT(0x8f000000), BT(0xc1000000), BT(0x66000000), BT(0x5d000000), BT(0xfa000000), BT(0xb4000000), BT(0x13000000),
+		BT(0xc2000000), BT(0x65000000), BT(0x2b000000), BT(0x8c000000), BT(0xb7000000), BT(0x10000000), BT(0x5e000000), BT(0xf9000000)
+	}, {
+		BMP_C(0x00000010), BMP_C(0x000000bc), BMP_C(0x00000008), BMP_C(0x0000005e),
+		BMP_C(0x00000004), BMP_C(0x0000002f), BMP_C(0x00000002), BMP_C(0x000000c4)
+	}},
+	{ 8UL, BT(0xd5000000), {
+		BT(0x00000000), BT(0xd5000000), BT(0x7f000000), BT(0xaa000000), BT(0xfe000000), BT(0x2b000000), BT(0x81000000), BT(0x54000000),
+		BT(0x29000000), BT(0xfc000000), BT(0x56000000), BT(0x83000000), BT(0xd7000000), BT(0x02000000), BT(0xa8000000), BT(0x7d000000),
+		BT(0x52000000), BT(0x87000000), BT(0x2d000000), BT(0xf8000000), BT(0xac000000), BT(0x79000000), BT(0xd3000000), BT(0x06000000),
+		BT(0x7b000000), BT(0xae000000), BT(0x04000000), BT(0xd1000000), BT(0x85000000), BT(0x50000000), BT(0xfa000000), BT(0x2f000000),
+		BT(0xa4000000), BT(0x71000000), BT(0xdb000000), BT(0x0e000000), BT(0x5a000000), BT(0x8f000000), BT(0x25000000), BT(0xf0000000),
+		BT(0x8d000000), BT(0x58000000), BT(0xf2000000), BT(0x27000000), BT(0x73000000), BT(0xa6000000), BT(0x0c000000), BT(0xd9000000),
+		BT(0xf6000000), BT(0x23000000), BT(0x89000000), BT(0x5c000000), BT(0x08000000), BT(0xdd000000), BT(0x77000000), BT(0xa2000000),
+		BT(0xdf000000), BT(0x0a000000), BT(0xa0000000), BT(0x75000000), BT(0x21000000), BT(0xf4000000), BT(0x5e000000), BT(0x8b000000),
+		BT(0x9d000000), BT(0x48000000), BT(0xe2000000), BT(0x37000000), BT(0x63000000), BT(0xb6000000), BT(0x1c000000), BT(0xc9000000),
+		BT(0xb4000000), BT(0x61000000), BT(0xcb000000), BT(0x1e000000), BT(0x4a000000), BT(0x9f000000), BT(0x35000000), BT(0xe0000000),
+		BT(0xcf000000), BT(0x1a000000), BT(0xb0000000), BT(0x65000000), BT(0x31000000), BT(0xe4000000), BT(0x4e000000), BT(0x9b000000),
+		BT(0xe6000000), BT(0x33000000), BT(0x99000000), BT(0x4c000000), BT(0x18000000), BT(0xcd000000), BT(0x67000000), BT(0xb2000000),
+		BT(0x39000000), BT(0xec000000), BT(0x46000000), BT(0x93000000), BT(0xc7000000), BT(0x12000000), BT(0xb8000000), BT(0x6d000000),
+		BT(0x10000000), BT(0xc5000000), BT(0x6f000000), BT(0xba000000), BT(0xee000000), BT(0x3b000000), BT(0x91000000), BT(0x44000000),
+		BT(0x6b000000), BT(0xbe000000), BT(0x14000000), BT(0xc1000000), BT(0x95000000), BT(0x40000000), BT(0xea000000), BT(0x3f000000),
+		BT(0x42000000), BT(0x97000000), BT(0x3d000000), BT(0xe8000000), BT(0xbc000000), BT(0x69000000), BT(0xc3000000), BT(0x16000000),
+		BT(0xef000000), BT(0x3a000000), BT(0x90000000), BT(0x45000000), BT(0x11000000), BT(0xc4000000), BT(0x6e000000), BT(0xbb000000),
+		BT(0xc6000000), BT(0x13000000), BT(0xb9000000), BT(0x6c000000), BT(0x38000000), BT(0xed000000), BT(0x47000000), BT(0x92000000),
+		BT(0xbd000000), BT(0x68000000), BT(0xc2000000), BT(0x17000000), BT(0x43000000), BT(0x96000000), BT(0x3c000000), BT(0xe9000000),
+		BT(0x94000000), BT(0x41000000), BT(0xeb000000), BT(0x3e000000), BT(0x6a000000), BT(0xbf000000), BT(0x15000000), BT(0xc0000000),
+		BT(0x4b000000), BT(0x9e000000), BT(0x34000000), BT(0xe1000000), BT(0xb5000000), BT(0x60000000), BT(0xca000000), BT(0x1f000000),
+		BT(0x62000000), BT(0xb7000000), BT(0x1d000000), BT(0xc8000000), BT(0x9c000000), BT(0x49000000), BT(0xe3000000), BT(0x36000000),
+		BT(0x19000000), BT(0xcc000000), BT(0x66000000), BT(0xb3000000), BT(0xe7000000), BT(0x32000000), BT(0x98000000), BT(0x4d000000),
+		BT(0x30000000), BT(0xe5000000), BT(0x4f000000), BT(0x9a000000), BT(0xce000000), BT(0x1b000000), BT(0xb1000000), BT(0x64000000),
+		BT(0x72000000), BT(0xa7000000), BT(0x0d000000), BT(0xd8000000), BT(0x8c000000), BT(0x59000000), BT(0xf3000000), BT(0x26000000),
+		BT(0x5b000000), BT(0x8e000000), BT(0x24000000), BT(0xf1000000), BT(0xa5000000), BT(0x70000000), BT(0xda000000), BT(0x0f000000),
+		BT(0x20000000), BT(0xf5000000), BT(0x5f000000), BT(0x8a000000), BT(0xde000000), BT(0x0b000000), BT(0xa1000000), BT(0x74000000),
+		BT(0x09000000), BT(0xdc000000), BT(0x76000000), BT(0xa3000000), BT(0xf7000000), BT(0x22000000), BT(0x88000000), BT(0x5d000000),
+		BT(0xd6000000), BT(0x03000000), BT(0xa9000000), BT(0x7c000000), BT(0x28000000), BT(0xfd000000), BT(0x57000000), BT(0x82000000),
+		BT(0xff000000), BT(0x2a000000), BT(0x80000000), BT(0x55000000), BT(0x01000000), BT(0xd4000000), BT(0x7e000000), BT(0xab000000),
+		BT(0x84000000), BT(0x51000000), BT(0xfb000000), BT(0x2e000000), BT(0x7a000000), BT(0xaf000000), BT(0x05000000), BT(0xd0000000),
+		BT(0xad000000), BT(0x78000000), BT(0xd2000000), BT(0x07000000), BT(0x53000000), BT(0x86000000), BT(0x2c000000), BT(0xf9000000)
+	}, {
+		BMP_C(0x0000004c), BMP_C(0x0000002c), BMP_C(0x00000052), BMP_C(0x000000da),
+		BMP_C(0x00000092), BMP_C(0x000000b9), BMP_C(0x00000057), BMP_C(0x00000040)
+	}},
+	{10UL, BT(0x5d400000), {
+		BT(0x00000000), BT(0x5d400000), BT(0xba800000), BT(0xe7c00000), BT(0x28400000), BT(0x75000000), BT(0x92c00000), BT(0xcf800000),
+		BT(0x50800000), BT(0x0dc00000), BT(0xea000000), BT(0xb7400000), BT(0x78c00000), BT(0x25800000), BT(0xc2400000), BT(0x9f000000),
+		BT(0xa1000000), BT(0xfc400000), BT(0x1b800000), BT(0x46c00000), BT(0x89400000), BT(0xd4000000), BT(0x33c00000), BT(0x6e800000),
+		BT(0xf1800000), BT(0xacc00000), BT(0x4b000000), BT(0x16400000), BT(0xd9c00000), BT(0x84800000), BT(0x63400000), BT(0x3e000000),
+		BT(0x1f400000), BT(0x42000000), BT(0xa5c00000), BT(0xf8800000), BT(0x37000000), BT(0x6a400000), BT(0x8d800000), BT(0xd0c00000),
+		BT(0x4fc00000), BT(0x12800000), BT(0xf5400000), BT(0xa8000000), BT(0x67800000), BT(0x3ac00000), BT(0xdd000000), BT(0x80400000),
+		BT(0xbe400000), BT(0xe3000000), BT(0x04c00000), BT(0x59800000), BT(0x96000000), BT(0xcb400000), BT(0x2c800000), BT(0x71c00000),
+		BT(0xeec00000), BT(0xb3800000), BT(0x54400000), BT(0x09000000), BT(0xc6800000), BT(0x9bc00000), BT(0x7c000000), BT(0x21400000),
+		BT(0x3e800000), BT(0x63c00000), BT(0x84000000), BT(0xd9400000), BT(0x16c00000), BT(0x4b800000), BT(0xac400000), BT(0xf1000000),
+		BT(0x6e000000), BT(0x33400000), BT(0xd4800000), BT(0x89c00000), BT(0x46400000), BT(0x1b000000), BT(0xfcc00000), BT(0xa1800000),
+		BT(0x9f800000), BT(0xc2c00000), BT(0x25000000), BT(0x78400000), BT(0xb7c00000), BT(0xea800000), BT(0x0d400000), BT(0x50000000),
+		BT(0xcf000000), BT(0x92400000), BT(0x75800000), BT(0x28c00000), BT(0xe7400000), BT(0xba000000), BT(0x5dc00000), BT(0x00800000),
+		BT(0x21c00000), BT(0x7c800000), BT(0x9b400000), BT(0xc6000000), BT(0x09800000), BT(0x54c00000), BT(0xb3000000), BT(0xee400000),
+		BT(0x71400000), BT(0x2c000000), BT(0xcbc00000), BT(0x96800000), BT(0x59000000), BT(0x04400000), BT(0xe3800000), BT(0xbec00000),
+		BT(0x80c00000), BT(0xdd800000), BT(0x3a400000), BT(0x67000000), BT(0xa8800000), BT(0xf5c00000), BT(0x12000000), BT(0x4f400000),
+		BT(0xd0400000), BT(0x8d000000), BT(0x6ac00000), BT(0x37800000), BT(0xf8000000), BT(0xa5400000), BT(0x42800000), BT(0x1fc00000),
+		BT(0x7d000000), BT(0x20400000), BT(0xc7800000), BT(0x9ac00000), BT(0x55400000), BT(0x08000000), BT(0xefc00000), BT(0xb2800000),
+		BT(0x2d800000), BT(0x70c00000), BT(0x97000000), BT(0xca400000), BT(0x05c00000), BT(0x58800000), BT(0xbf400000), BT(0xe2000000),
+		BT(0xdc000000), BT(0x81400000), BT(0x66800000), BT(0x3bc00000), BT(0xf4400000), BT(0xa9000000), BT(0x4ec00000), BT(0x13800000),
+		BT(0x8c800000), BT(0xd1c00000), BT(0x36000000), BT(0x6b400000), BT(0xa4c00000), BT(0xf9800000), BT(0x1e400000), BT(0x43000000),
+		BT(0x62400000), BT(0x3f000000), BT(0xd8c00000), BT(0x85800000), BT(0x4a000000), BT(0x17400000), BT(0xf0800000), BT(0xadc00000),
+		BT(0x32c00000), BT(0x6f800000), BT(0x88400000), BT(0xd5000000), BT(0x1a800000), BT(0x47c00000), BT(0xa0000000), BT(0xfd400000),
+		BT(0xc3400000), BT(0x9e000000), BT(0x79c00000), BT(0x24800000), BT(0xeb000000), BT(0xb6400000), BT(0x51800000), BT(0x0cc00000),
+		BT(0x93c00000), BT(0xce800000), BT(0x29400000), BT(0x74000000), BT(0xbb800000), BT(0xe6c00000), BT(0x01000000), BT(0x5c400000),
+		BT(0x43800000), BT(0x1ec00000), BT(0xf9000000), BT(0xa4400000), BT(0x6bc00000), BT(0x36800000), BT(0xd1400000), BT(0x8c000000),
+		BT(0x13000000), BT(0x4e400000), BT(0xa9800000), BT(0xf4c00000), BT(0x3b400000), BT(0x66000000), BT(0x81c00000), BT(0xdc800000),
+		BT(0xe2800000), BT(0xbfc00000), BT(0x58000000), BT(0x05400000), BT(0xcac00000), BT(0x97800000), BT(0x70400000), BT(0x2d000000),
+		BT(0xb2000000), BT(0xef400000), BT(0x08800000), BT(0x55c00000), BT(0x9a400000), BT(0xc7000000), BT(0x20c00000), BT(0x7d800000),
+		BT(0x5cc00000), BT(0x01800000), BT(0xe6400000), BT(0xbb000000), BT(0x74800000), BT(0x29c00000), BT(0xce000000), BT(0x93400000),
+		BT(0x0c400000), BT(0x51000000), BT(0xb6c00000), BT(0xeb800000), BT(0x24000000), BT(0x79400000), BT(0x9e800000), BT(0xc3c00000),
+		BT(0xfdc00000), BT(0xa0800000), BT(0x47400000), BT(0x1a000000), BT(0xd5800000), BT(0x88c00000), BT(0x6f000000), BT(0x32400000),
+		BT(0xad400000), BT(0xf0000000), BT(0x17c00000), BT(0x4a800000), BT(0x85000000), BT(0xd8400000), BT(0x3f800000), BT(0x62c00000)
+	}, {
+		BMP_C(0x000000fc), BMP_C(0x000000fa), BMP_C(0x000002ba), BMP_C(0x0000017c),
+		BMP_C(0x000002ea), BMP_C(0x00000020), BMP_C(0x000001f8), BMP_C(0x000001f4)
+	}},
+	{10UL, BT(0x8cc00000), {
+		BT(0x00000000), BT(0x8cc00000), BT(0x95400000), BT(0x19800000), BT(0xa6400000), BT(0x2a800000), BT(0x33000000), BT(0xbfc00000),
+		BT(0xc0400000), BT(0x4c800000), BT(0x55000000), BT(0xd9c00000), BT(0x66000000), BT(0xeac00000), BT(0xf3400000), BT(0x7f800000),
+		BT(0x0c400000), BT(0x80800000), BT(0x99000000), BT(0x15c00000), BT(0xaa000000), BT(0x26c00000), BT(0x3f400000), BT(0xb3800000),
+		BT(0xcc000000), BT(0x40c00000), BT(0x59400000), BT(0xd5800000), BT(0x6a400000), BT(0xe6800000), BT(0xff000000), BT(0x73c00000),
+		BT(0x18800000), BT(0x94400000), BT(0x8dc00000), BT(0x01000000), BT(0xbec00000), BT(0x32000000), BT(0x2b800000), BT(0xa7400000),
+		BT(0xd8c00000), BT(0x54000000), BT(0x4d800000), BT(0xc1400000), BT(0x7e800000), BT(0xf2400000), BT(0xebc00000), BT(0x67000000),
+		BT(0x14c00000), BT(0x98000000), BT(0x81800000), BT(0x0d400000), BT(0xb2800000), BT(0x3e400000), BT(0x27c00000), BT(0xab000000),
+		BT(0xd4800000), BT(0x58400000), BT(0x41c00000), BT(0xcd000000), BT(0x72c00000), BT(0xfe000000), BT(0xe7800000), BT(0x6b400000),
+		BT(0x31000000), BT(0xbdc00000), BT(0xa4400000), BT(0x28800000), BT(0x97400000), BT(0x1b800000), BT(0x02000000), BT(0x8ec00000),
+		BT(0xf1400000), BT(0x7d800000), BT(0x64000000), BT(0xe8c00000), BT(0x57000000), BT(0xdbc00000), BT(0xc2400000), BT(0x4e800000),
+		BT(0x3d400000), BT(0xb1800000), BT(0xa8000000), BT(0x24c00000), BT(0x9b000000), BT(0x17c00000), BT(0x0e400000), BT(0x82800000),
+		BT(0xfd000000), BT(0x71c00000), BT(0x68400000), BT(0xe4800000), BT(0x5b400000), BT(0xd7800000), BT(0xce000000), BT(0x42c00000),
+		BT(0x29800000), BT(0xa5400000), BT(0xbcc00000), BT(0x30000000), BT(0x8fc00000), BT(0x03000000), BT(0x1a800000), BT(0x96400000),
+		BT(0xe9c00000), BT(0x65000000), BT(0x7c800000), BT(0xf0400000), BT(0x4f800000), BT(0xc3400000), BT(0xdac00000), BT(0x56000000),
+		BT(0x25c00000), BT(0xa9000000), BT(0xb0800000), BT(0x3c400000), BT(0x83800000), BT(0x0f400000), BT(0x16c00000), BT(0x9a000000),
+		BT(0xe5800000), BT(0x69400000), BT(0x70c00000), BT(0xfc000000), BT(0x43c00000), BT(0xcf000000), BT(0xd6800000), BT(0x5a400000),
+		BT(0x62000000), BT(0xeec00000), BT(0xf7400000), BT(0x7b800000), BT(0xc4400000), BT(0x48800000), BT(0x51000000), BT(0xddc00000),
+		BT(0xa2400000), BT(0x2e800000), BT(0x37000000), BT(0xbbc00000), BT(0x04000000), BT(0x88c00000), BT(0x91400000), BT(0x1d800000),
+		BT(0x6e400000), BT(0xe2800000), BT(0xfb000000), BT(0x77c00000), BT(0xc8000000), BT(0x44c00000), BT(0x5d400000), BT(0xd1800000),
+		BT(0xae000000), BT(0x22c00000), BT(0x3b400000), BT(0xb7800000), BT(0x08400000), BT(0x84800000), BT(0x9d000000), BT(0x11c00000),
+		BT(0x7a800000), BT(0xf6400000), BT(0xefc00000), BT(0x63000000), BT(0xdcc00000), BT(0x50000000), BT(0x49800000), BT(0xc5400000),
+		BT(0xbac00000), BT(0x36000000), BT(0x2f800000), BT(0xa3400000), BT(0x1c800000), BT(0x90400000), BT(0x89c00000), BT(0x05000000),
+		BT(0x76c00000), BT(0xfa000000), BT(0xe3800000), BT(0x6f400000), BT(0xd0800000), BT(0x5c400000), BT(0x45c00000), BT(0xc9000000),
+		BT(0xb6800000), BT(0x3a400000), BT(0x23c00000), BT(0xaf000000), BT(0x10c00000), BT(0x9c000000), BT(0x85800000), BT(0x09400000),
+		BT(0x53000000), BT(0xdfc00000), BT(0xc6400000), BT(0x4a800000), BT(0xf5400000), BT(0x79800000), BT(0x60000000), BT(0xecc00000),
+		BT(0x93400000), BT(0x1f800000), BT(0x06000000), BT(0x8ac00000), BT(0x35000000), BT(0xb9c00000), BT(0xa0400000), BT(0x2c800000),
+		BT(0x5f400000), BT(0xd3800000), BT(0xca000000), BT(0x46c00000), BT(0xf9000000), BT(0x75c00000), BT(0x6c400000), BT(0xe0800000),
+		BT(0x9f000000), BT(0x13c00000), BT(0x0a400000), BT(0x86800000), BT(0x39400000), BT(0xb5800000), BT(0xac000000), BT(0x20c00000),
+		BT(0x4b800000), BT(0xc7400000), BT(0xdec00000), BT(0x52000000), BT(0xedc00000), BT(0x61000000), BT(0x78800000), BT(0xf4400000),
+		BT(0x8bc00000), BT(0x07000000), BT(0x1e800000), BT(0x92400000), BT(0x2d800000), BT(0xa1400000), BT(0xb8c00000), BT(0x34000000),
+		BT(0x47c00000), BT(0xcb000000), BT(0xd2800000), BT(0x5e400000), BT(0xe1800000), BT(0x6d400000), BT(0x74c00000), BT(0xf8000000),
+		BT(0x87800000), BT(0x0b400000), BT(0x12c00000), BT(0x9e000000), BT(0x21c00000), BT(0xad000000), BT(0xb4800000), BT(0x38400000)
+	}, {
+		BMP_C(0x00000002), BMP_C(0x000000a4), BMP_C(0x000003e6), BMP_C(0x0000007f),
+		BMP_C(0x000002b4), BMP_C(0x0000034a), BMP_C(0x0000039d), BMP_C(0x00000135)
+	}},
+	{10UL, BT(0xf6400000), {
+		BT(0x00000000), BT(0xf6400000), BT(0x1ac00000), BT(0xec800000), BT(0x35800000), BT(0xc3c00000), BT(0x2f400000), BT(0xd9000000),
+		BT(0x6b000000), BT(0x9d400000), BT(0x71c00000), BT(0x87800000), BT(0x5e800000), BT(0xa8c00000), BT(0x44400000), BT(0xb2000000),
+		BT(0xd6000000), BT(0x20400000), BT(0xccc00000), BT(0x3a800000), BT(0xe3800000), BT(0x15c00000), BT(0xf9400000), BT(0x0f000000),
+		BT(0xbd000000), BT(0x4b400000), BT(0xa7c00000), BT(0x51800000), BT(0x88800000), BT(0x7ec00000), BT(0x92400000), BT(0x64000000),
+		BT(0x5a400000), BT(0xac000000), BT(0x40800000), BT(0xb6c00000), BT(0x6fc00000), BT(0x99800000), BT(0x75000000), BT(0x83400000),
+		BT(0x31400000), BT(0xc7000000), BT(0x2b800000), BT(0xddc00000), BT(0x04c00000), BT(0xf2800000), BT(0x1e000000), BT(0xe8400000),
+		BT(0x8c400000), BT(0x7a000000), BT(0x96800000), BT(0x60c00000), BT(0xb9c00000), BT(0x4f800000), BT(0xa3000000), BT(0x55400000),
+		BT(0xe7400000), BT(0x11000000), BT(0xfd800000), BT(0x0bc00000), BT(0xd2c00000), BT(0x24800000), BT(0xc8000000), BT(0x3e400000),
+		BT(0xb4800000), BT(0x42c00000), BT(0xae400000), BT(0x58000000), BT(0x81000000), BT(0x77400000), BT(0x9bc00000), BT(0x6d800000),
+		BT(0xdf800000), BT(0x29c00000), BT(0xc5400000), BT(0x33000000), BT(0xea000000), BT(0x1c400000), BT(0xf0c00000), BT(0x06800000),
+		BT(0x62800000), BT(0x94c00000), BT(0x78400000), BT(0x8e000000), BT(0x57000000), BT(0xa1400000), BT(0x4dc00000), BT(0xbb800000),
+		BT(0x09800000), BT(0xffc00000), BT(0x13400000), BT(0xe5000000), BT(0x3c000000), BT(0xca400000), BT(0x26c00000), BT(0xd0800000),
+		BT(0xeec00000), BT(0x18800000), BT(0xf4000000), BT(0x02400000), BT(0xdb400000), BT(0x2d000000), BT(0xc1800000), BT(0x37c00000),
+		BT(0x85c00000), BT(0x73800000), BT(0x9f000000), BT(0x69400000), BT(0xb0400000), BT(0x46000000), BT(0xaa800000), BT(0x5cc00000),
+		BT(0x38c00000), BT(0xce800000), BT(0x22000000), BT(0xd4400000), BT(0x0d400000), BT(0xfb000000), BT(0x17800000), BT(0xe1c00000),
+		BT(0x53c00000), BT(0xa5800000), BT(0x49000000), BT(0xbf400000), BT(0x66400000), BT(0x90000000), BT(0x7c800000), BT(0x8ac00000),
+		BT(0x9f400000), BT(0x69000000), BT(0x85800000), BT(0x73c00000), BT(0xaac00000), BT(0x5c800000), BT(0xb0000000), BT(0x46400000),
+		BT(0xf4400000), BT(0x02000000), BT(0xee800000), BT(0x18c00000), BT(0xc1c00000), BT(0x37800000), BT(0xdb000000), BT(0x2d400000),
+		BT(0x49400000), BT(0xbf000000), BT(0x53800000), BT(0xa5c00000), BT(0x7cc00000), BT(0x8a800000), BT(0x66000000), BT(0x90400000),
+		BT(0x22400000), BT(0xd4000000), BT(0x38800000), BT(0xcec00000), BT(0x17c00000), BT(0xe1800000), BT(0x0d000000), BT(0xfb400000),
+		BT(0xc5000000), BT(0x33400000), BT(0xdfc00000), BT(0x29800000), BT(0xf0800000), BT(0x06c00000), BT(0xea400000), BT(0x1c000000),
+		BT(0xae000000), BT(0x58400000), BT(0xb4c00000), BT(0x42800000), BT(0x9b800000), BT(0x6dc00000), BT(0x81400000), BT(0x77000000),
+		BT(0x13000000), BT(0xe5400000), BT(0x09c00000), BT(0xff800000), BT(0x26800000), BT(0xd0c00000), BT(0x3c400000), BT(0xca000000),
+		BT(0x78000000), BT(0x8e400000), BT(0x62c00000), BT(0x94800000), BT(0x4d800000), BT(0xbbc00000), BT(0x57400000), BT(0xa1000000),
+		BT(0x2bc00000), BT(0xdd800000), BT(0x31000000), BT(0xc7400000), BT(0x1e400000), BT(0xe8000000), BT(0x04800000), BT(0xf2c00000),
+		BT(0x40c00000), BT(0xb6800000), BT(0x5a000000), BT(0xac400000), BT(0x75400000), BT(0x83000000), BT(0x6f800000), BT(0x99c00000),
+		BT(0xfdc00000), BT(0x0b800000), BT(0xe7000000), BT(0x11400000), BT(0xc8400000), BT(0x3e000000), BT(0xd2800000), BT(0x24c00000),
+		BT(0x96c00000), BT(0x60800000), BT(0x8c000000), BT(0x7a400000), BT(0xa3400000), BT(0x55000000), BT(0xb9800000), BT(0x4fc00000),
+		BT(0x71800000), BT(0x87c00000), BT(0x6b400000), BT(0x9d000000), BT(0x44000000), BT(0xb2400000), BT(0x5ec00000), BT(0xa8800000),
+		BT(0x1a800000), BT(0xecc00000), BT(0x00400000), BT(0xf6000000), BT(0x2f000000), BT(0xd9400000), BT(0x35c00000), BT(0xc3800000),
+		BT(0xa7800000), BT(0x51c00000), BT(0xbd400000), BT(0x4b000000), BT(0x92000000), BT(0x64400000), BT(0x88c00000), BT(0x7e800000),
+		BT(0xcc800000), BT(0x3ac00000), BT(0xd6400000), BT(0x20000000), BT(0xf9000000), BT(0x0f400000), BT(0xe3c00000), BT(0x15800000)
+	}, {
+		BMP_C(0x00000002), BMP_C(0x000003fd), BMP_C(0x0000018e), BMP_C(0x0000008a),
+		BMP_C(0x000000ef), BMP_C(0x0000011b), BMP_C(0x00000227), BMP_C(0x00000182)
+	}},
+	{11UL, BT(0x60e00000), {
+		BT(0x00000000), BT(0x60e00000), BT(0xc1c00000), BT(0xa1200000), BT(0xe3600000), BT(0x83800000), BT(0x22a00000), BT(0x42400000),
+		BT(0xa6200000), BT(0xc6c00000), BT(0x67e00000), BT(0x07000000), BT(0x45400000), BT(0x25a00000), BT(0x84800000), BT(0xe4600000),
+		BT(0x2ca00000), BT(0x4c400000), BT(0xed600000), BT(0x8d800000), BT(0xcfc00000), BT(0xaf200000), BT(0x0e000000), BT(0x6ee00000),
+		BT(0x8a800000), BT(0xea600000), BT(0x4b400000), BT(0x2ba00000), BT(0x69e00000), BT(0x09000000), BT(0xa8200000), BT(0xc8c00000),
+		BT(0x59400000), BT(0x39a00000), BT(0x98800000), BT(0xf8600000), BT(0xba200000), BT(0xdac00000), BT(0x7be00000), BT(0x1b000000),
+		BT(0xff600000), BT(0x9f800000), BT(0x3ea00000), BT(0x5e400000), BT(0x1c000000), BT(0x7ce00000), BT(0xddc00000), BT(0xbd200000),
+		BT(0x75e00000), BT(0x15000000), BT(0xb4200000), BT(0xd4c00000), BT(0x96800000), BT(0xf6600000), BT(0x57400000), BT(0x37a00000),
+		BT(0xd3c00000), BT(0xb3200000), BT(0x12000000), BT(0x72e00000), BT(0x30a00000), BT(0x50400000), BT(0xf1600000), BT(0x91800000),
+		BT(0xb2800000), BT(0xd2600000), BT(0x73400000), BT(0x13a00000), BT(0x51e00000), BT(0x31000000), BT(0x90200000), BT(0xf0c00000),
+		BT(0x14a00000), BT(0x74400000), BT(0xd5600000), BT(0xb5800000), BT(0xf7c00000), BT(0x97200000), BT(0x36000000), BT(0x56e00000),
+		BT(0x9e200000), BT(0xfec00000), BT(0x5fe00000), BT(0x3f000000), BT(0x7d400000), BT(0x1da00000), BT(0xbc800000), BT(0xdc600000),
+		BT(0x38000000), BT(0x58e00000), BT(0xf9c00000), BT(0x99200000), BT(0xdb600000), BT(0xbb800000), BT(0x1aa00000), BT(0x7a400000),
+		BT(0xebc00000), BT(0x8b200000), BT(0x2a000000), BT(0x4ae00000), BT(0x08a00000), BT(0x68400000), BT(0xc9600000), BT(0xa9800000),
+		BT(0x4de00000), BT(0x2d000000), BT(0x8c200000), BT(0xecc00000), BT(0xae800000), BT(0xce600000), BT(0x6f400000), BT(0x0fa00000),
+		BT(0xc7600000), BT(0xa7800000), BT(0x06a00000), BT(0x66400000), BT(0x24000000), BT(0x44e00000), BT(0xe5c00000), BT(0x85200000),
+		BT(0x61400000), BT(0x01a00000), BT(0xa0800000), BT(0xc0600000), BT(0x82200000), BT(0xe2c00000), BT(0x43e00000), BT(0x23000000),
+		BT(0x05e00000), BT(0x65000000), BT(0xc4200000), BT(0xa4c00000), BT(0xe6800000), BT(0x86600000), BT(0x27400000), BT(0x47a00000),
+		BT(0xa3c00000), BT(0xc3200000), BT(0x62000000), BT(0x02e00000), BT(0x40a00000), BT(0x20400000), BT(0x81600000), BT(0xe1800000),
+		BT(0x29400000), BT(0x49a00000), BT(0xe8800000), BT(0x88600000), BT(0xca200000), BT(0xaac00000), BT(0x0be00000), BT(0x6b000000),
+		BT(0x8f600000), BT(0xef800000), BT(0x4ea00000), BT(0x2e400000), BT(0x6c000000), BT(0x0ce00000), BT(0xadc00000), BT(0xcd200000),
+		BT(0x5ca00000), BT(0x3c400000), BT(0x9d600000), BT(0xfd800000), BT(0xbfc00000), BT(0xdf200000), BT(0x7e000000), BT(0x1ee00000),
+		BT(0xfa800000), BT(0x9a600000), BT(0x3b400000), BT(0x5ba00000), BT(0x19e00000), BT(0x79000000), BT(0xd8200000), BT(0xb8c00000),
+		BT(0x70000000), BT(0x10e00000), BT(0xb1c00000), BT(0xd1200000), BT(0x93600000), BT(0xf3800000), BT(0x52a00000), BT(0x32400000),
+		BT(0xd6200000), BT(0xb6c00000), BT(0x17e00000), BT(0x77000000), BT(0x35400000), BT(0x55a00000), BT(0xf4800000), BT(0x94600000),
+		BT(0xb7600000), BT(0xd7800000), BT(0x76a00000), BT(0x16400000), BT(0x54000000), BT(0x34e00000), BT(0x95c00000), BT(0xf5200000),
+		BT(0x11400000), BT(0x71a00000), BT(0xd0800000), BT(0xb0600000), BT(0xf2200000), BT(0x92c00000), BT(0x33e00000), BT(0x53000000),
+		BT(0x9bc00000), BT(0xfb200000), BT(0x5a000000), BT(0x3ae00000), BT(0x78a00000), BT(0x18400000), BT(0xb9600000), BT(0xd9800000),
+		BT(0x3de00000), BT(0x5d000000), BT(0xfc200000), BT(0x9cc00000), BT(0xde800000), BT(0xbe600000), BT(0x1f400000), BT(0x7fa00000),
+		BT(0xee200000), BT(0x8ec00000), BT(0x2fe00000), BT(0x4f000000), BT(0x0d400000), BT(0x6da00000), BT(0xcc800000), BT(0xac600000),
+		BT(0x48000000), BT(0x28e00000), BT(0x89c00000), BT(0xe9200000), BT(0xab600000), BT(0xcb800000), BT(0x6aa00000), BT(0x0a400000),
+		BT(0xc2800000), BT(0xa2600000), BT(0x03400000), BT(0x63a00000), BT(0x21e00000), BT(0x41000000), BT(0xe0200000), BT(0x80c00000),
+		BT(0x64a00000), BT(0x04400000), BT(0xa5600000), BT(0xc5800000), BT(0x87c00000), BT(0xe7200000), BT(0x46000000), BT(0x26e00000)
+	}, {
+		BMP_C(0x0000076f), BMP_C(0x00000075), BMP_C(0x000003fe), BMP_C(0x000007d1),
+		BMP_C(0x000000ec), BMP_C(0x0000034a), BMP_C(0x0000040c), BMP_C(0x000001a3)
+	}},
+	{11UL, BT(0x70a00000), {
+		BT(0x00000000), BT(0x70a00000), BT(0xe1400000), BT(0x91e00000), BT(0xb2200000), BT(0xc2800000), BT(0x53600000), BT(0x23c00000),
+		BT(0x14e00000), BT(0x64400000), BT(0xf5a00000), BT(0x85000000), BT(0xa6c00000), BT(0xd6600000), BT(0x47800000), BT(0x37200000),
+		BT(0x29c00000), BT(0x59600000), BT(0xc8800000), BT(0xb8200000), BT(0x9be00000), BT(0xeb400000), BT(0x7aa00000), BT(0x0a000000),
+		BT(0x3d200000), BT(0x4d800000), BT(0xdc600000), BT(0xacc00000), BT(0x8f000000), BT(0xffa00000), BT(0x6e400000), BT(0x1ee00000),
+		BT(0x53800000), BT(0x23200000), BT(0xb2c00000), BT(0xc2600000), BT(0xe1a00000), BT(0x91000000), BT(0x00e00000), BT(0x70400000),
+		BT(0x47600000), BT(0x37c00000), BT(0xa6200000), BT(0xd6800000), BT(0xf5400000), BT(0x85e00000), BT(0x14000000), BT(0x64a00000),
+		BT(0x7a400000), BT(0x0ae00000), BT(0x9b000000), BT(0xeba00000), BT(0xc8600000), BT(0xb8c00000), BT(0x29200000), BT(0x59800000),
+		BT(0x6ea00000), BT(0x1e000000), BT(0x8fe00000), BT(0xff400000), BT(0xdc800000), BT(0xac200000), BT(0x3dc00000), BT(0x4d600000),
+		BT(0xa7000000), BT(0xd7a00000), BT(0x46400000), BT(0x36e00000), BT(0x15200000), BT(0x65800000), BT(0xf4600000), BT(0x84c00000),
+		BT(0xb3e00000), BT(0xc3400000), BT(0x52a00000), BT(0x22000000), BT(0x01c00000), BT(0x71600000), BT(0xe0800000), BT(0x90200000),
+		BT(0x8ec00000), BT(0xfe600000), BT(0x6f800000), BT(0x1f200000), BT(0x3ce00000), BT(0x4c400000), BT(0xdda00000), BT(0xad000000),
+		BT(0x9a200000), BT(0xea800000), BT(0x7b600000), BT(0x0bc00000), BT(0x28000000), BT(0x58a00000), BT(0xc9400000), BT(0xb9e00000),
+		BT(0xf4800000), BT(0x84200000), BT(0x15c00000), BT(0x65600000), BT(0x46a00000), BT(0x36000000), BT(0xa7e00000), BT(0xd7400000),
+		BT(0xe0600000), BT(0x90c00000), BT(0x01200000), BT(0x71800000), BT(0x52400000), BT(0x22e00000), BT(0xb3000000), BT(0xc3a00000),
+		BT(0xdd400000), BT(0xade00000), BT(0x3c000000), BT(0x4ca00000), BT(0x6f600000), BT(0x1fc00000), BT(0x8e200000), BT(0xfe800000),
+		BT(0xc9a00000), BT(0xb9000000), BT(0x28e00000), BT(0x58400000), BT(0x7b800000), BT(0x0b200000), BT(0x9ac00000), BT(0xea600000),
+		BT(0x3ea00000), BT(0x4e000000), BT(0xdfe00000), BT(0xaf400000), BT(0x8c800000), BT(0xfc200000), BT(0x6dc00000), BT(0x1d600000),
+		BT(0x2a400000), BT(0x5ae00000), BT(0xcb000000), BT(0xbba00000), BT(0x98600000), BT(0xe8c00000), BT(0x79200000), BT(0x09800000),
+		BT(0x17600000), BT(0x67c00000), BT(0xf6200000), BT(0x86800000), BT(0xa5400000), BT(0xd5e00000), BT(0x44000000), BT(0x34a00000),
+		BT(0x03800000), BT(0x73200000), BT(0xe2c00000), BT(0x92600000), BT(0xb1a00000), BT(0xc1000000), BT(0x50e00000), BT(0x20400000),
+		BT(0x6d200000), BT(0x1d800000), BT(0x8c600000), BT(0xfcc00000), BT(0xdf000000), BT(0xafa00000), BT(0x3e400000), BT(0x4ee00000),
+		BT(0x79c00000), BT(0x09600000), BT(0x98800000), BT(0xe8200000), BT(0xcbe00000), BT(0xbb400000), BT(0x2aa00000), BT(0x5a000000),
+		BT(0x44e00000), BT(0x34400000), BT(0xa5a00000), BT(0xd5000000), BT(0xf6c00000), BT(0x86600000), BT(0x17800000), BT(0x67200000),
+		BT(0x50000000), BT(0x20a00000), BT(0xb1400000), BT(0xc1e00000), BT(0xe2200000), BT(0x92800000), BT(0x03600000), BT(0x73c00000),
+		BT(0x99a00000), BT(0xe9000000), BT(0x78e00000), BT(0x08400000), BT(0x2b800000), BT(0x5b200000), BT(0xcac00000), BT(0xba600000),
+		BT(0x8d400000), BT(0xfde00000), BT(0x6c000000), BT(0x1ca00000), BT(0x3f600000), BT(0x4fc00000), BT(0xde200000), BT(0xae800000),
+		BT(0xb0600000), BT(0xc0c00000), BT(0x51200000), BT(0x21800000), BT(0x02400000), BT(0x72e00000), BT(0xe3000000), BT(0x93a00000),
+		BT(0xa4800000), BT(0xd4200000), BT(0x45c00000), BT(0x35600000), BT(0x16a00000), BT(0x66000000), BT(0xf7e00000), BT(0x87400000),
+		BT(0xca200000), BT(0xba800000), BT(0x2b600000), BT(0x5bc00000), BT(0x78000000), BT(0x08a00000), BT(0x99400000), BT(0xe9e00000),
+		BT(0xdec00000), BT(0xae600000), BT(0x3f800000), BT(0x4f200000), BT(0x6ce00000), BT(0x1c400000), BT(0x8da00000), BT(0xfd000000),
+		BT(0xe3e00000), BT(0x93400000), BT(0x02a00000), BT(0x72000000), BT(0x51c00000), BT(0x21600000), BT(0xb0800000), BT(0xc0200000),
+		BT(0xf7000000), BT(0x87a00000), BT(0x16400000), BT(0x66e00000), BT(0x45200000), BT(0x35800000), BT(0xa4600000), BT(0xd4c00000)
+	}, {
+		BMP_C(0x0000029c), BMP_C(0x000001f5), BMP_C(0x0000070a), BMP_C(0x000000a7),
+		BMP_C(0x00000100), BMP_C(0x00000400), BMP_C(0x00000010), BMP_C(0x00000040)
+	}},
+	{12UL, BT(0x80f00000), {
+		BT(0x00000000), BT(0x80f00000), BT(0x81100000), BT(0x01e00000), BT(0x82d00000), BT(0x02200000), BT(0x03c00000), BT(0x83300000),
+		BT(0x85500000), BT(0x05a00000), BT(0x04400000), BT(0x84b00000), BT(0x07800000), BT(0x87700000), BT(0x86900000), BT(0x06600000),
+		BT(0x8a500000), BT(0x0aa00000), BT(0x0b400000), BT(0x8bb00000), BT(0x08800000), BT(0x88700000), BT(0x89900000), BT(0x09600000),
+		BT(0x0f000000), BT(0x8ff00000), BT(0x8e100000), BT(0x0ee00000), BT(0x8dd00000), BT(0x0d200000), BT(0x0cc00000), BT(0x8c300000),
+		BT(0x94500000), BT(0x14a00000), BT(0x15400000), BT(0x95b00000), BT(0x16800000), BT(0x96700000), BT(0x97900000), BT(0x17600000),
+		BT(0x11000000), BT(0x91f00000), BT(0x90100000), BT(0x10e00000), BT(0x93d00000), BT(0x13200000), BT(0x12c00000), BT(0x92300000),
+		BT(0x1e000000), BT(0x9ef00000), BT(0x9f100000), BT(0x1fe00000), BT(0x9cd00000), BT(0x1c200000), BT(0x1dc00000), BT(0x9d300000),
+		BT(0x9b500000), BT(0x1ba00000), BT(0x1a400000), BT(0x9ab00000), BT(0x19800000), BT(0x99700000), BT(0x98900000), BT(0x18600000),
+		BT(0xa8500000), BT(0x28a00000), BT(0x29400000), BT(0xa9b00000), BT(0x2a800000), BT(0xaa700000), BT(0xab900000), BT(0x2b600000),
+		BT(0x2d000000), BT(0xadf00000), BT(0xac100000), BT(0x2ce00000), BT(0xafd00000), BT(0x2f200000), BT(0x2ec00000), BT(0xae300000),
+		BT(0x22000000), BT(0xa2f00000), BT(0xa3100000), BT(0x23e00000), BT(0xa0d00000), BT(0x20200000), BT(0x21c00000), BT(0xa1300000),
+		BT(0xa7500000), BT(0x27a00000), BT(0x26400000), BT(0xa6b00000), BT(0x25800000), BT(0xa5700000), BT(0xa4900000), BT(0x24600000),
+		BT(0x3c000000), BT(0xbcf00000), BT(0xbd100000), BT(0x3de00000), BT(0xbed00000), BT(0x3e200000), BT(0x3fc00000), BT(0xbf300000),
+		BT(0xb9500000), BT(0x39a00000), BT(0x38400000), BT(0xb8b00000), BT(0x3b800000), BT(0xbb700000), BT(0xba900000), BT(0x3a600000),
+		BT(0xb6500000), BT(0x36a00000), BT(0x37400000), BT(0xb7b00000), BT(0x34800000), BT(0xb4700000), BT(0xb5900000), BT(0x35600000),
+		BT(0x33000000), BT(0xb3f00000), BT(0xb2100000), BT(0x32e00000), BT(0xb1d00000), BT(0x31200000), BT(0x30c00000), BT(0xb0300000),
+		BT(0xd0500000), BT(0x50a00000), BT(0x51400000), BT(0xd1b00000), BT(0x52800000), BT(0xd2700000), BT(0xd3900000), BT(0x53600000),
+		BT(0x55000000), BT(0xd5f00000), BT(0xd4100000), BT(0x54e00000), BT(0xd7d00000), BT(0x57200000), BT(0x56c00000), BT(0xd6300000),
+		BT(0x5a000000), BT(0xdaf00000), BT(0xdb100000), BT(0x5be00000), BT(0xd8d00000), BT(0x58200000), BT(0x59c00000), BT(0xd9300000),
+		BT(0xdf500000), BT(0x5fa00000), BT(0x5e400000), BT(0xdeb00000), BT(0x5d800000), BT(0xdd700000), BT(0xdc900000), BT(0x5c600000),
+		BT(0x44000000), BT(0xc4f00000), BT(0xc5100000), BT(0x45e00000), BT(0xc6d00000), BT(0x46200000), BT(0x47c00000), BT(0xc7300000),
+		BT(0xc1500000), BT(0x41a00000), BT(0x40400000), BT(0xc0b00000), BT(0x43800000), BT(0xc3700000), BT(0xc2900000), BT(0x42600000),
+		BT(0xce500000), BT(0x4ea00000), BT(0x4f400000), BT(0xcfb00000), BT(0x4c800000), BT(0xcc700000), BT(0xcd900000), BT(0x4d600000),
+		BT(0x4b000000), BT(0xcbf00000), BT(0xca100000), BT(0x4ae00000), BT(0xc9d00000), BT(0x49200000), BT(0x48c00000), BT(0xc8300000),
+		BT(0x78000000), BT(0xf8f00000), BT(0xf9100000), BT(0x79e00000), BT(0xfad00000), BT(0x7a200000), BT(0x7bc00000), BT(0xfb300000),
+		BT(0xfd500000), BT(0x7da00000), BT(0x7c400000), BT(0xfcb00000), BT(0x7f800000), BT(0xff700000), BT(0xfe900000), BT(0x7e600000),
+		BT(0xf2500000), BT(0x72a00000), BT(0x73400000), BT(0xf3b00000), BT(0x70800000), BT(0xf0700000), BT(0xf1900000), BT(0x71600000),
+		BT(0x77000000), BT(0xf7f00000), BT(0xf6100000), BT(0x76e00000), BT(0xf5d00000), BT(0x75200000), BT(0x74c00000), BT(0xf4300000),
+		BT(0xec500000), BT(0x6ca00000), BT(0x6d400000), BT(0xedb00000), BT(0x6e800000), BT(0xee700000), BT(0xef900000), BT(0x6f600000),
+		BT(0x69000000), BT(0xe9f00000), BT(0xe8100000), BT(0x68e00000), BT(0xebd00000), BT(0x6b200000), BT(0x6ac00000), BT(0xea300000),
+		BT(0x66000000), BT(0xe6f00000), BT(0xe7100000), BT(0x67e00000), BT(0xe4d00000), BT(0x64200000), BT(0x65c00000), BT(0xe5300000),
+		BT(0xe3500000), BT(0x63a00000), BT(0x62400000), BT(0xe2b00000), BT(0x61800000), BT(0xe1700000), BT(0xe0900000), BT(0x60600000)
+	}, {
+		BMP_C(0x00000dff), BMP_C(0x00000d84), BMP_C(0x00000d69), BMP_C(0x00000f08),
+		BMP_C(0x00000979), BMP_C(0x000000ce), BMP_C(0x0000009e), BMP_C(0x000000ba)
+	}},
+	{12UL, BT(0xd3100000), {
+		BT(0x00000000), BT(0xd3100000), BT(0x75300000), BT(0xa6200000), BT(0xea600000), BT(0x39700000), BT(0x9f500000), BT(0x4c400000),
+		BT(0x07d00000), BT(0xd4c00000), BT(0x72e00000), BT(0xa1f00000), BT(0xedb00000), BT(0x3ea00000), BT(0x98800000), BT(0x4b900000),
+		BT(0x0fa00000), BT(0xdcb00000), BT(0x7a900000), BT(0xa9800000), BT(0xe5c00000), BT(0x36d00000), BT(0x90f00000), BT(0x43e00000),
+		BT(0x08700000), BT(0xdb600000), BT(0x7d400000), BT(0xae500000), BT(0xe2100000), BT(0x31000000), BT(0x97200000), BT(0x44300000),
+		BT(0x1f400000), BT(0xcc500000), BT(0x6a700000), BT(0xb9600000), BT(0xf5200000), BT(0x26300000), BT(0x80100000), BT(0x53000000),
+		BT(0x18900000), BT(0xcb800000), BT(0x6da00000), BT(0xbeb00000), BT(0xf2f00000), BT(0x21e00000), BT(0x87c00000), BT(0x54d00000),
+		BT(0x10e00000), BT(0xc3f00000), BT(0x65d00000), BT(0xb6c00000), BT(0xfa800000), BT(0x29900000), BT(0x8fb00000), BT(0x5ca00000),
+		BT(0x17300000), BT(0xc4200000), BT(0x62000000), BT(0xb1100000), BT(0xfd500000), BT(0x2e400000), BT(0x88600000), BT(0x5b700000),
+		BT(0x3e800000), BT(0xed900000), BT(0x4bb00000), BT(0x98a00000), BT(0xd4e00000), BT(0x07f00000), BT(0xa1d00000), BT(0x72c00000),
+		BT(0x39500000), BT(0xea400000), BT(0x4c600000), BT(0x9f700000), BT(0xd3300000), BT(0x00200000), BT(0xa6000000), BT(0x75100000),
+		BT(0x31200000), BT(0xe2300000), BT(0x44100000), BT(0x97000000), BT(0xdb400000), BT(0x08500000), BT(0xae700000), BT(0x7d600000),
+		BT(0x36f00000), BT(0xe5e00000), BT(0x43c00000), BT(0x90d00000), BT(0xdc900000), BT(0x0f800000), BT(0xa9a00000), BT(0x7ab00000),
+		BT(0x21c00000), BT(0xf2d00000), BT(0x54f00000), BT(0x87e00000), BT(0xcba00000), BT(0x18b00000), BT(0xbe900000), BT(0x6d800000),
+		BT(0x26100000), BT(0xf5000000), BT(0x53200000), BT(0x80300000), BT(0xcc700000), BT(0x1f600000), BT(0xb9400000), BT(0x6a500000),
+		BT(0x2e600000), BT(0xfd700000), BT(0x5b500000), BT(0x88400000), BT(0xc4000000), BT(0x17100000), BT(0xb1300000), BT(0x62200000),
+		BT(0x29b00000), BT(0xfaa00000), BT(0x5c800000), BT(0x8f900000), BT(0xc3d00000), BT(0x10c00000), BT(0xb6e00000), BT(0x65f00000),
+		BT(0x7d000000), BT(0xae100000), BT(0x08300000), BT(0xdb200000), BT(0x97600000), BT(0x44700000), BT(0xe2500000), BT(0x31400000),
+		BT(0x7ad00000), BT(0xa9c00000), BT(0x0fe00000), BT(0xdcf00000), BT(0x90b00000), BT(0x43a00000), BT(0xe5800000), BT(0x36900000),
+		BT(0x72a00000), BT(0xa1b00000), BT(0x07900000), BT(0xd4800000), BT(0x98c00000), BT(0x4bd00000), BT(0xedf00000), BT(0x3ee00000),
+		BT(0x75700000), BT(0xa6600000), BT(0x00400000), BT(0xd3500000), BT(0x9f100000), BT(0x4c000000), BT(0xea200000), BT(0x39300000),
+		BT(0x62400000), BT(0xb1500000), BT(0x17700000), BT(0xc4600000), BT(0x88200000), BT(0x5b300000), BT(0xfd100000), BT(0x2e000000),
+		BT(0x65900000), BT(0xb6800000), BT(0x10a00000), BT(0xc3b00000), BT(0x8ff00000), BT(0x5ce00000), BT(0xfac00000), BT(0x29d00000),
+		BT(0x6de00000), BT(0xbef00000), BT(0x18d00000), BT(0xcbc00000), BT(0x87800000), BT(0x54900000), BT(0xf2b00000), BT(0x21a00000),
+		BT(0x6a300000), BT(0xb9200000), BT(0x1f000000), BT(0xcc100000), BT(0x80500000), BT(0x53400000), BT(0xf5600000), BT(0x26700000),
+		BT(0x43800000), BT(0x90900000), BT(0x36b00000), BT(0xe5a00000), BT(0xa9e00000), BT(0x7af00000), BT(0xdcd00000), BT(0x0fc00000),
+		BT(0x44500000), BT(0x97400000), BT(0x31600000), BT(0xe2700000), BT(0xae300000), BT(0x7d200000), BT(0xdb000000), BT(0x08100000),
+		BT(0x4c200000), BT(0x9f300000), BT(0x39100000), BT(0xea000000), BT(0xa6400000), BT(0x75500000), BT(0xd3700000), BT(0x00600000),
+		BT(0x4bf00000), BT(0x98e00000), BT(0x3ec00000), BT(0xedd00000), BT(0xa1900000), BT(0x72800000), BT(0xd4a00000), BT(0x07b00000),
+		BT(0x5cc00000), BT(0x8fd00000), BT(0x29f00000), BT(0xfae00000), BT(0xb6a00000), BT(0x65b00000), BT(0xc3900000), BT(0x10800000),
+		BT(0x5b100000), BT(0x88000000), BT(0x2e200000), BT(0xfd300000), BT(0xb1700000), BT(0x62600000), BT(0xc4400000), BT(0x17500000),
+		BT(0x53600000), BT(0x80700000), BT(0x26500000), BT(0xf5400000), BT(0xb9000000), BT(0x6a100000), BT(0xcc300000), BT(0x1f200000),
+		BT(0x54b00000), BT(0x87a00000), BT(0x21800000), BT(0xf2900000), BT(0xbed00000), BT(0x6dc00000), BT(0xcbe00000), BT(0x18f00000)
+	}, {
+		BMP_C(0x00000025), BMP_C(0x00000780), BMP_C(0x00000ff3), BMP_C(0x000002c1),
+		BMP_C(0x00000f7a), BMP_C(0x0000081c), BMP_C(0x00000a79), BMP_C(0x0000009f)
+	}},
+	{12UL, BT(0xf1300000), {
+		BT(0x00000000), BT(0xf1300000), BT(0x13500000), BT(0xe2600000), BT(0x26a00000), BT(0xd7900000), BT(0x35f00000), BT(0xc4c00000),
+		BT(0x4d400000), BT(0xbc700000), BT(0x5e100000), BT(0xaf200000), BT(0x6be00000), BT(0x9ad00000), BT(0x78b00000), BT(0x89800000),
+		BT(0x9a800000), BT(0x6bb00000), BT(0x89d00000), BT(0x78e00000), BT(0xbc200000), BT(0x4d100000), BT(0xaf700000), BT(0x5e400000),
+		BT(0xd7c00000), BT(0x26f00000), BT(0xc4900000), BT(0x35a00000), BT(0xf1600000), BT(0x00500000), BT(0xe2300000), BT(0x13000000),
+		BT(0xc4300000), BT(0x35000000), BT(0xd7600000), BT(0x26500000), BT(0xe2900000), BT(0x13a00000), BT(0xf1c00000), BT(0x00f00000),
+		BT(0x89700000), BT(0x78400000), BT(0x9a200000), BT(0x6b100000), BT(0xafd00000), BT(0x5ee00000), BT(0xbc800000), BT(0x4db00000),
+		BT(0x5eb00000), BT(0xaf800000), BT(0x4de00000), BT(0xbcd00000), BT(0x78100000), BT(0x89200000), BT(0x6b400000), BT(0x9a700000),
+		BT(0x13f00000), BT(0xe2c00000), BT(0x00a00000), BT(0xf1900000), BT(0x35500000), BT(0xc4600000), BT(0x26000000), BT(0xd7300000),
+		BT(0x79500000), BT(0x88600000), BT(0x6a000000), BT(0x9b300000), BT(0x5ff00000), BT(0xaec00000), BT(0x4ca00000), BT(0xbd900000),
+		BT(0x34100000), BT(0xc5200000), BT(0x27400000), BT(0xd6700000), BT(0x12b00000), BT(0xe3800000), BT(0x01e00000), BT(0xf0d00000),
+		BT(0xe3d00000), BT(0x12e00000), BT(0xf0800000), BT(0x01b00000), BT(0xc5700000), BT(0x34400000), BT(0xd6200000), BT(0x27100000),
+		BT(0xae900000), BT(0x5fa00000), BT(0xbdc00000), BT(0x4cf00000), BT(0x88300000), BT(0x79000000), BT(0x9b600000), BT(0x6a500000),
+		BT(0xbd600000), BT(0x4c500000), BT(0xae300000), BT(0x5f000000), BT(0x9bc00000), BT(0x6af00000), BT(0x88900000), BT(0x79a00000),
+		BT(0xf0200000), BT(0x01100000), BT(0xe3700000), BT(0x12400000), BT(0xd6800000), BT(0x27b00000), BT(0xc5d00000), BT(0x34e00000),
+		BT(0x27e00000), BT(0xd6d00000), BT(0x34b00000), BT(0xc5800000), BT(0x01400000), BT(0xf0700000), BT(0x12100000), BT(0xe3200000),
+		BT(0x6aa00000), BT(0x9b900000), BT(0x79f00000), BT(0x88c00000), BT(0x4c000000), BT(0xbd300000), BT(0x5f500000), BT(0xae600000),
+		BT(0xf2a00000), BT(0x03900000), BT(0xe1f00000), BT(0x10c00000), BT(0xd4000000), BT(0x25300000), BT(0xc7500000), BT(0x36600000),
+		BT(0xbfe00000), BT(0x4ed00000), BT(0xacb00000), BT(0x5d800000), BT(0x99400000), BT(0x68700000), BT(0x8a100000), BT(0x7b200000),
+		BT(0x68200000), BT(0x99100000), BT(0x7b700000), BT(0x8a400000), BT(0x4e800000), BT(0xbfb00000), BT(0x5dd00000), BT(0xace00000),
+		BT(0x25600000), BT(0xd4500000), BT(0x36300000), BT(0xc7000000), BT(0x03c00000), BT(0xf2f00000), BT(0x10900000), BT(0xe1a00000),
+		BT(0x36900000), BT(0xc7a00000), BT(0x25c00000), BT(0xd4f00000), BT(0x10300000), BT(0xe1000000), BT(0x03600000), BT(0xf2500000),
+		BT(0x7bd00000), BT(0x8ae00000), BT(0x68800000), BT(0x99b00000), BT(0x5d700000), BT(0xac400000), BT(0x4e200000), BT(0xbf100000),
+		BT(0xac100000), BT(0x5d200000), BT(0xbf400000), BT(0x4e700000), BT(0x8ab00000), BT(0x7b800000), BT(0x99e00000), BT(0x68d00000),
+		BT(0xe1500000), BT(0x10600000), BT(0xf2000000), BT(0x03300000), BT(0xc7f00000), BT(0x36c00000), BT(0xd4a00000), BT(0x25900000),
+		BT(0x8bf00000), BT(0x7ac00000), BT(0x98a00000), BT(0x69900000), BT(0xad500000), BT(0x5c600000), BT(0xbe000000), BT(0x4f300000),
+		BT(0xc6b00000), BT(0x37800000), BT(0xd5e00000), BT(0x24d00000), BT(0xe0100000), BT(0x11200000), BT(0xf3400000), BT(0x02700000),
+		BT(0x11700000), BT(0xe0400000), BT(0x02200000), BT(0xf3100000), BT(0x37d00000), BT(0xc6e00000), BT(0x24800000), BT(0xd5b00000),
+		BT(0x5c300000), BT(0xad000000), BT(0x4f600000), BT(0xbe500000), BT(0x7a900000), BT(0x8ba00000), BT(0x69c00000), BT(0x98f00000),
+		BT(0x4fc00000), BT(0xbef00000), BT(0x5c900000), BT(0xada00000), BT(0x69600000), BT(0x98500000), BT(0x7a300000), BT(0x8b000000),
+		BT(0x02800000), BT(0xf3b00000), BT(0x11d00000), BT(0xe0e00000), BT(0x24200000), BT(0xd5100000), BT(0x37700000), BT(0xc6400000),
+		BT(0xd5400000), BT(0x24700000), BT(0xc6100000), BT(0x37200000), BT(0xf3e00000), BT(0x02d00000), BT(0xe0b00000), BT(0x11800000),
+		BT(0x98000000), BT(0x69300000), BT(0x8b500000), BT(0x7a600000), BT(0xbea00000), BT(0x4f900000), BT(0xadf00000), BT(0x5cc00000)
+	}, {
+		BMP_C(0x00000c08), BMP_C(0x00000026), BMP_C(0x00000499), BMP_C(0x0000043a),
+		BMP_C(0x00000fa2), BMP_C(0x000008f5), BMP_C(0x00000ed7), BMP_C(0x000009fe)
+	}},
+	{13UL, BT(0xe7a80000), {
+		BT(0x00000000), BT(0xe7a80000), BT(0x28f80000), BT(0xcf500000), BT(0x51f00000), BT(0xb6580000), BT(0x79080000), BT(0x9ea00000),
+		BT(0xa3e00000), BT(0x44480000), BT(0x8b180000), BT(0x6cb00000), BT(0xf2100000), BT(0x15b80000), BT(0xdae80000), BT(0x3d400000),
+		BT(0xa0680000), BT(0x47c00000), BT(0x88900000), BT(0x6f380000), BT(0xf1980000), BT(0x16300000), BT(0xd9600000), BT(0x3ec80000),
+		BT(0x03880000), BT(0xe4200000), BT(0x2b700000), BT(0xccd80000), BT(0x52780000), BT(0xb5d00000), BT(0x7a800000), BT(0x9d280000),
+		BT(0xa7780000), BT(0x40d00000), BT(0x8f800000), BT(0x68280000), BT(0xf6880000), BT(0x11200000), BT(0xde700000), BT(0x39d80000),
+		BT(0x04980000), BT(0xe3300000), BT(0x2c600000), BT(0xcbc80000), BT(0x55680000), BT(0xb2c00000), BT(0x7d900000), BT(0x9a380000),
+		BT(0x07100000), BT(0xe0b80000), BT(0x2fe80000), BT(0xc8400000), BT(0x56e00000), BT(0xb1480000), BT(0x7e180000), BT(0x99b00000),
+		BT(0xa4f00000), BT(0x43580000), BT(0x8c080000), BT(0x6ba00000), BT(0xf5000000), BT(0x12a80000), BT(0xddf80000), BT(0x3a500000),
+		BT(0xa9580000), BT(0x4ef00000), BT(0x81a00000), BT(0x66080000), BT(0xf8a80000), BT(0x1f000000), BT(0xd0500000), BT(0x37f80000),
+		BT(0x0ab80000), BT(0xed100000), BT(0x22400000), BT(0xc5e80000), BT(0x5b480000), BT(0xbce00000), BT(0x73b00000), BT(0x94180000),
+		BT(0x09300000), BT(0xee980000), BT(0x21c80000), BT(0xc6600000), BT(0x58c00000), BT(0xbf680000), BT(0x70380000), BT(0x97900000),
+		BT(0xaad00000), BT(0x4d780000), BT(0x82280000), BT(0x65800000), BT(0xfb200000), BT(0x1c880000), BT(0xd3d80000), BT(0x34700000),
+		BT(0x0e200000), BT(0xe9880000), BT(0x26d80000), BT(0xc1700000), BT(0x5fd00000), BT(0xb8780000), BT(0x77280000), BT(0x90800000),
+		BT(0xadc00000), BT(0x4a680000), BT(0x85380000), BT(0x62900000), BT(0xfc300000), BT(0x1b980000), BT(0xd4c80000), BT(0x33600000),
+		BT(0xae480000), BT(0x49e00000), BT(0x86b00000), BT(0x61180000), BT(0xffb80000), BT(0x18100000), BT(0xd7400000), BT(0x30e80000),
+		BT(0x0da80000), BT(0xea000000), BT(0x25500000), BT(0xc2f80000), BT(0x5c580000), BT(0xbbf00000), BT(0x74a00000), BT(0x93080000),
+		BT(0xb5180000), BT(0x52b00000), BT(0x9de00000), BT(0x7a480000), BT(0xe4e80000), BT(0x03400000), BT(0xcc100000), BT(0x2bb80000),
+		BT(0x16f80000), BT(0xf1500000), BT(0x3e000000), BT(0xd9a80000), BT(0x47080000), BT(0xa0a00000), BT(0x6ff00000), BT(0x88580000),
+		BT(0x15700000), BT(0xf2d80000), BT(0x3d880000), BT(0xda200000), BT(0x44800000), BT(0xa3280000), BT(0x6c780000), BT(0x8bd00000),
+		BT(0xb6900000), BT(0x51380000), BT(0x9e680000), BT(0x79c00000), BT(0xe7600000), BT(0x00c80000), BT(0xcf980000), BT(0x28300000),
+		BT(0x12600000), BT(0xf5c80000), BT(0x3a980000), BT(0xdd300000), BT(0x43900000), BT(0xa4380000), BT(0x6b680000), BT(0x8cc00000),
+		BT(0xb1800000), BT(0x56280000), BT(0x99780000), BT(0x7ed00000), BT(0xe0700000), BT(0x07d80000), BT(0xc8880000), BT(0x2f200000),
+		BT(0xb2080000), BT(0x55a00000), BT(0x9af00000), BT(0x7d580000), BT(0xe3f80000), BT(0x04500000), BT(0xcb000000), BT(0x2ca80000),
+		BT(0x11e80000), BT(0xf6400000), BT(0x39100000), BT(0xdeb80000), BT(0x40180000), BT(0xa7b00000), BT(0x68e00000), BT(0x8f480000),
+		BT(0x1c400000), BT(0xfbe80000), BT(0x34b80000), BT(0xd3100000), BT(0x4db00000), BT(0xaa180000), BT(0x65480000), BT(0x82e00000),
+		BT(0xbfa00000), BT(0x58080000), BT(0x97580000), BT(0x70f00000), BT(0xee500000), BT(0x09f80000), BT(0xc6a80000), BT(0x21000000),
+		BT(0xbc280000), BT(0x5b800000), BT(0x94d00000), BT(0x73780000), BT(0xedd80000), BT(0x0a700000), BT(0xc5200000), BT(0x22880000),
+		BT(0x1fc80000), BT(0xf8600000), BT(0x37300000), BT(0xd0980000), BT(0x4e380000), BT(0xa9900000), BT(0x66c00000), BT(0x81680000),
+		BT(0xbb380000), BT(0x5c900000), BT(0x93c00000), BT(0x74680000), BT(0xeac80000), BT(0x0d600000), BT(0xc2300000), BT(0x25980000),
+		BT(0x18d80000), BT(0xff700000), BT(0x30200000), BT(0xd7880000), BT(0x49280000), BT(0xae800000), BT(0x61d00000), BT(0x86780000),
+		BT(0x1b500000), BT(0xfcf80000), BT(0x33a80000), BT(0xd4000000), BT(0x4aa00000), BT(0xad080000), BT(0x62580000), BT(0x85f00000),
+		BT(0xb8b00000), BT(0x5f180000), BT(0x90480000), BT(0x77e00000), BT(0xe9400000), BT(0x0ee80000), BT(0xc1b80000), BT(0x26100000)
+	}, {
+		BMP_C(0x00001536), BMP_C(0x000013c0), BMP_C(0x0000038a), BMP_C(0x0000145b),
+		BMP_C(0x000001af), BMP_C(0x000014ea), BMP_C(0x0000162b), BMP_C(0x0000051f)
+	}},
+	{14UL, BT(0x20140000), {
+		BT(0x00000000), BT(0x20140000), BT(0x40280000), BT(0x603c0000), BT(0x80500000), BT(0xa0440000), BT(0xc0780000), BT(0xe06c0000),
+		BT(0x20b40000), BT(0x00a00000), BT(0x609c0000), BT(0x40880000), BT(0xa0e40000), BT(0x80f00000), BT(0xe0cc0000), BT(0xc0d80000),
+		BT(0x41680000), BT(0x617c0000), BT(0x01400000), BT(0x21540000), BT(0xc1380000), BT(0xe12c0000), BT(0x81100000), BT(0xa1040000),
+		BT(0x61dc0000), BT(0x41c80000), BT(0x21f40000), BT(0x01e00000), BT(0xe18c0000), BT(0xc1980000), BT(0xa1a40000), BT(0x81b00000),
+		BT(0x82d00000), BT(0xa2c40000), BT(0xc2f80000), BT(0xe2ec0000), BT(0x02800000), BT(0x22940000), BT(0x42a80000), BT(0x62bc0000),
+		BT(0xa2640000), BT(0x82700000), BT(0xe24c0000), BT(0xc2580000), BT(0x22340000), BT(0x02200000), BT(0x621c0000), BT(0x42080000),
+		BT(0xc3b80000), BT(0xe3ac0000), BT(0x83900000), BT(0xa3840000), BT(0x43e80000), BT(0x63fc0000), BT(0x03c00000), BT(0x23d40000),
+		BT(0xe30c0000), BT(0xc3180000), BT(0xa3240000), BT(0x83300000), BT(0x635c0000), BT(0x43480000), BT(0x23740000), BT(0x03600000),
+		BT(0x25b40000), BT(0x05a00000), BT(0x659c0000), BT(0x45880000), BT(0xa5e40000), BT(0x85f00000), BT(0xe5cc0000), BT(0xc5d80000),
+		BT(0x05000000), BT(0x25140000), BT(0x45280000), BT(0x653c0000), BT(0x85500000), BT(0xa5440000), BT(0xc5780000), BT(0xe56c0000),
+		BT(0x64dc0000), BT(0x44c80000), BT(0x24f40000), BT(0x04e00000), BT(0xe48c0000), BT(0xc4980000), BT(0xa4a40000), BT(0x84b00000),
+		BT(0x44680000), BT(0x647c0000), BT(0x04400000), BT(0x24540000), BT(0xc4380000), BT(0xe42c0000), BT(0x84100000), BT(0xa4040000),
+		BT(0xa7640000), BT(0x87700000), BT(0xe74c0000), BT(0xc7580000), BT(0x27340000), BT(0x07200000), BT(0x671c0000), BT(0x47080000),
+		BT(0x87d00000), BT(0xa7c40000), BT(0xc7f80000), BT(0xe7ec0000), BT(0x07800000), BT(0x27940000), BT(0x47a80000), BT(0x67bc0000),
+		BT(0xe60c0000), BT(0xc6180000), BT(0xa6240000), BT(0x86300000), BT(0x665c0000), BT(0x46480000), BT(0x26740000), BT(0x06600000),
+		BT(0xc6b80000), BT(0xe6ac0000), BT(0x86900000), BT(0xa6840000), BT(0x46e80000), BT(0x66fc0000), BT(0x06c00000), BT(0x26d40000),
+		BT(0x4b680000), BT(0x6b7c0000), BT(0x0b400000), BT(0x2b540000), BT(0xcb380000), BT(0xeb2c0000), BT(0x8b100000), BT(0xab040000),
+		BT(0x6bdc0000), BT(0x4bc80000), BT(0x2bf40000), BT(0x0be00000), BT(0xeb8c0000), BT(0xcb980000), BT(0xaba40000), BT(0x8bb00000),
+		BT(0x0a000000), BT(0x2a140000), BT(0x4a280000), BT(0x6a3c0000), BT(0x8a500000), BT(0xaa440000), BT(0xca780000), BT(0xea6c0000),
+		BT(0x2ab40000), BT(0x0aa00000), BT(0x6a9c0000), BT(0x4a880000), BT(0xaae40000), BT(0x8af00000), BT(0xeacc0000), BT(0xcad80000),
+		BT(0xc9b80000), BT(0xe9ac0000), BT(0x89900000), BT(0xa9840000), BT(0x49e80000), BT(0x69fc0000), BT(0x09c00000), BT(0x29d40000),
+		BT(0xe90c0000), BT(0xc9180000), BT(0xa9240000), BT(0x89300000), BT(0x695c0000), BT(0x49480000), BT(0x29740000), BT(0x09600000),
+		BT(0x88d00000), BT(0xa8c40000), BT(0xc8f80000), BT(0xe8ec0000), BT(0x08800000), BT(0x28940000), BT(0x48a80000), BT(0x68bc0000),
+		BT(0xa8640000), BT(0x88700000), BT(0xe84c0000), BT(0xc8580000), BT(0x28340000), BT(0x08200000), BT(0x681c0000), BT(0x48080000),
+		BT(0x6edc0000), BT(0x4ec80000), BT(0x2ef40000), BT(0x0ee00000), BT(0xee8c0000), BT(0xce980000), BT(0xaea40000), BT(0x8eb00000),
+		BT(0x4e680000), BT(0x6e7c0000), BT(0x0e400000), BT(0x2e540000), BT(0xce380000), BT(0xee2c0000), BT(0x8e100000), BT(0xae040000),
+		BT(0x2fb40000), BT(0x0fa00000), BT(0x6f9c0000), BT(0x4f880000), BT(0xafe40000), BT(0x8ff00000), BT(0xefcc0000), BT(0xcfd80000),
+		BT(0x0f000000), BT(0x2f140000), BT(0x4f280000), BT(0x6f3c0000), BT(0x8f500000), BT(0xaf440000), BT(0xcf780000), BT(0xef6c0000),
+		BT(0xec0c0000), BT(0xcc180000), BT(0xac240000), BT(0x8c300000), BT(0x6c5c0000), BT(0x4c480000), BT(0x2c740000), BT(0x0c600000),
+		BT(0xccb80000), BT(0xecac0000), BT(0x8c900000), BT(0xac840000), BT(0x4ce80000), BT(0x6cfc0000), BT(0x0cc00000), BT(0x2cd40000),
+		BT(0xad640000), BT(0x8d700000), BT(0xed4c0000), BT(0xcd580000), BT(0x2d340000), BT(0x0d200000), BT(0x6d1c0000), BT(0x4d080000),
+		BT(0x8dd00000), BT(0xadc40000), BT(0xcdf80000), BT(0xedec0000), BT(0x0d800000), BT(0x2d940000), BT(0x4da80000), BT(0x6dbc0000)
+	}, {
+		BMP_C(0x00000baa), BMP_C(0x00001c7b), BMP_C(0x00002aeb), BMP_C(0x00001475),
+		BMP_C(0x00002fac), BMP_C(0x0000069b), BMP_C(0x0000174f), BMP_C(0x00002eb3)
+	}},
+	{14UL, BT(0x80b40000), {
+		BT(0x00000000), BT(0x80b40000), BT(0x81dc0000), BT(0x01680000), BT(0x830c0000), BT(0x03b80000), BT(0x02d00000), BT(0x82640000),
+		BT(0x86ac0000), BT(0x06180000), BT(0x07700000), BT(0x87c40000), BT(0x05a00000), BT(0x85140000), BT(0x847c0000), BT(0x04c80000),
+		BT(0x8dec0000), BT(0x0d580000), BT(0x0c300000), BT(0x8c840000), BT(0x0ee00000), BT(0x8e540000), BT(0x8f3c0000), BT(0x0f880000),
+		BT(0x0b400000), BT(0x8bf40000), BT(0x8a9c0000), BT(0x0a280000), BT(0x884c0000), BT(0x08f80000), BT(0x09900000), BT(0x89240000),
+		BT(0x9b6c0000), BT(0x1bd80000), BT(0x1ab00000), BT(0x9a040000), BT(0x18600000), BT(0x98d40000), BT(0x99bc0000), BT(0x19080000),
+		BT(0x1dc00000), BT(0x9d740000), BT(0x9c1c0000), BT(0x1ca80000), BT(0x9ecc0000), BT(0x1e780000), BT(0x1f100000), BT(0x9fa40000),
+		BT(0x16800000), BT(0x96340000), BT(0x975c0000), BT(0x17e80000), BT(0x958c0000), BT(0x15380000), BT(0x14500000), BT(0x94e40000),
+		BT(0x902c0000), BT(0x10980000), BT(0x11f00000), BT(0x91440000), BT(0x13200000), BT(0x93940000), BT(0x92fc0000), BT(0x12480000),
+		BT(0xb66c0000), BT(0x36d80000), BT(0x37b00000), BT(0xb7040000), BT(0x35600000), BT(0xb5d40000), BT(0xb4bc0000), BT(0x34080000),
+		BT(0x30c00000), BT(0xb0740000), BT(0xb11c0000), BT(0x31a80000), BT(0xb3cc0000), BT(0x33780000), BT(0x32100000), BT(0xb2a40000),
+		BT(0x3b800000), BT(0xbb340000), BT(0xba5c0000), BT(0x3ae80000), BT(0xb88c0000), BT(0x38380000), BT(0x39500000), BT(0xb9e40000),
+		BT(0xbd2c0000), BT(0x3d980000), BT(0x3cf00000), BT(0xbc440000), BT(0x3e200000), BT(0xbe940000), BT(0xbffc0000), BT(0x3f480000),
+		BT(0x2d000000), BT(0xadb40000), BT(0xacdc0000), BT(0x2c680000), BT(0xae0c0000), BT(0x2eb80000), BT(0x2fd00000), BT(0xaf640000),
+		BT(0xabac0000), BT(0x2b180000), BT(0x2a700000), BT(0xaac40000), BT(0x28a00000), BT(0xa8140000), BT(0xa97c0000), BT(0x29c80000),
+		BT(0xa0ec0000), BT(0x20580000), BT(0x21300000), BT(0xa1840000), BT(0x23e00000), BT(0xa3540000), BT(0xa23c0000), BT(0x22880000),
+		BT(0x26400000), BT(0xa6f40000), BT(0xa79c0000), BT(0x27280000), BT(0xa54c0000), BT(0x25f80000), BT(0x24900000), BT(0xa4240000),
+		BT(0xec6c0000), BT(0x6cd80000), BT(0x6db00000), BT(0xed040000), BT(0x6f600000), BT(0xefd40000), BT(0xeebc0000), BT(0x6e080000),
+		BT(0x6ac00000), BT(0xea740000), BT(0xeb1c0000), BT(0x6ba80000), BT(0xe9cc0000), BT(0x69780000), BT(0x68100000), BT(0xe8a40000),
+		BT(0x61800000), BT(0xe1340000), BT(0xe05c0000), BT(0x60e80000), BT(0xe28c0000), BT(0x62380000), BT(0x63500000), BT(0xe3e40000),
+		BT(0xe72c0000), BT(0x67980000), BT(0x66f00000), BT(0xe6440000), BT(0x64200000), BT(0xe4940000), BT(0xe5fc0000), BT(0x65480000),
+		BT(0x77000000), BT(0xf7b40000), BT(0xf6dc0000), BT(0x76680000), BT(0xf40c0000), BT(0x74b80000), BT(0x75d00000), BT(0xf5640000),
+		BT(0xf1ac0000), BT(0x71180000), BT(0x70700000), BT(0xf0c40000), BT(0x72a00000), BT(0xf2140000), BT(0xf37c0000), BT(0x73c80000),
+		BT(0xfaec0000), BT(0x7a580000), BT(0x7b300000), BT(0xfb840000), BT(0x79e00000), BT(0xf9540000), BT(0xf83c0000), BT(0x78880000),
+		BT(0x7c400000), BT(0xfcf40000), BT(0xfd9c0000), BT(0x7d280000), BT(0xff4c0000), BT(0x7ff80000), BT(0x7e900000), BT(0xfe240000),
+		BT(0x5a000000), BT(0xdab40000), BT(0xdbdc0000), BT(0x5b680000), BT(0xd90c0000), BT(0x59b80000), BT(0x58d00000), BT(0xd8640000),
+		BT(0xdcac0000), BT(0x5c180000), BT(0x5d700000), BT(0xddc40000), BT(0x5fa00000), BT(0xdf140000), BT(0xde7c0000), BT(0x5ec80000),
+		BT(0xd7ec0000), BT(0x57580000), BT(0x56300000), BT(0xd6840000), BT(0x54e00000), BT(0xd4540000), BT(0xd53c0000), BT(0x55880000),
+		BT(0x51400000), BT(0xd1f40000), BT(0xd09c0000), BT(0x50280000), BT(0xd24c0000), BT(0x52f80000), BT(0x53900000), BT(0xd3240000),
+		BT(0xc16c0000), BT(0x41d80000), BT(0x40b00000), BT(0xc0040000), BT(0x42600000), BT(0xc2d40000), BT(0xc3bc0000), BT(0x43080000),
+		BT(0x47c00000), BT(0xc7740000), BT(0xc61c0000), BT(0x46a80000), BT(0xc4cc0000), BT(0x44780000), BT(0x45100000), BT(0xc5a40000),
+		BT(0x4c800000), BT(0xcc340000), BT(0xcd5c0000), BT(0x4de80000), BT(0xcf8c0000), BT(0x4f380000), BT(0x4e500000), BT(0xcee40000),
+		BT(0xca2c0000), BT(0x4a980000), BT(0x4bf00000), BT(0xcb440000), BT(0x49200000), BT(0xc9940000), BT(0xc8fc0000), BT(0x48480000)
+	}, {
+		BMP_C(0x00002a82), BMP_C(0x00002f5f), BMP_C(0x000005da), BMP_C(0x00003cad),
+		BMP_C(0x0000393b), BMP_C(0x0000282f), BMP_C(0x00003a7a), BMP_C(0x00001440)
+	}},
+	{15UL, BT(0x8b320000), {
+		BT(0x00000000), BT(0x8b320000), BT(0x9d560000), BT(0x16640000), BT(0xb19e0000), BT(0x3aac0000), BT(0x2cc80000), BT(0xa7fa0000),
+		BT(0xe80e0000), BT(0x633c0000), BT(0x75580000), BT(0xfe6a0000), BT(0x59900000), BT(0xd2a20000), BT(0xc4c60000), BT(0x4ff40000),
+		BT(0x5b2e0000), BT(0xd01c0000), BT(0xc6780000), BT(0x4d4a0000), BT(0xeab00000), BT(0x61820000), BT(0x77e60000), BT(0xfcd40000),
+		BT(0xb3200000), BT(0x38120000), BT(0x2e760000), BT(0xa5440000), BT(0x02be0000), BT(0x898c0000), BT(0x9fe80000), BT(0x14da0000),
+		BT(0xb65c0000), BT(0x3d6e0000), BT(0x2b0a0000), BT(0xa0380000), BT(0x07c20000), BT(0x8cf00000), BT(0x9a940000), BT(0x11a60000),
+		BT(0x5e520000), BT(0xd5600000), BT(0xc3040000), BT(0x48360000), BT(0xefcc0000), BT(0x64fe0000), BT(0x729a0000), BT(0xf9a80000),
+		BT(0xed720000), BT(0x66400000), BT(0x70240000), BT(0xfb160000), BT(0x5cec0000), BT(0xd7de0000), BT(0xc1ba0000), BT(0x4a880000),
+		BT(0x057c0000), BT(0x8e4e0000), BT(0x982a0000), BT(0x13180000), BT(0xb4e20000), BT(0x3fd00000), BT(0x29b40000), BT(0xa2860000),
+		BT(0xe78a0000), BT(0x6cb80000), BT(0x7adc0000), BT(0xf1ee0000), BT(0x56140000), BT(0xdd260000), BT(0xcb420000), BT(0x40700000),
+		BT(0x0f840000), BT(0x84b60000), BT(0x92d20000), BT(0x19e00000), BT(0xbe1a0000), BT(0x35280000), BT(0x234c0000), BT(0xa87e0000),
+		BT(0xbca40000), BT(0x37960000), BT(0x21f20000), BT(0xaac00000), BT(0x0d3a0000), BT(0x86080000), BT(0x906c0000), BT(0x1b5e0000),
+		BT(0x54aa0000), BT(0xdf980000), BT(0xc9fc0000), BT(0x42ce0000), BT(0xe5340000), BT(0x6e060000), BT(0x78620000), BT(0xf3500000),
+		BT(0x51d60000), BT(0xdae40000), BT(0xcc800000), BT(0x47b20000), BT(0xe0480000), BT(0x6b7a0000), BT(0x7d1e0000), BT(0xf62c0000),
+		BT(0xb9d80000), BT(0x32ea0000), BT(0x248e0000), BT(0xafbc0000), BT(0x08460000), BT(0x83740000), BT(0x95100000), BT(0x1e220000),
+		BT(0x0af80000), BT(0x81ca0000), BT(0x97ae0000), BT(0x1c9c0000), BT(0xbb660000), BT(0x30540000), BT(0x26300000), BT(0xad020000),
+		BT(0xe2f60000), BT(0x69c40000), BT(0x7fa00000), BT(0xf4920000), BT(0x53680000), BT(0xd85a0000), BT(0xce3e0000), BT(0x450c0000),
+		BT(0x44260000), BT(0xcf140000), BT(0xd9700000), BT(0x52420000), BT(0xf5b80000), BT(0x7e8a0000), BT(0x68ee0000), BT(0xe3dc0000),
+		BT(0xac280000), BT(0x271a0000), BT(0x317e0000), BT(0xba4c0000), BT(0x1db60000), BT(0x96840000), BT(0x80e00000), BT(0x0bd20000),
+		BT(0x1f080000), BT(0x943a0000), BT(0x825e0000), BT(0x096c0000), BT(0xae960000), BT(0x25a40000), BT(0x33c00000), BT(0xb8f20000),
+		BT(0xf7060000), BT(0x7c340000), BT(0x6a500000), BT(0xe1620000), BT(0x46980000), BT(0xcdaa0000), BT(0xdbce0000), BT(0x50fc0000),
+		BT(0xf27a0000), BT(0x79480000), BT(0x6f2c0000), BT(0xe41e0000), BT(0x43e40000), BT(0xc8d60000), BT(0xdeb20000), BT(0x55800000),
+		BT(0x1a740000), BT(0x91460000), BT(0x87220000), BT(0x0c100000), BT(0xabea0000), BT(0x20d80000), BT(0x36bc0000), BT(0xbd8e0000),
+		BT(0xa9540000), BT(0x22660000), BT(0x34020000), BT(0xbf300000), BT(0x18ca0000), BT(0x93f80000), BT(0x859c0000), BT(0x0eae0000),
+		BT(0x415a0000), BT(0xca680000), BT(0xdc0c0000), BT(0x573e0000), BT(0xf0c40000), BT(0x7bf60000), BT(0x6d920000), BT(0xe6a00000),
+		BT(0xa3ac0000), BT(0x289e0000), BT(0x3efa0000), BT(0xb5c80000), BT(0x12320000), BT(0x99000000), BT(0x8f640000), BT(0x04560000),
+		BT(0x4ba20000), BT(0xc0900000), BT(0xd6f40000), BT(0x5dc60000), BT(0xfa3c0000), BT(0x710e0000), BT(0x676a0000), BT(0xec580000),
+		BT(0xf8820000), BT(0x73b00000), BT(0x65d40000), BT(0xeee60000), BT(0x491c0000), BT(0xc22e0000), BT(0xd44a0000), BT(0x5f780000),
+		BT(0x108c0000), BT(0x9bbe0000), BT(0x8dda0000), BT(0x06e80000), BT(0xa1120000), BT(0x2a200000), BT(0x3c440000), BT(0xb7760000),
+		BT(0x15f00000), BT(0x9ec20000), BT(0x88a60000), BT(0x03940000), BT(0xa46e0000), BT(0x2f5c0000), BT(0x39380000), BT(0xb20a0000),
+		BT(0xfdfe0000), BT(0x76cc0000), BT(0x60a80000), BT(0xeb9a0000), BT(0x4c600000), BT(0xc7520000), BT(0xd1360000), BT(0x5a040000),
+		BT(0x4ede0000), BT(0xc5ec0000), BT(0xd3880000), BT(0x58ba0000), BT(0xff400000), BT(0x74720000), BT(0x62160000), BT(0xe9240000),
+		BT(0xa6d00000), BT(0x2de20000), BT(0x3b860000), BT(0xb0b40000), BT(0x174e0000), BT(0x9c7c0000), BT(0x8a180000), BT(0x012a0000)
+	}, {
+		BMP_C(0x00000010), BMP_C(0x00000ae6), BMP_C(0x00000008), BMP_C(0x00000573),
+		BMP_C(0x00000004), BMP_C(0x00006075), BMP_C(0x00000002), BMP_C(0x000052f6)
+	}},
+	{15UL, BT(0xd02a0000), {
+		BT(0x00000000), BT(0xd02a0000), BT(0x707e0000), BT(0xa0540000), BT(0xe0fc0000), BT(0x30d60000), BT(0x90820000), BT(0x40a80000),
+		BT(0x11d20000), BT(0xc1f80000), BT(0x61ac0000), BT(0xb1860000), BT(0xf12e0000), BT(0x21040000), BT(0x81500000), BT(0x517a0000),
+		BT(0x23a40000), BT(0xf38e0000), BT(0x53da0000), BT(0x83f00000), BT(0xc3580000), BT(0x13720000), BT(0xb3260000), BT(0x630c0000),
+		BT(0x32760000), BT(0xe25c0000), BT(0x42080000), BT(0x92220000), BT(0xd28a0000), BT(0x02a00000), BT(0xa2f40000), BT(0x72de0000),
+		BT(0x47480000), BT(0x97620000), BT(0x37360000), BT(0xe71c0000), BT(0xa7b40000), BT(0x779e0000), BT(0xd7ca0000), BT(0x07e00000),
+		BT(0x569a0000), BT(0x86b00000), BT(0x26e40000), BT(0xf6ce0000), BT(0xb6660000), BT(0x664c0000), BT(0xc6180000), BT(0x16320000),
+		BT(0x64ec0000), BT(0xb4c60000), BT(0x14920000), BT(0xc4b80000), BT(0x84100000), BT(0x543a0000), BT(0xf46e0000), BT(0x24440000),
+		BT(0x753e0000), BT(0xa5140000), BT(0x05400000), BT(0xd56a0000), BT(0x95c20000), BT(0x45e80000), BT(0xe5bc0000), BT(0x35960000),
+		BT(0x8e900000), BT(0x5eba0000), BT(0xfeee0000), BT(0x2ec40000), BT(0x6e6c0000), BT(0xbe460000), BT(0x1e120000), BT(0xce380000),
+		BT(0x9f420000), BT(0x4f680000), BT(0xef3c0000), BT(0x3f160000), BT(0x7fbe0000), BT(0xaf940000), BT(0x0fc00000), BT(0xdfea0000),
+		BT(0xad340000), BT(0x7d1e0000), BT(0xdd4a0000), BT(0x0d600000), BT(0x4dc80000), BT(0x9de20000), BT(0x3db60000), BT(0xed9c0000),
+		BT(0xbce60000), BT(0x6ccc0000), BT(0xcc980000), BT(0x1cb20000), BT(0x5c1a0000), BT(0x8c300000), BT(0x2c640000), BT(0xfc4e0000),
+		BT(0xc9d80000), BT(0x19f20000), BT(0xb9a60000), BT(0x698c0000), BT(0x29240000), BT(0xf90e0000), BT(0x595a0000), BT(0x89700000),
+		BT(0xd80a0000), BT(0x08200000), BT(0xa8740000), BT(0x785e0000), BT(0x38f60000), BT(0xe8dc0000), BT(0x48880000), BT(0x98a20000),
+		BT(0xea7c0000), BT(0x3a560000), BT(0x9a020000), BT(0x4a280000), BT(0x0a800000), BT(0xdaaa0000), BT(0x7afe0000), BT(0xaad40000),
+		BT(0xfbae0000), BT(0x2b840000), BT(0x8bd00000), BT(0x5bfa0000), BT(0x1b520000), BT(0xcb780000), BT(0x6b2c0000), BT(0xbb060000),
+		BT(0xcd0a0000), BT(0x1d200000), BT(0xbd740000), BT(0x6d5e0000), BT(0x2df60000), BT(0xfddc0000), BT(0x5d880000), BT(0x8da20000),
+		BT(0xdcd80000), BT(0x0cf20000), BT(0xaca60000), BT(0x7c8c0000), BT(0x3c240000), BT(0xec0e0000), BT(0x4c5a0000), BT(0x9c700000),
+		BT(0xeeae0000), BT(0x3e840000), BT(0x9ed00000), BT(0x4efa0000), BT(0x0e520000), BT(0xde780000), BT(0x7e2c0000), BT(0xae060000),
+		BT(0xff7c0000), BT(0x2f560000), BT(0x8f020000), BT(0x5f280000), BT(0x1f800000), BT(0xcfaa0000), BT(0x6ffe0000), BT(0xbfd40000),
+		BT(0x8a420000), BT(0x5a680000), BT(0xfa3c0000), BT(0x2a160000), BT(0x6abe0000), BT(0xba940000), BT(0x1ac00000), BT(0xcaea0000),
+		BT(0x9b900000), BT(0x4bba0000), BT(0xebee0000), BT(0x3bc40000), BT(0x7b6c0000), BT(0xab460000), BT(0x0b120000), BT(0xdb380000),
+		BT(0xa9e60000), BT(0x79cc0000), BT(0xd9980000), BT(0x09b20000), BT(0x491a0000), BT(0x99300000), BT(0x39640000), BT(0xe94e0000),
+		BT(0xb8340000), BT(0x681e0000), BT(0xc84a0000), BT(0x18600000), BT(0x58c80000), BT(0x88e20000), BT(0x28b60000), BT(0xf89c0000),
+		BT(0x439a0000), BT(0x93b00000), BT(0x33e40000), BT(0xe3ce0000), BT(0xa3660000), BT(0x734c0000), BT(0xd3180000), BT(0x03320000),
+		BT(0x52480000), BT(0x82620000), BT(0x22360000), BT(0xf21c0000), BT(0xb2b40000), BT(0x629e0000), BT(0xc2ca0000), BT(0x12e00000),
+		BT(0x603e0000), BT(0xb0140000), BT(0x10400000), BT(0xc06a0000), BT(0x80c20000), BT(0x50e80000), BT(0xf0bc0000), BT(0x20960000),
+		BT(0x71ec0000), BT(0xa1c60000), BT(0x01920000), BT(0xd1b80000), BT(0x91100000), BT(0x413a0000), BT(0xe16e0000), BT(0x31440000),
+		BT(0x04d20000), BT(0xd4f80000), BT(0x74ac0000), BT(0xa4860000), BT(0xe42e0000), BT(0x34040000), BT(0x94500000), BT(0x447a0000),
+		BT(0x15000000), BT(0xc52a0000), BT(0x657e0000), BT(0xb5540000), BT(0xf5fc0000), BT(0x25d60000), BT(0x85820000), BT(0x55a80000),
+		BT(0x27760000), BT(0xf75c0000), BT(0x57080000), BT(0x87220000), BT(0xc78a0000), BT(0x17a00000), BT(0xb7f40000), BT(0x67de0000),
+		BT(0x36a40000), BT(0xe68e0000), BT(0x46da0000), BT(0x96f00000), BT(0xd6580000), BT(0x06720000), BT(0xa6260000), BT(0x760c0000)
+	}, {
+		BMP_C(0x00000100), BMP_C(0x00000200), BMP_C(0x00000040), BMP_C(0x00000080),
+		BMP_C(0x00000010), BMP_C(0x00000020), BMP_C(0x00000004), BMP_C(0x00000008)
+	}},
+	{16UL, BT(0x05890000), {
+		BT(0x00000000), BT(0x05890000), BT(0x0b120000), BT(0x0e9b0000), BT(0x16240000), BT(0x13ad0000), BT(0x1d360000), BT(0x18bf0000),
+		BT(0x2c480000), BT(0x29c10000), BT(0x275a0000), BT(0x22d30000), BT(0x3a6c0000), BT(0x3fe50000), BT(0x317e0000), BT(0x34f70000),
+		BT(0x58900000), BT(0x5d190000), BT(0x53820000), BT(0x560b0000), BT(0x4eb40000), BT(0x4b3d0000), BT(0x45a60000), BT(0x402f0000),
+		BT(0x74d80000), BT(0x71510000), BT(0x7fca0000), BT(0x7a430000), BT(0x62fc0000), BT(0x67750000), BT(0x69ee0000), BT(0x6c670000),
+		BT(0xb1200000), BT(0xb4a90000), BT(0xba320000), BT(0xbfbb0000), BT(0xa7040000), BT(0xa28d0000), BT(0xac160000), BT(0xa99f0000),
+		BT(0x9d680000), BT(0x98e10000), BT(0x967a0000), BT(0x93f30000), BT(0x8b4c0000), BT(0x8ec50000), BT(0x805e0000), BT(0x85d70000),
+		BT(0xe9b00000), BT(0xec390000), BT(0xe2a20000), BT(0xe72b0000), BT(0xff940000), BT(0xfa1d0000), BT(0xf4860000), BT(0xf10f0000),
+		BT(0xc5f80000), BT(0xc0710000), BT(0xceea0000), BT(0xcb630000), BT(0xd3dc0000), BT(0xd6550000), BT(0xd8ce0000), BT(0xdd470000),
+		BT(0x67c90000), BT(0x62400000), BT(0x6cdb0000), BT(0x69520000), BT(0x71ed0000), BT(0x74640000), BT(0x7aff0000), BT(0x7f760000),
+		BT(0x4b810000), BT(0x4e080000), BT(0x40930000), BT(0x451a0000), BT(0x5da50000), BT(0x582c0000), BT(0x56b70000), BT(0x533e0000),
+		BT(0x3f590000), BT(0x3ad00000), BT(0x344b0000), BT(0x31c20000), BT(0x297d0000), BT(0x2cf40000), BT(0x226f0000), BT(0x27e60000),
+		BT(0x13110000), BT(0x16980000), BT(0x18030000), BT(0x1d8a0000), BT(0x05350000), BT(0x00bc0000), BT(0x0e270000), BT(0x0bae0000),
+		BT(0xd6e90000), BT(0xd3600000), BT(0xddfb0000), BT(0xd8720000), BT(0xc0cd0000), BT(0xc5440000), BT(0xcbdf0000), BT(0xce560000),
+		BT(0xfaa10000), BT(0xff280000), BT(0xf1b30000), BT(0xf43a0000), BT(0xec850000), BT(0xe90c0000), BT(0xe7970000), BT(0xe21e0000),
+		BT(0x8e790000), BT(0x8bf00000), BT(0x856b0000), BT(0x80e20000), BT(0x985d0000), BT(0x9dd40000), BT(0x934f0000), BT(0x96c60000),
+		BT(0xa2310000), BT(0xa7b80000), BT(0xa9230000), BT(0xacaa0000), BT(0xb4150000), BT(0xb19c0000), BT(0xbf070000), BT(0xba8e0000),
+		BT(0xcf920000), BT(0xca1b0000), BT(0xc4800000), BT(0xc1090000), BT(0xd9b60000), BT(0xdc3f0000), BT(0xd2a40000), BT(0xd72d0000),
+		BT(0xe3da0000), BT(0xe6530000), BT(0xe8c80000), BT(0xed410000), BT(0xf5fe0000), BT(0xf0770000), BT(0xfeec0000), BT(0xfb650000),
+		BT(0x97020000), BT(0x928b0000), BT(0x9c100000), BT(0x99990000), BT(0x81260000), BT(0x84af0000), BT(0x8a340000), BT(0x8fbd0000),
+		BT(0xbb4a0000), BT(0xbec30000), BT(0xb0580000), BT(0xb5d10000), BT(0xad6e0000), BT(0xa8e70000), BT(0xa67c0000), BT(0xa3f50000),
+		BT(0x7eb20000), BT(0x7b3b0000), BT(0x75a00000), BT(0x70290000), BT(0x68960000), BT(0x6d1f0000), BT(0x63840000), BT(0x660d0000),
+		BT(0x52fa0000), BT(0x57730000), BT(0x59e80000), BT(0x5c610000), BT(0x44de0000), BT(0x41570000), BT(0x4fcc0000), BT(0x4a450000),
+		BT(0x26220000), BT(0x23ab0000), BT(0x2d300000), BT(0x28b90000), BT(0x30060000), BT(0x358f0000), BT(0x3b140000), BT(0x3e9d0000),
+		BT(0x0a6a0000), BT(0x0fe30000), BT(0x01780000), BT(0x04f10000), BT(0x1c4e0000), BT(0x19c70000), BT(0x175c0000), BT(0x12d50000),
+		BT(0xa85b0000), BT(0xadd20000), BT(0xa3490000), BT(0xa6c00000), BT(0xbe7f0000), BT(0xbbf60000), BT(0xb56d0000), BT(0xb0e40000),
+		BT(0x84130000), BT(0x819a0000), BT(0x8f010000), BT(0x8a880000), BT(0x92370000), BT(0x97be0000), BT(0x99250000), BT(0x9cac0000),
+		BT(0xf0cb0000), BT(0xf5420000), BT(0xfbd90000), BT(0xfe500000), BT(0xe6ef0000), BT(0xe3660000), BT(0xedfd0000), BT(0xe8740000),
+		BT(0xdc830000), BT(0xd90a0000), BT(0xd7910000), BT(0xd2180000), BT(0xcaa70000), BT(0xcf2e0000), BT(0xc1b50000), BT(0xc43c0000),
+		BT(0x197b0000), BT(0x1cf20000), BT(0x12690000), BT(0x17e00000), BT(0x0f5f0000), BT(0x0ad60000), BT(0x044d0000), BT(0x01c40000),
+		BT(0x35330000), BT(0x30ba0000), BT(0x3e210000), BT(0x3ba80000), BT(0x23170000), BT(0x269e0000), BT(0x28050000), BT(0x2d8c0000),
+		BT(0x41eb0000), BT(0x44620000), BT(0x4af90000), BT(0x4f700000), BT(0x57cf0000), BT(0x52460000), BT(0x5cdd0000), BT(0x59540000),
+		BT(0x6da30000), BT(0x682a0000), BT(0x66b10000), BT(0x63380000), BT(0x7b870000), BT(0x7e0e0000), BT(0x70950000), BT(0x751c0000)
+	}, {
+		BMP_C(0x00000010), BMP_C(0x00003103), BMP_C(0x0000fc8f), BMP_C(0x000066c2),
+		BMP_C(0x00000004), BMP_C(0x0000cfe6), BMP_C(0x0000fc85), BMP_C(0x00009b74)
+	}},
+	{16UL, BT(0x080b0000), {
+		BT(0x00000000), BT(0x080b0000), BT(0x10160000), BT(0x181d0000), BT(0x202c0000), BT(0x28270000), BT(0x303a0000), BT(0x38310000),
+		BT(0x40580000), BT(0x48530000), BT(0x504e0000), BT(0x58450000), BT(0x60740000), BT(0x687f0000), BT(0x70620000), BT(0x78690000),
+		BT(0x80b00000), BT(0x88bb0000), BT(0x90a60000), BT(0x98ad0000), BT(0xa09c0000), BT(0xa8970000), BT(0xb08a0000), BT(0xb8810000),
+		BT(0xc0e80000), BT(0xc8e30000), BT(0xd0fe0000), BT(0xd8f50000), BT(0xe0c40000), BT(0xe8cf0000), BT(0xf0d20000), BT(0xf8d90000),
+		BT(0x096b0000), BT(0x01600000), BT(0x197d0000), BT(0x11760000), BT(0x29470000), BT(0x214c0000), BT(0x39510000), BT(0x315a0000),
+		BT(0x49330000), BT(0x41380000), BT(0x59250000), BT(0x512e0000), BT(0x691f0000), BT(0x61140000), BT(0x79090000), BT(0x71020000),
+		BT(0x89db0000), BT(0x81d00000), BT(0x99cd0000), BT(0x91c60000), BT(0xa9f70000), BT(0xa1fc0000), BT(0xb9e10000), BT(0xb1ea0000),
+		BT(0xc9830000), BT(0xc1880000), BT(0xd9950000), BT(0xd19e0000), BT(0xe9af0000), BT(0xe1a40000), BT(0xf9b90000), BT(0xf1b20000),
+		BT(0x12d60000), BT(0x1add0000), BT(0x02c00000), BT(0x0acb0000), BT(0x32fa0000), BT(0x3af10000), BT(0x22ec0000), BT(0x2ae70000),
+		BT(0x528e0000), BT(0x5a850000), BT(0x42980000), BT(0x4a930000), BT(0x72a20000), BT(0x7aa90000), BT(0x62b40000), BT(0x6abf0000),
+		BT(0x92660000), BT(0x9a6d0000), BT(0x82700000), BT(0x8a7b0000), BT(0xb24a0000), BT(0xba410000), BT(0xa25c0000), BT(0xaa570000),
+		BT(0xd23e0000), BT(0xda350000), BT(0xc2280000), BT(0xca230000), BT(0xf2120000), BT(0xfa190000), BT(0xe2040000), BT(0xea0f0000),
+		BT(0x1bbd0000), BT(0x13b60000), BT(0x0bab0000), BT(0x03a00000), BT(0x3b910000), BT(0x339a0000), BT(0x2b870000), BT(0x238c0000),
+		BT(0x5be50000), BT(0x53ee0000), BT(0x4bf30000), BT(0x43f80000), BT(0x7bc90000), BT(0x73c20000), BT(0x6bdf0000), BT(0x63d40000),
+		BT(0x9b0d0000), BT(0x93060000), BT(0x8b1b0000), BT(0x83100000), BT(0xbb210000), BT(0xb32a0000), BT(0xab370000), BT(0xa33c0000),
+		BT(0xdb550000), BT(0xd35e0000), BT(0xcb430000), BT(0xc3480000), BT(0xfb790000), BT(0xf3720000), BT(0xeb6f0000), BT(0xe3640000),
+		BT(0x25ac0000), BT(0x2da70000), BT(0x35ba0000), BT(0x3db10000), BT(0x05800000), BT(0x0d8b0000), BT(0x15960000), BT(0x1d9d0000),
+		BT(0x65f40000), BT(0x6dff0000), BT(0x75e20000), BT(0x7de90000), BT(0x45d80000), BT(0x4dd30000), BT(0x55ce0000), BT(0x5dc50000),
+		BT(0xa51c0000), BT(0xad170000), BT(0xb50a0000), BT(0xbd010000), BT(0x85300000), BT(0x8d3b0000), BT(0x95260000), BT(0x9d2d0000),
+		BT(0xe5440000), BT(0xed4f0000), BT(0xf5520000), BT(0xfd590000), BT(0xc5680000), BT(0xcd630000), BT(0xd57e0000), BT(0xdd750000),
+		BT(0x2cc70000), BT(0x24cc0000), BT(0x3cd10000), BT(0x34da0000), BT(0x0ceb0000), BT(0x04e00000), BT(0x1cfd0000), BT(0x14f60000),
+		BT(0x6c9f0000), BT(0x64940000), BT(0x7c890000), BT(0x74820000), BT(0x4cb30000), BT(0x44b80000), BT(0x5ca50000), BT(0x54ae0000),
+		BT(0xac770000), BT(0xa47c0000), BT(0xbc610000), BT(0xb46a0000), BT(0x8c5b0000), BT(0x84500000), BT(0x9c4d0000), BT(0x94460000),
+		BT(0xec2f0000), BT(0xe4240000), BT(0xfc390000), BT(0xf4320000), BT(0xcc030000), BT(0xc4080000), BT(0xdc150000), BT(0xd41e0000),
+		BT(0x377a0000), BT(0x3f710000), BT(0x276c0000), BT(0x2f670000), BT(0x17560000), BT(0x1f5d0000), BT(0x07400000), BT(0x0f4b0000),
+		BT(0x77220000), BT(0x7f290000), BT(0x67340000), BT(0x6f3f0000), BT(0x570e0000), BT(0x5f050000), BT(0x47180000), BT(0x4f130000),
+		BT(0xb7ca0000), BT(0xbfc10000), BT(0xa7dc0000), BT(0xafd70000), BT(0x97e60000), BT(0x9fed0000), BT(0x87f00000), BT(0x8ffb0000),
+		BT(0xf7920000), BT(0xff990000), BT(0xe7840000), BT(0xef8f0000), BT(0xd7be0000), BT(0xdfb50000), BT(0xc7a80000), BT(0xcfa30000),
+		BT(0x3e110000), BT(0x361a0000), BT(0x2e070000), BT(0x260c0000), BT(0x1e3d0000), BT(0x16360000), BT(0x0e2b0000), BT(0x06200000),
+		BT(0x7e490000), BT(0x76420000), BT(0x6e5f0000), BT(0x66540000), BT(0x5e650000), BT(0x566e0000), BT(0x4e730000), BT(0x46780000),
+		BT(0xbea10000), BT(0xb6aa0000), BT(0xaeb70000), BT(0xa6bc0000), BT(0x9e8d0000), BT(0x96860000), BT(0x8e9b0000), BT(0x86900000),
+		BT(0xfef90000), BT(0xf6f20000), BT(0xeeef0000), BT(0xe6e40000), BT(0xded50000), BT(0xd6de0000), BT(0xcec30000), BT(0xc6c80000)
+	}, {
+		BMP_C(0x0000bc9c), BMP_C(0x0000303c), BMP_C(0x0000424d), BMP_C(0x00001d7c),
+		BMP_C(0x0000612c), BMP_C(0x0000c9ec), BMP_C(0x00000290), BMP_C(0x0000775b)
+	}},
+	{16UL, BT(0x10210000), {
+		BT(0x00000000), BT(0x10210000), BT(0x20420000), BT(0x30630000), BT(0x40840000), BT(0x50a50000), BT(0x60c60000), BT(0x70e70000),
+		BT(0x81080000), BT(0x91290000), BT(0xa14a0000), BT(0xb16b0000), BT(0xc18c0000), BT(0xd1ad0000), BT(0xe1ce0000), BT(0xf1ef0000),
+		BT(0x12310000), BT(0x02100000), BT(0x32730000), BT(0x22520000), BT(0x52b50000), BT(0x42940000), BT(0x72f70000), BT(0x62d60000),
+		BT(0x93390000), BT(0x83180000), BT(0xb37b0000), BT(0xa35a0000), BT(0xd3bd0000), BT(0xc39c0000), BT(0xf3ff0000), BT(0xe3de0000),
+		BT(0x24620000), BT(0x34430000), BT(0x04200000), BT(0x14010000), BT(0x64e60000), BT(0x74c70000), BT(0x44a40000), BT(0x54850000),
+		BT(0xa56a0000), BT(0xb54b0000), BT(0x85280000), BT(0x95090000), BT(0xe5ee0000), BT(0xf5cf0000), BT(0xc5ac0000), BT(0xd58d0000),
+		BT(0x36530000), BT(0x26720000), BT(0x16110000), BT(0x06300000), BT(0x76d70000), BT(0x66f60000), BT(0x56950000), BT(0x46b40000),
+		BT(0xb75b0000), BT(0xa77a0000), BT(0x97190000), BT(0x87380000), BT(0xf7df0000), BT(0xe7fe0000), BT(0xd79d0000), BT(0xc7bc0000),
+		BT(0x48c40000), BT(0x58e50000), BT(0x68860000), BT(0x78a70000), BT(0x08400000), BT(0x18610000), BT(0x28020000), BT(0x38230000),
+		BT(0xc9cc0000), BT(0xd9ed0000), BT(0xe98e0000), BT(0xf9af0000), BT(0x89480000), BT(0x99690000), BT(0xa90a0000), BT(0xb92b0000),
+		BT(0x5af50000), BT(0x4ad40000), BT(0x7ab70000), BT(0x6a960000), BT(0x1a710000), BT(0x0a500000), BT(0x3a330000), BT(0x2a120000),
+		BT(0xdbfd0000), BT(0xcbdc0000), BT(0xfbbf0000), BT(0xeb9e0000), BT(0x9b790000), BT(0x8b580000), BT(0xbb3b0000), BT(0xab1a0000),
+		BT(0x6ca60000), BT(0x7c870000), BT(0x4ce40000), BT(0x5cc50000), BT(0x2c220000), BT(0x3c030000), BT(0x0c600000), BT(0x1c410000),
+		BT(0xedae0000), BT(0xfd8f0000), BT(0xcdec0000), BT(0xddcd0000), BT(0xad2a0000), BT(0xbd0b0000), BT(0x8d680000), BT(0x9d490000),
+		BT(0x7e970000), BT(0x6eb60000), BT(0x5ed50000), BT(0x4ef40000), BT(0x3e130000), BT(0x2e320000), BT(0x1e510000), BT(0x0e700000),
+		BT(0xff9f0000), BT(0xefbe0000), BT(0xdfdd0000), BT(0xcffc0000), BT(0xbf1b0000), BT(0xaf3a0000), BT(0x9f590000), BT(0x8f780000),
+		BT(0x91880000), BT(0x81a90000), BT(0xb1ca0000), BT(0xa1eb0000), BT(0xd10c0000), BT(0xc12d0000), BT(0xf14e0000), BT(0xe16f0000),
+		BT(0x10800000), BT(0x00a10000), BT(0x30c20000), BT(0x20e30000), BT(0x50040000), BT(0x40250000), BT(0x70460000), BT(0x60670000),
+		BT(0x83b90000), BT(0x93980000), BT(0xa3fb0000), BT(0xb3da0000), BT(0xc33d0000), BT(0xd31c0000), BT(0xe37f0000), BT(0xf35e0000),
+		BT(0x02b10000), BT(0x12900000), BT(0x22f30000), BT(0x32d20000), BT(0x42350000), BT(0x52140000), BT(0x62770000), BT(0x72560000),
+		BT(0xb5ea0000), BT(0xa5cb0000), BT(0x95a80000), BT(0x85890000), BT(0xf56e0000), BT(0xe54f0000), BT(0xd52c0000), BT(0xc50d0000),
+		BT(0x34e20000), BT(0x24c30000), BT(0x14a00000), BT(0x04810000), BT(0x74660000), BT(0x64470000), BT(0x54240000), BT(0x44050000),
+		BT(0xa7db0000), BT(0xb7fa0000), BT(0x87990000), BT(0x97b80000), BT(0xe75f0000), BT(0xf77e0000), BT(0xc71d0000), BT(0xd73c0000),
+		BT(0x26d30000), BT(0x36f20000), BT(0x06910000), BT(0x16b00000), BT(0x66570000), BT(0x76760000), BT(0x46150000), BT(0x56340000),
+		BT(0xd94c0000), BT(0xc96d0000), BT(0xf90e0000), BT(0xe92f0000), BT(0x99c80000), BT(0x89e90000), BT(0xb98a0000), BT(0xa9ab0000),
+		BT(0x58440000), BT(0x48650000), BT(0x78060000), BT(0x68270000), BT(0x18c00000), BT(0x08e10000), BT(0x38820000), BT(0x28a30000),
+		BT(0xcb7d0000), BT(0xdb5c0000), BT(0xeb3f0000), BT(0xfb1e0000), BT(0x8bf90000), BT(0x9bd80000), BT(0xabbb0000), BT(0xbb9a0000),
+		BT(0x4a750000), BT(0x5a540000), BT(0x6a370000), BT(0x7a160000), BT(0x0af10000), BT(0x1ad00000), BT(0x2ab30000), BT(0x3a920000),
+		BT(0xfd2e0000), BT(0xed0f0000), BT(0xdd6c0000), BT(0xcd4d0000), BT(0xbdaa0000), BT(0xad8b0000), BT(0x9de80000), BT(0x8dc90000),
+		BT(0x7c260000), BT(0x6c070000), BT(0x5c640000), BT(0x4c450000), BT(0x3ca20000), BT(0x2c830000), BT(0x1ce00000), BT(0x0cc10000),
+		BT(0xef1f0000), BT(0xff3e0000), BT(0xcf5d0000), BT(0xdf7c0000), BT(0xaf9b0000), BT(0xbfba0000), BT(0x8fd90000), BT(0x9ff80000),
+		BT(0x6e170000), BT(0x7e360000), BT(0x4e550000), BT(0x5e740000), BT(0x2e930000), BT(0x3eb20000), BT(0x0ed10000), BT(0x1ef00000)
+	}, {
+		BMP_C(0x000013fc), BMP_C(0x00008832), BMP_C(0x0000cde2), BMP_C(0x00002535),
+		BMP_C(0x00008e29), BMP_C(0x000026aa), BMP_C(0x0000aefc), BMP_C(0x0000650b)
+	}},
+	{16UL, BT(0x1dcf0000), {
+		BT(0x00000000), BT(0x1dcf0000), BT(0x3b9e0000), BT(0x26510000), BT(0x773c0000), BT(0x6af30000), BT(0x4ca20000), BT(0x516d0000),
+		BT(0xee780000), BT(0xf3b70000), BT(0xd5e60000), BT(0xc8290000), BT(0x99440000), BT(0x848b0000), BT(0xa2da0000), BT(0xbf150000),
+		BT(0xc13f0000), BT(0xdcf00000), BT(0xfaa10000), BT(0xe76e0000), BT(0xb6030000), BT(0xabcc0000), BT(0x8d9d0000), BT(0x90520000),
+		BT(0x2f470000), BT(0x32880000), BT(0x14d90000), BT(0x09160000), BT(0x587b0000), BT(0x45b40000), BT(0x63e50000), BT(0x7e2a0000),
+		BT(0x9fb10000), BT(0x827e0000), BT(0xa42f0000), BT(0xb9e00000), BT(0xe88d0000), BT(0xf5420000), BT(0xd3130000), BT(0xcedc0000),
+		BT(0x71c90000), BT(0x6c060000), BT(0x4a570000), BT(0x57980000), BT(0x06f50000), BT(0x1b3a0000), BT(0x3d6b0000), BT(0x20a40000),
+		BT(0x5e8e0000), BT(0x43410000), BT(0x65100000), BT(0x78df0000), BT(0x29b20000), BT(0x347d0000), BT(0x122c0000), BT(0x0fe30000),
+		BT(0xb0f60000), BT(0xad390000), BT(0x8b680000), BT(0x96a70000), BT(0xc7ca0000), BT(0xda050000), BT(0xfc540000), BT(0xe19b0000),
+		BT(0x22ad0000), BT(0x3f620000), BT(0x19330000), BT(0x04fc0000), BT(0x55910000), BT(0x485e0000), BT(0x6e0f0000), BT(0x73c00000),
+		BT(0xccd50000), BT(0xd11a0000), BT(0xf74b0000), BT(0xea840000), BT(0xbbe90000), BT(0xa6260000), BT(0x80770000), BT(0x9db80000),
+		BT(0xe3920000), BT(0xfe5d0000), BT(0xd80c0000), BT(0xc5c30000), BT(0x94ae0000), BT(0x89610000), BT(0xaf300000), BT(0xb2ff0000),
+		BT(0x0dea0000), BT(0x10250000), BT(0x36740000), BT(0x2bbb0000), BT(0x7ad60000), BT(0x67190000), BT(0x41480000), BT(0x5c870000),
+		BT(0xbd1c0000), BT(0xa0d30000), BT(0x86820000), BT(0x9b4d0000), BT(0xca200000), BT(0xd7ef0000), BT(0xf1be0000), BT(0xec710000),
+		BT(0x53640000), BT(0x4eab0000), BT(0x68fa0000), BT(0x75350000), BT(0x24580000), BT(0x39970000), BT(0x1fc60000), BT(0x02090000),
+		BT(0x7c230000), BT(0x61ec0000), BT(0x47bd0000), BT(0x5a720000), BT(0x0b1f0000), BT(0x16d00000), BT(0x30810000), BT(0x2d4e0000),
+		BT(0x925b0000), BT(0x8f940000), BT(0xa9c50000), BT(0xb40a0000), BT(0xe5670000), BT(0xf8a80000), BT(0xdef90000), BT(0xc3360000),
+		BT(0x455a0000), BT(0x58950000), BT(0x7ec40000), BT(0x630b0000), BT(0x32660000), BT(0x2fa90000), BT(0x09f80000), BT(0x14370000),
+		BT(0xab220000), BT(0xb6ed0000), BT(0x90bc0000), BT(0x8d730000), BT(0xdc1e0000), BT(0xc1d10000), BT(0xe7800000), BT(0xfa4f0000),
+		BT(0x84650000), BT(0x99aa0000), BT(0xbffb0000), BT(0xa2340000), BT(0xf3590000), BT(0xee960000), BT(0xc8c70000), BT(0xd5080000),
+		BT(0x6a1d0000), BT(0x77d20000), BT(0x51830000), BT(0x4c4c0000), BT(0x1d210000), BT(0x00ee0000), BT(0x26bf0000), BT(0x3b700000),
+		BT(0xdaeb0000), BT(0xc7240000), BT(0xe1750000), BT(0xfcba0000), BT(0xadd70000), BT(0xb0180000), BT(0x96490000), BT(0x8b860000),
+		BT(0x34930000), BT(0x295c0000), BT(0x0f0d0000), BT(0x12c20000), BT(0x43af0000), BT(0x5e600000), BT(0x78310000), BT(0x65fe0000),
+		BT(0x1bd40000), BT(0x061b0000), BT(0x204a0000), BT(0x3d850000), BT(0x6ce80000), BT(0x71270000), BT(0x57760000), BT(0x4ab90000),
+		BT(0xf5ac0000), BT(0xe8630000), BT(0xce320000), BT(0xd3fd0000), BT(0x82900000), BT(0x9f5f0000), BT(0xb90e0000), BT(0xa4c10000),
+		BT(0x67f70000), BT(0x7a380000), BT(0x5c690000), BT(0x41a60000), BT(0x10cb0000), BT(0x0d040000), BT(0x2b550000), BT(0x369a0000),
+		BT(0x898f0000), BT(0x94400000), BT(0xb2110000), BT(0xafde0000), BT(0xfeb30000), BT(0xe37c0000), BT(0xc52d0000), BT(0xd8e20000),
+		BT(0xa6c80000), BT(0xbb070000), BT(0x9d560000), BT(0x80990000), BT(0xd1f40000), BT(0xcc3b0000), BT(0xea6a0000), BT(0xf7a50000),
+		BT(0x48b00000), BT(0x557f0000), BT(0x732e0000), BT(0x6ee10000), BT(0x3f8c0000), BT(0x22430000), BT(0x04120000), BT(0x19dd0000),
+		BT(0xf8460000), BT(0xe5890000), BT(0xc3d80000), BT(0xde170000), BT(0x8f7a0000), BT(0x92b50000), BT(0xb4e40000), BT(0xa92b0000),
+		BT(0x163e0000), BT(0x0bf10000), BT(0x2da00000), BT(0x306f0000), BT(0x61020000), BT(0x7ccd0000), BT(0x5a9c0000), BT(0x47530000),
+		BT(0x39790000), BT(0x24b60000), BT(0x02e70000), BT(0x1f280000), BT(0x4e450000), BT(0x538a0000), BT(0x75db0000), BT(0x68140000),
+		BT(0xd7010000), BT(0xcace0000), BT(0xec9f0000), BT(0xf1500000), BT(0xa03d0000), BT(0xbdf20000), BT(0x9ba30000), BT(0x866c0000)
+	}, {
+		BMP_C(0x0000a87c), BMP_C(0x00002421), BMP_C(0x000058aa), BMP_C(0x00001d9a),
+		BMP_C(0x00009396), BMP_C(0x000094db), BMP_C(0x00005b6a), BMP_C(0x00008a26)
+	}},
+	{16UL, BT(0x3d650000), {
+		BT(0x00000000), BT(0x3d650000), BT(0x7aca0000), BT(0x47af0000), BT(0xf5940000), BT(0xc8f10000), BT(0x8f5e0000), BT(0xb23b0000),
+		BT(0xd64d0000), BT(0xeb280000), BT(0xac870000), BT(0x91e20000), BT(0x23d90000), BT(0x1ebc0000), BT(0x59130000), BT(0x64760000),
+		BT(0x91ff0000), BT(0xac9a0000), BT(0xeb350000), BT(0xd6500000), BT(0x646b0000), BT(0x590e0000), BT(0x1ea10000), BT(0x23c40000),
+		BT(0x47b20000), BT(0x7ad70000), BT(0x3d780000), BT(0x001d0000), BT(0xb2260000), BT(0x8f430000), BT(0xc8ec0000), BT(0xf5890000),
+		BT(0x1e9b0000), BT(0x23fe0000), BT(0x64510000), BT(0x59340000), BT(0xeb0f0000), BT(0xd66a0000), BT(0x91c50000), BT(0xaca00000),
+		BT(0xc8d60000), BT(0xf5b30000), BT(0xb21c0000), BT(0x8f790000), BT(0x3d420000), BT(0x00270000), BT(0x47880000), BT(0x7aed0000),
+		BT(0x8f640000), BT(0xb2010000), BT(0xf5ae0000), BT(0xc8cb0000), BT(0x7af00000), BT(0x47950000), BT(0x003a0000), BT(0x3d5f0000),
+		BT(0x59290000), BT(0x644c0000), BT(0x23e30000), BT(0x1e860000), BT(0xacbd0000), BT(0x91d80000), BT(0xd6770000), BT(0xeb120000),
+		BT(0x3d360000), BT(0x00530000), BT(0x47fc0000), BT(0x7a990000), BT(0xc8a20000), BT(0xf5c70000), BT(0xb2680000), BT(0x8f0d0000),
+		BT(0xeb7b0000), BT(0xd61e0000), BT(0x91b10000), BT(0xacd40000), BT(0x1eef0000), BT(0x238a0000), BT(0x64250000), BT(0x59400000),
+		BT(0xacc90000), BT(0x91ac0000), BT(0xd6030000), BT(0xeb660000), BT(0x595d0000), BT(0x64380000), BT(0x23970000), BT(0x1ef20000),
+		BT(0x7a840000), BT(0x47e10000), BT(0x004e0000), BT(0x3d2b0000), BT(0x8f100000), BT(0xb2750000), BT(0xf5da0000), BT(0xc8bf0000),
+		BT(0x23ad0000), BT(0x1ec80000), BT(0x59670000), BT(0x64020000), BT(0xd6390000), BT(0xeb5c0000), BT(0xacf30000), BT(0x91960000),
+		BT(0xf5e00000), BT(0xc8850000), BT(0x8f2a0000), BT(0xb24f0000), BT(0x00740000), BT(0x3d110000), BT(0x7abe0000), BT(0x47db0000),
+		BT(0xb2520000), BT(0x8f370000), BT(0xc8980000), BT(0xf5fd0000), BT(0x47c60000), BT(0x7aa30000), BT(0x3d0c0000), BT(0x00690000),
+		BT(0x641f0000), BT(0x597a0000), BT(0x1ed50000), BT(0x23b00000), BT(0x918b0000), BT(0xacee0000), BT(0xeb410000), BT(0xd6240000),
+		BT(0x7a6c0000), BT(0x47090000), BT(0x00a60000), BT(0x3dc30000), BT(0x8ff80000), BT(0xb29d0000), BT(0xf5320000), BT(0xc8570000),
+		BT(0xac210000), BT(0x91440000), BT(0xd6eb0000), BT(0xeb8e0000), BT(0x59b50000), BT(0x64d00000), BT(0x237f0000), BT(0x1e1a0000),
+		BT(0xeb930000), BT(0xd6f60000), BT(0x91590000), BT(0xac3c0000), BT(0x1e070000), BT(0x23620000), BT(0x64cd0000), BT(0x59a80000),
+		BT(0x3dde0000), BT(0x00bb0000), BT(0x47140000), BT(0x7a710000), BT(0xc84a0000), BT(0xf52f0000), BT(0xb2800000), BT(0x8fe50000),
+		BT(0x64f70000), BT(0x59920000), BT(0x1e3d0000), BT(0x23580000), BT(0x91630000), BT(0xac060000), BT(0xeba90000), BT(0xd6cc0000),
+		BT(0xb2ba0000), BT(0x8fdf0000), BT(0xc8700000), BT(0xf5150000), BT(0x472e0000), BT(0x7a4b0000), BT(0x3de40000), BT(0x00810000),
+		BT(0xf5080000), BT(0xc86d0000), BT(0x8fc20000), BT(0xb2a70000), BT(0x009c0000), BT(0x3df90000), BT(0x7a560000), BT(0x47330000),
+		BT(0x23450000), BT(0x1e200000), BT(0x598f0000), BT(0x64ea0000), BT(0xd6d10000), BT(0xebb40000), BT(0xac1b0000), BT(0x917e0000),
+		BT(0x475a0000), BT(0x7a3f0000), BT(0x3d900000), BT(0x00f50000), BT(0xb2ce0000), BT(0x8fab0000), BT(0xc8040000), BT(0xf5610000),
+		BT(0x91170000), BT(0xac720000), BT(0xebdd0000), BT(0xd6b80000), BT(0x64830000), BT(0x59e60000), BT(0x1e490000), BT(0x232c0000),
+		BT(0xd6a50000), BT(0xebc00000), BT(0xac6f0000), BT(0x910a0000), BT(0x23310000), BT(0x1e540000), BT(0x59fb0000), BT(0x649e0000),
+		BT(0x00e80000), BT(0x3d8d0000), BT(0x7a220000), BT(0x47470000), BT(0xf57c0000), BT(0xc8190000), BT(0x8fb60000), BT(0xb2d30000),
+		BT(0x59c10000), BT(0x64a40000), BT(0x230b0000), BT(0x1e6e0000), BT(0xac550000), BT(0x91300000), BT(0xd69f0000), BT(0xebfa0000),
+		BT(0x8f8c0000), BT(0xb2e90000), BT(0xf5460000), BT(0xc8230000), BT(0x7a180000), BT(0x477d0000), BT(0x00d20000), BT(0x3db70000),
+		BT(0xc83e0000), BT(0xf55b0000), BT(0xb2f40000), BT(0x8f910000), BT(0x3daa0000), BT(0x00cf0000), BT(0x47600000), BT(0x7a050000),
+		BT(0x1e730000), BT(0x23160000), BT(0x64b90000), BT(0x59dc0000), BT(0xebe70000), BT(0xd6820000), BT(0x912d0000), BT(0xac480000)
+	}, {
+		BMP_C(0x0000831e), BMP_C(0x0000d11c), BMP_C(0x0000398a), BMP_C(0x0000b0f5),
+		BMP_C(0x0000f8c5), BMP_C(0x0000f594), BMP_C(0x00001ef8), BMP_C(0x00007660)
+	}},
+	{16UL, BT(0x59350000), {
+		BT(0x00000000), BT(0x59350000), BT(0xb26a0000), BT(0xeb5f0000), BT(0x3de10000), BT(0x64d40000), BT(0x8f8b0000), BT(0xd6be0000),
+		BT(0x7bc20000), BT(0x22f70000), BT(0xc9a80000), BT(0x909d0000), BT(0x46230000), BT(0x1f160000), BT(0xf4490000), BT(0xad7c0000),
+		BT(0xf7840000), BT(0xaeb10000), BT(0x45ee0000), BT(0x1cdb0000), BT(0xca650000), BT(0x93500000), BT(0x780f0000), BT(0x213a0000),
+		BT(0x8c460000), BT(0xd5730000), BT(0x3e2c0000), BT(0x67190000), BT(0xb1a70000), BT(0xe8920000), BT(0x03cd0000), BT(0x5af80000),
+		BT(0xb63d0000), BT(0xef080000), BT(0x04570000), BT(0x5d620000), BT(0x8bdc0000), BT(0xd2e90000), BT(0x39b60000), BT(0x60830000),
+		BT(0xcdff0000), BT(0x94ca0000), BT(0x7f950000), BT(0x26a00000), BT(0xf01e0000), BT(0xa92b0000), BT(0x42740000), BT(0x1b410000),
+		BT(0x41b90000), BT(0x188c0000), BT(0xf3d30000), BT(0xaae60000), BT(0x7c580000), BT(0x256d0000), BT(0xce320000), BT(0x97070000),
+		BT(0x3a7b0000), BT(0x634e0000), BT(0x88110000), BT(0xd1240000), BT(0x079a0000), BT(0x5eaf0000), BT(0xb5f00000), BT(0xecc50000),
+		BT(0x354f0000), BT(0x6c7a0000), BT(0x87250000), BT(0xde100000), BT(0x08ae0000), BT(0x519b0000), BT(0xbac40000), BT(0xe3f10000),
+		BT(0x4e8d0000), BT(0x17b80000), BT(0xfce70000), BT(0xa5d20000), BT(0x736c0000), BT(0x2a590000), BT(0xc1060000), BT(0x98330000),
+		BT(0xc2cb0000), BT(0x9bfe0000), BT(0x70a10000), BT(0x29940000), BT(0xff2a0000), BT(0xa61f0000), BT(0x4d400000), BT(0x14750000),
+		BT(0xb9090000), BT(0xe03c0000), BT(0x0b630000), BT(0x52560000), BT(0x84e80000), BT(0xdddd0000), BT(0x36820000), BT(0x6fb70000),
+		BT(0x83720000), BT(0xda470000), BT(0x31180000), BT(0x682d0000), BT(0xbe930000), BT(0xe7a60000), BT(0x0cf90000), BT(0x55cc0000),
+		BT(0xf8b00000), BT(0xa1850000), BT(0x4ada0000), BT(0x13ef0000), BT(0xc5510000), BT(0x9c640000), BT(0x773b0000), BT(0x2e0e0000),
+		BT(0x74f60000), BT(0x2dc30000), BT(0xc69c0000), BT(0x9fa90000), BT(0x49170000), BT(0x10220000), BT(0xfb7d0000), BT(0xa2480000),
+		BT(0x0f340000), BT(0x56010000), BT(0xbd5e0000), BT(0xe46b0000), BT(0x32d50000), BT(0x6be00000), BT(0x80bf0000), BT(0xd98a0000),
+		BT(0x6a9e0000), BT(0x33ab0000), BT(0xd8f40000), BT(0x81c10000), BT(0x577f0000), BT(0x0e4a0000), BT(0xe5150000), BT(0xbc200000),
+		BT(0x115c0000), BT(0x48690000), BT(0xa3360000), BT(0xfa030000), BT(0x2cbd0000), BT(0x75880000), BT(0x9ed70000), BT(0xc7e20000),
+		BT(0x9d1a0000), BT(0xc42f0000), BT(0x2f700000), BT(0x76450000), BT(0xa0fb0000), BT(0xf9ce0000), BT(0x12910000), BT(0x4ba40000),
+		BT(0xe6d80000), BT(0xbfed0000), BT(0x54b20000), BT(0x0d870000), BT(0xdb390000), BT(0x820c0000), BT(0x69530000), BT(0x30660000),
+		BT(0xdca30000), BT(0x85960000), BT(0x6ec90000), BT(0x37fc0000), BT(0xe1420000), BT(0xb8770000), BT(0x53280000), BT(0x0a1d0000),
+		BT(0xa7610000), BT(0xfe540000), BT(0x150b0000), BT(0x4c3e0000), BT(0x9a800000), BT(0xc3b50000), BT(0x28ea0000), BT(0x71df0000),
+		BT(0x2b270000), BT(0x72120000), BT(0x994d0000), BT(0xc0780000), BT(0x16c60000), BT(0x4ff30000), BT(0xa4ac0000), BT(0xfd990000),
+		BT(0x50e50000), BT(0x09d00000), BT(0xe28f0000), BT(0xbbba0000), BT(0x6d040000), BT(0x34310000), BT(0xdf6e0000), BT(0x865b0000),
+		BT(0x5fd10000), BT(0x06e40000), BT(0xedbb0000), BT(0xb48e0000), BT(0x62300000), BT(0x3b050000), BT(0xd05a0000), BT(0x896f0000),
+		BT(0x24130000), BT(0x7d260000), BT(0x96790000), BT(0xcf4c0000), BT(0x19f20000), BT(0x40c70000), BT(0xab980000), BT(0xf2ad0000),
+		BT(0xa8550000), BT(0xf1600000), BT(0x1a3f0000), BT(0x430a0000), BT(0x95b40000), BT(0xcc810000), BT(0x27de0000), BT(0x7eeb0000),
+		BT(0xd3970000), BT(0x8aa20000), BT(0x61fd0000), BT(0x38c80000), BT(0xee760000), BT(0xb7430000), BT(0x5c1c0000), BT(0x05290000),
+		BT(0xe9ec0000), BT(0xb0d90000), BT(0x5b860000), BT(0x02b30000), BT(0xd40d0000), BT(0x8d380000), BT(0x66670000), BT(0x3f520000),
+		BT(0x922e0000), BT(0xcb1b0000), BT(0x20440000), BT(0x79710000), BT(0xafcf0000), BT(0xf6fa0000), BT(0x1da50000), BT(0x44900000),
+		BT(0x1e680000), BT(0x475d0000), BT(0xac020000), BT(0xf5370000), BT(0x23890000), BT(0x7abc0000), BT(0x91e30000), BT(0xc8d60000),
+		BT(0x65aa0000), BT(0x3c9f0000), BT(0xd7c00000), BT(0x8ef50000), BT(0x584b0000), BT(0x017e0000), BT(0xea210000), BT(0xb3140000)
+	}, {
+		BMP_C(0x0000564d), BMP_C(0x00005547), BMP_C(0x00006345), BMP_C(0x00003858),
+		BMP_C(0x0000ac9a), BMP_C(0x0000aa8e), BMP_C(0x0000c68a), BMP_C(0x000070b0)
+	}},
+	{16UL, BT(0x6f630000), {
+		BT(0x00000000), BT(0x6f630000), BT(0xdec60000), BT(0xb1a50000), BT(0xd2ef0000), BT(0xbd8c0000), BT(0x0c290000), BT(0x634a0000),
+		BT(0xcabd0000), BT(0xa5de0000), BT(0x147b0000), BT(0x7b180000), BT(0x18520000), BT(0x77310000), BT(0xc6940000), BT(0xa9f70000),
+		BT(0xfa190000), BT(0x957a0000), BT(0x24df0000), BT(0x4bbc0000), BT(0x28f60000), BT(0x47950000), BT(0xf6300000), BT(0x99530000),
+		BT(0x30a40000), BT(0x5fc70000), BT(0xee620000), BT(0x81010000), BT(0xe24b0000), BT(0x8d280000), BT(0x3c8d0000), BT(0x53ee0000),
+		BT(0x9b510000), BT(0xf4320000), BT(0x45970000), BT(0x2af40000), BT(0x49be0000), BT(0x26dd0000), BT(0x97780000), BT(0xf81b0000),
+		BT(0x51ec0000), BT(0x3e8f0000), BT(0x8f2a0000), BT(0xe0490000), BT(0x83030000), BT(0xec600000), BT(0x5dc50000), BT(0x32a60000),
+		BT(0x61480000), BT(0x0e2b0000), BT(0xbf8e0000), BT(0xd0ed0000), BT(0xb3a70000), BT(0xdcc40000), BT(0x6d610000), BT(0x02020000),
+		BT(0xabf50000), BT(0xc4960000), BT(0x75330000), BT(0x1a500000), BT(0x791a0000), BT(0x16790000), BT(0xa7dc0000), BT(0xc8bf0000),
+		BT(0x59c10000), BT(0x36a20000), BT(0x87070000), BT(0xe8640000), BT(0x8b2e0000), BT(0xe44d0000), BT(0x55e80000), BT(0x3a8b0000),
+		BT(0x937c0000), BT(0xfc1f0000), BT(0x4dba0000), BT(0x22d90000), BT(0x41930000), BT(0x2ef00000), BT(0x9f550000), BT(0xf0360000),
+		BT(0xa3d80000), BT(0xccbb0000), BT(0x7d1e0000), BT(0x127d0000), BT(0x71370000), BT(0x1e540000), BT(0xaff10000), BT(0xc0920000),
+		BT(0x69650000), BT(0x06060000), BT(0xb7a30000), BT(0xd8c00000), BT(0xbb8a0000), BT(0xd4e90000), BT(0x654c0000), BT(0x0a2f0000),
+		BT(0xc2900000), BT(0xadf30000), BT(0x1c560000), BT(0x73350000), BT(0x107f0000), BT(0x7f1c0000), BT(0xceb90000), BT(0xa1da0000),
+		BT(0x082d0000), BT(0x674e0000), BT(0xd6eb0000), BT(0xb9880000), BT(0xdac20000), BT(0xb5a10000), BT(0x04040000), BT(0x6b670000),
+		BT(0x38890000), BT(0x57ea0000), BT(0xe64f0000), BT(0x892c0000), BT(0xea660000), BT(0x85050000), BT(0x34a00000), BT(0x5bc30000),
+		BT(0xf2340000), BT(0x9d570000), BT(0x2cf20000), BT(0x43910000), BT(0x20db0000), BT(0x4fb80000), BT(0xfe1d0000), BT(0x917e0000),
+		BT(0xb3820000), BT(0xdce10000), BT(0x6d440000), BT(0x02270000), BT(0x616d0000), BT(0x0e0e0000), BT(0xbfab0000), BT(0xd0c80000),
+		BT(0x793f0000), BT(0x165c0000), BT(0xa7f90000), BT(0xc89a0000), BT(0xabd00000), BT(0xc4b30000), BT(0x75160000), BT(0x1a750000),
+		BT(0x499b0000), BT(0x26f80000), BT(0x975d0000), BT(0xf83e0000), BT(0x9b740000), BT(0xf4170000), BT(0x45b20000), BT(0x2ad10000),
+		BT(0x83260000), BT(0xec450000), BT(0x5de00000), BT(0x32830000), BT(0x51c90000), BT(0x3eaa0000), BT(0x8f0f0000), BT(0xe06c0000),
+		BT(0x28d30000), BT(0x47b00000), BT(0xf6150000), BT(0x99760000), BT(0xfa3c0000), BT(0x955f0000), BT(0x24fa0000), BT(0x4b990000),
+		BT(0xe26e0000), BT(0x8d0d0000), BT(0x3ca80000), BT(0x53cb0000), BT(0x30810000), BT(0x5fe20000), BT(0xee470000), BT(0x81240000),
+		BT(0xd2ca0000), BT(0xbda90000), BT(0x0c0c0000), BT(0x636f0000), BT(0x00250000), BT(0x6f460000), BT(0xdee30000), BT(0xb1800000),
+		BT(0x18770000), BT(0x77140000), BT(0xc6b10000), BT(0xa9d20000), BT(0xca980000), BT(0xa5fb0000), BT(0x145e0000), BT(0x7b3d0000),
+		BT(0xea430000), BT(0x85200000), BT(0x34850000), BT(0x5be60000), BT(0x38ac0000), BT(0x57cf0000), BT(0xe66a0000), BT(0x89090000),
+		BT(0x20fe0000), BT(0x4f9d0000), BT(0xfe380000), BT(0x915b0000), BT(0xf2110000), BT(0x9d720000), BT(0x2cd70000), BT(0x43b40000),
+		BT(0x105a0000), BT(0x7f390000), BT(0xce9c0000), BT(0xa1ff0000), BT(0xc2b50000), BT(0xadd60000), BT(0x1c730000), BT(0x73100000),
+		BT(0xdae70000), BT(0xb5840000), BT(0x04210000), BT(0x6b420000), BT(0x08080000), BT(0x676b0000), BT(0xd6ce0000), BT(0xb9ad0000),
+		BT(0x71120000), BT(0x1e710000), BT(0xafd40000), BT(0xc0b70000), BT(0xa3fd0000), BT(0xcc9e0000), BT(0x7d3b0000), BT(0x12580000),
+		BT(0xbbaf0000), BT(0xd4cc0000), BT(0x65690000), BT(0x0a0a0000), BT(0x69400000), BT(0x06230000), BT(0xb7860000), BT(0xd8e50000),
+		BT(0x8b0b0000), BT(0xe4680000), BT(0x55cd0000), BT(0x3aae0000), BT(0x59e40000), BT(0x36870000), BT(0x87220000), BT(0xe8410000),
+		BT(0x41b60000), BT(0x2ed50000), BT(0x9f700000), BT(0xf0130000), BT(0x93590000), BT(0xfc3a0000), BT(0x4d9f0000), BT(0x22fc0000)
+	}, {
+		BMP_C(0x00000004), BMP_C(0x0000d2a3), BMP_C(0x00003613), BMP_C(0x000015bd),
+		BMP_C(0x00000002), BMP_C(0x0000dee0), BMP_C(0x0000acb8), BMP_C(0x0000bd6f)
+	}},
+	{16UL, BT(0x755b0000), {
+		BT(0x00000000), BT(0x755b0000), BT(0xeab60000), BT(0x9fed0000), BT(0xa0370000), BT(0xd56c0000), BT(0x4a810000), BT(0x3fda0000),
+		BT(0x35350000), BT(0x406e0000), BT(0xdf830000), BT(0xaad80000), BT(0x95020000), BT(0xe0590000), BT(0x7fb40000), BT(0x0aef0000),
+		BT(0x6a6a0000), BT(0x1f310000), BT(0x80dc0000), BT(0xf5870000), BT(0xca5d0000), BT(0xbf060000), BT(0x20eb0000), BT(0x55b00000),
+		BT(0x5f5f0000), BT(0x2a040000), BT(0xb5e90000), BT(0xc0b20000), BT(0xff680000), BT(0x8a330000), BT(0x15de0000), BT(0x60850000),
+		BT(0xd4d40000), BT(0xa18f0000), BT(0x3e620000), BT(0x4b390000), BT(0x74e30000), BT(0x01b80000), BT(0x9e550000), BT(0xeb0e0000),
+		BT(0xe1e10000), BT(0x94ba0000), BT(0x0b570000), BT(0x7e0c0000), BT(0x41d60000), BT(0x348d0000), BT(0xab600000), BT(0xde3b0000),
+		BT(0xbebe0000), BT(0xcbe50000), BT(0x54080000), BT(0x21530000), BT(0x1e890000), BT(0x6bd20000), BT(0xf43f0000), BT(0x81640000),
+		BT(0x8b8b0000), BT(0xfed00000), BT(0x613d0000), BT(0x14660000), BT(0x2bbc0000), BT(0x5ee70000), BT(0xc10a0000), BT(0xb4510000),
+		BT(0xdcf30000), BT(0xa9a80000), BT(0x36450000), BT(0x431e0000), BT(0x7cc40000), BT(0x099f0000), BT(0x96720000), BT(0xe3290000),
+		BT(0xe9c60000), BT(0x9c9d0000), BT(0x03700000), BT(0x762b0000), BT(0x49f10000), BT(0x3caa0000), BT(0xa3470000), BT(0xd61c0000),
+		BT(0xb6990000), BT(0xc3c20000), BT(0x5c2f0000), BT(0x29740000), BT(0x16ae0000), BT(0x63f50000), BT(0xfc180000), BT(0x89430000),
+		BT(0x83ac0000), BT(0xf6f70000), BT(0x691a0000), BT(0x1c410000), BT(0x239b0000), BT(0x56c00000), BT(0xc92d0000), BT(0xbc760000),
+		BT(0x08270000), BT(0x7d7c0000), BT(0xe2910000), BT(0x97ca0000), BT(0xa8100000), BT(0xdd4b0000), BT(0x42a60000), BT(0x37fd0000),
+		BT(0x3d120000), BT(0x48490000), BT(0xd7a40000), BT(0xa2ff0000), BT(0x9d250000), BT(0xe87e0000), BT(0x77930000), BT(0x02c80000),
+		BT(0x624d0000), BT(0x17160000), BT(0x88fb0000), BT(0xfda00000), BT(0xc27a0000), BT(0xb7210000), BT(0x28cc0000), BT(0x5d970000),
+		BT(0x57780000), BT(0x22230000), BT(0xbdce0000), BT(0xc8950000), BT(0xf74f0000), BT(0x82140000), BT(0x1df90000), BT(0x68a20000),
+		BT(0xccbd0000), BT(0xb9e60000), BT(0x260b0000), BT(0x53500000), BT(0x6c8a0000), BT(0x19d10000), BT(0x863c0000), BT(0xf3670000),
+		BT(0xf9880000), BT(0x8cd30000), BT(0x133e0000), BT(0x66650000), BT(0x59bf0000), BT(0x2ce40000), BT(0xb3090000), BT(0xc6520000),
+		BT(0xa6d70000), BT(0xd38c0000), BT(0x4c610000), BT(0x393a0000), BT(0x06e00000), BT(0x73bb0000), BT(0xec560000), BT(0x990d0000),
+		BT(0x93e20000), BT(0xe6b90000), BT(0x79540000), BT(0x0c0f0000), BT(0x33d50000), BT(0x468e0000), BT(0xd9630000), BT(0xac380000),
+		BT(0x18690000), BT(0x6d320000), BT(0xf2df0000), BT(0x87840000), BT(0xb85e0000), BT(0xcd050000), BT(0x52e80000), BT(0x27b30000),
+		BT(0x2d5c0000), BT(0x58070000), BT(0xc7ea0000), BT(0xb2b10000), BT(0x8d6b0000), BT(0xf8300000), BT(0x67dd0000), BT(0x12860000),
+		BT(0x72030000), BT(0x07580000), BT(0x98b50000), BT(0xedee0000), BT(0xd2340000), BT(0xa76f0000), BT(0x38820000), BT(0x4dd90000),
+		BT(0x47360000), BT(0x326d0000), BT(0xad800000), BT(0xd8db0000), BT(0xe7010000), BT(0x925a0000), BT(0x0db70000), BT(0x78ec0000),
+		BT(0x104e0000), BT(0x65150000), BT(0xfaf80000), BT(0x8fa30000), BT(0xb0790000), BT(0xc5220000), BT(0x5acf0000), BT(0x2f940000),
+		BT(0x257b0000), BT(0x50200000), BT(0xcfcd0000), BT(0xba960000), BT(0x854c0000), BT(0xf0170000), BT(0x6ffa0000), BT(0x1aa10000),
+		BT(0x7a240000), BT(0x0f7f0000), BT(0x90920000), BT(0xe5c90000), BT(0xda130000), BT(0xaf480000), BT(0x30a50000), BT(0x45fe0000),
+		BT(0x4f110000), BT(0x3a4a0000), BT(0xa5a70000), BT(0xd0fc0000), BT(0xef260000), BT(0x9a7d0000), BT(0x05900000), BT(0x70cb0000),
+		BT(0xc49a0000), BT(0xb1c10000), BT(0x2e2c0000), BT(0x5b770000), BT(0x64ad0000), BT(0x11f60000), BT(0x8e1b0000), BT(0xfb400000),
+		BT(0xf1af0000), BT(0x84f40000), BT(0x1b190000), BT(0x6e420000), BT(0x51980000), BT(0x24c30000), BT(0xbb2e0000), BT(0xce750000),
+		BT(0xaef00000), BT(0xdbab0000), BT(0x44460000), BT(0x311d0000), BT(0x0ec70000), BT(0x7b9c0000), BT(0xe4710000), BT(0x912a0000),
+		BT(0x9bc50000), BT(0xee9e0000), BT(0x71730000), BT(0x04280000), BT(0x3bf20000), BT(0x4ea90000), BT(0xd1440000), BT(0xa41f0000)
+	}, {
+		BMP_C(0x00008e6e), BMP_C(0x00000c8a), BMP_C(0x000025bf), BMP_C(0x0000c355),
+		BMP_C(0x0000b0d0), BMP_C(0x0000ea43), BMP_C(0x0000e4ed), BMP_C(0x0000c3dd)
+	}},
+	{16UL, BT(0x80050000), {
+		BT(0x00000000), BT(0x80050000), BT(0x800f0000), BT(0x000a0000), BT(0x801b0000), BT(0x001e0000), BT(0x00140000), BT(0x80110000),
+		BT(0x80330000), BT(0x00360000), BT(0x003c0000), BT(0x80390000), BT(0x00280000), BT(0x802d0000), BT(0x80270000), BT(0x00220000),
+		BT(0x80630000), BT(0x00660000), BT(0x006c0000), BT(0x80690000), BT(0x00780000), BT(0x807d0000), BT(0x80770000), BT(0x00720000),
+		BT(0x00500000), BT(0x80550000), BT(0x805f0000), BT(0x005a0000), BT(0x804b0000), BT(0x004e0000), BT(0x00440000), BT(0x80410000),
+		BT(0x80c30000), BT(0x00c60000), BT(0x00cc0000), BT(0x80c90000), BT(0x00d80000), BT(0x80dd0000), BT(0x80d70000), BT(0x00d20000),
+		BT(0x00f00000), BT(0x80f50000), BT(0x80ff0000), BT(0x00fa0000), BT(0x80eb0000), BT(0x00ee0000), BT(0x00e40000), BT(0x80e10000),
+		BT(0x00a00000), BT(0x80a50000), BT(0x80af0000), BT(0x00aa0000), BT(0x80bb0000), BT(0x00be0000), BT(0x00b40000), BT(0x80b10000),
+		BT(0x80930000), BT(0x00960000), BT(0x009c0000), BT(0x80990000), BT(0x00880000), BT(0x808d0000), BT(0x80870000), BT(0x00820000),
+		BT(0x81830000), BT(0x01860000), BT(0x018c0000), BT(0x81890000), BT(0x01980000), BT(0x819d0000), BT(0x81970000), BT(0x01920000),
+		BT(0x01b00000), BT(0x81b50000), BT(0x81bf0000), BT(0x01ba0000), BT(0x81ab0000), BT(0x01ae0000), BT(0x01a40000), BT(0x81a10000),
+		BT(0x01e00000), BT(0x81e50000), BT(0x81ef0000), BT(0x01ea0000), BT(0x81fb0000), BT(0x01fe0000), BT(0x01f40000), BT(0x81f10000),
+		BT(0x81d30000), BT(0x01d60000), BT(0x01dc0000), BT(0x81d90000), BT(0x01c80000), BT(0x81cd0000), BT(0x81c70000), BT(0x01c20000),
+		BT(0x01400000), BT(0x81450000), BT(0x814f0000), BT(0x014a0000), BT(0x815b0000), BT(0x015e0000), BT(0x01540000), BT(0x81510000),
+		BT(0x81730000), BT(0x01760000), BT(0x017c0000), BT(0x81790000), BT(0x01680000), BT(0x816d0000), BT(0x81670000), BT(0x01620000),
+		BT(0x81230000), BT(0x01260000), BT(0x012c0000), BT(0x81290000), BT(0x01380000), BT(0x813d0000), BT(0x81370000), BT(0x01320000),
+		BT(0x01100000), BT(0x81150000), BT(0x811f0000), BT(0x011a0000), BT(0x810b0000), BT(0x010e0000), BT(0x01040000), BT(0x81010000),
+		BT(0x83030000), BT(0x03060000), BT(0x030c0000), BT(0x83090000), BT(0x03180000), BT(0x831d0000), BT(0x83170000), BT(0x03120000),
+		BT(0x03300000), BT(0x83350000), BT(0x833f0000), BT(0x033a0000), BT(0x832b0000), BT(0x032e0000), BT(0x03240000), BT(0x83210000),
+		BT(0x03600000), BT(0x83650000), BT(0x836f0000), BT(0x036a0000), BT(0x837b0000), BT(0x037e0000), BT(0x03740000), BT(0x83710000),
+		BT(0x83530000), BT(0x03560000), BT(0x035c0000), BT(0x83590000), BT(0x03480000), BT(0x834d0000), BT(0x83470000), BT(0x03420000),
+		BT(0x03c00000), BT(0x83c50000), BT(0x83cf0000), BT(0x03ca0000), BT(0x83db0000), BT(0x03de0000), BT(0x03d40000), BT(0x83d10000),
+		BT(0x83f30000), BT(0x03f60000), BT(0x03fc0000), BT(0x83f90000), BT(0x03e80000), BT(0x83ed0000), BT(0x83e70000), BT(0x03e20000),
+		BT(0x83a30000), BT(0x03a60000), BT(0x03ac0000), BT(0x83a90000), BT(0x03b80000), BT(0x83bd0000), BT(0x83b70000), BT(0x03b20000),
+		BT(0x03900000), BT(0x83950000), BT(0x839f0000), BT(0x039a0000), BT(0x838b0000), BT(0x038e0000), BT(0x03840000), BT(0x83810000),
+		BT(0x02800000), BT(0x82850000), BT(0x828f0000), BT(0x028a0000), BT(0x829b0000), BT(0x029e0000), BT(0x02940000), BT(0x82910000),
+		BT(0x82b30000), BT(0x02b60000), BT(0x02bc0000), BT(0x82b90000), BT(0x02a80000), BT(0x82ad0000), BT(0x82a70000), BT(0x02a20000),
+		BT(0x82e30000), BT(0x02e60000), BT(0x02ec0000), BT(0x82e90000), BT(0x02f80000), BT(0x82fd0000), BT(0x82f70000), BT(0x02f20000),
+		BT(0x02d00000), BT(0x82d50000), BT(0x82df0000), BT(0x02da0000), BT(0x82cb0000), BT(0x02ce0000), BT(0x02c40000), BT(0x82c10000),
+		BT(0x82430000), BT(0x02460000), BT(0x024c0000), BT(0x82490000), BT(0x02580000), BT(0x825d0000), BT(0x82570000), BT(0x02520000),
+		BT(0x02700000), BT(0x82750000), BT(0x827f0000), BT(0x027a0000), BT(0x826b0000), BT(0x026e0000), BT(0x02640000), BT(0x82610000),
+		BT(0x02200000), BT(0x82250000), BT(0x822f0000), BT(0x022a0000), BT(0x823b0000), BT(0x023e0000), BT(0x02340000), BT(0x82310000),
+		BT(0x82130000), BT(0x02160000), BT(0x021c0000), BT(0x82190000), BT(0x02080000), BT(0x820d0000), BT(0x82070000), BT(0x02020000)
+	}, {
+		BMP_C(0x00008107), BMP_C(0x00001446), BMP_C(0x0000926f), BMP_C(0x00004aaa),
+		BMP_C(0x00008011), BMP_C(0x00009323), BMP_C(0x00000106), BMP_C(0x00001666)
+	}},
+	{16UL, BT(0x8bb70000), {
+		BT(0x00000000), BT(0x8bb70000), BT(0x9cd90000), BT(0x176e0000), BT(0xb2050000), BT(0x39b20000), BT(0x2edc0000), BT(0xa56b0000),
+		BT(0xefbd0000), BT(0x640a0000), BT(0x73640000), BT(0xf8d30000), BT(0x5db80000), BT(0xd60f0000), BT(0xc1610000), BT(0x4ad60000),
+		BT(0x54cd0000), BT(0xdf7a0000), BT(0xc8140000), BT(0x43a30000), BT(0xe6c80000), BT(0x6d7f0000), BT(0x7a110000), BT(0xf1a60000),
+		BT(0xbb700000), BT(0x30c70000), BT(0x27a90000), BT(0xac1e0000), BT(0x09750000), BT(0x82c20000), BT(0x95ac0000), BT(0x1e1b0000),
+		BT(0xa99a0000), BT(0x222d0000), BT(0x35430000), BT(0xbef40000), BT(0x1b9f0000), BT(0x90280000), BT(0x87460000), BT(0x0cf10000),
+		BT(0x46270000), BT(0xcd900000), BT(0xdafe0000), BT(0x51490000), BT(0xf4220000), BT(0x7f950000), BT(0x68fb0000), BT(0xe34c0000),
+		BT(0xfd570000), BT(0x76e00000), BT(0x618e0000), BT(0xea390000), BT(0x4f520000), BT(0xc4e50000), BT(0xd38b0000), BT(0x583c0000),
+		BT(0x12ea0000), BT(0x995d0000), BT(0x8e330000), BT(0x05840000), BT(0xa0ef0000), BT(0x2b580000), BT(0x3c360000), BT(0xb7810000),
+		BT(0xd8830000), BT(0x53340000), BT(0x445a0000), BT(0xcfed0000), BT(0x6a860000), BT(0xe1310000), BT(0xf65f0000), BT(0x7de80000),
+		BT(0x373e0000), BT(0xbc890000), BT(0xabe70000), BT(0x20500000), BT(0x853b0000), BT(0x0e8c0000), BT(0x19e20000), BT(0x92550000),
+		BT(0x8c4e0000), BT(0x07f90000), BT(0x10970000), BT(0x9b200000), BT(0x3e4b0000), BT(0xb5fc0000), BT(0xa2920000), BT(0x29250000),
+		BT(0x63f30000), BT(0xe8440000), BT(0xff2a0000), BT(0x749d0000), BT(0xd1f60000), BT(0x5a410000), BT(0x4d2f0000), BT(0xc6980000),
+		BT(0x71190000), BT(0xfaae0000), BT(0xedc00000), BT(0x66770000), BT(0xc31c0000), BT(0x48ab0000), BT(0x5fc50000), BT(0xd4720000),
+		BT(0x9ea40000), BT(0x15130000), BT(0x027d0000), BT(0x89ca0000), BT(0x2ca10000), BT(0xa7160000), BT(0xb0780000), BT(0x3bcf0000),
+		BT(0x25d40000), BT(0xae630000), BT(0xb90d0000), BT(0x32ba0000), BT(0x97d10000), BT(0x1c660000), BT(0x0b080000), BT(0x80bf0000),
+		BT(0xca690000), BT(0x41de0000), BT(0x56b00000), BT(0xdd070000), BT(0x786c0000), BT(0xf3db0000), BT(0xe4b50000), BT(0x6f020000),
+		BT(0x3ab10000), BT(0xb1060000), BT(0xa6680000), BT(0x2ddf0000), BT(0x88b40000), BT(0x03030000), BT(0x146d0000), BT(0x9fda0000),
+		BT(0xd50c0000), BT(0x5ebb0000), BT(0x49d50000), BT(0xc2620000), BT(0x67090000), BT(0xecbe0000), BT(0xfbd00000), BT(0x70670000),
+		BT(0x6e7c0000), BT(0xe5cb0000), BT(0xf2a50000), BT(0x79120000), BT(0xdc790000), BT(0x57ce0000), BT(0x40a00000), BT(0xcb170000),
+		BT(0x81c10000), BT(0x0a760000), BT(0x1d180000), BT(0x96af0000), BT(0x33c40000), BT(0xb8730000), BT(0xaf1d0000), BT(0x24aa0000),
+		BT(0x932b0000), BT(0x189c0000), BT(0x0ff20000), BT(0x84450000), BT(0x212e0000), BT(0xaa990000), BT(0xbdf70000), BT(0x36400000),
+		BT(0x7c960000), BT(0xf7210000), BT(0xe04f0000), BT(0x6bf80000), BT(0xce930000), BT(0x45240000), BT(0x524a0000), BT(0xd9fd0000),
+		BT(0xc7e60000), BT(0x4c510000), BT(0x5b3f0000), BT(0xd0880000), BT(0x75e30000), BT(0xfe540000), BT(0xe93a0000), BT(0x628d0000),
+		BT(0x285b0000), BT(0xa3ec0000), BT(0xb4820000), BT(0x3f350000), BT(0x9a5e0000), BT(0x11e90000), BT(0x06870000), BT(0x8d300000),
+		BT(0xe2320000), BT(0x69850000), BT(0x7eeb0000), BT(0xf55c0000), BT(0x50370000), BT(0xdb800000), BT(0xccee0000), BT(0x47590000),
+		BT(0x0d8f0000), BT(0x86380000), BT(0x91560000), BT(0x1ae10000), BT(0xbf8a0000), BT(0x343d0000), BT(0x23530000), BT(0xa8e40000),
+		BT(0xb6ff0000), BT(0x3d480000), BT(0x2a260000), BT(0xa1910000), BT(0x04fa0000), BT(0x8f4d0000), BT(0x98230000), BT(0x13940000),
+		BT(0x59420000), BT(0xd2f50000), BT(0xc59b0000), BT(0x4e2c0000), BT(0xeb470000), BT(0x60f00000), BT(0x779e0000), BT(0xfc290000),
+		BT(0x4ba80000), BT(0xc01f0000), BT(0xd7710000), BT(0x5cc60000), BT(0xf9ad0000), BT(0x721a0000), BT(0x65740000), BT(0xeec30000),
+		BT(0xa4150000), BT(0x2fa20000), BT(0x38cc0000), BT(0xb37b0000), BT(0x16100000), BT(0x9da70000), BT(0x8ac90000), BT(0x017e0000),
+		BT(0x1f650000), BT(0x94d20000), BT(0x83bc0000), BT(0x080b0000), BT(0xad600000), BT(0x26d70000), BT(0x31b90000), BT(0xba0e0000),
+		BT(0xf0d80000), BT(0x7b6f0000), BT(0x6c010000), BT(0xe7b60000), BT(0x42dd0000), BT(0xc96a0000), BT(0xde040000), BT(0x55b30000)
+	}, {
+		BMP_C(0x00001069), BMP_C(0x0000dd31), BMP_C(0x000084da), BMP_C(0x00004a84),
+		BMP_C(0x0000857d), BMP_C(0x00007acc), BMP_C(0x0000a010), BMP_C(0x00001faa)
+	}},
+	{16UL, BT(0xa0970000), {
+		BT(0x00000000), BT(0xa0970000), BT(0xe1b90000), BT(0x412e0000), BT(0x63e50000), BT(0xc3720000), BT(0x825c0000), BT(0x22cb0000),
+		BT(0xc7ca0000), BT(0x675d0000), BT(0x26730000), BT(0x86e40000), BT(0xa42f0000), BT(0x04b80000), BT(0x45960000), BT(0xe5010000),
+		BT(0x2f030000), BT(0x8f940000), BT(0xceba0000), BT(0x6e2d0000), BT(0x4ce60000), BT(0xec710000), BT(0xad5f0000), BT(0x0dc80000),
+		BT(0xe8c90000), BT(0x485e0000), BT(0x09700000), BT(0xa9e70000), BT(0x8b2c0000), BT(0x2bbb0000), BT(0x6a950000), BT(0xca020000),
+		BT(0x5e060000), BT(0xfe910000), BT(0xbfbf0000), BT(0x1f280000), BT(0x3de30000), BT(0x9d740000), BT(0xdc5a0000), BT(0x7ccd0000),
+		BT(0x99cc0000), BT(0x395b0000), BT(0x78750000), BT(0xd8e20000), BT(0xfa290000), BT(0x5abe0000), BT(0x1b900000), BT(0xbb070000),
+		BT(0x71050000), BT(0xd1920000), BT(0x90bc0000), BT(0x302b0000), BT(0x12e00000), BT(0xb2770000), BT(0xf3590000), BT(0x53ce0000),
+		BT(0xb6cf0000), BT(0x16580000), BT(0x57760000), BT(0xf7e10000), BT(0xd52a0000), BT(0x75bd0000), BT(0x34930000), BT(0x94040000),
+		BT(0xbc0c0000), BT(0x1c9b0000), BT(0x5db50000), BT(0xfd220000), BT(0xdfe90000), BT(0x7f7e0000), BT(0x3e500000), BT(0x9ec70000),
+		BT(0x7bc60000), BT(0xdb510000), BT(0x9a7f0000), BT(0x3ae80000), BT(0x18230000), BT(0xb8b40000), BT(0xf99a0000), BT(0x590d0000),
+		BT(0x930f0000), BT(0x33980000), BT(0x72b60000), BT(0xd2210000), BT(0xf0ea0000), BT(0x507d0000), BT(0x11530000), BT(0xb1c40000),
+		BT(0x54c50000), BT(0xf4520000), BT(0xb57c0000), BT(0x15eb0000), BT(0x37200000), BT(0x97b70000), BT(0xd6990000), BT(0x760e0000),
+		BT(0xe20a0000), BT(0x429d0000), BT(0x03b30000), BT(0xa3240000), BT(0x81ef0000), BT(0x21780000), BT(0x60560000), BT(0xc0c10000),
+		BT(0x25c00000), BT(0x85570000), BT(0xc4790000), BT(0x64ee0000), BT(0x46250000), BT(0xe6b20000), BT(0xa79c0000), BT(0x070b0000),
+		BT(0xcd090000), BT(0x6d9e0000), BT(0x2cb00000), BT(0x8c270000), BT(0xaeec0000), BT(0x0e7b0000), BT(0x4f550000), BT(0xefc20000),
+		BT(0x0ac30000), BT(0xaa540000), BT(0xeb7a0000), BT(0x4bed0000), BT(0x69260000), BT(0xc9b10000), BT(0x889f0000), BT(0x28080000),
+		BT(0xd88f0000), BT(0x78180000), BT(0x39360000), BT(0x99a10000), BT(0xbb6a0000), BT(0x1bfd0000), BT(0x5ad30000), BT(0xfa440000),
+		BT(0x1f450000), BT(0xbfd20000), BT(0xfefc0000), BT(0x5e6b0000), BT(0x7ca00000), BT(0xdc370000), BT(0x9d190000), BT(0x3d8e0000),
+		BT(0xf78c0000), BT(0x571b0000), BT(0x16350000), BT(0xb6a20000), BT(0x94690000), BT(0x34fe0000), BT(0x75d00000), BT(0xd5470000),
+		BT(0x30460000), BT(0x90d10000), BT(0xd1ff0000), BT(0x71680000), BT(0x53a30000), BT(0xf3340000), BT(0xb21a0000), BT(0x128d0000),
+		BT(0x86890000), BT(0x261e0000), BT(0x67300000), BT(0xc7a70000), BT(0xe56c0000), BT(0x45fb0000), BT(0x04d50000), BT(0xa4420000),
+		BT(0x41430000), BT(0xe1d40000), BT(0xa0fa0000), BT(0x006d0000), BT(0x22a60000), BT(0x82310000), BT(0xc31f0000), BT(0x63880000),
+		BT(0xa98a0000), BT(0x091d0000), BT(0x48330000), BT(0xe8a40000), BT(0xca6f0000), BT(0x6af80000), BT(0x2bd60000), BT(0x8b410000),
+		BT(0x6e400000), BT(0xced70000), BT(0x8ff90000), BT(0x2f6e0000), BT(0x0da50000), BT(0xad320000), BT(0xec1c0000), BT(0x4c8b0000),
+		BT(0x64830000), BT(0xc4140000), BT(0x853a0000), BT(0x25ad0000), BT(0x07660000), BT(0xa7f10000), BT(0xe6df0000), BT(0x46480000),
+		BT(0xa3490000), BT(0x03de0000), BT(0x42f00000), BT(0xe2670000), BT(0xc0ac0000), BT(0x603b0000), BT(0x21150000), BT(0x81820000),
+		BT(0x4b800000), BT(0xeb170000), BT(0xaa390000), BT(0x0aae0000), BT(0x28650000), BT(0x88f20000), BT(0xc9dc0000), BT(0x694b0000),
+		BT(0x8c4a0000), BT(0x2cdd0000), BT(0x6df30000), BT(0xcd640000), BT(0xefaf0000), BT(0x4f380000), BT(0x0e160000), BT(0xae810000),
+		BT(0x3a850000), BT(0x9a120000), BT(0xdb3c0000), BT(0x7bab0000), BT(0x59600000), BT(0xf9f70000), BT(0xb8d90000), BT(0x184e0000),
+		BT(0xfd4f0000), BT(0x5dd80000), BT(0x1cf60000), BT(0xbc610000), BT(0x9eaa0000), BT(0x3e3d0000), BT(0x7f130000), BT(0xdf840000),
+		BT(0x15860000), BT(0xb5110000), BT(0xf43f0000), BT(0x54a80000), BT(0x76630000), BT(0xd6f40000), BT(0x97da0000), BT(0x374d0000),
+		BT(0xd24c0000), BT(0x72db0000), BT(0x33f50000), BT(0x93620000), BT(0xb1a90000), BT(0x113e0000), BT(0x50100000), BT(0xf0870000)
+	}, {
+		BMP_C(0x0000ccfb), BMP_C(0x00004cd4), BMP_C(0x00001f1e), BMP_C(0x0000d9ff),
+		BMP_C(0x0000f295), BMP_C(0x0000a79f), BMP_C(0x0000668c), BMP_C(0x0000a9a2)
+	}},
+	{16UL, BT(0xc8670000), {
+		BT(0x00000000), BT(0xc8670000), BT(0x58a90000), BT(0x90ce0000), BT(0xb1520000), BT(0x79350000), BT(0xe9fb0000), BT(0x219c0000),
+		BT(0xaac30000), BT(0x62a40000), BT(0xf26a0000), BT(0x3a0d0000), BT(0x1b910000), BT(0xd3f60000), BT(0x43380000), BT(0x8b5f0000),
+		BT(0x9de10000), BT(0x55860000), BT(0xc5480000), BT(0x0d2f0000), BT(0x2cb30000), BT(0xe4d40000), BT(0x741a0000), BT(0xbc7d0000),
+		BT(0x37220000), BT(0xff450000), BT(0x6f8b0000), BT(0xa7ec0000), BT(0x86700000), BT(0x4e170000), BT(0xded90000), BT(0x16be0000),
+		BT(0xf3a50000), BT(0x3bc20000), BT(0xab0c0000), BT(0x636b0000), BT(0x42f70000), BT(0x8a900000), BT(0x1a5e0000), BT(0xd2390000),
+		BT(0x59660000), BT(0x91010000), BT(0x01cf0000), BT(0xc9a80000), BT(0xe8340000), BT(0x20530000), BT(0xb09d0000), BT(0x78fa0000),
+		BT(0x6e440000), BT(0xa6230000), BT(0x36ed0000), BT(0xfe8a0000), BT(0xdf160000), BT(0x17710000), BT(0x87bf0000), BT(0x4fd80000),
+		BT(0xc4870000), BT(0x0ce00000), BT(0x9c2e0000), BT(0x54490000), BT(0x75d50000), BT(0xbdb20000), BT(0x2d7c0000), BT(0xe51b0000),
+		BT(0x2f2d0000), BT(0xe74a0000), BT(0x77840000), BT(0xbfe30000), BT(0x9e7f0000), BT(0x56180000), BT(0xc6d60000), BT(0x0eb10000),
+		BT(0x85ee0000), BT(0x4d890000), BT(0xdd470000), BT(0x15200000), BT(0x34bc0000), BT(0xfcdb0000), BT(0x6c150000), BT(0xa4720000),
+		BT(0xb2cc0000), BT(0x7aab0000), BT(0xea650000), BT(0x22020000), BT(0x039e0000), BT(0xcbf90000), BT(0x5b370000), BT(0x93500000),
+		BT(0x180f0000), BT(0xd0680000), BT(0x40a60000), BT(0x88c10000), BT(0xa95d0000), BT(0x613a0000), BT(0xf1f40000), BT(0x39930000),
+		BT(0xdc880000), BT(0x14ef0000), BT(0x84210000), BT(0x4c460000), BT(0x6dda0000), BT(0xa5bd0000), BT(0x35730000), BT(0xfd140000),
+		BT(0x764b0000), BT(0xbe2c0000), BT(0x2ee20000), BT(0xe6850000), BT(0xc7190000), BT(0x0f7e0000), BT(0x9fb00000), BT(0x57d70000),
+		BT(0x41690000), BT(0x890e0000), BT(0x19c00000), BT(0xd1a70000), BT(0xf03b0000), BT(0x385c0000), BT(0xa8920000), BT(0x60f50000),
+		BT(0xebaa0000), BT(0x23cd0000), BT(0xb3030000), BT(0x7b640000), BT(0x5af80000), BT(0x929f0000), BT(0x02510000), BT(0xca360000),
+		BT(0x5e5a0000), BT(0x963d0000), BT(0x06f30000), BT(0xce940000), BT(0xef080000), BT(0x276f0000), BT(0xb7a10000), BT(0x7fc60000),
+		BT(0xf4990000), BT(0x3cfe0000), BT(0xac300000), BT(0x64570000), BT(0x45cb0000), BT(0x8dac0000), BT(0x1d620000), BT(0xd5050000),
+		BT(0xc3bb0000), BT(0x0bdc0000), BT(0x9b120000), BT(0x53750000), BT(0x72e90000), BT(0xba8e0000), BT(0x2a400000), BT(0xe2270000),
+		BT(0x69780000), BT(0xa11f0000), BT(0x31d10000), BT(0xf9b60000), BT(0xd82a0000), BT(0x104d0000), BT(0x80830000), BT(0x48e40000),
+		BT(0xadff0000), BT(0x65980000), BT(0xf5560000), BT(0x3d310000), BT(0x1cad0000), BT(0xd4ca0000), BT(0x44040000), BT(0x8c630000),
+		BT(0x073c0000), BT(0xcf5b0000), BT(0x5f950000), BT(0x97f20000), BT(0xb66e0000), BT(0x7e090000), BT(0xeec70000), BT(0x26a00000),
+		BT(0x301e0000), BT(0xf8790000), BT(0x68b70000), BT(0xa0d00000), BT(0x814c0000), BT(0x492b0000), BT(0xd9e50000), BT(0x11820000),
+		BT(0x9add0000), BT(0x52ba0000), BT(0xc2740000), BT(0x0a130000), BT(0x2b8f0000), BT(0xe3e80000), BT(0x73260000), BT(0xbb410000),
+		BT(0x71770000), BT(0xb9100000), BT(0x29de0000), BT(0xe1b90000), BT(0xc0250000), BT(0x08420000), BT(0x988c0000), BT(0x50eb0000),
+		BT(0xdbb40000), BT(0x13d30000), BT(0x831d0000), BT(0x4b7a0000), BT(0x6ae60000), BT(0xa2810000), BT(0x324f0000), BT(0xfa280000),
+		BT(0xec960000), BT(0x24f10000), BT(0xb43f0000), BT(0x7c580000), BT(0x5dc40000), BT(0x95a30000), BT(0x056d0000), BT(0xcd0a0000),
+		BT(0x46550000), BT(0x8e320000), BT(0x1efc0000), BT(0xd69b0000), BT(0xf7070000), BT(0x3f600000), BT(0xafae0000), BT(0x67c90000),
+		BT(0x82d20000), BT(0x4ab50000), BT(0xda7b0000), BT(0x121c0000), BT(0x33800000), BT(0xfbe70000), BT(0x6b290000), BT(0xa34e0000),
+		BT(0x28110000), BT(0xe0760000), BT(0x70b80000), BT(0xb8df0000), BT(0x99430000), BT(0x51240000), BT(0xc1ea0000), BT(0x098d0000),
+		BT(0x1f330000), BT(0xd7540000), BT(0x479a0000), BT(0x8ffd0000), BT(0xae610000), BT(0x66060000), BT(0xf6c80000), BT(0x3eaf0000),
+		BT(0xb5f00000), BT(0x7d970000), BT(0xed590000), BT(0x253e0000), BT(0x04a20000), BT(0xccc50000), BT(0x5c0b0000), BT(0x946c0000)
+	}, {
+		BMP_C(0x00009449), BMP_C(0x00005f9c), BMP_C(0x00008b85), BMP_C(0x00001381),
+		BMP_C(0x000054ad), BMP_C(0x00009a2c), BMP_C(0x0000be62), BMP_C(0x00008a80)
+	}},
+	{17UL, BT(0xb42d8000), {
+		BT(0x00000000), BT(0xb42d8000), BT(0xdc768000), BT(0x685b0000), BT(0x0cc08000), BT(0xb8ed0000), BT(0xd0b60000), BT(0x649b8000),
+		BT(0x19810000), BT(0xadac8000), BT(0xc5f78000), BT(0x71da0000), BT(0x15418000), BT(0xa16c0000), BT(0xc9370000), BT(0x7d1a8000),
+		BT(0x33020000), BT(0x872f8000), BT(0xef748000), BT(0x5b590000), BT(0x3fc28000), BT(0x8bef0000), BT(0xe3b40000), BT(0x57998000),
+		BT(0x2a830000), BT(0x9eae8000), BT(0xf6f58000), BT(0x42d80000), BT(0x26438000), BT(0x926e0000), BT(0xfa350000), BT(0x4e188000),
+		BT(0x66040000), BT(0xd2298000), BT(0xba728000), BT(0x0e5f0000), BT(0x6ac48000), BT(0xdee90000), BT(0xb6b20000), BT(0x029f8000),
+		BT(0x7f850000), BT(0xcba88000), BT(0xa3f38000), BT(0x17de0000), BT(0x73458000), BT(0xc7680000), BT(0xaf330000), BT(0x1b1e8000),
+		BT(0x55060000), BT(0xe12b8000), BT(0x89708000), BT(0x3d5d0000), BT(0x59c68000), BT(0xedeb0000), BT(0x85b00000), BT(0x319d8000),
+		BT(0x4c870000), BT(0xf8aa8000), BT(0x90f18000), BT(0x24dc0000), BT(0x40478000), BT(0xf46a0000), BT(0x9c310000), BT(0x281c8000),
+		BT(0xcc080000), BT(0x78258000), BT(0x107e8000), BT(0xa4530000), BT(0xc0c88000), BT(0x74e50000), BT(0x1cbe0000), BT(0xa8938000),
+		BT(0xd5890000), BT(0x61a48000), BT(0x09ff8000), BT(0xbdd20000), BT(0xd9498000), BT(0x6d640000), BT(0x053f0000), BT(0xb1128000),
+		BT(0xff0a0000), BT(0x4b278000), BT(0x237c8000), BT(0x97510000), BT(0xf3ca8000), BT(0x47e70000), BT(0x2fbc0000), BT(0x9b918000),
+		BT(0xe68b0000), BT(0x52a68000), BT(0x3afd8000), BT(0x8ed00000), BT(0xea4b8000), BT(0x5e660000), BT(0x363d0000), BT(0x82108000),
+		BT(0xaa0c0000), BT(0x1e218000), BT(0x767a8000), BT(0xc2570000), BT(0xa6cc8000), BT(0x12e10000), BT(0x7aba0000), BT(0xce978000),
+		BT(0xb38d0000), BT(0x07a08000), BT(0x6ffb8000), BT(0xdbd60000), BT(0xbf4d8000), BT(0x0b600000), BT(0x633b0000), BT(0xd7168000),
+		BT(0x990e0000), BT(0x2d238000), BT(0x45788000), BT(0xf1550000), BT(0x95ce8000), BT(0x21e30000), BT(0x49b80000), BT(0xfd958000),
+		BT(0x808f0000), BT(0x34a28000), BT(0x5cf98000), BT(0xe8d40000), BT(0x8c4f8000), BT(0x38620000), BT(0x50390000), BT(0xe4148000),
+		BT(0x2c3d8000), BT(0x98100000), BT(0xf04b0000), BT(0x44668000), BT(0x20fd0000), BT(0x94d08000), BT(0xfc8b8000), BT(0x48a60000),
+		BT(0x35bc8000), BT(0x81910000), BT(0xe9ca0000), BT(0x5de78000), BT(0x397c0000), BT(0x8d518000), BT(0xe50a8000), BT(0x51270000),
+		BT(0x1f3f8000), BT(0xab120000), BT(0xc3490000), BT(0x77648000), BT(0x13ff0000), BT(0xa7d28000), BT(0xcf898000), BT(0x7ba40000),
+		BT(0x06be8000), BT(0xb2930000), BT(0xdac80000), BT(0x6ee58000), BT(0x0a7e0000), BT(0xbe538000), BT(0xd6088000), BT(0x62250000),
+		BT(0x4a398000), BT(0xfe140000), BT(0x964f0000), BT(0x22628000), BT(0x46f90000), BT(0xf2d48000), BT(0x9a8f8000), BT(0x2ea20000),
+		BT(0x53b88000), BT(0xe7950000), BT(0x8fce0000), BT(0x3be38000), BT(0x5f780000), BT(0xeb558000), BT(0x830e8000), BT(0x37230000),
+		BT(0x793b8000), BT(0xcd160000), BT(0xa54d0000), BT(0x11608000), BT(0x75fb0000), BT(0xc1d68000), BT(0xa98d8000), BT(0x1da00000),
+		BT(0x60ba8000), BT(0xd4970000), BT(0xbccc0000), BT(0x08e18000), BT(0x6c7a0000), BT(0xd8578000), BT(0xb00c8000), BT(0x04210000),
+		BT(0xe0358000), BT(0x54180000), BT(0x3c430000), BT(0x886e8000), BT(0xecf50000), BT(0x58d88000), BT(0x30838000), BT(0x84ae0000),
+		BT(0xf9b48000), BT(0x4d990000), BT(0x25c20000), BT(0x91ef8000), BT(0xf5740000), BT(0x41598000), BT(0x29028000), BT(0x9d2f0000),
+		BT(0xd3378000), BT(0x671a0000), BT(0x0f410000), BT(0xbb6c8000), BT(0xdff70000), BT(0x6bda8000), BT(0x03818000), BT(0xb7ac0000),
+		BT(0xcab68000), BT(0x7e9b0000), BT(0x16c00000), BT(0xa2ed8000), BT(0xc6760000), BT(0x725b8000), BT(0x1a008000), BT(0xae2d0000),
+		BT(0x86318000), BT(0x321c0000), BT(0x5a470000), BT(0xee6a8000), BT(0x8af10000), BT(0x3edc8000), BT(0x56878000), BT(0xe2aa0000),
+		BT(0x9fb08000), BT(0x2b9d0000), BT(0x43c60000), BT(0xf7eb8000), BT(0x93700000), BT(0x275d8000), BT(0x4f068000), BT(0xfb2b0000),
+		BT(0xb5338000), BT(0x011e0000), BT(0x69450000), BT(0xdd688000), BT(0xb9f30000), BT(0x0dde8000), BT(0x65858000), BT(0xd1a80000),
+		BT(0xacb28000), BT(0x189f0000), BT(0x70c40000), BT(0xc4e98000), BT(0xa0720000), BT(0x145f8000), BT(0x7c048000), BT(0xc8290000)
+	}, {
+		BMP_C(0x00000004), BMP_C(0x0001d1ed), BMP_C(0x00002a71), BMP_C(0x00007dc2),
+		BMP_C(0x00000002), BMP_C(0x00015cdb), BMP_C(0x0001a115), BMP_C(0x00003ee1)
+	}},
+	{21UL, BT(0x8144c800), {
+		BT(0x00000000), BT(0x8144c800), BT(0x83cd5800), BT(0x02899000), BT(0x86de7800), BT(0x079ab000), BT(0x05132000), BT(0x8457e800),
+		BT(0x8cf83800), BT(0x0dbcf000), BT(0x0f356000), BT(0x8e71a800), BT(0x0a264000), BT(0x8b628800), BT(0x89eb1800), BT(0x08afd000),
+		BT(0x98b4b800), BT(0x19f07000), BT(0x1b79e000), BT(0x9a3d2800), BT(0x1e6ac000), BT(0x9f2e0800), BT(0x9da79800), BT(0x1ce35000),
+		BT(0x144c8000), BT(0x95084800), BT(0x9781d800), BT(0x16c51000), BT(0x9292f800), BT(0x13d63000), BT(0x115fa000), BT(0x901b6800),
+		BT(0xb02db800), BT(0x31697000), BT(0x33e0e000), BT(0xb2a42800), BT(0x36f3c000), BT(0xb7b70800), BT(0xb53e9800), BT(0x347a5000),
+		BT(0x3cd58000), BT(0xbd914800), BT(0xbf18d800), BT(0x3e5c1000), BT(0xba0bf800), BT(0x3b4f3000), BT(0x39c6a000), BT(0xb8826800),
+		BT(0x28990000), BT(0xa9ddc800), BT(0xab545800), BT(0x2a109000), BT(0xae477800), BT(0x2f03b000), BT(0x2d8a2000), BT(0xaccee800),
+		BT(0xa4613800), BT(0x2525f000), BT(0x27ac6000), BT(0xa6e8a800), BT(0x22bf4000), BT(0xa3fb8800), BT(0xa1721800), BT(0x2036d000),
+		BT(0xe11fb800), BT(0x605b7000), BT(0x62d2e000), BT(0xe3962800), BT(0x67c1c000), BT(0xe6850800), BT(0xe40c9800), BT(0x65485000),
+		BT(0x6de78000), BT(0xeca34800), BT(0xee2ad800), BT(0x6f6e1000), BT(0xeb39f800), BT(0x6a7d3000), BT(0x68f4a000), BT(0xe9b06800),
+		BT(0x79ab0000), BT(0xf8efc800), BT(0xfa665800), BT(0x7b229000), BT(0xff757800), BT(0x7e31b000), BT(0x7cb82000), BT(0xfdfce800),
+		BT(0xf5533800), BT(0x7417f000), BT(0x769e6000), BT(0xf7daa800), BT(0x738d4000), BT(0xf2c98800), BT(0xf0401800), BT(0x7104d000),
+		BT(0x51320000), BT(0xd076c800), BT(0xd2ff5800), BT(0x53bb9000), BT(0xd7ec7800), BT(0x56a8b000), BT(0x54212000), BT(0xd565e800),
+		BT(0xddca3800), BT(0x5c8ef000), BT(0x5e076000), BT(0xdf43a800), BT(0x5b144000), BT(0xda508800), BT(0xd8d91800), BT(0x599dd000),
+		BT(0xc986b800), BT(0x48c27000), BT(0x4a4be000), BT(0xcb0f2800), BT(0x4f58c000), BT(0xce1c0800), BT(0xcc959800), BT(0x4dd15000),
+		BT(0x457e8000), BT(0xc43a4800), BT(0xc6b3d800), BT(0x47f71000), BT(0xc3a0f800), BT(0x42e43000), BT(0x406da000), BT(0xc1296800),
+		BT(0x437bb800), BT(0xc23f7000), BT(0xc0b6e000), BT(0x41f22800), BT(0xc5a5c000), BT(0x44e10800), BT(0x46689800), BT(0xc72c5000),
+		BT(0xcf838000), BT(0x4ec74800), BT(0x4c4ed800), BT(0xcd0a1000), BT(0x495df800), BT(0xc8193000), BT(0xca90a000), BT(0x4bd46800),
+		BT(0xdbcf0000), BT(0x5a8bc800), BT(0x58025800), BT(0xd9469000), BT(0x5d117800), BT(0xdc55b000), BT(0xdedc2000), BT(0x5f98e800),
+		BT(0x57373800), BT(0xd673f000), BT(0xd4fa6000), BT(0x55bea800), BT(0xd1e94000), BT(0x50ad8800), BT(0x52241800), BT(0xd360d000),
+		BT(0xf3560000), BT(0x7212c800), BT(0x709b5800), BT(0xf1df9000), BT(0x75887800), BT(0xf4ccb000), BT(0xf6452000), BT(0x7701e800),
+		BT(0x7fae3800), BT(0xfeeaf000), BT(0xfc636000), BT(0x7d27a800), BT(0xf9704000), BT(0x78348800), BT(0x7abd1800), BT(0xfbf9d000),
+		BT(0x6be2b800), BT(0xeaa67000), BT(0xe82fe000), BT(0x696b2800), BT(0xed3cc000), BT(0x6c780800), BT(0x6ef19800), BT(0xefb55000),
+		BT(0xe71a8000), BT(0x665e4800), BT(0x64d7d800), BT(0xe5931000), BT(0x61c4f800), BT(0xe0803000), BT(0xe209a000), BT(0x634d6800),
+		BT(0xa2640000), BT(0x2320c800), BT(0x21a95800), BT(0xa0ed9000), BT(0x24ba7800), BT(0xa5feb000), BT(0xa7772000), BT(0x2633e800),
+		BT(0x2e9c3800), BT(0xafd8f000), BT(0xad516000), BT(0x2c15a800), BT(0xa8424000), BT(0x29068800), BT(0x2b8f1800), BT(0xaacbd000),
+		BT(0x3ad0b800), BT(0xbb947000), BT(0xb91de000), BT(0x38592800), BT(0xbc0ec000), BT(0x3d4a0800), BT(0x3fc39800), BT(0xbe875000),
+		BT(0xb6288000), BT(0x376c4800), BT(0x35e5d800), BT(0xb4a11000), BT(0x30f6f800), BT(0xb1b23000), BT(0xb33ba000), BT(0x327f6800),
+		BT(0x1249b800), BT(0x930d7000), BT(0x9184e000), BT(0x10c02800), BT(0x9497c000), BT(0x15d30800), BT(0x175a9800), BT(0x961e5000),
+		BT(0x9eb18000), BT(0x1ff54800), BT(0x1d7cd800), BT(0x9c381000), BT(0x186ff800), BT(0x992b3000), BT(0x9ba2a000), BT(0x1ae66800),
+		BT(0x8afd0000), BT(0x0bb9c800), BT(0x09305800), BT(0x88749000), BT(0x0c237800), BT(0x8d67b000), BT(0x8fee2000), BT(0x0eaae800),
+		BT(0x06053800), BT(0x8741f000), BT(0x85c86000), BT(0x048ca800), BT(0x80db4000), BT(0x019f8800), BT(0x03161800), BT(0x8252d000)
+	}, {
+		BMP_C(0x001eb0a6), BMP_C(0x00030ccd), BMP_C(0x0005b003), BMP_C(0x0006efe4),
+		BMP_C(0x001ae613), BMP_C(0x000f0f80), BMP_C(0x000f6709), BMP_C(0x0006606d)
+	}},
+	{24UL, BT(0x00065b00), {
+		BT(0x00000000), BT(0x00065b00), BT(0x000cb600), BT(0x000aed00), BT(0x00196c00), BT(0x001f3700), BT(0x0015da00), BT(0x00138100),
+		BT(0x0032d800), BT(0x00348300), BT(0x003e6e00), BT(0x00383500), BT(0x002bb400), BT(0x002def00), BT(0x00270200), BT(0x00215900),
+		BT(0x0065b000), BT(0x0063eb00), BT(0x00690600), BT(0x006f5d00), BT(0x007cdc00), BT(0x007a8700), BT(0x00706a00), BT(0x00763100),
+		BT(0x00576800), BT(0x00513300), BT(0x005bde00), BT(0x005d8500), BT(0x004e0400), BT(0x00485f00), BT(0x0042b200), BT(0x0044e900),
+		BT(0x00cb6000), BT(0x00cd3b00), BT(0x00c7d600), BT(0x00c18d00), BT(0x00d20c00), BT(0x00d45700), BT(0x00deba00), BT(0x00d8e100),
+		BT(0x00f9b800), BT(0x00ffe300), BT(0x00f50e00), BT(0x00f35500), BT(0x00e0d400), BT(0x00e68f00), BT(0x00ec6200), BT(0x00ea3900),
+		BT(0x00aed000), BT(0x00a88b00), BT(0x00a26600), BT(0x00a43d00), BT(0x00b7bc00), BT(0x00b1e700), BT(0x00bb0a00), BT(0x00bd5100),
+		BT(0x009c0800), BT(0x009a5300), BT(0x0090be00), BT(0x0096e500), BT(0x00856400), BT(0x00833f00), BT(0x0089d200), BT(0x008f8900),
+		BT(0x0196c000), BT(0x01909b00), BT(0x019a7600), BT(0x019c2d00), BT(0x018fac00), BT(0x0189f700), BT(0x01831a00), BT(0x01854100),
+		BT(0x01a41800), BT(0x01a24300), BT(0x01a8ae00), BT(0x01aef500), BT(0x01bd7400), BT(0x01bb2f00), BT(0x01b1c200), BT(0x01b79900),
+		BT(0x01f37000), BT(0x01f52b00), BT(0x01ffc600), BT(0x01f99d00), BT(0x01ea1c00), BT(0x01ec4700), BT(0x01e6aa00), BT(0x01e0f100),
+		BT(0x01c1a800), BT(0x01c7f300), BT(0x01cd1e00), BT(0x01cb4500), BT(0x01d8c400), BT(0x01de9f00), BT(0x01d47200), BT(0x01d22900),
+		BT(0x015da000), BT(0x015bfb00), BT(0x01511600), BT(0x01574d00), BT(0x0144cc00), BT(0x01429700), BT(0x01487a00), BT(0x014e2100),
+		BT(0x016f7800), BT(0x01692300), BT(0x0163ce00), BT(0x01659500), BT(0x01761400), BT(0x01704f00), BT(0x017aa200), BT(0x017cf900),
+		BT(0x01381000), BT(0x013e4b00), BT(0x0134a600), BT(0x0132fd00), BT(0x01217c00), BT(0x01272700), BT(0x012dca00), BT(0x012b9100),
+		BT(0x010ac800), BT(0x010c9300), BT(0x01067e00), BT(0x01002500), BT(0x0113a400), BT(0x0115ff00), BT(0x011f1200), BT(0x01194900),
+		BT(0x032d8000), BT(0x032bdb00), BT(0x03213600), BT(0x03276d00), BT(0x0334ec00), BT(0x0332b700), BT(0x03385a00), BT(0x033e0100),
+		BT(0x031f5800), BT(0x03190300), BT(0x0313ee00), BT(0x0315b500), BT(0x03063400), BT(0x03006f00), BT(0x030a8200), BT(0x030cd900),
+		BT(0x03483000), BT(0x034e6b00), BT(0x03448600), BT(0x0342dd00), BT(0x03515c00), BT(0x03570700), BT(0x035dea00), BT(0x035bb100),
+		BT(0x037ae800), BT(0x037cb300), BT(0x03765e00), BT(0x03700500), BT(0x03638400), BT(0x0365df00), BT(0x036f3200), BT(0x03696900),
+		BT(0x03e6e000), BT(0x03e0bb00), BT(0x03ea5600), BT(0x03ec0d00), BT(0x03ff8c00), BT(0x03f9d700), BT(0x03f33a00), BT(0x03f56100),
+		BT(0x03d43800), BT(0x03d26300), BT(0x03d88e00), BT(0x03ded500), BT(0x03cd5400), BT(0x03cb0f00), BT(0x03c1e200), BT(0x03c7b900),
+		BT(0x03835000), BT(0x03850b00), BT(0x038fe600), BT(0x0389bd00), BT(0x039a3c00), BT(0x039c6700), BT(0x03968a00), BT(0x0390d100),
+		BT(0x03b18800), BT(0x03b7d300), BT(0x03bd3e00), BT(0x03bb6500), BT(0x03a8e400), BT(0x03aebf00), BT(0x03a45200), BT(0x03a20900),
+		BT(0x02bb4000), BT(0x02bd1b00), BT(0x02b7f600), BT(0x02b1ad00), BT(0x02a22c00), BT(0x02a47700), BT(0x02ae9a00), BT(0x02a8c100),
+		BT(0x02899800), BT(0x028fc300), BT(0x02852e00), BT(0x02837500), BT(0x0290f400), BT(0x0296af00), BT(0x029c4200), BT(0x029a1900),
+		BT(0x02def000), BT(0x02d8ab00), BT(0x02d24600), BT(0x02d41d00), BT(0x02c79c00), BT(0x02c1c700), BT(0x02cb2a00), BT(0x02cd7100),
+		BT(0x02ec2800), BT(0x02ea7300), BT(0x02e09e00), BT(0x02e6c500), BT(0x02f54400), BT(0x02f31f00), BT(0x02f9f200), BT(0x02ffa900),
+		BT(0x02702000), BT(0x02767b00), BT(0x027c9600), BT(0x027acd00), BT(0x02694c00), BT(0x026f1700), BT(0x0265fa00), BT(0x0263a100),
+		BT(0x0242f800), BT(0x0244a300), BT(0x024e4e00), BT(0x02481500), BT(0x025b9400), BT(0x025dcf00), BT(0x02572200), BT(0x02517900),
+		BT(0x02159000), BT(0x0213cb00), BT(0x02192600), BT(0x021f7d00), BT(0x020cfc00), BT(0x020aa700), BT(0x02004a00), BT(0x02061100),
+		BT(0x02274800), BT(0x02211300), BT(0x022bfe00), BT(0x022da500), BT(0x023e2400), BT(0x02387f00), BT(0x02329200), BT(0x0234c900)
+	}, {
+		BMP_C(0x00576aeb), BMP_C(0x0078fc52), BMP_C(0x0093f39d), BMP_C(0x002bd9ee),
+		BMP_C(0x004c3794), BMP_C(0x0067d1eb), BMP_C(0x00f30400), BMP_C(0x00dfcd45)
+	}},
+	{24UL, BT(0x328b6300), {
+		BT(0x00000000), BT(0x328b6300), BT(0x6516c600), BT(0x579da500), BT(0xca2d8c00), BT(0xf8a6ef00), BT(0xaf3b4a00), BT(0x9db02900),
+		BT(0xa6d07b00), BT(0x945b1800), BT(0xc3c6bd00), BT(0xf14dde00), BT(0x6cfdf700), BT(0x5e769400), BT(0x09eb3100), BT(0x3b605200),
+		BT(0x7f2b9500), BT(0x4da0f600), BT(0x1a3d5300), BT(0x28b63000), BT(0xb5061900), BT(0x878d7a00), BT(0xd010df00), BT(0xe29bbc00),
+		BT(0xd9fbee00), BT(0xeb708d00), BT(0xbced2800), BT(0x8e664b00), BT(0x13d66200), BT(0x215d0100), BT(0x76c0a400), BT(0x444bc700),
+		BT(0xfe572a00), BT(0xccdc4900), BT(0x9b41ec00), BT(0xa9ca8f00), BT(0x347aa600), BT(0x06f1c500), BT(0x516c6000), BT(0x63e70300),
+		BT(0x58875100), BT(0x6a0c3200), BT(0x3d919700), BT(0x0f1af400), BT(0x92aadd00), BT(0xa021be00), BT(0xf7bc1b00), BT(0xc5377800),
+		BT(0x817cbf00), BT(0xb3f7dc00), BT(0xe46a7900), BT(0xd6e11a00), BT(0x4b513300), BT(0x79da5000), BT(0x2e47f500), BT(0x1ccc9600),
+		BT(0x27acc400), BT(0x1527a700), BT(0x42ba0200), BT(0x70316100), BT(0xed814800), BT(0xdf0a2b00), BT(0x88978e00), BT(0xba1ced00),
+		BT(0xce253700), BT(0xfcae5400), BT(0xab33f100), BT(0x99b89200), BT(0x0408bb00), BT(0x3683d800), BT(0x611e7d00), BT(0x53951e00),
+		BT(0x68f54c00), BT(0x5a7e2f00), BT(0x0de38a00), BT(0x3f68e900), BT(0xa2d8c000), BT(0x9053a300), BT(0xc7ce0600), BT(0xf5456500),
+		BT(0xb10ea200), BT(0x8385c100), BT(0xd4186400), BT(0xe6930700), BT(0x7b232e00), BT(0x49a84d00), BT(0x1e35e800), BT(0x2cbe8b00),
+		BT(0x17ded900), BT(0x2555ba00), BT(0x72c81f00), BT(0x40437c00), BT(0xddf35500), BT(0xef783600), BT(0xb8e59300), BT(0x8a6ef000),
+		BT(0x30721d00), BT(0x02f97e00), BT(0x5564db00), BT(0x67efb800), BT(0xfa5f9100), BT(0xc8d4f200), BT(0x9f495700), BT(0xadc23400),
+		BT(0x96a26600), BT(0xa4290500), BT(0xf3b4a000), BT(0xc13fc300), BT(0x5c8fea00), BT(0x6e048900), BT(0x39992c00), BT(0x0b124f00),
+		BT(0x4f598800), BT(0x7dd2eb00), BT(0x2a4f4e00), BT(0x18c42d00), BT(0x85740400), BT(0xb7ff6700), BT(0xe062c200), BT(0xd2e9a100),
+		BT(0xe989f300), BT(0xdb029000), BT(0x8c9f3500), BT(0xbe145600), BT(0x23a47f00), BT(0x112f1c00), BT(0x46b2b900), BT(0x7439da00),
+		BT(0xaec10d00), BT(0x9c4a6e00), BT(0xcbd7cb00), BT(0xf95ca800), BT(0x64ec8100), BT(0x5667e200), BT(0x01fa4700), BT(0x33712400),
+		BT(0x08117600), BT(0x3a9a1500), BT(0x6d07b000), BT(0x5f8cd300), BT(0xc23cfa00), BT(0xf0b79900), BT(0xa72a3c00), BT(0x95a15f00),
+		BT(0xd1ea9800), BT(0xe361fb00), BT(0xb4fc5e00), BT(0x86773d00), BT(0x1bc71400), BT(0x294c7700), BT(0x7ed1d200), BT(0x4c5ab100),
+		BT(0x773ae300), BT(0x45b18000), BT(0x122c2500), BT(0x20a74600), BT(0xbd176f00), BT(0x8f9c0c00), BT(0xd801a900), BT(0xea8aca00),
+		BT(0x50962700), BT(0x621d4400), BT(0x3580e100), BT(0x070b8200), BT(0x9abbab00), BT(0xa830c800), BT(0xffad6d00), BT(0xcd260e00),
+		BT(0xf6465c00), BT(0xc4cd3f00), BT(0x93509a00), BT(0xa1dbf900), BT(0x3c6bd000), BT(0x0ee0b300), BT(0x597d1600), BT(0x6bf67500),
+		BT(0x2fbdb200), BT(0x1d36d100), BT(0x4aab7400), BT(0x78201700), BT(0xe5903e00), BT(0xd71b5d00), BT(0x8086f800), BT(0xb20d9b00),
+		BT(0x896dc900), BT(0xbbe6aa00), BT(0xec7b0f00), BT(0xdef06c00), BT(0x43404500), BT(0x71cb2600), BT(0x26568300), BT(0x14dde000),
+		BT(0x60e43a00), BT(0x526f5900), BT(0x05f2fc00), BT(0x37799f00), BT(0xaac9b600), BT(0x9842d500), BT(0xcfdf7000), BT(0xfd541300),
+		BT(0xc6344100), BT(0xf4bf2200), BT(0xa3228700), BT(0x91a9e400), BT(0x0c19cd00), BT(0x3e92ae00), BT(0x690f0b00), BT(0x5b846800),
+		BT(0x1fcfaf00), BT(0x2d44cc00), BT(0x7ad96900), BT(0x48520a00), BT(0xd5e22300), BT(0xe7694000), BT(0xb0f4e500), BT(0x827f8600),
+		BT(0xb91fd400), BT(0x8b94b700), BT(0xdc091200), BT(0xee827100), BT(0x73325800), BT(0x41b93b00), BT(0x16249e00), BT(0x24affd00),
+		BT(0x9eb31000), BT(0xac387300), BT(0xfba5d600), BT(0xc92eb500), BT(0x549e9c00), BT(0x6615ff00), BT(0x31885a00), BT(0x03033900),
+		BT(0x38636b00), BT(0x0ae80800), BT(0x5d75ad00), BT(0x6ffece00), BT(0xf24ee700), BT(0xc0c58400), BT(0x97582100), BT(0xa5d34200),
+		BT(0xe1988500), BT(0xd313e600), BT(0x848e4300), BT(0xb6052000), BT(0x2bb50900), BT(0x193e6a00), BT(0x4ea3cf00), BT(0x7c28ac00),
+		BT(0x4748fe00), BT(0x75c39d00), BT(0x225e3800), BT(0x10d55b00), BT(0x8d657200), BT(0xbfee1100), BT(0xe873b400), BT(0xdaf8d700)
+	}, {
+		BMP_C(0x001c29f1), BMP_C(0x00b876aa), BMP_C(0x008316da), BMP_C(0x0072817a),
+		BMP_C(0x003de4d2), BMP_C(0x00d4db79), BMP_C(0x0026ceb5), BMP_C(0x0002fa44)
+	}},
+	{24UL, BT(0x5d6dcb00), {
+		BT(0x00000000), BT(0x5d6dcb00), BT(0xbadb9600), BT(0xe7b65d00), BT(0x28dae700), BT(0x75b72c00), BT(0x92017100), BT(0xcf6cba00),
+		BT(0x51b5ce00), BT(0x0cd80500), BT(0xeb6e5800), BT(0xb6039300), BT(0x796f2900), BT(0x2402e200), BT(0xc3b4bf00), BT(0x9ed97400),
+		BT(0xa36b9c00), BT(0xfe065700), BT(0x19b00a00), BT(0x44ddc100), BT(0x8bb17b00), BT(0xd6dcb000), BT(0x316aed00), BT(0x6c072600),
+		BT(0xf2de5200), BT(0xafb39900), BT(0x4805c400), BT(0x15680f00), BT(0xda04b500), BT(0x87697e00), BT(0x60df2300), BT(0x3db2e800),
+		BT(0x1bbaf300), BT(0x46d73800), BT(0xa1616500), BT(0xfc0cae00), BT(0x33601400), BT(0x6e0ddf00), BT(0x89bb8200), BT(0xd4d64900),
+		BT(0x4a0f3d00), BT(0x1762f600), BT(0xf0d4ab00), BT(0xadb96000), BT(0x62d5da00), BT(0x3fb81100), BT(0xd80e4c00), BT(0x85638700),
+		BT(0xb8d16f00), BT(0xe5bca400), BT(0x020af900), BT(0x5f673200), BT(0x900b8800), BT(0xcd664300), BT(0x2ad01e00), BT(0x77bdd500),
+		BT(0xe964a100), BT(0xb4096a00), BT(0x53bf3700), BT(0x0ed2fc00), BT(0xc1be4600), BT(0x9cd38d00), BT(0x7b65d000), BT(0x26081b00),
+		BT(0x3775e600), BT(0x6a182d00), BT(0x8dae7000), BT(0xd0c3bb00), BT(0x1faf0100), BT(0x42c2ca00), BT(0xa5749700), BT(0xf8195c00),
+		BT(0x66c02800), BT(0x3bade300), BT(0xdc1bbe00), BT(0x81767500), BT(0x4e1acf00), BT(0x13770400), BT(0xf4c15900), BT(0xa9ac9200),
+		BT(0x941e7a00), BT(0xc973b100), BT(0x2ec5ec00), BT(0x73a82700), BT(0xbcc49d00), BT(0xe1a95600), BT(0x061f0b00), BT(0x5b72c000),
+		BT(0xc5abb400), BT(0x98c67f00), BT(0x7f702200), BT(0x221de900), BT(0xed715300), BT(0xb01c9800), BT(0x57aac500), BT(0x0ac70e00),
+		BT(0x2ccf1500), BT(0x71a2de00), BT(0x96148300), BT(0xcb794800), BT(0x0415f200), BT(0x59783900), BT(0xbece6400), BT(0xe3a3af00),
+		BT(0x7d7adb00), BT(0x20171000), BT(0xc7a14d00), BT(0x9acc8600), BT(0x55a03c00), BT(0x08cdf700), BT(0xef7baa00), BT(0xb2166100),
+		BT(0x8fa48900), BT(0xd2c94200), BT(0x357f1f00), BT(0x6812d400), BT(0xa77e6e00), BT(0xfa13a500), BT(0x1da5f800), BT(0x40c83300),
+		BT(0xde114700), BT(0x837c8c00), BT(0x64cad100), BT(0x39a71a00), BT(0xf6cba000), BT(0xaba66b00), BT(0x4c103600), BT(0x117dfd00),
+		BT(0x6eebcc00), BT(0x33860700), BT(0xd4305a00), BT(0x895d9100), BT(0x46312b00), BT(0x1b5ce000), BT(0xfceabd00), BT(0xa1877600),
+		BT(0x3f5e0200), BT(0x6233c900), BT(0x85859400), BT(0xd8e85f00), BT(0x1784e500), BT(0x4ae92e00), BT(0xad5f7300), BT(0xf032b800),
+		BT(0xcd805000), BT(0x90ed9b00), BT(0x775bc600), BT(0x2a360d00), BT(0xe55ab700), BT(0xb8377c00), BT(0x5f812100), BT(0x02ecea00),
+		BT(0x9c359e00), BT(0xc1585500), BT(0x26ee0800), BT(0x7b83c300), BT(0xb4ef7900), BT(0xe982b200), BT(0x0e34ef00), BT(0x53592400),
+		BT(0x75513f00), BT(0x283cf400), BT(0xcf8aa900), BT(0x92e76200), BT(0x5d8bd800), BT(0x00e61300), BT(0xe7504e00), BT(0xba3d8500),
+		BT(0x24e4f100), BT(0x79893a00), BT(0x9e3f6700), BT(0xc352ac00), BT(0x0c3e1600), BT(0x5153dd00), BT(0xb6e58000), BT(0xeb884b00),
+		BT(0xd63aa300), BT(0x8b576800), BT(0x6ce13500), BT(0x318cfe00), BT(0xfee04400), BT(0xa38d8f00), BT(0x443bd200), BT(0x19561900),
+		BT(0x878f6d00), BT(0xdae2a600), BT(0x3d54fb00), BT(0x60393000), BT(0xaf558a00), BT(0xf2384100), BT(0x158e1c00), BT(0x48e3d700),
+		BT(0x599e2a00), BT(0x04f3e100), BT(0xe345bc00), BT(0xbe287700), BT(0x7144cd00), BT(0x2c290600), BT(0xcb9f5b00), BT(0x96f29000),
+		BT(0x082be400), BT(0x55462f00), BT(0xb2f07200), BT(0xef9db900), BT(0x20f10300), BT(0x7d9cc800), BT(0x9a2a9500), BT(0xc7475e00),
+		BT(0xfaf5b600), BT(0xa7987d00), BT(0x402e2000), BT(0x1d43eb00), BT(0xd22f5100), BT(0x8f429a00), BT(0x68f4c700), BT(0x35990c00),
+		BT(0xab407800), BT(0xf62db300), BT(0x119bee00), BT(0x4cf62500), BT(0x839a9f00), BT(0xdef75400), BT(0x39410900), BT(0x642cc200),
+		BT(0x4224d900), BT(0x1f491200), BT(0xf8ff4f00), BT(0xa5928400), BT(0x6afe3e00), BT(0x3793f500), BT(0xd025a800), BT(0x8d486300),
+		BT(0x13911700), BT(0x4efcdc00), BT(0xa94a8100), BT(0xf4274a00), BT(0x3b4bf000), BT(0x66263b00), BT(0x81906600), BT(0xdcfdad00),
+		BT(0xe14f4500), BT(0xbc228e00), BT(0x5b94d300), BT(0x06f91800), BT(0xc995a200), BT(0x94f86900), BT(0x734e3400), BT(0x2e23ff00),
+		BT(0xb0fa8b00), BT(0xed974000), BT(0x0a211d00), BT(0x574cd600), BT(0x98206c00), BT(0xc54da700), BT(0x22fbfa00), BT(0x7f963100)
+	}, {
+		BMP_C(0x00c40595), BMP_C(0x000d1c5b), BMP_C(0x00d104b2), BMP_C(0x005e6f7b),
+		BMP_C(0x0069e63f), BMP_C(0x00a10b79), BMP_C(0x00e762f3), BMP_C(0x0033fd8b)
+	}},
+	{24UL, BT(0x80006300), {
+		BT(0x00000000), BT(0x80006300), BT(0x8000a500), BT(0x0000c600), BT(0x80012900), BT(0x00014a00), BT(0x00018c00), BT(0x8001ef00),
+		BT(0x80023100), BT(0x00025200), BT(0x00029400), BT(0x8002f700), BT(0x00031800), BT(0x80037b00), BT(0x8003bd00), BT(0x0003de00),
+		BT(0x80040100), BT(0x00046200), BT(0x0004a400), BT(0x8004c700), BT(0x00052800), BT(0x80054b00), BT(0x80058d00), BT(0x0005ee00),
+		BT(0x00063000), BT(0x80065300), BT(0x80069500), BT(0x0006f600), BT(0x80071900), BT(0x00077a00), BT(0x0007bc00), BT(0x8007df00),
+		BT(0x80086100), BT(0x00080200), BT(0x0008c400), BT(0x8008a700), BT(0x00094800), BT(0x80092b00), BT(0x8009ed00), BT(0x00098e00),
+		BT(0x000a5000), BT(0x800a3300), BT(0x800af500), BT(0x000a9600), BT(0x800b7900), BT(0x000b1a00), BT(0x000bdc00), BT(0x800bbf00),
+		BT(0x000c6000), BT(0x800c0300), BT(0x800cc500), BT(0x000ca600), BT(0x800d4900), BT(0x000d2a00), BT(0x000dec00), BT(0x800d8f00),
+		BT(0x800e5100), BT(0x000e3200), BT(0x000ef400), BT(0x800e9700), BT(0x000f7800), BT(0x800f1b00), BT(0x800fdd00), BT(0x000fbe00),
+		BT(0x8010a100), BT(0x0010c200), BT(0x00100400), BT(0x80106700), BT(0x00118800), BT(0x8011eb00), BT(0x80112d00), BT(0x00114e00),
+		BT(0x00129000), BT(0x8012f300), BT(0x80123500), BT(0x00125600), BT(0x8013b900), BT(0x0013da00), BT(0x00131c00), BT(0x80137f00),
+		BT(0x0014a000), BT(0x8014c300), BT(0x80140500), BT(0x00146600), BT(0x80158900), BT(0x0015ea00), BT(0x00152c00), BT(0x80154f00),
+		BT(0x80169100), BT(0x0016f200), BT(0x00163400), BT(0x80165700), BT(0x0017b800), BT(0x8017db00), BT(0x80171d00), BT(0x00177e00),
+		BT(0x0018c000), BT(0x8018a300), BT(0x80186500), BT(0x00180600), BT(0x8019e900), BT(0x00198a00), BT(0x00194c00), BT(0x80192f00),
+		BT(0x801af100), BT(0x001a9200), BT(0x001a5400), BT(0x801a3700), BT(0x001bd800), BT(0x801bbb00), BT(0x801b7d00), BT(0x001b1e00),
+		BT(0x801cc100), BT(0x001ca200), BT(0x001c6400), BT(0x801c0700), BT(0x001de800), BT(0x801d8b00), BT(0x801d4d00), BT(0x001d2e00),
+		BT(0x001ef000), BT(0x801e9300), BT(0x801e5500), BT(0x001e3600), BT(0x801fd900), BT(0x001fba00), BT(0x001f7c00), BT(0x801f1f00),
+		BT(0x80212100), BT(0x00214200), BT(0x00218400), BT(0x8021e700), BT(0x00200800), BT(0x80206b00), BT(0x8020ad00), BT(0x0020ce00),
+		BT(0x00231000), BT(0x80237300), BT(0x8023b500), BT(0x0023d600), BT(0x80223900), BT(0x00225a00), BT(0x00229c00), BT(0x8022ff00),
+		BT(0x00252000), BT(0x80254300), BT(0x80258500), BT(0x0025e600), BT(0x80240900), BT(0x00246a00), BT(0x0024ac00), BT(0x8024cf00),
+		BT(0x80271100), BT(0x00277200), BT(0x0027b400), BT(0x8027d700), BT(0x00263800), BT(0x80265b00), BT(0x80269d00), BT(0x0026fe00),
+		BT(0x00294000), BT(0x80292300), BT(0x8029e500), BT(0x00298600), BT(0x80286900), BT(0x00280a00), BT(0x0028cc00), BT(0x8028af00),
+		BT(0x802b7100), BT(0x002b1200), BT(0x002bd400), BT(0x802bb700), BT(0x002a5800), BT(0x802a3b00), BT(0x802afd00), BT(0x002a9e00),
+		BT(0x802d4100), BT(0x002d2200), BT(0x002de400), BT(0x802d8700), BT(0x002c6800), BT(0x802c0b00), BT(0x802ccd00), BT(0x002cae00),
+		BT(0x002f7000), BT(0x802f1300), BT(0x802fd500), BT(0x002fb600), BT(0x802e5900), BT(0x002e3a00), BT(0x002efc00), BT(0x802e9f00),
+		BT(0x00318000), BT(0x8031e300), BT(0x80312500), BT(0x00314600), BT(0x8030a900), BT(0x0030ca00), BT(0x00300c00), BT(0x80306f00),
+		BT(0x8033b100), BT(0x0033d200), BT(0x00331400), BT(0x80337700), BT(0x00329800), BT(0x8032fb00), BT(0x80323d00), BT(0x00325e00),
+		BT(0x80358100), BT(0x0035e200), BT(0x00352400), BT(0x80354700), BT(0x0034a800), BT(0x8034cb00), BT(0x80340d00), BT(0x00346e00),
+		BT(0x0037b000), BT(0x8037d300), BT(0x80371500), BT(0x00377600), BT(0x80369900), BT(0x0036fa00), BT(0x00363c00), BT(0x80365f00),
+		BT(0x8039e100), BT(0x00398200), BT(0x00394400), BT(0x80392700), BT(0x0038c800), BT(0x8038ab00), BT(0x80386d00), BT(0x00380e00),
+		BT(0x003bd000), BT(0x803bb300), BT(0x803b7500), BT(0x003b1600), BT(0x803af900), BT(0x003a9a00), BT(0x003a5c00), BT(0x803a3f00),
+		BT(0x003de000), BT(0x803d8300), BT(0x803d4500), BT(0x003d2600), BT(0x803cc900), BT(0x003caa00), BT(0x003c6c00), BT(0x803c0f00),
+		BT(0x803fd100), BT(0x003fb200), BT(0x003f7400), BT(0x803f1700), BT(0x003ef800), BT(0x803e9b00), BT(0x803e5d00), BT(0x003e3e00)
+	}, {
+		BMP_C(0x00662840), BMP_C(0x0081770b), BMP_C(0x00810073), BMP_C(0x00684b0a),
+		BMP_C(0x00562108), BMP_C(0x0034c72c), BMP_C(0x00942421), BMP_C(0x00001104)
+	}},
+	{24UL, BT(0x864cfb00), {
+		BT(0x00000000), BT(0x864cfb00), BT(0x8ad50d00), BT(0x0c99f600), BT(0x93e6e100), BT(0x15aa1a00), BT(0x1933ec00), BT(0x9f7f1700),
+		BT(0xa1813900), BT(0x27cdc200), BT(0x2b543400), BT(0xad18cf00), BT(0x3267d800), BT(0xb42b2300), BT(0xb8b2d500), BT(0x3efe2e00),
+		BT(0xc54e8900), BT(0x43027200), BT(0x4f9b8400), BT(0xc9d77f00), BT(0x56a86800), BT(0xd0e49300), BT(0xdc7d6500), BT(0x5a319e00),
+		BT(0x64cfb000), BT(0xe2834b00), BT(0xee1abd00), BT(0x68564600), BT(0xf7295100), BT(0x7165aa00), BT(0x7dfc5c00), BT(0xfbb0a700),
+		BT(0x0cd1e900), BT(0x8a9d1200), BT(0x8604e400), BT(0x00481f00), BT(0x9f370800), BT(0x197bf300), BT(0x15e20500), BT(0x93aefe00),
+		BT(0xad50d000), BT(0x2b1c2b00), BT(0x2785dd00), BT(0xa1c92600), BT(0x3eb63100), BT(0xb8faca00), BT(0xb4633c00), BT(0x322fc700),
+		BT(0xc99f6000), BT(0x4fd39b00), BT(0x434a6d00), BT(0xc5069600), BT(0x5a798100), BT(0xdc357a00), BT(0xd0ac8c00), BT(0x56e07700),
+		BT(0x681e5900), BT(0xee52a200), BT(0xe2cb5400), BT(0x6487af00), BT(0xfbf8b800), BT(0x7db44300), BT(0x712db500), BT(0xf7614e00),
+		BT(0x19a3d200), BT(0x9fef2900), BT(0x9376df00), BT(0x153a2400), BT(0x8a453300), BT(0x0c09c800), BT(0x00903e00), BT(0x86dcc500),
+		BT(0xb822eb00), BT(0x3e6e1000), BT(0x32f7e600), BT(0xb4bb1d00), BT(0x2bc40a00), BT(0xad88f100), BT(0xa1110700), BT(0x275dfc00),
+		BT(0xdced5b00), BT(0x5aa1a000), BT(0x56385600), BT(0xd074ad00), BT(0x4f0bba00), BT(0xc9474100), BT(0xc5deb700), BT(0x43924c00),
+		BT(0x7d6c6200), BT(0xfb209900), BT(0xf7b96f00), BT(0x71f59400), BT(0xee8a8300), BT(0x68c67800), BT(0x645f8e00), BT(0xe2137500),
+		BT(0x15723b00), BT(0x933ec000), BT(0x9fa73600), BT(0x19ebcd00), BT(0x8694da00), BT(0x00d82100), BT(0x0c41d700), BT(0x8a0d2c00),
+		BT(0xb4f30200), BT(0x32bff900), BT(0x3e260f00), BT(0xb86af400), BT(0x2715e300), BT(0xa1591800), BT(0xadc0ee00), BT(0x2b8c1500),
+		BT(0xd03cb200), BT(0x56704900), BT(0x5ae9bf00), BT(0xdca54400), BT(0x43da5300), BT(0xc596a800), BT(0xc90f5e00), BT(0x4f43a500),
+		BT(0x71bd8b00), BT(0xf7f17000), BT(0xfb688600), BT(0x7d247d00), BT(0xe25b6a00), BT(0x64179100), BT(0x688e6700), BT(0xeec29c00),
+		BT(0x3347a400), BT(0xb50b5f00), BT(0xb992a900), BT(0x3fde5200), BT(0xa0a14500), BT(0x26edbe00), BT(0x2a744800), BT(0xac38b300),
+		BT(0x92c69d00), BT(0x148a6600), BT(0x18139000), BT(0x9e5f6b00), BT(0x01207c00), BT(0x876c8700), BT(0x8bf57100), BT(0x0db98a00),
+		BT(0xf6092d00), BT(0x7045d600), BT(0x7cdc2000), BT(0xfa90db00), BT(0x65efcc00), BT(0xe3a33700), BT(0xef3ac100), BT(0x69763a00),
+		BT(0x57881400), BT(0xd1c4ef00), BT(0xdd5d1900), BT(0x5b11e200), BT(0xc46ef500), BT(0x42220e00), BT(0x4ebbf800), BT(0xc8f70300),
+		BT(0x3f964d00), BT(0xb9dab600), BT(0xb5434000), BT(0x330fbb00), BT(0xac70ac00), BT(0x2a3c5700), BT(0x26a5a100), BT(0xa0e95a00),
+		BT(0x9e177400), BT(0x185b8f00), BT(0x14c27900), BT(0x928e8200), BT(0x0df19500), BT(0x8bbd6e00), BT(0x87249800), BT(0x01686300),
+		BT(0xfad8c400), BT(0x7c943f00), BT(0x700dc900), BT(0xf6413200), BT(0x693e2500), BT(0xef72de00), BT(0xe3eb2800), BT(0x65a7d300),
+		BT(0x5b59fd00), BT(0xdd150600), BT(0xd18cf000), BT(0x57c00b00), BT(0xc8bf1c00), BT(0x4ef3e700), BT(0x426a1100), BT(0xc426ea00),
+		BT(0x2ae47600), BT(0xaca88d00), BT(0xa0317b00), BT(0x267d8000), BT(0xb9029700), BT(0x3f4e6c00), BT(0x33d79a00), BT(0xb59b6100),
+		BT(0x8b654f00), BT(0x0d29b400), BT(0x01b04200), BT(0x87fcb900), BT(0x1883ae00), BT(0x9ecf5500), BT(0x9256a300), BT(0x141a5800),
+		BT(0xefaaff00), BT(0x69e60400), BT(0x657ff200), BT(0xe3330900), BT(0x7c4c1e00), BT(0xfa00e500), BT(0xf6991300), BT(0x70d5e800),
+		BT(0x4e2bc600), BT(0xc8673d00), BT(0xc4fecb00), BT(0x42b23000), BT(0xddcd2700), BT(0x5b81dc00), BT(0x57182a00), BT(0xd154d100),
+		BT(0x26359f00), BT(0xa0796400), BT(0xace09200), BT(0x2aac6900), BT(0xb5d37e00), BT(0x339f8500), BT(0x3f067300), BT(0xb94a8800),
+		BT(0x87b4a600), BT(0x01f85d00), BT(0x0d61ab00), BT(0x8b2d5000), BT(0x14524700), BT(0x921ebc00), BT(0x9e874a00), BT(0x18cbb100),
+		BT(0xe37b1600), BT(0x6537ed00), BT(0x69ae1b00), BT(0xefe2e000), BT(0x709df700), BT(0xf6d10c00), BT(0xfa48fa00), BT(0x7c040100),
+		BT(0x42fa2f00), BT(0xc4b6d400), BT(0xc82f2200), BT(0x4e63d900), BT(0xd11cce00), BT(0x57503500), BT(0x5bc9c300), BT(0xdd853800)
+	}, {
+		BMP_C(0x007db43e), BMP_C(0x00b937a7), BMP_C(0x0001cd94), BMP_C(0x003b20e3),
+		BMP_C(0x00cb800e), BMP_C(0x00d15ed7), BMP_C(0x006243da), BMP_C(0x00b22b31)
+	}},
+	{30UL, BT(0x80c2e71c), {
+		BT(0x00000000), BT(0x80c2e71c), BT(0x81472924), BT(0x0185ce38), BT(0x824cb554), BT(0x028e5248), BT(0x030b9c70), BT(0x83c97b6c),
+		BT(0x845b8db4), BT(0x04996aa8), BT(0x051ca490), BT(0x85de438c), BT(0x061738e0), BT(0x86d5dffc), BT(0x875011c4), BT(0x0792f6d8),
+		BT(0x8875fc74), BT(0x08b71b68), BT(0x0932d550), BT(0x89f0324c), BT(0x0a394920), BT(0x8afbae3c), BT(0x8b7e6004), BT(0x0bbc8718),
+		BT(0x0c2e71c0), BT(0x8cec96dc), BT(0x8d6958e4), BT(0x0dabbff8), BT(0x8e62c494), BT(0x0ea02388), BT(0x0f25edb0), BT(0x8fe70aac),
+		BT(0x90291ff4), BT(0x10ebf8e8), BT(0x116e36d0), BT(0x91acd1cc), BT(0x1265aaa0), BT(0x92a74dbc), BT(0x93228384), BT(0x13e06498),
+		BT(0x14729240), BT(0x94b0755c), BT(0x9535bb64), BT(0x15f75c78), BT(0x963e2714), BT(0x16fcc008), BT(0x17790e30), BT(0x97bbe92c),
+		BT(0x185ce380), BT(0x989e049c), BT(0x991bcaa4), BT(0x19d92db8), BT(0x9a1056d4), BT(0x1ad2b1c8), BT(0x1b577ff0), BT(0x9b9598ec),
+		BT(0x9c076e34), BT(0x1cc58928), BT(0x1d404710), BT(0x9d82a00c), BT(0x1e4bdb60), BT(0x9e893c7c), BT(0x9f0cf244), BT(0x1fce1558),
+		BT(0xa090d8f4), BT(0x20523fe8), BT(0x21d7f1d0), BT(0xa11516cc), BT(0x22dc6da0), BT(0xa21e8abc), BT(0xa39b4484), BT(0x2359a398),
+		BT(0x24cb5540), BT(0xa409b25c), BT(0xa58c7c64), BT(0x254e9b78), BT(0xa687e014), BT(0x26450708), BT(0x27c0c930), BT(0xa7022e2c),
+		BT(0x28e52480), BT(0xa827c39c), BT(0xa9a20da4), BT(0x2960eab8), BT(0xaaa991d4), BT(0x2a6b76c8), BT(0x2beeb8f0), BT(0xab2c5fec),
+		BT(0xacbea934), BT(0x2c7c4e28), BT(0x2df98010), BT(0xad3b670c), BT(0x2ef21c60), BT(0xae30fb7c), BT(0xafb53544), BT(0x2f77d258),
+		BT(0x30b9c700), BT(0xb07b201c), BT(0xb1feee24), BT(0x313c0938), BT(0xb2f57254), BT(0x32379548), BT(0x33b25b70), BT(0xb370bc6c),
+		BT(0xb4e24ab4), BT(0x3420ada8), BT(0x35a56390), BT(0xb567848c), BT(0x36aeffe0), BT(0xb66c18fc), BT(0xb7e9d6c4), BT(0x372b31d8),
+		BT(0xb8cc3b74), BT(0x380edc68), BT(0x398b1250), BT(0xb949f54c), BT(0x3a808e20), BT(0xba42693c), BT(0xbbc7a704), BT(0x3b054018),
+		BT(0x3c97b6c0), BT(0xbc5551dc), BT(0xbdd09fe4), BT(0x3d1278f8), BT(0xbedb0394), BT(0x3e19e488), BT(0x3f9c2ab0), BT(0xbf5ecdac),
+		BT(0xc1e356f4), BT(0x4121b1e8), BT(0x40a47fd0), BT(0xc06698cc), BT(0x43afe3a0), BT(0xc36d04bc), BT(0xc2e8ca84), BT(0x422a2d98),
+		BT(0x45b8db40), BT(0xc57a3c5c), BT(0xc4fff264), BT(0x443d1578), BT(0xc7f46e14), BT(0x47368908), BT(0x46b34730), BT(0xc671a02c),
+		BT(0x4996aa80), BT(0xc9544d9c), BT(0xc8d183a4), BT(0x481364b8), BT(0xcbda1fd4), BT(0x4b18f8c8), BT(0x4a9d36f0), BT(0xca5fd1ec),
+		BT(0xcdcd2734), BT(0x4d0fc028), BT(0x4c8a0e10), BT(0xcc48e90c), BT(0x4f819260), BT(0xcf43757c), BT(0xcec6bb44), BT(0x4e045c58),
+		BT(0x51ca4900), BT(0xd108ae1c), BT(0xd08d6024), BT(0x504f8738), BT(0xd386fc54), BT(0x53441b48), BT(0x52c1d570), BT(0xd203326c),
+		BT(0xd591c4b4), BT(0x555323a8), BT(0x54d6ed90), BT(0xd4140a8c), BT(0x57dd71e0), BT(0xd71f96fc), BT(0xd69a58c4), BT(0x5658bfd8),
+		BT(0xd9bfb574), BT(0x597d5268), BT(0x58f89c50), BT(0xd83a7b4c), BT(0x5bf30020), BT(0xdb31e73c), BT(0xdab42904), BT(0x5a76ce18),
+		BT(0x5de438c0), BT(0xdd26dfdc), BT(0xdca311e4), BT(0x5c61f6f8), BT(0xdfa88d94), BT(0x5f6a6a88), BT(0x5eefa4b0), BT(0xde2d43ac),
+		BT(0x61738e00), BT(0xe1b1691c), BT(0xe034a724), BT(0x60f64038), BT(0xe33f3b54), BT(0x63fddc48), BT(0x62781270), BT(0xe2baf56c),
+		BT(0xe52803b4), BT(0x65eae4a8), BT(0x646f2a90), BT(0xe4adcd8c), BT(0x6764b6e0), BT(0xe7a651fc), BT(0xe6239fc4), BT(0x66e178d8),
+		BT(0xe9067274), BT(0x69c49568), BT(0x68415b50), BT(0xe883bc4c), BT(0x6b4ac720), BT(0xeb88203c), BT(0xea0dee04), BT(0x6acf0918),
+		BT(0x6d5dffc0), BT(0xed9f18dc), BT(0xec1ad6e4), BT(0x6cd831f8), BT(0xef114a94), BT(0x6fd3ad88), BT(0x6e5663b0), BT(0xee9484ac),
+		BT(0xf15a91f4), BT(0x719876e8), BT(0x701db8d0), BT(0xf0df5fcc), BT(0x731624a0), BT(0xf3d4c3bc), BT(0xf2510d84), BT(0x7293ea98),
+		BT(0x75011c40), BT(0xf5c3fb5c), BT(0xf4463564), BT(0x7484d278), BT(0xf74da914), BT(0x778f4e08), BT(0x760a8030), BT(0xf6c8672c),
+		BT(0x792f6d80), BT(0xf9ed8a9c), BT(0xf86844a4), BT(0x78aaa3b8), BT(0xfb63d8d4), BT(0x7ba13fc8), BT(0x7a24f1f0), BT(0xfae616ec),
+		BT(0xfd74e034), BT(0x7db60728), BT(0x7c33c910), BT(0xfcf12e0c), BT(0x7f385560), BT(0xfffab27c), BT(0xfe7f7c44), BT(0x7ebd9b58)
+	}, {
+		BMP_C(0x295ca2c7), BMP_C(0x2bd788fb), BMP_C(0x15d1a093), BMP_C(0x080aaa4d),
+		BMP_C(0x25506a06), BMP_C(0x0c5a1df1), BMP_C(0x1a8534ee), BMP_C(0x3740d60f)
+	}},
+	{31UL, BT(0x09823b6e), {
+		BT(0x00000000), BT(0x09823b6e), BT(0x130476dc), BT(0x1a864db2), BT(0x2608edb8), BT(0x2f8ad6d6), BT(0x350c9b64), BT(0x3c8ea00a),
+		BT(0x4c11db70), BT(0x4593e01e), BT(0x5f15adac), BT(0x569796c2), BT(0x6a1936c8), BT(0x639b0da6), BT(0x791d4014), BT(0x709f7b7a),
+		BT(0x9823b6e0), BT(0x91a18d8e), BT(0x8b27c03c), BT(0x82a5fb52), BT(0xbe2b5b58), BT(0xb7a96036), BT(0xad2f2d84), BT(0xa4ad16ea),
+		BT(0xd4326d90), BT(0xddb056fe), BT(0xc7361b4c), BT(0xceb42022), BT(0xf23a8028), BT(0xfbb8bb46), BT(0xe13ef6f4), BT(0xe8bccd9a),
+		BT(0x39c556ae), BT(0x30476dc0), BT(0x2ac12072), BT(0x23431b1c), BT(0x1fcdbb16), BT(0x164f8078), BT(0x0cc9cdca), BT(0x054bf6a4),
+		BT(0x75d48dde), BT(0x7c56b6b0), BT(0x66d0fb02), BT(0x6f52c06c), BT(0x53dc6066), BT(0x5a5e5b08), BT(0x40d816ba), BT(0x495a2dd4),
+		BT(0xa1e6e04e), BT(0xa864db20), BT(0xb2e29692), BT(0xbb60adfc), BT(0x87ee0df6), BT(0x8e6c3698), BT(0x94ea7b2a), BT(0x9d684044),
+		BT(0xedf73b3e), BT(0xe4750050), BT(0xfef34de2), BT(0xf771768c), BT(0xcbffd686), BT(0xc27dede8), BT(0xd8fba05a), BT(0xd1799b34),
+		BT(0x738aad5c), BT(0x7a089632), BT(0x608edb80), BT(0x690ce0ee), BT(0x558240e4), BT(0x5c007b8a), BT(0x46863638), BT(0x4f040d56),
+		BT(0x3f9b762c), BT(0x36194d42), BT(0x2c9f00f0), BT(0x251d3b9e), BT(0x19939b94), BT(0x1011a0fa), BT(0x0a97ed48), BT(0x0315d626),
+		BT(0xeba91bbc), BT(0xe22b20d2), BT(0xf8ad6d60), BT(0xf12f560e), BT(0xcda1f604), BT(0xc423cd6a), BT(0xdea580d8), BT(0xd727bbb6),
+		BT(0xa7b8c0cc), BT(0xae3afba2), BT(0xb4bcb610), BT(0xbd3e8d7e), BT(0x81b02d74), BT(0x8832161a), BT(0x92b45ba8), BT(0x9b3660c6),
+		BT(0x4a4ffbf2), BT(0x43cdc09c), BT(0x594b8d2e), BT(0x50c9b640), BT(0x6c47164a), BT(0x65c52d24), BT(0x7f436096), BT(0x76c15bf8),
+		BT(0x065e2082), BT(0x0fdc1bec), BT(0x155a565e), BT(0x1cd86d30), BT(0x2056cd3a), BT(0x29d4f654), BT(0x3352bbe6), BT(0x3ad08088),
+		BT(0xd26c4d12), BT(0xdbee767c), BT(0xc1683bce), BT(0xc8ea00a0), BT(0xf464a0aa), BT(0xfde69bc4), BT(0xe760d676), BT(0xeee2ed18),
+		BT(0x9e7d9662), BT(0x97ffad0c), BT(0x8d79e0be), BT(0x84fbdbd0), BT(0xb8757bda), BT(0xb1f740b4), BT(0xab710d06), BT(0xa2f33668),
+		BT(0xe7155ab8), BT(0xee9761d6), BT(0xf4112c64), BT(0xfd93170a), BT(0xc11db700), BT(0xc89f8c6e), BT(0xd219c1dc), BT(0xdb9bfab2),
+		BT(0xab0481c8), BT(0xa286baa6), BT(0xb800f714), BT(0xb182cc7a), BT(0x8d0c6c70), BT(0x848e571e), BT(0x9e081aac), BT(0x978a21c2),
+		BT(0x7f36ec58), BT(0x76b4d736), BT(0x6c329a84), BT(0x65b0a1ea), BT(0x593e01e0), BT(0x50bc3a8e), BT(0x4a3a773c), BT(0x43b84c52),
+		BT(0x33273728), BT(0x3aa50c46), BT(0x202341f4), BT(0x29a17a9a), BT(0x152fda90), BT(0x1cade1fe), BT(0x062bac4c), BT(0x0fa99722),
+		BT(0xded00c16), BT(0xd7523778), BT(0xcdd47aca), BT(0xc45641a4), BT(0xf8d8e1ae), BT(0xf15adac0), BT(0xebdc9772), BT(0xe25eac1c),
+		BT(0x92c1d766), BT(0x9b43ec08), BT(0x81c5a1ba), BT(0x88479ad4), BT(0xb4c93ade), BT(0xbd4b01b0), BT(0xa7cd4c02), BT(0xae4f776c),
+		BT(0x46f3baf6), BT(0x4f718198), BT(0x55f7cc2a), BT(0x5c75f744), BT(0x60fb574e), BT(0x69796c20), BT(0x73ff2192), BT(0x7a7d1afc),
+		BT(0x0ae26186), BT(0x03605ae8), BT(0x19e6175a), BT(0x10642c34), BT(0x2cea8c3e), BT(0x2568b750), BT(0x3feefae2), BT(0x366cc18c),
+		BT(0x949ff7e4), BT(0x9d1dcc8a), BT(0x879b8138), BT(0x8e19ba56), BT(0xb2971a5c), BT(0xbb152132), BT(0xa1936c80), BT(0xa81157ee),
+		BT(0xd88e2c94), BT(0xd10c17fa), BT(0xcb8a5a48), BT(0xc2086126), BT(0xfe86c12c), BT(0xf704fa42), BT(0xed82b7f0), BT(0xe4008c9e),
+		BT(0x0cbc4104), BT(0x053e7a6a), BT(0x1fb837d8), BT(0x163a0cb6), BT(0x2ab4acbc), BT(0x233697d2), BT(0x39b0da60), BT(0x3032e10e),
+		BT(0x40ad9a74), BT(0x492fa11a), BT(0x53a9eca8), BT(0x5a2bd7c6), BT(0x66a577cc), BT(0x6f274ca2), BT(0x75a10110), BT(0x7c233a7e),
+		BT(0xad5aa14a), BT(0xa4d89a24), BT(0xbe5ed796), BT(0xb7dcecf8), BT(0x8b524cf2), BT(0x82d0779c), BT(0x98563a2e), BT(0x91d40140),
+		BT(0xe14b7a3a), BT(0xe8c94154), BT(0xf24f0ce6), BT(0xfbcd3788), BT(0xc7439782), BT(0xcec1acec), BT(0xd447e15e), BT(0xddc5da30),
+		BT(0x357917aa), BT(0x3cfb2cc4), BT(0x267d6176), BT(0x2fff5a18), BT(0x1371fa12), BT(0x1af3c17c), BT(0x00758cce), BT(0x09f7b7a0),
+		BT(0x7968ccda), BT(0x70eaf7b4), BT(0x6a6cba06), BT(0x63ee8168), BT(0x5f602162), BT(0x56e21a0c), BT(0x4c6457be), BT(0x45e66cd0)
+	}, {
+		BMP_C(0x69e72752), BMP_C(0x43f179c5), BMP_C(0x16f49a2b), BMP_C(0x23b785c3),
+		BMP_C(0x3c4da576), BMP_C(0x57290424), BMP_C(0x5ca90a5c), BMP_C(0x1a338635)
+	}},
+	{32UL, BT(0x000000af), {
+		BT(0x00000000), BT(0x000000af), BT(0x0000015e), BT(0x000001f1), BT(0x000002bc), BT(0x00000213), BT(0x000003e2), BT(0x0000034d),
+		BT(0x00000578), BT(0x000005d7), BT(0x00000426), BT(0x00000489), BT(0x000007c4), BT(0x0000076b), BT(0x0000069a), BT(0x00000635),
+		BT(0x00000af0), BT(0x00000a5f), BT(0x00000bae), BT(0x00000b01), BT(0x0000084c), BT(0x000008e3), BT(0x00000912), BT(0x000009bd),
+		BT(0x00000f88), BT(0x00000f27), BT(0x00000ed6), BT(0x00000e79), BT(0x00000d34), BT(0x00000d9b), BT(0x00000c6a), BT(0x00000cc5),
+		BT(0x000015e0), BT(0x0000154f), BT(0x000014be), BT(0x00001411), BT(0x0000175c), BT(0x000017f3), BT(0x00001602), BT(0x000016ad),
+		BT(0x00001098), BT(0x00001037), BT(0x000011c6), BT(0x00001169), BT(0x00001224), BT(0x0000128b), BT(0x0000137a), BT(0x000013d5),
+		BT(0x00001f10), BT(0x00001fbf), BT(0x00001e4e), BT(0x00001ee1), BT(0x00001dac), BT(0x00001d03), BT(0x00001cf2), BT(0x00001c5d),
+		BT(0x00001a68), BT(0x00001ac7), BT(0x00001b36), BT(0x00001b99), BT(0x000018d4), BT(0x0000187b), BT(0x0000198a), BT(0x00001925),
+		BT(0x00002bc0), BT(0x00002b6f), BT(0x00002a9e), BT(0x00002a31), BT(0x0000297c), BT(0x000029d3), BT(0x00002822), BT(0x0000288d),
+		BT(0x00002eb8), BT(0x00002e17), BT(0x00002fe6), BT(0x00002f49), BT(0x00002c04), BT(0x00002cab), BT(0x00002d5a), BT(0x00002df5),
+		BT(0x00002130), BT(0x0000219f), BT(0x0000206e), BT(0x000020c1), BT(0x0000238c), BT(0x00002323), BT(0x000022d2), BT(0x0000227d),
+		BT(0x00002448), BT(0x000024e7), BT(0x00002516), BT(0x000025b9), BT(0x000026f4), BT(0x0000265b), BT(0x000027aa), BT(0x00002705),
+		BT(0x00003e20), BT(0x00003e8f), BT(0x00003f7e), BT(0x00003fd1), BT(0x00003c9c), BT(0x00003c33), BT(0x00003dc2), BT(0x00003d6d),
+		BT(0x00003b58), BT(0x00003bf7), BT(0x00003a06), BT(0x00003aa9), BT(0x000039e4), BT(0x0000394b), BT(0x000038ba), BT(0x00003815),
+		BT(0x000034d0), BT(0x0000347f), BT(0x0000358e), BT(0x00003521), BT(0x0000366c), BT(0x000036c3), BT(0x00003732), BT(0x0000379d),
+		BT(0x000031a8), BT(0x00003107), BT(0x000030f6), BT(0x00003059), BT(0x00003314), BT(0x000033bb), BT(0x0000324a), BT(0x000032e5),
+		BT(0x00005780), BT(0x0000572f), BT(0x000056de), BT(0x00005671), BT(0x0000553c), BT(0x00005593), BT(0x00005462), BT(0x000054cd),
+		BT(0x000052f8), BT(0x00005257), BT(0x000053a6), BT(0x00005309), BT(0x00005044), BT(0x000050eb), BT(0x0000511a), BT(0x000051b5),
+		BT(0x00005d70), BT(0x00005ddf), BT(0x00005c2e), BT(0x00005c81), BT(0x00005fcc), BT(0x00005f63), BT(0x00005e92), BT(0x00005e3d),
+		BT(0x00005808), BT(0x000058a7), BT(0x00005956), BT(0x000059f9), BT(0x00005ab4), BT(0x00005a1b), BT(0x00005bea), BT(0x00005b45),
+		BT(0x00004260), BT(0x000042cf), BT(0x0000433e), BT(0x00004391), BT(0x000040dc), BT(0x00004073), BT(0x00004182), BT(0x0000412d),
+		BT(0x00004718), BT(0x000047b7), BT(0x00004646), BT(0x000046e9), BT(0x000045a4), BT(0x0000450b), BT(0x000044fa), BT(0x00004455),
+		BT(0x00004890), BT(0x0000483f), BT(0x000049ce), BT(0x00004961), BT(0x00004a2c), BT(0x00004a83), BT(0x00004b72), BT(0x00004bdd),
+		BT(0x00004de8), BT(0x00004d47), BT(0x00004cb6), BT(0x00004c19), BT(0x00004f54), BT(0x00004ffb), BT(0x00004e0a), BT(0x00004ea5),
+		BT(0x00007c40), BT(0x00007cef), BT(0x00007d1e), BT(0x00007db1), BT(0x00007efc), BT(0x00007e53), BT(0x00007fa2), BT(0x00007f0d),
+		BT(0x00007938), BT(0x00007997), BT(0x00007866), BT(0x000078c9), BT(0x00007b84), BT(0x00007b2b), BT(0x00007ada), BT(0x00007a75),
+		BT(0x000076b0), BT(0x0000761f), BT(0x000077ee), BT(0x00007741), BT(0x0000740c), BT(0x000074a3), BT(0x00007552), BT(0x000075fd),
+		BT(0x000073c8), BT(0x00007367), BT(0x00007296), BT(0x00007239), BT(0x00007174), BT(0x000071db), BT(0x0000702a), BT(0x00007085),
+		BT(0x000069a0), BT(0x0000690f), BT(0x000068fe), BT(0x00006851), BT(0x00006b1c), BT(0x00006bb3), BT(0x00006a42), BT(0x00006aed),
+		BT(0x00006cd8), BT(0x00006c77), BT(0x00006d86), BT(0x00006d29), BT(0x00006e64), BT(0x00006ecb), BT(0x00006f3a), BT(0x00006f95),
+		BT(0x00006350), BT(0x000063ff), BT(0x0000620e), BT(0x000062a1), BT(0x000061ec), BT(0x00006143), BT(0x000060b2), BT(0x0000601d),
+		BT(0x00006628), BT(0x00006687), BT(0x00006776), BT(0x000067d9), BT(0x00006494), BT(0x0000643b), BT(0x000065ca), BT(0x00006565)
+	}, {
+		BMP_C(0x1bd81099), BMP_C(0x5b5ae0c7), BMP_C(0xeea043a7), BMP_C(0x87c8bdd7),
+		BMP_C(0xae01ae01), BMP_C(0x1b5e0b2c), BMP_C(0x10101111), BMP_C(0x1157936a)
+	}},
+	{32UL, BT(0x04c11db7), {
+		BT(0x00000000), BT(0x04c11db7), BT(0x09823b6e), BT(0x0d4326d9), BT(0x130476dc), BT(0x17c56b6b), BT(0x1a864db2), BT(0x1e475005),
+		BT(0x2608edb8), BT(0x22c9f00f), BT(0x2f8ad6d6), BT(0x2b4bcb61), BT(0x350c9b64), BT(0x31cd86d3), BT(0x3c8ea00a), BT(0x384fbdbd),
+		BT(0x4c11db70), BT(0x48d0c6c7), BT(0x4593e01e), BT(0x4152fda9), BT(0x5f15adac), BT(0x5bd4b01b), BT(0x569796c2), BT(0x52568b75),
+		BT(0x6a1936c8), BT(0x6ed82b7f), BT(0x639b0da6), BT(0x675a1011), BT(0x791d4014), BT(0x7ddc5da3), BT(0x709f7b7a), BT(0x745e66cd),
+		BT(0x9823b6e0), BT(0x9ce2ab57), BT(0x91a18d8e), BT(0x95609039), BT(0x8b27c03c), BT(0x8fe6dd8b), BT(0x82a5fb52), BT(0x8664e6e5),
+		BT(0xbe2b5b58), BT(0xbaea46ef), BT(0xb7a96036), BT(0xb3687d81), BT(0xad2f2d84), BT(0xa9ee3033), BT(0xa4ad16ea), BT(0xa06c0b5d),
+		BT(0xd4326d90), BT(0xd0f37027), BT(0xddb056fe), BT(0xd9714b49), BT(0xc7361b4c), BT(0xc3f706fb), BT(0xceb42022), BT(0xca753d95),
+		BT(0xf23a8028), BT(0xf6fb9d9f), BT(0xfbb8bb46), BT(0xff79a6f1), BT(0xe13ef6f4), BT(0xe5ffeb43), BT(0xe8bccd9a), BT(0xec7dd02d),
+		BT(0x34867077), BT(0x30476dc0), BT(0x3d044b19), BT(0x39c556ae), BT(0x278206ab), BT(0x23431b1c), BT(0x2e003dc5), BT(0x2ac12072),
+		BT(0x128e9dcf), BT(0x164f8078), BT(0x1b0ca6a1), BT(0x1fcdbb16), BT(0x018aeb13), BT(0x054bf6a4), BT(0x0808d07d), BT(0x0cc9cdca),
+		BT(0x7897ab07), BT(0x7c56b6b0), BT(0x71159069), BT(0x75d48dde), BT(0x6b93dddb), BT(0x6f52c06c), BT(0x6211e6b5), BT(0x66d0fb02),
+		BT(0x5e9f46bf), BT(0x5a5e5b08), BT(0x571d7dd1), BT(0x53dc6066), BT(0x4d9b3063), BT(0x495a2dd4), BT(0x44190b0d), BT(0x40d816ba),
+		BT(0xaca5c697), BT(0xa864db20), BT(0xa527fdf9), BT(0xa1e6e04e), BT(0xbfa1b04b), BT(0xbb60adfc), BT(0xb6238b25), BT(0xb2e29692),
+		BT(0x8aad2b2f), BT(0x8e6c3698), BT(0x832f1041), BT(0x87ee0df6), BT(0x99a95df3), BT(0x9d684044), BT(0x902b669d), BT(0x94ea7b2a),
+		BT(0xe0b41de7), BT(0xe4750050), BT(0xe9362689), BT(0xedf73b3e), BT(0xf3b06b3b), BT(0xf771768c), BT(0xfa325055), BT(0xfef34de2),
+		BT(0xc6bcf05f), BT(0xc27dede8), BT(0xcf3ecb31), BT(0xcbffd686), BT(0xd5b88683), BT(0xd1799b34), BT(0xdc3abded), BT(0xd8fba05a),
+		BT(0x690ce0ee), BT(0x6dcdfd59), BT(0x608edb80), BT(0x644fc637), BT(0x7a089632), BT(0x7ec98b85), BT(0x738aad5c), BT(0x774bb0eb),
+		BT(0x4f040d56), BT(0x4bc510e1), BT(0x46863638), BT(0x42472b8f), BT(0x5c007b8a), BT(0x58c1663d), BT(0x558240e4), BT(0x51435d53),
+		BT(0x251d3b9e), BT(0x21dc2629), BT(0x2c9f00f0), BT(0x285e1d47), BT(0x36194d42), BT(0x32d850f5), BT(0x3f9b762c), BT(0x3b5a6b9b),
+		BT(0x0315d626), BT(0x07d4cb91), BT(0x0a97ed48), BT(0x0e56f0ff), BT(0x1011a0fa), BT(0x14d0bd4d), BT(0x19939b94), BT(0x1d528623),
+		BT(0xf12f560e), BT(0xf5ee4bb9), BT(0xf8ad6d60), BT(0xfc6c70d7), BT(0xe22b20d2), BT(0xe6ea3d65), BT(0xeba91bbc), BT(0xef68060b),
+		BT(0xd727bbb6), BT(0xd3e6a601), BT(0xdea580d8), BT(0xda649d6f), BT(0xc423cd6a), BT(0xc0e2d0dd), BT(0xcda1f604), BT(0xc960ebb3),
+		BT(0xbd3e8d7e), BT(0xb9ff90c9), BT(0xb4bcb610), BT(0xb07daba7), BT(0xae3afba2), BT(0xaafbe615), BT(0xa7b8c0cc), BT(0xa379dd7b),
+		BT(0x9b3660c6), BT(0x9ff77d71), BT(0x92b45ba8), BT(0x9675461f), BT(0x8832161a), BT(0x8cf30bad), BT(0x81b02d74), BT(0x857130c3),
+		BT(0x5d8a9099), BT(0x594b8d2e), BT(0x5408abf7), BT(0x50c9b640), BT(0x4e8ee645), BT(0x4a4ffbf2), BT(0x470cdd2b), BT(0x43cdc09c),
+		BT(0x7b827d21), BT(0x7f436096), BT(0x7200464f), BT(0x76c15bf8), BT(0x68860bfd), BT(0x6c47164a), BT(0x61043093), BT(0x65c52d24),
+		BT(0x119b4be9), BT(0x155a565e), BT(0x18197087), BT(0x1cd86d30), BT(0x029f3d35), BT(0x065e2082), BT(0x0b1d065b), BT(0x0fdc1bec),
+		BT(0x3793a651), BT(0x3352bbe6), BT(0x3e119d3f), BT(0x3ad08088), BT(0x2497d08d), BT(0x2056cd3a), BT(0x2d15ebe3), BT(0x29d4f654),
+		BT(0xc5a92679), BT(0xc1683bce), BT(0xcc2b1d17), BT(0xc8ea00a0), BT(0xd6ad50a5), BT(0xd26c4d12), BT(0xdf2f6bcb), BT(0xdbee767c),
+		BT(0xe3a1cbc1), BT(0xe760d676), BT(0xea23f0af), BT(0xeee2ed18), BT(0xf0a5bd1d), BT(0xf464a0aa), BT(0xf9278673), BT(0xfde69bc4),
+		BT(0x89b8fd09), BT(0x8d79e0be), BT(0x803ac667), BT(0x84fbdbd0), BT(0x9abc8bd5), BT(0x9e7d9662), BT(0x933eb0bb), BT(0x97ffad0c),
+		BT(0xafb010b1), BT(0xab710d06), BT(0xa6322bdf), BT(0xa2f33668), BT(0xbcb4666d), BT(0xb8757bda), BT(0xb5365d03), BT(0xb1f740b4)
+	}, {
+		BMP_C(0xe6228b11), BMP_C(0x8833794c), BMP_C(0x8c3828a8), BMP_C(0x64bf7a9b),
+		BMP_C(0x75be46b7), BMP_C(0x569700e5), BMP_C(0xe8a45605), BMP_C(0xc5b9cd4c)
+	}},
+	{32UL, BT(0x1edc6f41), {
+		BT(0x00000000), BT(0x1edc6f41), BT(0x3db8de82), BT(0x2364b1c3), BT(0x7b71bd04), BT(0x65add245), BT(0x46c96386), BT(0x58150cc7),
+		BT(0xf6e37a08), BT(0xe83f1549), BT(0xcb5ba48a), BT(0xd587cbcb), BT(0x8d92c70c), BT(0x934ea84d), BT(0xb02a198e), BT(0xaef676cf),
+		BT(0xf31a9b51), BT(0xedc6f410), BT(0xcea245d3), BT(0xd07e2a92), BT(0x886b2655), BT(0x96b74914), BT(0xb5d3f8d7), BT(0xab0f9796),
+		BT(0x05f9e159), BT(0x1b258e18), BT(0x38413fdb), BT(0x269d509a), BT(0x7e885c5d), BT(0x6054331c), BT(0x433082df), BT(0x5deced9e),
+		BT(0xf8e959e3), BT(0xe63536a2), BT(0xc5518761), BT(0xdb8de820), BT(0x8398e4e7), BT(0x9d448ba6), BT(0xbe203a65), BT(0xa0fc5524),
+		BT(0x0e0a23eb), BT(0x10d64caa), BT(0x33b2fd69), BT(0x2d6e9228), BT(0x757b9eef), BT(0x6ba7f1ae), BT(0x48c3406d), BT(0x561f2f2c),
+		BT(0x0bf3c2b2), BT(0x152fadf3), BT(0x364b1c30), BT(0x28977371), BT(0x70827fb6), BT(0x6e5e10f7), BT(0x4d3aa134), BT(0x53e6ce75),
+		BT(0xfd10b8ba), BT(0xe3ccd7fb), BT(0xc0a86638), BT(0xde740979), BT(0x866105be), BT(0x98bd6aff), BT(0xbbd9db3c), BT(0xa505b47d),
+		BT(0xef0edc87), BT(0xf1d2b3c6), BT(0xd2b60205), BT(0xcc6a6d44), BT(0x947f6183), BT(0x8aa30ec2), BT(0xa9c7bf01), BT(0xb71bd040),
+		BT(0x19eda68f), BT(0x0731c9ce), BT(0x2455780d), BT(0x3a89174c), BT(0x629c1b8b), BT(0x7c4074ca), BT(0x5f24c509), BT(0x41f8aa48),
+		BT(0x1c1447d6), BT(0x02c82897), BT(0x21ac9954), BT(0x3f70f615), BT(0x6765fad2), BT(0x79b99593), BT(0x5add2450), BT(0x44014b11),
+		BT(0xeaf73dde), BT(0xf42b529f), BT(0xd74fe35c), BT(0xc9938c1d), BT(0x918680da), BT(0x8f5aef9b), BT(0xac3e5e58), BT(0xb2e23119),
+		BT(0x17e78564), BT(0x093bea25), BT(0x2a5f5be6), BT(0x348334a7), BT(0x6c963860), BT(0x724a5721), BT(0x512ee6e2), BT(0x4ff289a3),
+		BT(0xe104ff6c), BT(0xffd8902d), BT(0xdcbc21ee), BT(0xc2604eaf), BT(0x9a754268), BT(0x84a92d29), BT(0xa7cd9cea), BT(0xb911f3ab),
+		BT(0xe4fd1e35), BT(0xfa217174), BT(0xd945c0b7), BT(0xc799aff6), BT(0x9f8ca331), BT(0x8150cc70), BT(0xa2347db3), BT(0xbce812f2),
+		BT(0x121e643d), BT(0x0cc20b7c), BT(0x2fa6babf), BT(0x317ad5fe), BT(0x696fd939), BT(0x77b3b678), BT(0x54d707bb), BT(0x4a0b68fa),
+		BT(0xc0c1d64f), BT(0xde1db90e), BT(0xfd7908cd), BT(0xe3a5678c), BT(0xbbb06b4b), BT(0xa56c040a), BT(0x8608b5c9), BT(0x98d4da88),
+		BT(0x3622ac47), BT(0x28fec306), BT(0x0b9a72c5), BT(0x15461d84), BT(0x4d531143), BT(0x538f7e02), BT(0x70ebcfc1), BT(0x6e37a080),
+		BT(0x33db4d1e), BT(0x2d07225f), BT(0x0e63939c), BT(0x10bffcdd), BT(0x48aaf01a), BT(0x56769f5b), BT(0x75122e98), BT(0x6bce41d9),
+		BT(0xc5383716), BT(0xdbe45857), BT(0xf880e994), BT(0xe65c86d5), BT(0xbe498a12), BT(0xa095e553), BT(0x83f15490), BT(0x9d2d3bd1),
+		BT(0x38288fac), BT(0x26f4e0ed), BT(0x0590512e), BT(0x1b4c3e6f), BT(0x435932a8), BT(0x5d855de9), BT(0x7ee1ec2a), BT(0x603d836b),
+		BT(0xcecbf5a4), BT(0xd0179ae5), BT(0xf3732b26), BT(0xedaf4467), BT(0xb5ba48a0), BT(0xab6627e1), BT(0x88029622), BT(0x96def963),
+		BT(0xcb3214fd), BT(0xd5ee7bbc), BT(0xf68aca7f), BT(0xe856a53e), BT(0xb043a9f9), BT(0xae9fc6b8), BT(0x8dfb777b), BT(0x9327183a),
+		BT(0x3dd16ef5), BT(0x230d01b4), BT(0x0069b077), BT(0x1eb5df36), BT(0x46a0d3f1), BT(0x587cbcb0), BT(0x7b180d73), BT(0x65c46232),
+		BT(0x2fcf0ac8), BT(0x31136589), BT(0x1277d44a), BT(0x0cabbb0b), BT(0x54beb7cc), BT(0x4a62d88d), BT(0x6906694e), BT(0x77da060f),
+		BT(0xd92c70c0), BT(0xc7f01f81), BT(0xe494ae42), BT(0xfa48c103), BT(0xa25dcdc4), BT(0xbc81a285), BT(0x9fe51346), BT(0x81397c07),
+		BT(0xdcd59199), BT(0xc209fed8), BT(0xe16d4f1b), BT(0xffb1205a), BT(0xa7a42c9d), BT(0xb97843dc), BT(0x9a1cf21f), BT(0x84c09d5e),
+		BT(0x2a36eb91), BT(0x34ea84d0), BT(0x178e3513), BT(0x09525a52), BT(0x51475695), BT(0x4f9b39d4), BT(0x6cff8817), BT(0x7223e756),
+		BT(0xd726532b), BT(0xc9fa3c6a), BT(0xea9e8da9), BT(0xf442e2e8), BT(0xac57ee2f), BT(0xb28b816e), BT(0x91ef30ad), BT(0x8f335fec),
+		BT(0x21c52923), BT(0x3f194662), BT(0x1c7df7a1), BT(0x02a198e0), BT(0x5ab49427), BT(0x4468fb66), BT(0x670c4aa5), BT(0x79d025e4),
+		BT(0x243cc87a), BT(0x3ae0a73b), BT(0x198416f8), BT(0x075879b9), BT(0x5f4d757e), BT(0x41911a3f), BT(0x62f5abfc), BT(0x7c29c4bd),
+		BT(0xd2dfb272), BT(0xcc03dd33), BT(0xef676cf0), BT(0xf1bb03b1), BT(0xa9ae0f76), BT(0xb7726037), BT(0x9416d1f4), BT(0x8acabeb5)
+	}, {
+		BMP_C(0xaa97d41d), BMP_C(0xa6955f31), BMP_C(0xe6957b4d), BMP_C(0xaa5eec4a),
+		BMP_C(0x59a3508a), BMP_C(0x7bba6798), BMP_C(0x18571d18), BMP_C(0x6503ea99)
+	}},
+	{32UL, BT(0x741b8cd7), {
+		BT(0x00000000), BT(0x741b8cd7), BT(0xe83719ae), BT(0x9c2c9579), BT(0xa475bf8b), BT(0xd06e335c), BT(0x4c42a625), BT(0x38592af2),
+		BT(0x3cf0f3c1), BT(0x48eb7f16), BT(0xd4c7ea6f), BT(0xa0dc66b8), BT(0x98854c4a), BT(0xec9ec09d), BT(0x70b255e4), BT(0x04a9d933),
+		BT(0x79e1e782), BT(0x0dfa6b55), BT(0x91d6fe2c), BT(0xe5cd72fb), BT(0xdd945809), BT(0xa98fd4de), BT(0x35a341a7), BT(0x41b8cd70),
+		BT(0x45111443), BT(0x310a9894), BT(0xad260ded), BT(0xd93d813a), BT(0xe164abc8), BT(0x957f271f), BT(0x0953b266), BT(0x7d483eb1),
+		BT(0xf3c3cf04), BT(0x87d843d3), BT(0x1bf4d6aa), BT(0x6fef5a7d), BT(0x57b6708f), BT(0x23adfc58), BT(0xbf816921), BT(0xcb9ae5f6),
+		BT(0xcf333cc5), BT(0xbb28b012), BT(0x2704256b), BT(0x531fa9bc), BT(0x6b46834e), BT(0x1f5d0f99), BT(0x83719ae0), BT(0xf76a1637),
+		BT(0x8a222886), BT(0xfe39a451), BT(0x62153128), BT(0x160ebdff), BT(0x2e57970d), BT(0x5a4c1bda), BT(0xc6608ea3), BT(0xb27b0274),
+		BT(0xb6d2db47), BT(0xc2c95790), BT(0x5ee5c2e9), BT(0x2afe4e3e), BT(0x12a764cc), BT(0x66bce81b), BT(0xfa907d62), BT(0x8e8bf1b5),
+		BT(0x939c12df), BT(0xe7879e08), BT(0x7bab0b71), BT(0x0fb087a6), BT(0x37e9ad54), BT(0x43f22183), BT(0xdfdeb4fa), BT(0xabc5382d),
+		BT(0xaf6ce11e), BT(0xdb776dc9), BT(0x475bf8b0), BT(0x33407467), BT(0x0b195e95), BT(0x7f02d242), BT(0xe32e473b), BT(0x9735cbec),
+		BT(0xea7df55d), BT(0x9e66798a), BT(0x024aecf3), BT(0x76516024), BT(0x4e084ad6), BT(0x3a13c601), BT(0xa63f5378), BT(0xd224dfaf),
+		BT(0xd68d069c), BT(0xa2968a4b), BT(0x3eba1f32), BT(0x4aa193e5), BT(0x72f8b917), BT(0x06e335c0), BT(0x9acfa0b9), BT(0xeed42c6e),
+		BT(0x605fdddb), BT(0x1444510c), BT(0x8868c475), BT(0xfc7348a2), BT(0xc42a6250), BT(0xb031ee87), BT(0x2c1d7bfe), BT(0x5806f729),
+		BT(0x5caf2e1a), BT(0x28b4a2cd), BT(0xb49837b4), BT(0xc083bb63), BT(0xf8da9191), BT(0x8cc11d46), BT(0x10ed883f), BT(0x64f604e8),
+		BT(0x19be3a59), BT(0x6da5b68e), BT(0xf18923f7), BT(0x8592af20), BT(0xbdcb85d2), BT(0xc9d00905), BT(0x55fc9c7c), BT(0x21e710ab),
+		BT(0x254ec998), BT(0x5155454f), BT(0xcd79d036), BT(0xb9625ce1), BT(0x813b7613), BT(0xf520fac4), BT(0x690c6fbd), BT(0x1d17e36a),
+		BT(0x5323a969), BT(0x273825be), BT(0xbb14b0c7), BT(0xcf0f3c10), BT(0xf75616e2), BT(0x834d9a35), BT(0x1f610f4c), BT(0x6b7a839b),
+		BT(0x6fd35aa8), BT(0x1bc8d67f), BT(0x87e44306), BT(0xf3ffcfd1), BT(0xcba6e523), BT(0xbfbd69f4), BT(0x2391fc8d), BT(0x578a705a),
+		BT(0x2ac24eeb), BT(0x5ed9c23c), BT(0xc2f55745), BT(0xb6eedb92), BT(0x8eb7f160), BT(0xfaac7db7), BT(0x6680e8ce), BT(0x129b6419),
+		BT(0x1632bd2a), BT(0x622931fd), BT(0xfe05a484), BT(0x8a1e2853), BT(0xb24702a1), BT(0xc65c8e76), BT(0x5a701b0f), BT(0x2e6b97d8),
+		BT(0xa0e0666d), BT(0xd4fbeaba), BT(0x48d77fc3), BT(0x3cccf314), BT(0x0495d9e6), BT(0x708e5531), BT(0xeca2c048), BT(0x98b94c9f),
+		BT(0x9c1095ac), BT(0xe80b197b), BT(0x74278c02), BT(0x003c00d5), BT(0x38652a27), BT(0x4c7ea6f0), BT(0xd0523389), BT(0xa449bf5e),
+		BT(0xd90181ef), BT(0xad1a0d38), BT(0x31369841), BT(0x452d1496), BT(0x7d743e64), BT(0x096fb2b3), BT(0x954327ca), BT(0xe158ab1d),
+		BT(0xe5f1722e), BT(0x91eafef9), BT(0x0dc66b80), BT(0x79dde757), BT(0x4184cda5), BT(0x359f4172), BT(0xa9b3d40b), BT(0xdda858dc),
+		BT(0xc0bfbbb6), BT(0xb4a43761), BT(0x2888a218), BT(0x5c932ecf), BT(0x64ca043d), BT(0x10d188ea), BT(0x8cfd1d93), BT(0xf8e69144),
+		BT(0xfc4f4877), BT(0x8854c4a0), BT(0x147851d9), BT(0x6063dd0e), BT(0x583af7fc), BT(0x2c217b2b), BT(0xb00dee52), BT(0xc4166285),
+		BT(0xb95e5c34), BT(0xcd45d0e3), BT(0x5169459a), BT(0x2572c94d), BT(0x1d2be3bf), BT(0x69306f68), BT(0xf51cfa11), BT(0x810776c6),
+		BT(0x85aeaff5), BT(0xf1b52322), BT(0x6d99b65b), BT(0x19823a8c), BT(0x21db107e), BT(0x55c09ca9), BT(0xc9ec09d0), BT(0xbdf78507),
+		BT(0x337c74b2), BT(0x4767f865), BT(0xdb4b6d1c), BT(0xaf50e1cb), BT(0x9709cb39), BT(0xe31247ee), BT(0x7f3ed297), BT(0x0b255e40),
+		BT(0x0f8c8773), BT(0x7b970ba4), BT(0xe7bb9edd), BT(0x93a0120a), BT(0xabf938f8), BT(0xdfe2b42f), BT(0x43ce2156), BT(0x37d5ad81),
+		BT(0x4a9d9330), BT(0x3e861fe7), BT(0xa2aa8a9e), BT(0xd6b10649), BT(0xeee82cbb), BT(0x9af3a06c), BT(0x06df3515), BT(0x72c4b9c2),
+		BT(0x766d60f1), BT(0x0276ec26), BT(0x9e5a795f), BT(0xea41f588), BT(0xd218df7a), BT(0xa60353ad), BT(0x3a2fc6d4), BT(0x4e344a03)
+	}, {
+		BMP_C(0x37e8223f), BMP_C(0x59038b34), BMP_C(0x7820a2c1), BMP_C(0xda4f1d2a),
+		BMP_C(0x0b8f4071), BMP_C(0x80c94414), BMP_C(0x10f9d3fb), BMP_C(0x21779771)
+	}},
+	{32UL, BT(0x8001801b), {
+		BT(0x00000000), BT(0x8001801b), BT(0x8002802d), BT(0x00030036), BT(0x80048041), BT(0x0005005a), BT(0x0006006c), BT(0x80078077),
+		BT(0x80088099), BT(0x00090082), BT(0x000a00b4), BT(0x800b80af), BT(0x000c00d8), BT(0x800d80c3), BT(0x800e80f5), BT(0x000f00ee),
+		BT(0x80108129), BT(0x00110132), BT(0x00120104), BT(0x8013811f), BT(0x00140168), BT(0x80158173), BT(0x80168145), BT(0x0017015e),
+		BT(0x001801b0), BT(0x801981ab), BT(0x801a819d), BT(0x001b0186), BT(0x801c81f1), BT(0x001d01ea), BT(0x001e01dc), BT(0x801f81c7),
+		BT(0x80208249), BT(0x00210252), BT(0x00220264), BT(0x8023827f), BT(0x00240208), BT(0x80258213), BT(0x80268225), BT(0x0027023e),
+		BT(0x002802d0), BT(0x802982cb), BT(0x802a82fd), BT(0x002b02e6), BT(0x802c8291), BT(0x002d028a), BT(0x002e02bc), BT(0x802f82a7),
+		BT(0x00300360), BT(0x8031837b), BT(0x8032834d), BT(0x00330356), BT(0x80348321), BT(0x0035033a), BT(0x0036030c), BT(0x80378317),
+		BT(0x803883f9), BT(0x003903e2), BT(0x003a03d4), BT(0x803b83cf), BT(0x003c03b8), BT(0x803d83a3), BT(0x803e8395), BT(0x003f038e),
+		BT(0x80408489), BT(0x00410492), BT(0x004204a4), BT(0x804384bf), BT(0x004404c8), BT(0x804584d3), BT(0x804684e5), BT(0x004704fe),
+		BT(0x00480410), BT(0x8049840b), BT(0x804a843d), BT(0x004b0426), BT(0x804c8451), BT(0x004d044a), BT(0x004e047c), BT(0x804f8467),
+		BT(0x005005a0), BT(0x805185bb), BT(0x8052858d), BT(0x00530596), BT(0x805485e1), BT(0x005505fa), BT(0x005605cc), BT(0x805785d7),
+		BT(0x80588539), BT(0x00590522), BT(0x005a0514), BT(0x805b850f), BT(0x005c0578), BT(0x805d8563), BT(0x805e8555), BT(0x005f054e),
+		BT(0x006006c0), BT(0x806186db), BT(0x806286ed), BT(0x006306f6), BT(0x80648681), BT(0x0065069a), BT(0x006606ac), BT(0x806786b7),
+		BT(0x80688659), BT(0x00690642), BT(0x006a0674), BT(0x806b866f), BT(0x006c0618), BT(0x806d8603), BT(0x806e8635), BT(0x006f062e),
+		BT(0x807087e9), BT(0x007107f2), BT(0x007207c4), BT(0x807387df), BT(0x007407a8), BT(0x807587b3), BT(0x80768785), BT(0x0077079e),
+		BT(0x00780770), BT(0x8079876b), BT(0x807a875d), BT(0x007b0746), BT(0x807c8731), BT(0x007d072a), BT(0x007e071c), BT(0x807f8707),
+		BT(0x80808909), BT(0x00810912), BT(0x00820924), BT(0x8083893f), BT(0x00840948), BT(0x80858953), BT(0x80868965), BT(0x0087097e),
+		BT(0x00880990), BT(0x8089898b), BT(0x808a89bd), BT(0x008b09a6), BT(0x808c89d1), BT(0x008d09ca), BT(0x008e09fc), BT(0x808f89e7),
+		BT(0x00900820), BT(0x8091883b), BT(0x8092880d), BT(0x00930816), BT(0x80948861), BT(0x0095087a), BT(0x0096084c), BT(0x80978857),
+		BT(0x809888b9), BT(0x009908a2), BT(0x009a0894), BT(0x809b888f), BT(0x009c08f8), BT(0x809d88e3), BT(0x809e88d5), BT(0x009f08ce),
+		BT(0x00a00b40), BT(0x80a18b5b), BT(0x80a28b6d), BT(0x00a30b76), BT(0x80a48b01), BT(0x00a50b1a), BT(0x00a60b2c), BT(0x80a78b37),
+		BT(0x80a88bd9), BT(0x00a90bc2), BT(0x00aa0bf4), BT(0x80ab8bef), BT(0x00ac0b98), BT(0x80ad8b83), BT(0x80ae8bb5), BT(0x00af0bae),
+		BT(0x80b08a69), BT(0x00b10a72), BT(0x00b20a44), BT(0x80b38a5f), BT(0x00b40a28), BT(0x80b58a33), BT(0x80b68a05), BT(0x00b70a1e),
+		BT(0x00b80af0), BT(0x80b98aeb), BT(0x80ba8add), BT(0x00bb0ac6), BT(0x80bc8ab1), BT(0x00bd0aaa), BT(0x00be0a9c), BT(0x80bf8a87),
+		BT(0x00c00d80), BT(0x80c18d9b), BT(0x80c28dad), BT(0x00c30db6), BT(0x80c48dc1), BT(0x00c50dda), BT(0x00c60dec), BT(0x80c78df7),
+		BT(0x80c88d19), BT(0x00c90d02), BT(0x00ca0d34), BT(0x80cb8d2f), BT(0x00cc0d58), BT(0x80cd8d43), BT(0x80ce8d75), BT(0x00cf0d6e),
+		BT(0x80d08ca9), BT(0x00d10cb2), BT(0x00d20c84), BT(0x80d38c9f), BT(0x00d40ce8), BT(0x80d58cf3), BT(0x80d68cc5), BT(0x00d70cde),
+		BT(0x00d80c30), BT(0x80d98c2b), BT(0x80da8c1d), BT(0x00db0c06), BT(0x80dc8c71), BT(0x00dd0c6a), BT(0x00de0c5c), BT(0x80df8c47),
+		BT(0x80e08fc9), BT(0x00e10fd2), BT(0x00e20fe4), BT(0x80e38fff), BT(0x00e40f88), BT(0x80e58f93), BT(0x80e68fa5), BT(0x00e70fbe),
+		BT(0x00e80f50), BT(0x80e98f4b), BT(0x80ea8f7d), BT(0x00eb0f66), BT(0x80ec8f11), BT(0x00ed0f0a), BT(0x00ee0f3c), BT(0x80ef8f27),
+		BT(0x00f00ee0), BT(0x80f18efb), BT(0x80f28ecd), BT(0x00f30ed6), BT(0x80f48ea1), BT(0x00f50eba), BT(0x00f60e8c), BT(0x80f78e97),
+		BT(0x80f88e79), BT(0x00f90e62), BT(0x00fa0e54), BT(0x80fb8e4f), BT(0x00fc0e38), BT(0x80fd8e23), BT(0x80fe8e15), BT(0x00ff0e0e)
+	}, {
+		BMP_C(0x8001810b), BMP_C(0x80149437), BMP_C(0x81069471), BMP_C(0x051e54ee),
+		BMP_C(0x00010014), BMP_C(0x0103152a), BMP_C(0x8000810f), BMP_C(0x01071074)
+	}},
+	{32UL, BT(0x814141ab), {
+		BT(0x00000000), BT(0x814141ab), BT(0x83c3c2fd), BT(0x02828356), BT(0x86c6c451), BT(0x078785fa), BT(0x050506ac), BT(0x84444707),
+		BT(0x8cccc909), BT(0x0d8d88a2), BT(0x0f0f0bf4), BT(0x8e4e4a5f), BT(0x0a0a0d58), BT(0x8b4b4cf3), BT(0x89c9cfa5), BT(0x08888e0e),
+		BT(0x98d8d3b9), BT(0x19999212), BT(0x1b1b1144), BT(0x9a5a50ef), BT(0x1e1e17e8), BT(0x9f5f5643), BT(0x9dddd515), BT(0x1c9c94be),
+		BT(0x14141ab0), BT(0x95555b1b), BT(0x97d7d84d), BT(0x169699e6), BT(0x92d2dee1), BT(0x13939f4a), BT(0x11111c1c), BT(0x90505db7),
+		BT(0xb0f0e6d9), BT(0x31b1a772), BT(0x33332424), BT(0xb272658f), BT(0x36362288), BT(0xb7776323), BT(0xb5f5e075), BT(0x34b4a1de),
+		BT(0x3c3c2fd0), BT(0xbd7d6e7b), BT(0xbfffed2d), BT(0x3ebeac86), BT(0xbafaeb81), BT(0x3bbbaa2a), BT(0x3939297c), BT(0xb87868d7),
+		BT(0x28283560), BT(0xa96974cb), BT(0xabebf79d), BT(0x2aaab636), BT(0xaeeef131), BT(0x2fafb09a), BT(0x2d2d33cc), BT(0xac6c7267),
+		BT(0xa4e4fc69), BT(0x25a5bdc2), BT(0x27273e94), BT(0xa6667f3f), BT(0x22223838), BT(0xa3637993), BT(0xa1e1fac5), BT(0x20a0bb6e),
+		BT(0xe0a08c19), BT(0x61e1cdb2), BT(0x63634ee4), BT(0xe2220f4f), BT(0x66664848), BT(0xe72709e3), BT(0xe5a58ab5), BT(0x64e4cb1e),
+		BT(0x6c6c4510), BT(0xed2d04bb), BT(0xefaf87ed), BT(0x6eeec646), BT(0xeaaa8141), BT(0x6bebc0ea), BT(0x696943bc), BT(0xe8280217),
+		BT(0x78785fa0), BT(0xf9391e0b), BT(0xfbbb9d5d), BT(0x7afadcf6), BT(0xfebe9bf1), BT(0x7fffda5a), BT(0x7d7d590c), BT(0xfc3c18a7),
+		BT(0xf4b496a9), BT(0x75f5d702), BT(0x77775454), BT(0xf63615ff), BT(0x727252f8), BT(0xf3331353), BT(0xf1b19005), BT(0x70f0d1ae),
+		BT(0x50506ac0), BT(0xd1112b6b), BT(0xd393a83d), BT(0x52d2e996), BT(0xd696ae91), BT(0x57d7ef3a), BT(0x55556c6c), BT(0xd4142dc7),
+		BT(0xdc9ca3c9), BT(0x5ddde262), BT(0x5f5f6134), BT(0xde1e209f), BT(0x5a5a6798), BT(0xdb1b2633), BT(0xd999a565), BT(0x58d8e4ce),
+		BT(0xc888b979), BT(0x49c9f8d2), BT(0x4b4b7b84), BT(0xca0a3a2f), BT(0x4e4e7d28), BT(0xcf0f3c83), BT(0xcd8dbfd5), BT(0x4cccfe7e),
+		BT(0x44447070), BT(0xc50531db), BT(0xc787b28d), BT(0x46c6f326), BT(0xc282b421), BT(0x43c3f58a), BT(0x414176dc), BT(0xc0003777),
+		BT(0x40005999), BT(0xc1411832), BT(0xc3c39b64), BT(0x4282dacf), BT(0xc6c69dc8), BT(0x4787dc63), BT(0x45055f35), BT(0xc4441e9e),
+		BT(0xcccc9090), BT(0x4d8dd13b), BT(0x4f0f526d), BT(0xce4e13c6), BT(0x4a0a54c1), BT(0xcb4b156a), BT(0xc9c9963c), BT(0x4888d797),
+		BT(0xd8d88a20), BT(0x5999cb8b), BT(0x5b1b48dd), BT(0xda5a0976), BT(0x5e1e4e71), BT(0xdf5f0fda), BT(0xdddd8c8c), BT(0x5c9ccd27),
+		BT(0x54144329), BT(0xd5550282), BT(0xd7d781d4), BT(0x5696c07f), BT(0xd2d28778), BT(0x5393c6d3), BT(0x51114585), BT(0xd050042e),
+		BT(0xf0f0bf40), BT(0x71b1feeb), BT(0x73337dbd), BT(0xf2723c16), BT(0x76367b11), BT(0xf7773aba), BT(0xf5f5b9ec), BT(0x74b4f847),
+		BT(0x7c3c7649), BT(0xfd7d37e2), BT(0xffffb4b4), BT(0x7ebef51f), BT(0xfafab218), BT(0x7bbbf3b3), BT(0x793970e5), BT(0xf878314e),
+		BT(0x68286cf9), BT(0xe9692d52), BT(0xebebae04), BT(0x6aaaefaf), BT(0xeeeea8a8), BT(0x6fafe903), BT(0x6d2d6a55), BT(0xec6c2bfe),
+		BT(0xe4e4a5f0), BT(0x65a5e45b), BT(0x6727670d), BT(0xe66626a6), BT(0x622261a1), BT(0xe363200a), BT(0xe1e1a35c), BT(0x60a0e2f7),
+		BT(0xa0a0d580), BT(0x21e1942b), BT(0x2363177d), BT(0xa22256d6), BT(0x266611d1), BT(0xa727507a), BT(0xa5a5d32c), BT(0x24e49287),
+		BT(0x2c6c1c89), BT(0xad2d5d22), BT(0xafafde74), BT(0x2eee9fdf), BT(0xaaaad8d8), BT(0x2beb9973), BT(0x29691a25), BT(0xa8285b8e),
+		BT(0x38780639), BT(0xb9394792), BT(0xbbbbc4c4), BT(0x3afa856f), BT(0xbebec268), BT(0x3fff83c3), BT(0x3d7d0095), BT(0xbc3c413e),
+		BT(0xb4b4cf30), BT(0x35f58e9b), BT(0x37770dcd), BT(0xb6364c66), BT(0x32720b61), BT(0xb3334aca), BT(0xb1b1c99c), BT(0x30f08837),
+		BT(0x10503359), BT(0x911172f2), BT(0x9393f1a4), BT(0x12d2b00f), BT(0x9696f708), BT(0x17d7b6a3), BT(0x155535f5), BT(0x9414745e),
+		BT(0x9c9cfa50), BT(0x1dddbbfb), BT(0x1f5f38ad), BT(0x9e1e7906), BT(0x1a5a3e01), BT(0x9b1b7faa), BT(0x9999fcfc), BT(0x18d8bd57),
+		BT(0x8888e0e0), BT(0x09c9a14b), BT(0x0b4b221d), BT(0x8a0a63b6), BT(0x0e4e24b1), BT(0x8f0f651a), BT(0x8d8de64c), BT(0x0ccca7e7),
+		BT(0x044429e9), BT(0x85056842), BT(0x8787eb14), BT(0x06c6aabf), BT(0x8282edb8), BT(0x03c3ac13), BT(0x01412f45), BT(0x80006eee)
+	}, {
+		BMP_C(0x6256aa77), BMP_C(0x10115fa6), BMP_C(0x251293d7), BMP_C(0x7c58233f),
+		BMP_C(0x2ffc5e91), BMP_C(0x505740ef), BMP_C(0xa1fa6bec), BMP_C(0x5603a6bc)
+	}},
+	{32UL, BT(0xa833982b), {
+		BT(0x00000000), BT(0xa833982b), BT(0xf854a87d), BT(0x50673056), BT(0x589ac8d1), BT(0xf0a950fa), BT(0xa0ce60ac), BT(0x08fdf887),
+		BT(0xb13591a2), BT(0x19060989), BT(0x496139df), BT(0xe152a1f4), BT(0xe9af5973), BT(0x419cc158), BT(0x11fbf10e), BT(0xb9c86925),
+		BT(0xca58bb6f), BT(0x626b2344), BT(0x320c1312), BT(0x9a3f8b39), BT(0x92c273be), BT(0x3af1eb95), BT(0x6a96dbc3), BT(0xc2a543e8),
+		BT(0x7b6d2acd), BT(0xd35eb2e6), BT(0x833982b0), BT(0x2b0a1a9b), BT(0x23f7e21c), BT(0x8bc47a37), BT(0xdba34a61), BT(0x7390d24a),
+		BT(0x3c82eef5), BT(0x94b176de), BT(0xc4d64688), BT(0x6ce5dea3), BT(0x64182624), BT(0xcc2bbe0f), BT(0x9c4c8e59), BT(0x347f1672),
+		BT(0x8db77f57), BT(0x2584e77c), BT(0x75e3d72a), BT(0xddd04f01), BT(0xd52db786), BT(0x7d1e2fad), BT(0x2d791ffb), BT(0x854a87d0),
+		BT(0xf6da559a), BT(0x5ee9cdb1), BT(0x0e8efde7), BT(0xa6bd65cc), BT(0xae409d4b), BT(0x06730560), BT(0x56143536), BT(0xfe27ad1d),
+		BT(0x47efc438), BT(0xefdc5c13), BT(0xbfbb6c45), BT(0x1788f46e), BT(0x1f750ce9), BT(0xb74694c2), BT(0xe721a494), BT(0x4f123cbf),
+		BT(0x7905ddea), BT(0xd13645c1), BT(0x81517597), BT(0x2962edbc), BT(0x219f153b), BT(0x89ac8d10), BT(0xd9cbbd46), BT(0x71f8256d),
+		BT(0xc8304c48), BT(0x6003d463), BT(0x3064e435), BT(0x98577c1e), BT(0x90aa8499), BT(0x38991cb2), BT(0x68fe2ce4), BT(0xc0cdb4cf),
+		BT(0xb35d6685), BT(0x1b6efeae), BT(0x4b09cef8), BT(0xe33a56d3), BT(0xebc7ae54), BT(0x43f4367f), BT(0x13930629), BT(0xbba09e02),
+		BT(0x0268f727), BT(0xaa5b6f0c), BT(0xfa3c5f5a), BT(0x520fc771), BT(0x5af23ff6), BT(0xf2c1a7dd), BT(0xa2a6978b), BT(0x0a950fa0),
+		BT(0x4587331f), BT(0xedb4ab34), BT(0xbdd39b62), BT(0x15e00349), BT(0x1d1dfbce), BT(0xb52e63e5), BT(0xe54953b3), BT(0x4d7acb98),
+		BT(0xf4b2a2bd), BT(0x5c813a96), BT(0x0ce60ac0), BT(0xa4d592eb), BT(0xac286a6c), BT(0x041bf247), BT(0x547cc211), BT(0xfc4f5a3a),
+		BT(0x8fdf8870), BT(0x27ec105b), BT(0x778b200d), BT(0xdfb8b826), BT(0xd74540a1), BT(0x7f76d88a), BT(0x2f11e8dc), BT(0x872270f7),
+		BT(0x3eea19d2), BT(0x96d981f9), BT(0xc6beb1af), BT(0x6e8d2984), BT(0x6670d103), BT(0xce434928), BT(0x9e24797e), BT(0x3617e155),
+		BT(0xf20bbbd4), BT(0x5a3823ff), BT(0x0a5f13a9), BT(0xa26c8b82), BT(0xaa917305), BT(0x02a2eb2e), BT(0x52c5db78), BT(0xfaf64353),
+		BT(0x433e2a76), BT(0xeb0db25d), BT(0xbb6a820b), BT(0x13591a20), BT(0x1ba4e2a7), BT(0xb3977a8c), BT(0xe3f04ada), BT(0x4bc3d2f1),
+		BT(0x385300bb), BT(0x90609890), BT(0xc007a8c6), BT(0x683430ed), BT(0x60c9c86a), BT(0xc8fa5041), BT(0x989d6017), BT(0x30aef83c),
+		BT(0x89669119), BT(0x21550932), BT(0x71323964), BT(0xd901a14f), BT(0xd1fc59c8), BT(0x79cfc1e3), BT(0x29a8f1b5), BT(0x819b699e),
+		BT(0xce895521), BT(0x66bacd0a), BT(0x36ddfd5c), BT(0x9eee6577), BT(0x96139df0), BT(0x3e2005db), BT(0x6e47358d), BT(0xc674ada6),
+		BT(0x7fbcc483), BT(0xd78f5ca8), BT(0x87e86cfe), BT(0x2fdbf4d5), BT(0x27260c52), BT(0x8f159479), BT(0xdf72a42f), BT(0x77413c04),
+		BT(0x04d1ee4e), BT(0xace27665), BT(0xfc854633), BT(0x54b6de18), BT(0x5c4b269f), BT(0xf478beb4), BT(0xa41f8ee2), BT(0x0c2c16c9),
+		BT(0xb5e47fec), BT(0x1dd7e7c7), BT(0x4db0d791), BT(0xe5834fba), BT(0xed7eb73d), BT(0x454d2f16), BT(0x152a1f40), BT(0xbd19876b),
+		BT(0x8b0e663e), BT(0x233dfe15), BT(0x735ace43), BT(0xdb695668), BT(0xd394aeef), BT(0x7ba736c4), BT(0x2bc00692), BT(0x83f39eb9),
+		BT(0x3a3bf79c), BT(0x92086fb7), BT(0xc26f5fe1), BT(0x6a5cc7ca), BT(0x62a13f4d), BT(0xca92a766), BT(0x9af59730), BT(0x32c60f1b),
+		BT(0x4156dd51), BT(0xe965457a), BT(0xb902752c), BT(0x1131ed07), BT(0x19cc1580), BT(0xb1ff8dab), BT(0xe198bdfd), BT(0x49ab25d6),
+		BT(0xf0634cf3), BT(0x5850d4d8), BT(0x0837e48e), BT(0xa0047ca5), BT(0xa8f98422), BT(0x00ca1c09), BT(0x50ad2c5f), BT(0xf89eb474),
+		BT(0xb78c88cb), BT(0x1fbf10e0), BT(0x4fd820b6), BT(0xe7ebb89d), BT(0xef16401a), BT(0x4725d831), BT(0x1742e867), BT(0xbf71704c),
+		BT(0x06b91969), BT(0xae8a8142), BT(0xfeedb114), BT(0x56de293f), BT(0x5e23d1b8), BT(0xf6104993), BT(0xa67779c5), BT(0x0e44e1ee),
+		BT(0x7dd433a4), BT(0xd5e7ab8f), BT(0x85809bd9), BT(0x2db303f2), BT(0x254efb75), BT(0x8d7d635e), BT(0xdd1a5308), BT(0x7529cb23),
+		BT(0xcce1a206), BT(0x64d23a2d), BT(0x34b50a7b), BT(0x9c869250), BT(0x947b6ad7), BT(0x3c48f2fc), BT(0x6c2fc2aa), BT(0xc41c5a81)
+	}, {
+		BMP_C(0x7cb57c62), BMP_C(0x1613f105), BMP_C(0x3090df2c), BMP_C(0x016cbc51),
+		BMP_C(0xc124f502), BMP_C(0x924ba040), BMP_C(0x83e729fa), BMP_C(0x0130cd55)
+	}},
+	{32UL, BT(0xf4acfb13), {
+		BT(0x00000000), BT(0xf4acfb13), BT(0x1df50d35), BT(0xe959f626), BT(0x3bea1a6a), BT(0xcf46e179), BT(0x261f175f), BT(0xd2b3ec4c),
+		BT(0x77d434d4), BT(0x8378cfc7), BT(0x6a2139e1), BT(0x9e8dc2f2), BT(0x4c3e2ebe), BT(0xb892d5ad), BT(0x51cb238b), BT(0xa567d898),
+		BT(0xefa869a8), BT(0x1b0492bb), BT(0xf25d649d), BT(0x06f19f8e), BT(0xd44273c2), BT(0x20ee88d1), BT(0xc9b77ef7), BT(0x3d1b85e4),
+		BT(0x987c5d7c), BT(0x6cd0a66f), BT(0x85895049), BT(0x7125ab5a), BT(0xa3964716), BT(0x573abc05), BT(0xbe634a23), BT(0x4acfb130),
+		BT(0x2bfc2843), BT(0xdf50d350), BT(0x36092576), BT(0xc2a5de65), BT(0x10163229), BT(0xe4bac93a), BT(0x0de33f1c), BT(0xf94fc40f),
+		BT(0x5c281c97), BT(0xa884e784), BT(0x41dd11a2), BT(0xb571eab1), BT(0x67c206fd), BT(0x936efdee), BT(0x7a370bc8), BT(0x8e9bf0db),
+		BT(0xc45441eb), BT(0x30f8baf8), BT(0xd9a14cde), BT(0x2d0db7cd), BT(0xffbe5b81), BT(0x0b12a092), BT(0xe24b56b4), BT(0x16e7ada7),
+		BT(0xb380753f), BT(0x472c8e2c), BT(0xae75780a), BT(0x5ad98319), BT(0x886a6f55), BT(0x7cc69446), BT(0x959f6260), BT(0x61339973),
+		BT(0x57f85086), BT(0xa354ab95), BT(0x4a0d5db3), BT(0xbea1a6a0), BT(0x6c124aec), BT(0x98beb1ff), BT(0x71e747d9), BT(0x854bbcca),
+		BT(0x202c6452), BT(0xd4809f41), BT(0x3dd96967), BT(0xc9759274), BT(0x1bc67e38), BT(0xef6a852b), BT(0x0633730d), BT(0xf29f881e),
+		BT(0xb850392e), BT(0x4cfcc23d), BT(0xa5a5341b), BT(0x5109cf08), BT(0x83ba2344), BT(0x7716d857), BT(0x9e4f2e71), BT(0x6ae3d562),
+		BT(0xcf840dfa), BT(0x3b28f6e9), BT(0xd27100cf), BT(0x26ddfbdc), BT(0xf46e1790), BT(0x00c2ec83), BT(0xe99b1aa5), BT(0x1d37e1b6),
+		BT(0x7c0478c5), BT(0x88a883d6), BT(0x61f175f0), BT(0x955d8ee3), BT(0x47ee62af), BT(0xb34299bc), BT(0x5a1b6f9a), BT(0xaeb79489),
+		BT(0x0bd04c11), BT(0xff7cb702), BT(0x16254124), BT(0xe289ba37), BT(0x303a567b), BT(0xc496ad68), BT(0x2dcf5b4e), BT(0xd963a05d),
+		BT(0x93ac116d), BT(0x6700ea7e), BT(0x8e591c58), BT(0x7af5e74b), BT(0xa8460b07), BT(0x5ceaf014), BT(0xb5b30632), BT(0x411ffd21),
+		BT(0xe47825b9), BT(0x10d4deaa), BT(0xf98d288c), BT(0x0d21d39f), BT(0xdf923fd3), BT(0x2b3ec4c0), BT(0xc26732e6), BT(0x36cbc9f5),
+		BT(0xaff0a10c), BT(0x5b5c5a1f), BT(0xb205ac39), BT(0x46a9572a), BT(0x941abb66), BT(0x60b64075), BT(0x89efb653), BT(0x7d434d40),
+		BT(0xd82495d8), BT(0x2c886ecb), BT(0xc5d198ed), BT(0x317d63fe), BT(0xe3ce8fb2), BT(0x176274a1), BT(0xfe3b8287), BT(0x0a977994),
+		BT(0x4058c8a4), BT(0xb4f433b7), BT(0x5dadc591), BT(0xa9013e82), BT(0x7bb2d2ce), BT(0x8f1e29dd), BT(0x6647dffb), BT(0x92eb24e8),
+		BT(0x378cfc70), BT(0xc3200763), BT(0x2a79f145), BT(0xded50a56), BT(0x0c66e61a), BT(0xf8ca1d09), BT(0x1193eb2f), BT(0xe53f103c),
+		BT(0x840c894f), BT(0x70a0725c), BT(0x99f9847a), BT(0x6d557f69), BT(0xbfe69325), BT(0x4b4a6836), BT(0xa2139e10), BT(0x56bf6503),
+		BT(0xf3d8bd9b), BT(0x07744688), BT(0xee2db0ae), BT(0x1a814bbd), BT(0xc832a7f1), BT(0x3c9e5ce2), BT(0xd5c7aac4), BT(0x216b51d7),
+		BT(0x6ba4e0e7), BT(0x9f081bf4), BT(0x7651edd2), BT(0x82fd16c1), BT(0x504efa8d), BT(0xa4e2019e), BT(0x4dbbf7b8), BT(0xb9170cab),
+		BT(0x1c70d433), BT(0xe8dc2f20), BT(0x0185d906), BT(0xf5292215), BT(0x279ace59), BT(0xd336354a), BT(0x3a6fc36c), BT(0xcec3387f),
+		BT(0xf808f18a), BT(0x0ca40a99), BT(0xe5fdfcbf), BT(0x115107ac), BT(0xc3e2ebe0), BT(0x374e10f3), BT(0xde17e6d5), BT(0x2abb1dc6),
+		BT(0x8fdcc55e), BT(0x7b703e4d), BT(0x9229c86b), BT(0x66853378), BT(0xb436df34), BT(0x409a2427), BT(0xa9c3d201), BT(0x5d6f2912),
+		BT(0x17a09822), BT(0xe30c6331), BT(0x0a559517), BT(0xfef96e04), BT(0x2c4a8248), BT(0xd8e6795b), BT(0x31bf8f7d), BT(0xc513746e),
+		BT(0x6074acf6), BT(0x94d857e5), BT(0x7d81a1c3), BT(0x892d5ad0), BT(0x5b9eb69c), BT(0xaf324d8f), BT(0x466bbba9), BT(0xb2c740ba),
+		BT(0xd3f4d9c9), BT(0x275822da), BT(0xce01d4fc), BT(0x3aad2fef), BT(0xe81ec3a3), BT(0x1cb238b0), BT(0xf5ebce96), BT(0x01473585),
+		BT(0xa420ed1d), BT(0x508c160e), BT(0xb9d5e028), BT(0x4d791b3b), BT(0x9fcaf777), BT(0x6b660c64), BT(0x823ffa42), BT(0x76930151),
+		BT(0x3c5cb061), BT(0xc8f04b72), BT(0x21a9bd54), BT(0xd5054647), BT(0x07b6aa0b), BT(0xf31a5118), BT(0x1a43a73e), BT(0xeeef5c2d),
+		BT(0x4b8884b5), BT(0xbf247fa6), BT(0x567d8980), BT(0xa2d17293), BT(0x70629edf), BT(0x84ce65cc), BT(0x6d9793ea), BT(0x993b68f9)
+	}, {
+		BMP_C(0xe1d04ae3), BMP_C(0x5ecf6cd1), BMP_C(0x46d30016), BMP_C(0x012a0610),
+		BMP_C(0xdcc76058), BMP_C(0xf8350d46), BMP_C(0x052e2a05), BMP_C(0xbda13578)
+	}},
+};
+#    define NBAKED 64
+/* END AUTO-GENERATED TABLES */
+/* DO NOT EDIT the section above, INCLUDING the previous comment. */
+
 #  endif /* BMP_BIT */
 #else /* PRESETS */
 
@@ -844,9 +3242,22 @@ static const struct malias aliases[] = {
 };
 #  define NALIASES 0
 
+static const struct mbaked baked[] = {
+	{ 0UL, 0, {0}, {0}},	/* unused entry */
+};
+#  define NBAKED 0
+
 #endif /* PRESETS */
 
 static void munpack(model_t *, const struct mpreset *);
+static int mgkey(const mprep_t *, unsigned long, int);
+static void mkeep(mprep_t *index, int count);
+
+/* the preset index, built on the first call to mgroup() */
+static mprep_t *mindex = NULL;
+#ifdef THREADS
+static pthread_mutex_t mglock = PTHREAD_MUTEX_INITIALIZER;
+#endif /* THREADS */
 
 /* copy a parameter of a preset to a poly */
 
@@ -875,7 +3286,7 @@ mbynam(model_t *dest, const char *key) {
 
 	if(!aliases->name)
 		return(-1);
-	if(!(ukey = malloc((size_t) 1 + strlen(key))))
+	if(!(ukey = pmalloc((size_t) 1 + strlen(key))))
 		uerror("cannot allocate memory for comparison string");
 	uptr = ukey;
 	do
@@ -888,7 +3299,7 @@ mbynam(model_t *dest, const char *key) {
 		if(cmp < 0) right = middle;
 		else if(cmp > 0) left = middle + 1;
 	}
-	free(ukey);
+	pmfree(ukey);
 
 	if(cmp)
 		return(0);
@@ -926,7 +3337,7 @@ mnames(void) {
 		++aptr;
 	}
 	if(!size) return(NULL);
-	if((string = malloc(size))) {
+	if((string = pmalloc(size))) {
 		aptr = aliases;
 		sptr = string;
 		while(aptr->name) {
@@ -987,8 +3398,172 @@ mmatch(model_t *model, int flags) {
 	}
 }
 
+int
+mgroup(const mprep_t **dest, unsigned long width, int flags) {
+	/* Sets *dest to the presets of the given width whose RefIn and
+	 * RefOut flags match those in flags, and returns their number.
+	 * The presets are listed in descending order of preset number.
+	 * On the first call every preset is unpacked into an index,
+	 * sorted by width and reflection; the CRC engines of a group
+	 * are prepared when the group is first requested.  The index
+	 * lasts until exit and must not be modified or freed.
+	 * The index and each engine are built without mglock held and
+	 * published when complete, so that an error thrown meanwhile
+	 * leaves the lock free and the index as it was.
+	 */
+	static const mprep_t mpzero = MPZERO;
+	mprep_t swap, *index;
+	ptab_t tab = PTZERO;
+	size_t left = 0, right = NPRESETS, middle, end;
+	int num, done;
+
+	*dest = NULL;
+	if(!NPRESETS)
+		return(0);
+#ifdef THREADS
+	pthread_mutex_lock(&mglock);
+#endif /* THREADS */
+	index = mindex;
+#ifdef THREADS
+	pthread_mutex_unlock(&mglock);
+#endif /* THREADS */
+	if(!index) {
+		if(!(index = pmalloc(NPRESETS * sizeof(mprep_t))))
+			uerror("cannot allocate memory for preset index");
+		/* straight insertion keeps each group in descending order */
+		for(num = 0; num < NPRESETS; ++num) {
+			swap = mpzero;
+			munpack(&swap.model, models + NPRESETS - 1 - num);
+			swap.xorout = pclone(swap.model.xorout);
+			if(swap.model.flags & P_REFOUT)
+				prev(&swap.xorout);
+			for(middle = num; middle && mgkey(index + middle - 1,
+					plen(swap.model.spoly), swap.model.flags) > 0; --middle)
+				index[middle] = index[middle - 1];
+			index[middle] = swap;
+		}
+#ifdef THREADS
+		pthread_mutex_lock(&mglock);
+#endif /* THREADS */
+		if(!mindex) {
+			mkeep(index, NPRESETS);
+			mindex = index;
+			index = NULL;
+		}
+#ifdef THREADS
+		pthread_mutex_unlock(&mglock);
+#endif /* THREADS */
+		/* another thread published its index first */
+		if(index) {
+			for(num = 0; num < NPRESETS; ++num) {
+				mfree(&index[num].model);
+				pfree(&index[num].xorout);
+			}
+			pmfree(index);
+		}
+	}
+
+	/* find the first preset not below the key */
+	while(left < right) {
+		middle = (left >> 1) + (right >> 1);
+		if(mgkey(mindex + middle, width, flags) < 0)
+			left = middle + 1;
+		else
+			right = middle;
+	}
+	for(end = left; end < NPRESETS && !mgkey(mindex + end, width, flags); ++end) {
+#ifdef THREADS
+		pthread_mutex_lock(&mglock);
+#endif /* THREADS */
+		done = plen(mindex[end].tab.divisor) != 0UL;
+#ifdef THREADS
+		pthread_mutex_unlock(&mglock);
+#endif /* THREADS */
+		if(done)
+			continue;
+		mtinit(&tab, mindex[end].model.spoly);
+#ifdef THREADS
+		pthread_mutex_lock(&mglock);
+#endif /* THREADS */
+		if(!plen(mindex[end].tab.divisor)) {
+			plkeep(tab.divisor.bitmap);
+			plkeep(tab.store);
+			plkeep(tab.rtable);
+			mindex[end].tab = tab;
+			tab = mpzero.tab;
+		}
+#ifdef THREADS
+		pthread_mutex_unlock(&mglock);
+#endif /* THREADS */
+		ptfree(&tab);
+	}
+
+	*dest = mindex + left;
+	return((int) (end - left));
+}
+
+int
+mtinit(ptab_t *tab, const poly_t spoly) {
+	/* Prepares tab as ptinit(tab, spoly) would.  If spoly is the
+	 * generator of a preset, the tables baked into baked[] by
+	 * relink.pl are used and nonzero is returned.
+	 * spoly must be CLEAN.
+	 */
+	size_t left = 0, right = NBAKED, middle;
+	bmp_t word;
+
+	if(spoly.length && spoly.length <= 32UL) {
+		word = *spoly.bitmap;
+		while(left < right) {
+			middle = (left >> 1) + (right >> 1);
+			if(baked[middle].width < spoly.length || (baked[middle].width == spoly.length && baked[middle].spoly < word))
+				left = middle + 1;
+			else
+				right = middle;
+		}
+		if(left < NBAKED && baked[left].width == spoly.length && baked[left].spoly == word) {
+			ptbake(tab, spoly, baked[left].table, baked[left].keys);
+			return(1);
+		}
+	}
+	ptinit(tab, spoly);
+	return(0);
+}
+
 /* Private functions */
 
+static int
+mgkey(const mprep_t *prep, unsigned long width, int flags) {
+	/* Compares the width and reflection of the preset in prep with
+	 * the key, returning <0, 0 or >0 as the preset sorts before,
+	 * with or after it.
+	 */
+	unsigned long plength = plen(prep->model.spoly);
+
+	if(plength != width)
+		return(plength < width ? -1 : 1);
+	return((prep->model.flags & (P_REFIN | P_REFOUT)) - (flags & (P_REFIN | P_REFOUT)));
+}
+
+static void
+mkeep(mprep_t *index, int count) {
+	/* Strikes the storage of index[0..count-1] from the ledger of
+	 * the reveng() call that built it, so that the index outlives
+	 * the call.
+	 */
+	int num;
+
+	plkeep(index);
+	for(num = 0; num < count; ++num) {
+		plkeep(index[num].model.spoly.bitmap);
+		plkeep(index[num].model.init.bitmap);
+		plkeep(index[num].model.xorout.bitmap);
+		plkeep(index[num].model.check.bitmap);
+		plkeep(index[num].model.magic.bitmap);
+		plkeep(index[num].xorout.bitmap);
+	}
+}
+
 static void
 munpack(model_t *dest, const struct mpreset *src) {
 	/* Copies the parameters of src to dest.
@@ -1006,12 +3581,22 @@ munpack(model_t *dest, const struct mpreset *src) {
 }
 
 #ifdef PRETST
+static int pengin(const model_t *model);
+static int pbdtst(const model_t *model);
+static int pstmtst(const model_t *model);
+static int pcbtst(const model_t *model);
+static int pfctst(const model_t *model);
+static poly_t prand(unsigned long length, bmp_t *seed);
+
+static const poly_t pzero = PZERO;
+
 int
 main(int argc, char *argv[]) {
 	/* check models[] and aliases[] are in order */
 	model_t a = MZERO, b = MZERO, n = MZERO;
 	const struct mpreset *model = models;
 	const struct malias *alias = aliases;
+	const char *fails;
 
 	munpack(&a, model);
 	while(plen(a.spoly)) {
@@ -1039,9 +3624,313 @@ main(int argc, char *argv[]) {
 		}
 		++alias;
 	}
+
+	/* check the CRC engines reproduce the stored check values,
+	 * and the arithmetic of the search on each generator
+	 */
+	for(model = models; model->width; ++model) {
+		munpack(&a, model);
+		fails = NULL;
+		if(!pengin(&a))
+			fails = "CRC engine";
+		else if(!pstmtst(&a))
+			fails = "streaming CRC engine";
+		else if(!pbdtst(&a))
+			fails = "batch division";
+		else if(!pcbtst(&a))
+			fails = "CRC combination";
+		else if(!pfctst(&a))
+			fails = "factorisation";
+		if(fails) {
+			fprintf(stderr, "reveng: coding error.  %s "
+				"fails model '%s'.\n",
+				fails, a.name);
+			mfree(&a);
+			exit(EXIT_FAILURE);
+		}
+		mfree(&a);
+	}
 	exit(EXIT_SUCCESS);
 }
 
+static int
+pengin(const model_t *model) {
+	/* Returns nonzero if ptcrc() yields the Check and Residue values
+	 * of model and agrees with pcrc() on a long message, and any
+	 * baked tables for its generator match those of ptinit().
+	 */
+	ptab_t tab = PTZERO;
+	poly_t apoly, xorout, crc, ref;
+	bmp_t seed = BMP_C(0x2545f491);
+	int ok;
+
+	/* the baked tables, if any, must match those computed */
+	ptinit(&tab, model->spoly);
+	if(model->spoly.length <= 32UL) {
+		ptab_t bake = PTZERO;
+		int i;
+
+		if(!mtinit(&bake, model->spoly))
+			return(0);
+		for(i = 0; i < 256; ++i)
+			if(bake.table[i] != tab.table[i])
+				return(0);
+		for(i = 0; tab.keys && i < 8; ++i)
+			if(bake.keys[i] != tab.keys[i])
+				return(0);
+		ptfree(&bake);
+	}
+	xorout = pclone(model->xorout);
+	if(model->flags & P_REFOUT)
+		prev(&xorout);
+
+	/* as mcheck() */
+	apoly = strtop("313233343536373839", model->flags, 8);
+	crc = ptcrc(apoly, &tab, model->init, xorout, model->flags);
+	if(model->flags & P_REFOUT)
+		prev(&crc);
+	ok = !psncmp(&crc, &model->check);
+	pfree(&crc);
+	pfree(&apoly);
+
+	crc = ptcrc(xorout, &tab, pzero, pzero, model->flags);
+	if(model->flags & P_REFIN)
+		prev(&crc);
+	ok = ok && !psncmp(&crc, &model->magic);
+	pfree(&crc);
+
+	/* an odd-length pseudorandom message, with and without
+	 * augmentation
+	 */
+	apoly = prand(65537UL, &seed);
+	crc = ptcrc(apoly, &tab, model->init, xorout, model->flags);
+	ref = pcrc(apoly, model->spoly, model->init, xorout, model->flags, NULL);
+	ok = ok && !pcmp(&crc, &ref);
+	pfree(&crc);
+	pfree(&ref);
+	crc = ptcrc(apoly, &tab, model->init, xorout, model->flags & ~P_MULXN);
+	ref = pcrc(apoly, model->spoly, model->init, xorout, model->flags & ~P_MULXN, NULL);
+	ok = ok && !pcmp(&crc, &ref);
+	pfree(&crc);
+	pfree(&ref);
+
+	pfree(&apoly);
+	pfree(&xorout);
+	ptfree(&tab);
+	return(ok);
+}
+
+static int
+pbdtst(const model_t *model) {
+	/* Returns nonzero if pbdiv() agrees with pcrc() in every lane,
+	 * dividing a multiple of the generator of model by the run of
+	 * odd trial factors that includes the generator, as rscan()
+	 * would.
+	 */
+	poly_t full = PZERO, mult, dvnd, base, fac = PZERO, rem;
+	unsigned long width = plen(model->spoly), lanes, lg, j;
+	bmp_t seed = BMP_C(0x1b873593), mask;
+	int ok = 1;
+
+	/* as many lanes as fit in a word and leave a chopped term */
+	for(lanes = 1UL, lg = 0UL; (lanes << 1) <= (unsigned long) BMP_BIT && lg + 1UL < width; lanes <<= 1, ++lg)
+		;
+	palloc(&full, width + 1UL);
+	full.bitmap[0] = ~(~BMP_C(0) >> 1);
+	psum(&full, model->spoly, 1UL);
+	mult = prand(301UL, &seed);
+	dvnd = pmul(full, mult);
+	pnorm(&dvnd);
+	/* the even factor before the aligned run */
+	base = pclone(model->spoly);
+	pshift(&base, base, 0UL, 0UL, width - lg - 1UL, lg + 1UL);
+	mask = pbdiv(dvnd, base, lanes, NULL);
+	pcpy(&fac, base);
+	for(j = 0UL; j < lanes; ++j) {
+		piter(&fac);
+		rem = pcrc(dvnd, fac, pzero, pzero, 0, NULL);
+		if(!ptst(rem) != !!(mask & BMP_C(1) << j))
+			ok = 0;
+		pfree(&rem);
+		piter(&fac);
+	}
+	pfree(&fac);
+	pfree(&base);
+	pfree(&dvnd);
+	pfree(&mult);
+	pfree(&full);
+	return(ok);
+}
+
+static int
+pstmtst(const model_t *model) {
+	/* Returns nonzero if ptupdate() on a message cut at odd term
+	 * offsets, and ptrupdate() on octets cut at odd octet offsets,
+	 * give the CRC that ptcrc() gives on the whole message, with
+	 * and without augmentation.
+	 */
+	static const unsigned long cuts[] = {1UL, 3UL, 7UL, 61UL, 129UL, 1021UL};
+	ptab_t tab = PTZERO;
+	pstrm_t strm = PSZERO;
+	poly_t apoly, xorout, chunk, crc, ref;
+	unsigned char buffer[2053];
+	unsigned long iter, step, k;
+	bmp_t seed = BMP_C(0x68e31da4);
+	int flags, pass, ok = 1;
+
+	ptinit(&tab, model->spoly);
+	ptrinit(&tab);
+	xorout = pclone(model->xorout);
+	if(model->flags & P_REFOUT)
+		prev(&xorout);
+	apoly = prand(8191UL, &seed);
+	for(iter = 0UL; iter < sizeof(buffer); ++iter) {
+		seed = seed * BMP_C(1103515245) + BMP_C(12345);
+		buffer[iter] = (unsigned char) (seed >> 16 & BMP_C(0xff));
+	}
+	for(pass = 0; pass < 2; ++pass) {
+		flags = pass ? model->flags & ~P_MULXN : model->flags;
+
+		ptbegin(&strm, &tab, model->init, flags);
+		for(iter = 0UL, k = 0UL; iter < apoly.length; iter += step, ++k) {
+			step = cuts[k % (sizeof(cuts) / sizeof(cuts[0]))];
+			if(step > apoly.length - iter)
+				step = apoly.length - iter;
+			chunk = psubs(apoly, 0UL, iter, iter + step, 0UL);
+			ptupdate(&strm, chunk);
+			pfree(&chunk);
+		}
+		crc = ptfinal(&strm, xorout);
+		ref = ptcrc(apoly, &tab, model->init, xorout, flags);
+		ok = ok && !pcmp(&crc, &ref);
+		pfree(&crc);
+		pfree(&ref);
+
+		ptbegin(&strm, &tab, model->init, flags);
+		for(iter = 0UL, k = 0UL; iter < sizeof(buffer); iter += step, ++k) {
+			step = cuts[k % (sizeof(cuts) / sizeof(cuts[0]))];
+			if(step > sizeof(buffer) - iter)
+				step = sizeof(buffer) - iter;
+			ptrupdate(&strm, buffer + iter, step);
+		}
+		crc = ptfinal(&strm, xorout);
+		chunk = buftop(buffer, sizeof(buffer), flags, 8);
+		ref = ptcrc(chunk, &tab, model->init, xorout, flags);
+		ok = ok && !pcmp(&crc, &ref);
+		pfree(&chunk);
+		pfree(&crc);
+		pfree(&ref);
+	}
+	pfree(&apoly);
+	pfree(&xorout);
+	ptfree(&tab);
+	return(ok);
+}
+
+static int
+pcbtst(const model_t *model) {
+	/* Returns nonzero if pcomb() gives the CRC of A catenated with
+	 * B that pcrc() gives, for a long and a one-term B, and if
+	 * pxpow() gives the remainder of a power of x.
+	 */
+	static const unsigned long lens[] = {2011UL, 1UL};
+	poly_t apoly, bpoly, abpoly, crca, crcb, crc, ref, xpow;
+	unsigned long width = plen(model->spoly), power = width + 1000UL;
+	bmp_t seed = BMP_C(0x85ebca6b);
+	int i, ok = 1;
+
+	apoly = prand(1237UL, &seed);
+	crca = pcrc(apoly, model->spoly, model->init, model->xorout, P_MULXN, NULL);
+	for(i = 0; i < 2; ++i) {
+		bpoly = prand(lens[i], &seed);
+		abpoly = pclone(apoly);
+		psum(&abpoly, bpoly, plen(abpoly));
+		crcb = pcrc(bpoly, model->spoly, model->init, model->xorout, P_MULXN, NULL);
+		crc = pcomb(crca, crcb, plen(bpoly), model->spoly, model->init, model->xorout);
+		ref = pcrc(abpoly, model->spoly, model->init, model->xorout, P_MULXN, NULL);
+		ok = ok && !pcmp(&crc, &ref);
+		pfree(&ref);
+		pfree(&crc);
+		pfree(&crcb);
+		pfree(&abpoly);
+		pfree(&bpoly);
+	}
+	pfree(&crca);
+	pfree(&apoly);
+
+	/* x^power is a 1 followed by power - width zeroes, times x^width */
+	apoly = pzero;
+	palloc(&apoly, power - width + 1UL);
+	apoly.bitmap[0] = ~(~BMP_C(0) >> 1);
+	ref = pcrc(apoly, model->spoly, pzero, pzero, P_MULXN, NULL);
+	xpow = pxpow(power, model->spoly);
+	ok = ok && !pcmp(&xpow, &ref);
+	pfree(&xpow);
+	pfree(&ref);
+	pfree(&apoly);
+	return(ok);
+}
+
+static int
+pfctst(const model_t *model) {
+	/* Returns nonzero if pfactor() splits the square of the
+	 * generator of model, times x + 1, into factors in order of
+	 * degree whose product pmul() gives back.  Generators without
+	 * a + 1 term are passed over.
+	 */
+	poly_t full = PZERO, poly, prod = PZERO, next, *facs;
+	unsigned long width = plen(model->spoly), count, i;
+	int ok = 1;
+
+	if(!width || !pcoeff(model->spoly, width - 1UL))
+		return(1);
+	palloc(&full, width + 1UL);
+	full.bitmap[0] = ~(~BMP_C(0) >> 1);
+	psum(&full, model->spoly, 1UL);
+	poly = pmul(full, full);
+	/* x + 1 */
+	palloc(&full, 2UL);
+	full.bitmap[0] = ~(~BMP_C(0) >> 2);
+	next = pmul(poly, full);
+	pfree(&poly);
+	poly = next;
+
+	count = pfactor(&facs, poly, plen(poly) - 1UL);
+	palloc(&prod, 1UL);
+	prod.bitmap[0] = ~(~BMP_C(0) >> 1);
+	for(i = 0UL; i < count; ++i) {
+		if(plen(facs[i]) < 2UL || (i && plen(facs[i]) < plen(facs[i - 1UL])))
+			ok = 0;
+		next = pmul(prod, facs[i]);
+		pfree(&prod);
+		prod = next;
+		pfree(&facs[i]);
+	}
+	pmfree(facs);
+	ok = ok && count >= 3UL && !pcmp(&prod, &poly);
+	pfree(&prod);
+	pfree(&poly);
+	pfree(&full);
+	return(ok);
+}
+
+static poly_t
+prand(unsigned long length, bmp_t *seed) {
+	/* Returns a pseudorandom CLEAN poly of length terms, advancing
+	 * *seed.
+	 */
+	poly_t poly = PZERO;
+	unsigned long iter;
+
+	palloc(&poly, length);
+	for(iter = 0UL; iter < length; iter += BMP_BIT) {
+		*seed = *seed * BMP_C(1103515245) + BMP_C(12345);
+		poly.bitmap[iter / BMP_BIT] = *seed ^ *seed << 17;
+	}
+	pcanon(&poly);
+	return(poly);
+}
+
 void
 uerror(const char *msg) {
 	/* Callback function to report fatal errors */
@@ -0,0 +1,237 @@
+/* prof.c
+ * agent, 14/Oct/2026
+ */
+
+/* CRC RevEng: arbitrary-precision CRC calculator and algorithm finder
+ * Copyright (C) 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018,
+ * 2019, 2020, 2021, 2022  Gregory Cook
+ *
+ * This file is part of CRC RevEng.
+ *
+ * CRC RevEng is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * CRC RevEng is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with CRC RevEng.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/* 2026-10-14: started prof.c, counters for the profile build
+ */
+
+/* This file is only compiled by `make profile', which defines PROFILE
+ * in every file.  The primitives marked with PF_BEGIN and PF_END in
+ * poly.c and reveng.c then count their calls, the terms they process,
+ * the bytes they allocate and the ticks spent in them, callees
+ * included.  Each thread counts into its own block, and pfdump() sums
+ * the blocks to stderr at exit or, after SIGUSR1, at the next counted
+ * call.
+ * A tick is a processor cycle where GCC can read the time stamp
+ * counter, a count of the virtual timer on AArch64, and otherwise one
+ * tick of clock().  The counters themselves take some ticks, which
+ * weigh most on the shortest primitives such as getwrd().
+ */
+
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#  include <x86intrin.h>
+#  define PF_UNIT "cycles"
+#elif defined(__GNUC__) && defined(__aarch64__)
+#  define PF_UNIT "timer ticks"
+#else
+#  define PF_UNIT "clock() ticks"
+#endif
+#ifdef THREADS
+#  include <pthread.h>
+#endif /* THREADS */
+
+#include "reveng.h"
+
+/* Counters of one primitive */
+typedef struct {
+	unsigned long calls;	/* calls made */
+	double bits;		/* terms processed */
+	double bytes;		/* bytes allocated */
+	double ticks;		/* ticks spent, callees included */
+} pfctr_t;
+
+/* Counters of one thread, in a list of all threads */
+typedef struct pfblk {
+	struct pfblk *next;
+	pfctr_t ctr[PF_COUNT];
+} pfblk_t;
+
+static const char *const pfname[PF_COUNT] = {
+	"pcrcto", "ptcrc", "pbdiv", "psum", "pshift", "ppaste", "palloc",
+	"praloc", "getwrd", "modpol", "rtest", "dispch", "engini", "chkres"
+};
+
+static pfblk_t *pfhead = NULL;		/* blocks of all threads */
+static volatile sig_atomic_t pfsig = 0;	/* nonzero after SIGUSR1 */
+#ifdef THREADS
+static pthread_mutex_t pflock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_once_t pfonce = PTHREAD_ONCE_INIT;
+static pthread_key_t pfkey;
+#else
+static pfblk_t *pfmine = NULL;		/* block of the only thread */
+#endif /* THREADS */
+
+static pfblk_t *pfjoin(void);
+static void pfinit(void);
+#ifdef SIGUSR1
+static void pfcatch(int sig);
+#endif /* SIGUSR1 */
+
+unsigned long
+pftick(void) {
+	/* Returns the tick counter, wrapping modulo ULONG_MAX + 1. */
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+	return((unsigned long) __rdtsc());
+#elif defined(__GNUC__) && defined(__aarch64__)
+	unsigned long ticks;
+
+	__asm__ __volatile__("mrs %0, cntvct_el0" : "=r" (ticks));
+	return(ticks);
+#else
+	return((unsigned long) clock());
+#endif
+}
+
+void
+pfnote(int id, unsigned long bits, unsigned long bytes, unsigned long start) {
+	/* Adds a call of primitive id, processing bits terms and
+	 * allocating bytes bytes, begun when pftick() returned start,
+	 * to the calling thread's counters.  Dumps the counters if
+	 * SIGUSR1 has been received since the last dump.
+	 */
+	pfblk_t *mine;
+	pfctr_t *ctr;
+	unsigned long ticks = pftick() - start;
+
+#ifdef THREADS
+	pthread_once(&pfonce, pfinit);
+	if(!(mine = (pfblk_t *) pthread_getspecific(pfkey)) && !(mine = pfjoin()))
+		return;
+#else
+	if(!(mine = pfmine) && !(mine = pfjoin()))
+		return;
+#endif /* THREADS */
+	ctr = &mine->ctr[id];
+	++ctr->calls;
+	ctr->bits += (double) bits;
+	ctr->bytes += (double) bytes;
+	ctr->ticks += (double) ticks;
+	if(pfsig) {
+		pfsig = 0;
+		pfdump();
+	}
+}
+
+void
+pfdump(void) {
+	/* Prints the counters summed over all threads to stderr.
+	 * Registered with atexit() on the first counted call.
+	 * Counters of running threads are read as they stand.
+	 */
+	pfctr_t sum[PF_COUNT];
+	const pfblk_t *blk;
+	int id;
+
+	for(id = 0; id < PF_COUNT; ++id) {
+		sum[id].calls = 0UL;
+		sum[id].bits = sum[id].bytes = sum[id].ticks = 0.0;
+	}
+#ifdef THREADS
+	pthread_mutex_lock(&pflock);
+#endif /* THREADS */
+	for(blk = pfhead; blk; blk = blk->next)
+		for(id = 0; id < PF_COUNT; ++id) {
+			sum[id].calls += blk->ctr[id].calls;
+			sum[id].bits += blk->ctr[id].bits;
+			sum[id].bytes += blk->ctr[id].bytes;
+			sum[id].ticks += blk->ctr[id].ticks;
+		}
+#ifdef THREADS
+	pthread_mutex_unlock(&pflock);
+#endif /* THREADS */
+
+	fprintf(stderr, "reveng: profile, ticks are " PF_UNIT " including callees\n");
+	fprintf(stderr, "%-8s %12s %16s %16s %16s %10s\n", "function", "calls", "bits", "bytes", "ticks", "ticks/call");
+	for(id = 0; id < PF_COUNT; ++id)
+		if(sum[id].calls)
+			fprintf(stderr, "%-8s %12lu %16.0f %16.0f %16.0f %10.1f\n", pfname[id],
+				sum[id].calls, sum[id].bits, sum[id].bytes, sum[id].ticks,
+				sum[id].ticks / (double) sum[id].calls);
+	fflush(stderr);
+}
+
+static pfblk_t *
+pfjoin(void) {
+	/* Gives the calling thread a block of counters and adds it to
+	 * the list.  Without THREADS, calls pfinit() the first time.
+	 * Returns NULL if there is no memory, in which case the
+	 * thread's calls are not counted.
+	 */
+#ifndef THREADS
+	static int ready = 0;
+#endif /* THREADS */
+	pfblk_t *mine;
+
+#ifndef THREADS
+	if(!ready) {
+		ready = 1;
+		pfinit();
+	}
+#endif /* THREADS */
+	if(!(mine = (pfblk_t *) calloc(1, sizeof(pfblk_t))))
+		return(NULL);
+#ifdef THREADS
+	if(pthread_setspecific(pfkey, mine)) {
+		free(mine);
+		return(NULL);
+	}
+	pthread_mutex_lock(&pflock);
+	mine->next = pfhead;
+	pfhead = mine;
+	pthread_mutex_unlock(&pflock);
+#else
+	mine->next = pfhead;
+	pfhead = pfmine = mine;
+#endif /* THREADS */
+	return(mine);
+}
+
+static void
+pfinit(void) {
+	/* Registers pfdump() to run at exit and after SIGUSR1, and with
+	 * THREADS creates the key of the threads' blocks.  Blocks are kept until exit, so that
+	 * the calls of finished threads are still summed.
+	 */
+#ifdef THREADS
+	pthread_key_create(&pfkey, NULL);
+#endif /* THREADS */
+	atexit(pfdump);
+#ifdef SIGUSR1
+	signal(SIGUSR1, pfcatch);
+#endif /* SIGUSR1 */
+}
+
+#ifdef SIGUSR1
+static void
+pfcatch(int sig) {
+	/* Signal handler for SIGUSR1.  Asks the next counted call to
+	 * dump, as stdio cannot be used here.
+	 */
+	signal(sig, pfcatch);
+	pfsig = 1;
+}
+#endif /* SIGUSR1 */
@@ -23,6 +23,7 @@
 
 # Renumbers and relinks the elements of b32[], models[] and aliases[]
 # and generates initialising code for the large polynomial bitmaps
+# and the baked CRC tables
 # in file preset.c of CRC RevEng, to permit adding or deleting presets.
 # New elements can be referenced by a new alphanumeric tag wherever the
 # index number is to appear.  A string constant in place of an alias
@@ -36,6 +37,7 @@ use integer;
 
 until(($_ = <>) =~ /(?:aliases\+\s*\w+|\"[A-Z0-9\/-]+\")\s*},\s+\/\*\s*\w+\s*\*\//) {
 	if(m|/\*\s*CONSTANT\s+(\w+)\s*=\s*\((\d+)\s*,\s*((?:0x)?[0-9a-fA-F]+)\)\s*\*/|) {push @{$hash{$2}},$1,$3;}
+	if(/^\s+BMP_C\(0x([0-9A-Fa-f]{8})\) << \(BMP_BIT - 32\),\s+\/\*/) {$b32[$x] = hex($1);}
 	if(s/(^\s+BMP_C\(0x[0-9A-Fa-f]{8}\) << \(BMP_BIT - 32\),\s+\/\*)\s*(\w+)(.*$)/sprintf("%s%4d%s",$1,$x,$3)/e) {$x{$2} = $x++ || "0";}
 	if(m|/\*\s*END AUTO-GENERATED CONSTANTS\s*\*/|) {&bigbmp(\%hash); undef %hash; $blank = 0;}
 	unless($blank) {print $_;}
@@ -44,6 +46,7 @@ until(($_ = <>) =~ /(?:aliases\+\s*\w+|\"[A-Z0-9\/-]+\")\s*},\s+\/\*\s*\w+\s*\*\
 
 do {
 	s/b32\+\s*(\w+)/sprintf("b32+%3d",$x{$1})/eg;
+	if(/^\s*{\s*(\d+)UL,\s*b32\+\s*(\d+),/ && $1 > 0) {$baked{sprintf("%02d %08x", $1, $b32[$2])} = 1;}
 	if(s/(aliases\+\s*\w+|\"[A-Z0-9\/-]+\")(\s*},\s+\/\*)\s*(\w+)(\s*\*\/)/sprintf("%s%s%4d%s",$1,$2,$y,$4)/e){$y{$3} = $y++ || "0";}
 	push(@models,$_);
 } until(($_ = <>) =~ /(^\#\s*define\s+NPRESETS\s+)[1-9][0-9]*/);
@@ -67,7 +70,9 @@ print(@aliases);
 
 do {
 	s/(^\#\s*define\s+NALIASES\s+)[1-9][0-9]*/$1$z/;
-	print $_;
+	if(m|/\*\s*END AUTO-GENERATED TABLES\s*\*/|) {&baketab(\%baked); $blank = 0;}
+	unless($blank) {print $_;}
+	if(m|/\*\s*BEGIN AUTO-GENERATED TABLES\s*\*/|) {$blank = 1;}
 } while(defined(($_ = <>)));
 
 sub bigbmp (\%) {
@@ -119,6 +124,36 @@ sub bigbmp (\%) {
   }
 }
 
+sub baketab (\%) {
+  my ($hr) = @_;
+  my ($key, $width, $poly, $dvsr, $accu, $i, $j);
+  print "static const struct mbaked baked[] = {\n";
+  foreach $key (sort keys %$hr) {
+    ($width, $poly) = split(' ', $key);
+    $width += 0; $dvsr = hex($poly);
+    printf("\t{%2dUL, BT(0x%s), {\n", $width, $poly);
+    for($i = 0; $i < 256; ++$i) {
+      for($accu = $i << 24, $j = 0; $j < 8; ++$j) {
+        $accu = $accu & 0x80000000 ? ($accu << 1 & 0xffffffff) ^ $dvsr : $accu << 1;
+      }
+      printf("%sBT(0x%08x)%s", $i & 7 ? " " : "\t\t", $accu, $i & 7 ^ 7 ? "," : $i ^ 255 ? ",\n" : "\n");
+    }
+    print "\t}, {\n";
+    # x^d mod the generator for the folding kernels, see clmul.c
+    $j = 0;
+    foreach (512, 576, 384, 448, 256, 320, 128, 192) {
+      for($accu = 1, $i = $_; $i; --$i) {
+        $accu <<= 1;
+        $accu ^= 1 << $width | $dvsr >> 32 - $width if $accu >> $width;
+      }
+      printf("%sBMP_C(0x%08x)%s", $j & 3 ? " " : "\t\t", $accu, ++$j & 3 ? "," : $j ^ 8 ? ",\n" : "\n");
+    }
+    print "\t}},\n";
+  }
+  print "};\n";
+  printf("#    define NBAKED %d\n", scalar(keys %$hr));
+}
+
 sub myhex ($) {
   my ($bin) = @_;
   return(substr(unpack("H*",pack("B*","0"x(-length($bin)&7).$bin)),((length($bin)+3)&4)>>2));
@@ -22,7 +22,27 @@
  * along with CRC RevEng.  If not, see <https://www.gnu.org/licenses/>.
  */
 
-/* 2021-12-31: modpol() passes only GCD to reveng()
+/* 2026-10-14: a failed reveng() frees the storage it allocated
+ * 2026-10-14: no progress report past the end of the range
+ * 2026-10-14: rwork() keeps its trap and scratch out of the setjmp() frame
+ * 2026-10-14: reveng() traps errors around rbody(), no locals clobbered
+ * 2026-10-14: only the first shard solves models found without searching
+ * 2026-10-14: search primitives counted in the profile build
+ * 2026-10-14: trial factors divided on an OpenCL device with offload
+ * 2026-10-14: -Z lists generators by factorising the GCD, parity sieve
+ * 2026-10-14: search folds new arguments into an earlier GCD, rechecks
+ *	       earlier generators
+ * 2026-10-14: chkres() tries the shortest argument first, caches residues
+ * 2026-10-14: search keeps counters and stage times in rctx_t
+ * 2026-10-14: modpol() takes O(args) differences, exits early
+ * 2026-10-14: engini() solves on a dense GF(2) matrix, one XOR per Init
+ * 2026-10-14: candidate generators solved from a queue by any thread
+ * 2026-10-14: reveng() reports through rctx_t callbacks, traps errors
+ * 2026-10-14: search reuses scratch polys and chunk records
+ * 2026-10-14: batches of trial factors divided bit-sliced
+ * 2026-10-14: search range divided into shards
+ * 2026-10-14: trial factors searched in chunks, on several threads
+ * 2021-12-31: modpol() passes only GCD to reveng()
  * 2019-12-07: skip equivalent forms
  * 2019-04-30: brute-force short factor if shortest diff <= 2n
  * 2013-09-16: calini(), calout() work on shortest argument
@@ -51,40 +71,345 @@
  * It is more effective to search for each shorter width directly.
  */
 
+#include <setjmp.h>
 #include <stdlib.h>
+#include <time.h>
+#ifdef THREADS
+#  include <pthread.h>
+#  define LOCK(s)   pthread_mutex_lock(&(s)->lock)
+#  define UNLOCK(s) pthread_mutex_unlock(&(s)->lock)
+#else
+#  define LOCK(s)
+#  define UNLOCK(s)
+#endif /* THREADS */
 
 #define FILE void
 #include "reveng.h"
 
-static poly_t modpol(const poly_t init, int rflags, int args, const poly_t *argpolys);
-static void dispch(const model_t *guess, int *resc, model_t **result, const poly_t divisor, int rflags, int args, const poly_t *argpolys);
-static void engini(int *resc, model_t **result, const poly_t divisor, int flags, int args, const poly_t *argpolys);
-static void calout(int *resc, model_t **result, const poly_t divisor, const poly_t init, int flags, int args, const poly_t *argpolys);
-static void calini(int *resc, model_t **result, const poly_t divisor, int flags, const poly_t xorout, int args, const poly_t *argpolys);
-static void chkres(int *resc, model_t **result, const poly_t divisor, const poly_t init, int flags, const poly_t xorout, int args, const poly_t *argpolys);
+/* An error trap.  rtpush() makes it the innermost trap of the
+ * calling thread; rthrow() pops it and jumps to its setjmp().
+ */
+typedef struct rtrap {
+	jmp_buf env;
+	struct rtrap *outer;	/* enclosing trap of the same thread */
+	const char *msg;	/* error message passed to rthrow() */
+	int held;		/* nonzero while the search lock is held */
+	plog_t *log;		/* ledger opened within the trap, or NULL */
+	plog_t *cur;		/* ledger of the thread at rtpush() */
+} rtrap_t;
+
+/* Each chunk of the trial factor search varies the lowest R_CBITS
+ * terms of the factor, so holds up to 2^(R_CBITS-1) odd factors.
+ */
+#define R_CBITS 12UL
+
+/* Each search thread adds room for R_QPER candidates to the queue
+ * of generators awaiting Init and XorOut.
+ */
+#define R_QPER 4
+
+/* rfactr() lists at most RFMAX generators; beyond that the trial
+ * factor search is quicker than solving them all.
+ */
+#define RFMAX 65536UL
+
+/* A worker with an OpenCL device claims R_OBATCH chunks, a million
+ * trial factors, to divide in one launch.
+ */
+#define R_OBATCH 512UL
+
+/* A candidate generator found in a chunk.  It is solved on the
+ * thread that takes it from the queue, or on the finding thread if
+ * the queue is full.
+ */
+typedef struct rcand {
+	struct rcand *next;	/* next candidate of the chunk, in factor order */
+	struct rcand *qnext;	/* next candidate in the queue */
+	struct rchnk *chunk;	/* chunk the candidate was found in */
+	poly_t gpoly;		/* candidate generator */
+	int resc;		/* models found for the candidate */
+	model_t *result;
+} rcand_t;
+
+/* A claimed chunk of the trial factor range */
+typedef struct rchnk {
+	struct rchnk *next;	/* next chunk in claim order */
+	poly_t start;		/* even trial factor preceding the chunk */
+	unsigned long count;	/* number of odd trial factors in chunk */
+	unsigned long first;	/* index of first factor within chunk */
+	int whole;		/* nonzero if chunk precedes range end */
+	unsigned long spin;	/* number of trial factors tested */
+	int done;		/* nonzero once the chunk is searched */
+	int resc;		/* models found in the chunk */
+	model_t *result;
+	rcand_t *cands, *ctail;	/* candidates found in the chunk */
+	int pending;		/* queued candidates not yet solved */
+	unsigned long divs;	/* divisions of the GCD */
+	unsigned long ncands;	/* number of candidates found */
+} rchnk_t;
+
+/* State of a trial factor search, shared between threads */
+typedef struct {
+	const model_t *guess;	/* partial model being completed */
+	const poly_t *argpolys;	/* argument list */
+	int args, rflags;
+	poly_t pwork;		/* GCD of the differences */
+	poly_t qqpoly;		/* range end polynomial */
+	poly_t next;		/* even trial factor preceding next chunk */
+	int more;		/* nonzero while chunks remain to claim */
+	unsigned long shard;	/* index of the chunks to search, modulo */
+	unsigned long shards;	/* number of shards */
+	unsigned long cidx;	/* index of the next chunk, modulo shards */
+	unsigned long lanes;	/* factors per batch division, or 0 */
+	int parity;		/* nonzero if factors of odd chopped weight cannot divide */
+	ocl_t *ocl;		/* device for the first worker to take it, or NULL */
+	rchnk_t *head, *tail;	/* claimed chunks not yet reported */
+	rchnk_t *spare;		/* reported chunks, for reuse */
+	poly_t ones;		/* R_CBITS ones, to step chunks */
+	unsigned long spin;	/* trial factors tested in reported chunks */
+	unsigned long prog;	/* value of spin at the last progress report */
+	unsigned long pseq;	/* progress report sequence number */
+	int resc;		/* models reported */
+	model_t *result;
+	rctx_t *ctx;		/* callbacks and cancellation, or NULL */
+	plog_t *log;		/* ledger of the reveng() call, or NULL */
+	const char *error;	/* first error met by a worker, or NULL */
+	rcand_t *qhead, *qtail;	/* candidates awaiting a solver */
+	int queued, qmax;	/* length and capacity of the queue */
+	rcand_t *cspare;	/* solved candidates, for reuse */
+	unsigned long every;	/* trial factors between progress reports */
+	double beg, end;	/* positions of the range ends, see rpos() */
+	clock_t cpu;		/* processor time at the start of the search */
+	time_t wall;		/* time at the start of the search */
+	rstat_t stat;		/* statistics, copied to ctx */
+#ifdef THREADS
+	pthread_mutex_t lock;
+#endif /* THREADS */
+} rsrch_t;
+
+/* A dense matrix over GF(2), for engini().  Each row is a bit
+ * vector of stride words, MSB first as in a poly_t, and the rows
+ * are contiguous, so that a row operation is a run of word XORs
+ * which compilers can vectorise.
+ */
+typedef struct {
+	bmp_t *words;		/* rows, stride words apart */
+	unsigned long stride;	/* words per row */
+	unsigned long size;	/* words allocated */
+} rmat_t;
+
+#define RMZERO {(bmp_t *) 0, 0UL, 0UL}
+
+/* Residues of the arguments for chkres(), shortest argument first.
+ * For a generator of at most BMP_BIT terms, the entry of each
+ * argument holds a flag, the argument's CRC with zero Init and
+ * XorOut, and the contribution of each Init term to the CRC.  The
+ * CRC is linear in Init, so once the entry is made a further Init
+ * and XorOut cost one word XOR per term of Init.  Entries are only
+ * made on the second call with a generator, as most generators
+ * are checked once and rejected by their shortest argument.
+ */
+typedef struct {
+	const poly_t *args;	/* argument list of order */
+	const poly_t **order;	/* arguments, shortest first */
+	bmp_t *ents;		/* entries, RESTR words apart */
+	poly_t divisor;		/* generator of the entries */
+	poly_t unit;		/* Init of the last term only */
+	unsigned long calls;	/* chkres() calls with divisor */
+} rres_t;
+
+#define RRZERO {NULL, NULL, NULL, PZERO, PZERO, 0UL}
+
+/* words per rres_t entry */
+#define RESTR (BMP_BIT + 2UL)
+
+/* number of words holding n terms */
+#define RSIZE(n) (((n) + BMP_BIT - 1UL) / BMP_BIT)
+/* term j of the bit vector v */
+#define RBIT(v, j) ((v)[(j) / BMP_BIT] >> (BMP_BIT - 1UL - (j) % BMP_BIT) & BMP_C(1))
+/* toggles term j of the bit vector v */
+#define RFLIP(v, j) ((v)[(j) / BMP_BIT] ^= BMP_C(1) << (BMP_BIT - 1UL - (j) % BMP_BIT))
+
+/* Scratch polynomials for one search thread.  Each is reused from
+ * one trial to the next, so that a search in progress seldom needs
+ * the heap.
+ */
+typedef struct {
+	poly_t factor;		/* trial factor */
+	poly_t gpoly;		/* generator, from a cofactor */
+	poly_t rem;		/* remainder of trial division */
+	poly_t regs;		/* pbdiv() registers */
+	poly_t crc;		/* chkres() remainder */
+	poly_t xor;		/* chkres() reflected XorOut */
+	poly_t xorout;		/* calout() XorOut */
+	poly_t init;		/* calini() and engini() Init */
+	poly_t arg;		/* calini() reversed argument */
+	poly_t rcpdiv;		/* calini() reciprocal divisor */
+	poly_t rxor;		/* calini() mirrored XorOut */
+	rmat_t mat;		/* engini() matrix */
+	rres_t res;		/* chkres() argument residues */
+	unsigned long solves;	/* engini() calls not yet counted in the search */
+	unsigned long rejects;	/* chkres() rejections not yet counted */
+} rscr_t;
+
+#define RCZERO {PZERO, PZERO, PZERO, PZERO, PZERO, PZERO, PZERO, PZERO, PZERO, PZERO, PZERO, RMZERO, RRZERO, 0UL, 0UL}
+
+#define RSZERO {NULL, NULL, 0, 0, PZERO, PZERO, PZERO, 0, 0UL, 1UL, 0UL, 0UL, 0, NULL, NULL, NULL, NULL, PZERO, 0UL, 0UL, 0UL, 0, NULL, NULL, NULL, NULL, NULL, NULL, 0, 0, NULL, R_SPMASK + 1UL, 0.0, 1.0, 0, 0, RSTZERO}
+
+static poly_t modpol(const poly_t init, unsigned long width, int rflags, int args, const poly_t *argpolys, int olds, const poly_t start);
+static poly_t moddif(const poly_t init, int rflags, const poly_t a, const poly_t b);
+static int modgcd(poly_t *gcd, poly_t work, ptab_t *tab, unsigned long width);
+static int rfactr(poly_t **cands, unsigned long *count, const poly_t pwork, unsigned long width, int rflags);
+static void rfenum(poly_t *cands, unsigned long *count, const poly_t *facs, unsigned long nfacs, unsigned long first, const poly_t prod, unsigned long deg);
+static int rfcmp(const void *a, const void *b);
+static void dispch(rscr_t *scr, const model_t *guess, int *resc, model_t **result, const poly_t divisor, int rflags, int args, const poly_t *argpolys);
+static void engini(rscr_t *scr, int *resc, model_t **result, const poly_t divisor, int flags, int args, const poly_t *argpolys);
+static void calout(rscr_t *scr, int *resc, model_t **result, const poly_t divisor, const poly_t init, int flags, int args, const poly_t *argpolys);
+static void calini(rscr_t *scr, int *resc, model_t **result, const poly_t divisor, int flags, const poly_t xorout, int args, const poly_t *argpolys);
+static void chkres(rscr_t *scr, int *resc, model_t **result, const poly_t divisor, const poly_t init, int flags, const poly_t xorout, int args, const poly_t *argpolys);
+static void rsorder(rres_t *res, int args, const poly_t *argpolys);
+static void rsent(rscr_t *scr, bmp_t *ent, const poly_t arg, const poly_t divisor);
+static void rsfree(rscr_t *scr);
+static unsigned long rfirst(const bmp_t *vec, unsigned long len);
+static void rxor(bmp_t *dest, const bmp_t *src, unsigned long stride);
+static void rsolve(bmp_t *vec, const bmp_t *rows, unsigned long dlen, unsigned long stride, unsigned long free);
+static void rthrds(rsrch_t *srch, int threads);
+static void rwork(rsrch_t *srch);
+static void rwtry(rsrch_t *srch, rscr_t *scr, rtrap_t *trap, ocl_t *ocl);
+static void rwloop(rsrch_t *srch, rscr_t *scr, rtrap_t *trap, ocl_t *ocl);
+static rchnk_t *rclaim(rsrch_t *srch, rtrap_t *trap);
+static unsigned long rstep(rsrch_t *srch, unsigned long *first);
+static void rscan(rsrch_t *srch, rscr_t *scr, rtrap_t *trap, rchnk_t *chunk);
+static void rtest(rsrch_t *srch, rscr_t *scr, rtrap_t *trap, rchnk_t *chunk);
+static int roffl(rsrch_t *srch, rscr_t *scr, rtrap_t *trap, ocl_t **ocl);
+static void rqueue(rsrch_t *srch, rscr_t *scr, rtrap_t *trap, rchnk_t *chunk, const poly_t gpoly);
+static rcand_t *rtake(rsrch_t *srch, rtrap_t *trap);
+static void rpost(rsrch_t *srch, rscr_t *scr, rtrap_t *trap, rchnk_t *chunk, rcand_t *cand);
+static void rstats(rsrch_t *srch, const poly_t pos);
+static double rpos(const poly_t poly);
+static int rodd(const poly_t poly);
+static void rtime(rstat_t *stat, int stage, clock_t cpu, time_t wall);
+static void rmove(rsrch_t *srch, int *resc, model_t **result);
+static void rdrop(int *resc, model_t **result);
+static void rsdrop(rsrch_t *srch);
+static void rfound(const rctx_t *ctx, const model_t *model);
+static void rprog(const rctx_t *ctx, const poly_t gpoly, int flags, unsigned long seq);
+static void rtpush(rtrap_t *trap);
+static void rtpop(rtrap_t *trap);
+static void rtdrop(rtrap_t *trap, rctx_t *ctx);
+static model_t *rtry(rtrap_t *trap, const model_t *guess, const poly_t qpoly, int rflags, int args, const poly_t *argpolys, rctx_t *ctx);
+static model_t *rbody(const model_t *guess, const poly_t qpoly, int rflags, int args, const poly_t *argpolys, rctx_t *ctx);
+
+#ifdef THREADS
+static void rtinit(void);
+
+static pthread_key_t rtkey;	/* innermost trap of each thread */
+static pthread_once_t rtonce = PTHREAD_ONCE_INIT;
+static int rtkok = 0;		/* nonzero if rtkey was created */
+#else
+static rtrap_t *rttop = NULL;	/* innermost trap */
+#endif /* THREADS */
 
 static const poly_t pzero = PZERO;
 
 model_t *
-reveng(const model_t *guess, const poly_t qpoly, int rflags, int args, const poly_t *argpolys) {
-	/* Complete the parameters of a model by calculation or brute search. */
-	poly_t pwork, rem = PZERO, factor = PZERO, gpoly = PZERO, qqpoly = PZERO;
+reveng(const model_t *guess, const poly_t qpoly, int rflags, int args, const poly_t *argpolys, rctx_t *ctx) {
+	/* Complete the parameters of a model by calculation or brute search.
+	 * If ctx is not NULL, its callbacks replace ufound() and uprog()
+	 * and its status is set on return.  If uerror() passes an
+	 * error to rthrow(), reveng() returns NULL with R_ERROR status
+	 * and the storage it allocated is freed, except that of
+	 * ctx->gcd and of the preset index.  If ctx->cancel is set
+	 * during a search, the models found so far are returned with
+	 * R_CANCEL.
+	 * Models found other than by the trial factor search are only
+	 * solved in the first shard, so that merged shards list them
+	 * once.
+	 * The trap is kept here and the work is done by rbody() within
+	 * rtry(), so that no local of the frame that calls setjmp() is
+	 * changed before the jump.
+	 */
+	rtrap_t trap;
+
+	return(rtry(&trap, guess, qpoly, rflags, args, argpolys, ctx));
+}
+
+static model_t *
+rtry(rtrap_t *trap, const model_t *guess, const poly_t qpoly, int rflags, int args, const poly_t *argpolys, rctx_t *ctx) {
+	/* Calls rbody() for reveng() within trap.  If an error is
+	 * thrown, sets R_ERROR status and returns NULL.  The storage
+	 * rbody() allocates is entered in a ledger, which is dropped
+	 * if it fails and otherwise closed, leaving the storage to
+	 * the caller.
+	 */
+	model_t *result;
+
+	rtpush(trap);
+	if(setjmp(trap->env)) {
+		if(ctx) {
+			ctx->status = R_ERROR;
+			ctx->error = trap->msg;
+		}
+		rtdrop(trap, ctx);
+		return(NULL);
+	}
+	if(!(trap->log = plopen()))
+		uerror("cannot allocate storage ledger");
+	result = rbody(guess, qpoly, rflags, args, argpolys, ctx);
+	rtpop(trap);
+	if(result)
+		plclose(trap->log, 0);
+	else
+		rtdrop(trap, ctx);
+	return(result);
+}
+
+static model_t *
+rbody(const model_t *guess, const poly_t qpoly, int rflags, int args, const poly_t *argpolys, rctx_t *ctx) {
+	/* Does the work of reveng(), which see, within its error trap.
+	 * Returns NULL with R_ERROR status if a search worker failed.
+	 */
+	poly_t pwork, rem = PZERO, factor = PZERO, gpoly = PZERO, qqpoly = PZERO, *cands;
 	model_t *result = NULL, *rptr;
 	int resc = 0;
-	unsigned long spin = 0, seq = 0;
+	rsrch_t srch = RSZERO;
+	rscr_t scr = RCZERO;
+	rchnk_t *chunk;
+	rcand_t *cand;
+	ocl_t *ocl;
+	unsigned long i, lg;
+	clock_t cpu = clock();
+	time_t wall = time(NULL);
+	const int lead = !ctx || !ctx->shard;
+
+	if(ctx) {
+		ctx->status = R_OK;
+		ctx->error = NULL;
+		ctx->stat = srch.stat;
+	}
 
 	if(rflags & R_HAVEP) {
 		/* The poly is known.  Engineer, calculate or return
 		 * Init and XorOut.
 		 */
-		dispch(guess, &resc, &result, guess->spoly, rflags, args, argpolys);
+		if(lead)
+			dispch(&scr, guess, &resc, &result, guess->spoly, rflags, args, argpolys);
+		rtime(&srch.stat, R_SSOLV, cpu, wall);
+		for(rptr = result; rptr < result + resc; ++rptr)
+			rfound(ctx, rptr);
 	} else {
 		/* The poly is not known.
 		 * Produce the GCD of all differences between the arguments.
 		 */
 		if(!plen(guess->spoly))
 			goto requit;
-		pwork = modpol(guess->init, rflags, args, argpolys);
+		if(ctx && ctx->gcd)
+			pwork = modpol(guess->init, plen(guess->spoly), rflags, args, argpolys, ctx->olds, *ctx->gcd);
+		else
+			pwork = modpol(guess->init, plen(guess->spoly), rflags, args, argpolys, 0, pzero);
+		if(ctx && ctx->gcd)
+			pcpy(ctx->gcd, pwork);
+		rtime(&srch.stat, R_SGCD, cpu, wall);
 		/* If too short a difference is returned, there is nothing to do. */
 		if(plen(pwork) < plen(guess->spoly) + 1UL)
 			goto rpquit;
@@ -99,9 +424,66 @@ reveng(const model_t *guess, const poly_t qpoly, int rflags, int args, const pol
 			 * as differences come normalized from modpol().
 			 */
 			pshift(&gpoly,gpoly, 0UL, 1UL, plen(gpoly), 0UL); /* plen(gpoly) >= 1 */
-			dispch(guess, &resc, &result, gpoly, rflags, args, argpolys);
+			cpu = clock();
+			wall = time(NULL);
+			if(lead)
+				dispch(&scr, guess, &resc, &result, gpoly, rflags, args, argpolys);
+			rtime(&srch.stat, R_SSOLV, cpu, wall);
+			for(rptr = result; rptr < result + resc; ++rptr)
+				rfound(ctx, rptr);
 			goto rpquit;
 		}
+		if(ctx && ctx->gens >= 0) {
+			/* The arguments include those of an earlier search,
+			 * so only generators it solved can solve them all.
+			 * Solve those that still divide the GCD.
+			 */
+			cpu = clock();
+			wall = time(NULL);
+			for(i = 0UL; lead && i < (unsigned long) ctx->gens; ++i) {
+				if(plen(ctx->gpolys[i]) != plen(guess->spoly))
+					continue;
+				pcrcto(&rem, pwork, ctx->gpolys[i], pzero, pzero, 0, NULL);
+				++srch.stat.divs;
+				if(ptst(rem))
+					continue;
+				++srch.stat.cands;
+				dispch(&scr, guess, &resc, &result, ctx->gpolys[i], rflags, args, argpolys);
+			}
+			rtime(&srch.stat, R_SSOLV, cpu, wall);
+			srch.stat.done = 1.0;
+			for(rptr = result; rptr < result + resc; ++rptr)
+				rfound(ctx, rptr);
+			goto rpquit;
+		}
+		if(ctx && ctx->sieve && !ptst(guess->spoly) && ~rflags & R_HAVEQ && ctx->shards <= 1UL) {
+			/* The whole range is to be searched, so instead
+			 * list the generators dividing the GCD from its
+			 * factors, unless there are too many.
+			 */
+			cpu = clock();
+			wall = time(NULL);
+			rflags &= ~R_SHORT;
+			if(plen(pwork) <= plen(guess->spoly) << 1)
+				rflags |= R_SHORT;
+			if(rfactr(&cands, &i, pwork, plen(guess->spoly), rflags)) {
+				rprog(ctx, guess->spoly, guess->flags, 0UL);
+				for(lg = 0UL; lg < i && !ctx->cancel; ++lg)
+					dispch(&scr, guess, &resc, &result, cands[lg], rflags, args, argpolys);
+				srch.stat.factors = srch.stat.cands = lg;
+				if(ctx->cancel)
+					ctx->status = R_CANCEL;
+				else
+					srch.stat.done = 1.0;
+				while(i)
+					pfree(&cands[--i]);
+				pmfree(cands);
+				rtime(&srch.stat, R_SSRCH, cpu, wall);
+				for(rptr = result; rptr < result + resc; ++rptr)
+					rfound(ctx, rptr);
+				goto rpquit;
+			}
+		}
 		/* Otherwise initialise the trial factor to the starting value. */
 		factor = pclone(guess->spoly);
 		if(rflags & R_HAVEQ)
@@ -146,42 +528,82 @@ reveng(const model_t *guess, const poly_t qpoly, int rflags, int args, const pol
 		pshift(&factor, factor, 0UL, 0UL, plen(factor) - 1UL, 1UL);
 
 		/* plen(factor) >= 1 */
-		while(piter(&factor) && (~rflags & R_HAVEQ || pcmp(&factor, &qqpoly) < 0)) {
-			/* For each possible poly of this size, try
-			 * dividing the GCD of the differences.
-			 */
-			if(!(spin++ & R_SPMASK)) {
-				uprog(factor, guess->flags, seq++);
-			}
-			if(rflags & R_SHORT) {
-				/* test whether cofactor divides the GCD */
-				rem = pcrc(pwork, factor, pzero, pzero, 0, NULL);
-				if(!ptst(rem)) {
-					pfree(&rem);
-					/* repeat division to get generator polynomial
-					 * then test generator against other differences
-					 */
-					rem = pcrc(pwork, factor, pzero, pzero, 0, &gpoly);
-					/* chop generator and ensure + 1 term */
-					pshift(&gpoly,gpoly,0UL,1UL,plen(gpoly) - 1UL,1UL);
-					piter(&gpoly); /* plen(gpoly) >= 1 */
-				}
-			} else {
-				/* straight divide message by poly, don't multiply by x^n */
-				rem = pcrc(pwork, factor, pzero, pzero, 0, 0);
-			}
-			/* If factor divides all the differences, it is a
-			 * candidate.  Search for an Init value for this
-			 * poly or if Init is known, log the result.
-			 */
-			if(!ptst(rem)) {
-				/* gpoly || factor is a candidate poly */
-				dispch(guess, &resc, &result, (rflags & R_SHORT) ? gpoly : factor, rflags, args, argpolys);
-			}
-			pfree(&rem);
-			if(!piter(&factor))
-				break;
+		/* Scan the trial factors in chunks, on as many threads
+		 * as have been requested.
+		 */
+		srch.guess = guess;
+		srch.args = args;
+		srch.argpolys = argpolys;
+		srch.rflags = rflags;
+		srch.pwork = pwork;
+		srch.qqpoly = qqpoly;
+		srch.next = factor;
+		srch.more = 1;
+		srch.ctx = ctx;
+		srch.log = plget();
+		palloc(&srch.ones, R_CBITS);
+		pinv(&srch.ones);
+		/* Find which shard the first chunk belongs to.  Chunk
+		 * i of the whole range, counting from 0, is in shard
+		 * i modulo the number of shards.
+		 */
+		if(ctx && ctx->shards > 1UL && ctx->shard < ctx->shards) {
+			srch.shard = ctx->shard;
+			srch.shards = ctx->shards;
+			for(i = 0UL; i + R_CBITS < plen(factor); ++i)
+				srch.cidx = ((srch.cidx << 1) + pcoeff(factor, i)) % srch.shards;
+		}
+		/* Divide by as many factors at once as fit in a word
+		 * and in a chunk, varying the terms above the + 1 term.
+		 */
+		for(i = 1UL, lg = 2UL; (i << 1) <= (unsigned long) BMP_BIT && lg <= R_CBITS && lg <= plen(factor); i <<= 1, ++lg)
+			;
+		if(i > 1UL)
+			srch.lanes = i;
+		/* A GCD of odd weight has no factor of even weight, nor
+		 * a trial factor of odd weight once its top term is
+		 * chopped, so those need not be divided.
+		 */
+		srch.parity = rodd(pwork);
+		if(ctx && ctx->every)
+			srch.every = ctx->every;
+		srch.beg = rpos(factor);
+		if(rflags & R_HAVEQ)
+			srch.end = rpos(qqpoly);
+		srch.cpu = clock();
+		srch.wall = time(NULL);
+		rstats(&srch, factor);
+		rprog(ctx, factor, guess->flags, srch.pseq++);
+		if(ctx && ctx->offload)
+			srch.ocl = oclopen(pwork, plen(factor));
+		ocl = srch.ocl;
+		rthrds(&srch, ctx ? ctx->threads : 1);
+		oclfree(ocl);
+		factor = srch.next;
+		rstats(&srch, srch.next);
+		if(!(ctx && ctx->cancel))
+			srch.stat.done = 1.0;
+		result = srch.result;
+		resc = srch.resc;
+		if(srch.error) {
+			/* keep the error, discard all the models */
+			rsdrop(&srch);
+			result = NULL;
+			resc = 0;
+		} else if(ctx && ctx->cancel)
+			ctx->status = R_CANCEL;
+		pfree(&srch.ones);
+		while((chunk = srch.spare)) {
+			srch.spare = chunk->next;
+			pfree(&chunk->start);
+			pmfree(chunk);
+		}
+		while((cand = srch.cspare)) {
+			srch.cspare = cand->next;
+			pfree(&cand->gpoly);
+			pmfree(cand);
 		}
+
 		/* Finished with factor and the GCD, free them.
 		 */
 rpquit:
@@ -193,7 +615,20 @@ rpquit:
 	}
 
 requit:
-	if(!(result = realloc(result, ++resc * sizeof(model_t))))
+	rsfree(&scr);
+	srch.stat.solves += scr.solves;
+	srch.stat.rejects += scr.rejects;
+	srch.stat.models = (unsigned long) resc;
+	if(ctx)
+		ctx->stat = srch.stat;
+	if(srch.error) {
+		if(ctx) {
+			ctx->status = R_ERROR;
+			ctx->error = srch.error;
+		}
+		return(NULL);
+	}
+	if(!(result = prealloc(result, ++resc * sizeof(model_t))))
 		uerror("cannot reallocate result array");
 	rptr = result + resc - 1;
 	rptr->spoly  = pzero;
@@ -207,10 +642,33 @@ requit:
 	return(result);
 }
 
+void
+rthrow(const char *msg) {
+	/* Passes msg to the innermost error trap of the calling thread,
+	 * that is, to a reveng() call in progress, and does not return.
+	 * Returns if the thread has no trap.  A uerror() that lets
+	 * reveng() return errors calls rthrow() before exiting.
+	 */
+	rtrap_t *trap;
+
+#ifdef THREADS
+	if(pthread_once(&rtonce, rtinit) || !rtkok
+		|| !(trap = (rtrap_t *) pthread_getspecific(rtkey)))
+		return;
+#else
+	if(!(trap = rttop))
+		return;
+#endif /* THREADS */
+	rtpop(trap);
+	plset(trap->cur);
+	trap->msg = msg;
+	longjmp(trap->env, 1);
+}
+
 /* Private functions */
 
 static poly_t
-modpol(const poly_t init, int rflags, int args, const poly_t *argpolys) {
+modpol(const poly_t init, unsigned long width, int rflags, int args, const poly_t *argpolys, int olds, const poly_t start) {
 	/* Produce the greatest common divisor (GCD) of differences
 	 * between pairs of arguments in argpolys[0..args-1].
 	 * If R_HAVEI is not set in rflags, only pairs of equal length are
@@ -218,84 +676,251 @@ modpol(const poly_t init, int rflags, int args, const poly_t *argpolys) {
 	 * Otherwise, sums of right-aligned pairs are included, with
 	 * the supplied init poly added to the leftmost terms of each
 	 * poly of the pair.
+	 * As the difference of any two arguments is the sum of their
+	 * differences from a third, only the differences from the first
+	 * argument of each length, or with R_HAVEI the first argument,
+	 * are taken.  Once the GCD is shorter than width + 1 terms it
+	 * cannot contain a generator, and is returned at once.
+	 * The differences between the first olds arguments are taken
+	 * to be in start, which is the GCD of none if empty; only
+	 * pairs with a later argument are summed into it.
 	 */
-	poly_t gcd = PZERO, work, rem;
-	const poly_t *aptr, *bptr, *const eptr = argpolys + args;
-	unsigned long alen, blen;
-	unsigned int nogcd = 2U;
-
-	if(args < 2) return(gcd);
-
-	for(aptr = argpolys; aptr < eptr; ++aptr) {
-		alen = plen(*aptr);
-		for(bptr = aptr + 1; bptr < eptr; ++bptr) {
-			blen = plen(*bptr);
-			if(alen == blen) {
-				work = pclone(*aptr);
-				psum(&work, *bptr, 0UL);
-			} else if(rflags & R_HAVEI && alen < blen) {
-				work = pclone(*bptr);
-				psum(&work, *aptr, blen - alen);
-				psum(&work, init, 0UL);
-				psum(&work, init, blen - alen);
-			} else if(rflags & R_HAVEI /* && alen > blen */) {
-				work = pclone(*aptr);
-				psum(&work, *bptr, alen - blen);
-				psum(&work, init, 0UL);
-				psum(&work, init, alen - blen);
-			} else
-				work = pzero;
-
-			if(plen(work))
-				pnorm(&work);
-			if(plen(work)) {
-				/* combine work with running gcd */
-				if((nogcd >>= 1)) /* true first time only */
-					pcpy(&gcd, work);
-				else do {
-					/* ptst(gcd) != 0 */
-
-					/* optimisation which also accounts
-					 * for the way pmod() works.
-					 * this emulates one iteration of
-					 * a correct loop whereby
-					 * (short, long) -> (long, short)
-					 * since
-					 * poly_mod(short, long) == short
-					 * whereas pmod() left-aligns operands
-					 */
-					if(plen(gcd) < plen(work)) {
-						rem = gcd;
-						gcd = work;
-						work = rem;
-					}
-					rem = pmod(gcd, work, NULL);
-					pfree(&gcd);
-					gcd = work;
-					work = rem;
-					pnorm(&work);
-				} while(plen(work));
-			}
-			pfree(&work);
+	poly_t gcd = pclone(start);
+	const poly_t *aptr, *bptr, *const eptr = argpolys + args, *const nptr = argpolys + olds;
+	ptab_t tab = PTZERO;
+	int pairs = 0;
+	PF_BEGIN;
+
+	if(args < 2 || (plen(gcd) && plen(gcd) < width + 1UL)) {
+		PF_END(PF_MODPOL, plen(gcd), 0);
+		return(gcd);
+	}
+
+	/* init added to an argument shorter than itself overhangs the
+	 * right-aligned sum, so then every pair is taken
+	 */
+	if(rflags & R_HAVEI)
+		for(aptr = argpolys; aptr < eptr; ++aptr)
+			if(plen(*aptr) < plen(init))
+				pairs = 1;
+
+	if(pairs) {
+		for(aptr = argpolys; aptr < eptr; ++aptr)
+			for(bptr = aptr < nptr ? nptr : aptr + 1; bptr < eptr; ++bptr)
+				if(modgcd(&gcd, moddif(init, rflags, *aptr, *bptr), &tab, width))
+					goto mpquit;
+	} else {
+		for(aptr = nptr > argpolys ? nptr : argpolys + 1; aptr < eptr; ++aptr) {
+			for(bptr = argpolys; bptr < aptr && ~rflags & R_HAVEI && plen(*bptr) != plen(*aptr); ++bptr)
+				;
+			if(bptr < aptr && modgcd(&gcd, moddif(init, rflags, *bptr, *aptr), &tab, width))
+				break;
 		}
 	}
+mpquit:
+	ptfree(&tab);
+	PF_END(PF_MODPOL, plen(gcd), 0);
 	return(gcd);
 }
 
+static poly_t
+moddif(const poly_t init, int rflags, const poly_t a, const poly_t b) {
+	/* Returns the difference of a and b for modpol(), or the zero
+	 * poly if the pair is not summed.
+	 */
+	poly_t work;
+	unsigned long alen = plen(a), blen = plen(b);
+
+	if(alen == blen) {
+		work = pclone(a);
+		psum(&work, b, 0UL);
+	} else if(rflags & R_HAVEI && alen < blen) {
+		work = pclone(b);
+		psum(&work, a, blen - alen);
+		psum(&work, init, 0UL);
+		psum(&work, init, blen - alen);
+	} else if(rflags & R_HAVEI /* && alen > blen */) {
+		work = pclone(a);
+		psum(&work, b, alen - blen);
+		psum(&work, init, 0UL);
+		psum(&work, init, alen - blen);
+	} else
+		work = pzero;
+	return(work);
+}
+
+static int
+modgcd(poly_t *gcd, poly_t work, ptab_t *tab, unsigned long width) {
+	/* Combines the difference work with the running GCD in *gcd,
+	 * and frees work.  Returns nonzero if the GCD is now shorter
+	 * than width + 1 terms.  tab caches the CRC engine of the GCD.
+	 */
+	poly_t rem, sub;
+
+	if(plen(work))
+		pnorm(&work);
+	if(!plen(work))
+		return(0);
+	/* combine work with running gcd */
+	if(!plen(*gcd)) {
+		/* first time only */
+		*gcd = work;
+		return(plen(*gcd) < width + 1UL);
+	}
+	if(plen(*gcd) < plen(work)) {
+		/* The first step below divides work by the GCD.  Once
+		 * the GCD is short this is a CRC calculation, so do it
+		 * with a table-driven engine, as pmod() would divide.
+		 */
+		sub = psubs(*gcd, 0UL, pfirst(*gcd) + 1UL, plast(*gcd), 0UL);
+		if(plen(sub) <= (unsigned long) BMP_BIT) {
+			if(!tab->table || pcmp(&tab->divisor, &sub))
+				ptinit(tab, sub);
+			rem = ptcrc(work, tab, pzero, pzero, 0);
+			pfree(&work);
+			work = rem;
+			pnorm(&work);
+		}
+		pfree(&sub);
+	}
+	while(plen(work)) {
+		/* ptst(gcd) != 0 */
+
+		/* optimisation which also accounts
+		 * for the way pmod() works.
+		 * this emulates one iteration of
+		 * a correct loop whereby
+		 * (short, long) -> (long, short)
+		 * since
+		 * poly_mod(short, long) == short
+		 * whereas pmod() left-aligns operands
+		 */
+		if(plen(*gcd) < plen(work)) {
+			rem = *gcd;
+			*gcd = work;
+			work = rem;
+		}
+		rem = pmod(*gcd, work, NULL);
+		pfree(gcd);
+		*gcd = work;
+		work = rem;
+		pnorm(&work);
+	}
+	pfree(&work);
+	return(plen(*gcd) < width + 1UL);
+}
+
+static int
+rfactr(poly_t **cands, unsigned long *count, const poly_t pwork, unsigned long width, int rflags) {
+	/* Lists in *cands the chopped generators of width terms that
+	 * divide pwork, the GCD of the differences, in the order the
+	 * trial factor search finds them, and places their number in
+	 * *count.  The generators are the products of the irreducible
+	 * factors of pwork whose degrees sum to width, or with R_SHORT
+	 * the cofactors of such products, whose degrees sum to
+	 * plen(pwork) - width - 1.  Returns zero, listing none, if
+	 * there are more than RFMAX of them.
+	 * pwork must be NORMALISED.
+	 */
+	poly_t *facs = NULL, *cptr, rem = PZERO, gpoly = PZERO;
+	unsigned long deg, nfacs, *ways, i, j, k, t, fdeg;
+	int ok;
+
+	*cands = NULL;
+	*count = 0UL;
+	deg = rflags & R_SHORT ? plen(pwork) - width - 1UL : width;
+	nfacs = pfactor(&facs, pwork, deg);
+
+	/* Count the divisors of each degree up to deg, taking each
+	 * distinct factor up to its multiplicity.
+	 */
+	if(!(ways = (unsigned long *) pcalloc(deg + 1UL, sizeof(unsigned long))))
+		uerror("cannot allocate divisor counts");
+	ways[0] = 1UL;
+	for(i = 0UL; i < nfacs; i = j) {
+		for(j = i + 1UL; j < nfacs && !pcmp(&facs[j], &facs[i]); ++j)
+			;
+		fdeg = plen(facs[i]) - 1UL;
+		for(t = deg; t; --t)
+			for(k = 1UL; k <= j - i && k * fdeg <= t; ++k)
+				if((ways[t] += ways[t - k * fdeg]) > RFMAX)
+					ways[t] = RFMAX + 1UL;
+	}
+	if((ok = ways[deg] <= RFMAX) && ways[deg]) {
+		if(!(*cands = (poly_t *) pmalloc(ways[deg] * sizeof(poly_t))))
+			uerror("cannot allocate candidate generators");
+		palloc(&rem, 1UL);
+		pinv(&rem);
+		rfenum(*cands, count, facs, nfacs, 0UL, rem, deg);
+		pfree(&rem);
+		qsort(*cands, (size_t) *count, sizeof(poly_t), rfcmp);
+		if(rflags & R_SHORT)
+			for(cptr = *cands; cptr < *cands + *count; ++cptr) {
+				/* divide the GCD by the cofactor, as rtest() does */
+				pcrcto(&rem, pwork, *cptr, pzero, pzero, 0, &gpoly);
+				pfree(cptr);
+				*cptr = psubs(gpoly, 0UL, 1UL, plen(gpoly), 0UL);
+			}
+		pfree(&rem);
+		pfree(&gpoly);
+	}
+	pmfree(ways);
+	for(i = 0UL; i < nfacs; ++i)
+		pfree(&facs[i]);
+	pmfree(facs);
+	return(ok);
+}
+
+static void
+rfenum(poly_t *cands, unsigned long *count, const poly_t *facs, unsigned long nfacs, unsigned long first, const poly_t prod, unsigned long deg) {
+	/* Appends to cands the chopped products of prod with divisors
+	 * of deg degrees drawn from facs[first..nfacs-1], for rfactr().
+	 */
+	poly_t power, next;
+	unsigned long j, k, fdeg;
+
+	if(!deg) {
+		cands[(*count)++] = psubs(prod, 0UL, 1UL, plen(prod), 0UL);
+		return;
+	}
+	if(first >= nfacs)
+		return;
+	for(j = first + 1UL; j < nfacs && !pcmp(&facs[j], &facs[first]); ++j)
+		;
+	fdeg = plen(facs[first]) - 1UL;
+	power = pclone(prod);
+	for(k = 0UL; k <= j - first && k * fdeg <= deg; ++k) {
+		rfenum(cands, count, facs, nfacs, j, power, deg - k * fdeg);
+		next = pmul(power, facs[first]);
+		pfree(&power);
+		power = next;
+	}
+	pfree(&power);
+}
+
+static int
+rfcmp(const void *a, const void *b) {
+	/* qsort() comparison function for candidate generators */
+	return(pcmp((const poly_t *) a, (const poly_t *) b));
+}
+
 static void
-dispch(const model_t *guess, int *resc, model_t **result, const poly_t divisor, int rflags, int args, const poly_t *argpolys) {
+dispch(rscr_t *scr, const model_t *guess, int *resc, model_t **result, const poly_t divisor, int rflags, int args, const poly_t *argpolys) {
+	PF_BEGIN;
+
 	if(rflags & R_HAVEI && rflags & R_HAVEX)
-		chkres(resc, result, divisor, guess->init, guess->flags, guess->xorout, args, argpolys);
+		chkres(scr, resc, result, divisor, guess->init, guess->flags, guess->xorout, args, argpolys);
 	else if(rflags & R_HAVEI)
-		calout(resc, result, divisor, guess->init, guess->flags, args, argpolys);
+		calout(scr, resc, result, divisor, guess->init, guess->flags, args, argpolys);
 	else if(rflags & R_HAVEX)
-		calini(resc, result, divisor, guess->flags, guess->xorout, args, argpolys);
+		calini(scr, resc, result, divisor, guess->flags, guess->xorout, args, argpolys);
 	else
-		engini(resc, result, divisor, guess->flags, args, argpolys);
+		engini(scr, resc, result, divisor, guess->flags, args, argpolys);
+	PF_END(PF_DISPCH, plen(divisor), 0);
 }
 
 static void
-engini(int *resc, model_t **result, const poly_t divisor, int flags, int args, const poly_t *argpolys) {
+engini(rscr_t *scr, int *resc, model_t **result, const poly_t divisor, int flags, int args, const poly_t *argpolys) {
 	/* Search for init values implied by the arguments.
 	 * Method from: Ewing, Gregory C. (March 2010).
 	 * "Reverse-Engineering a CRC Algorithm". Christchurch:
@@ -303,16 +928,14 @@ engini(int *resc, model_t **result, const poly_t divisor, int flags, int args, c
 	 * <http://www.cosc.canterbury.ac.nz/greg.ewing/essays/
 	 * CRC-Reverse-Engineering.html>
 	 */
-	poly_t apoly = PZERO, bpoly, pone = PZERO, *mat, *jptr;
+	poly_t apoly = PZERO, bpoly, pone = PZERO, cpoly;
 	const poly_t *aptr, *bptr, *iptr;
-	unsigned long alen, blen, dlen, ilen, i, j;
-	int cy;
+	unsigned long alen, blen, dlen, ilen, stride, i, j, k, nfree;
+	bmp_t *rows, *trans, *row, *work, *col, *sums, *count, top;
+	PF_BEGIN;
 
 	dlen = plen(divisor);
-
-	/* Allocate the CRC matrix */
-	if(!(mat = (poly_t *) malloc((dlen << 1) * sizeof(poly_t))))
-		uerror("cannot allocate memory for CRC matrix");
+	++scr->solves;
 
 	/* Find arguments of the two shortest lengths */
 	alen = blen = plen(*(aptr = bptr = iptr = argpolys));
@@ -330,11 +953,35 @@ engini(int *resc, model_t **result, const poly_t divisor, int flags, int args, c
 		 * assumed XorOut of 0.  Create a padded XorOut
 		 */
 		palloc(&apoly, dlen);
-		calini(resc, result, divisor, flags, apoly, args, argpolys);
+		calini(scr, resc, result, divisor, flags, apoly, args, argpolys);
 		pfree(&apoly);
+		PF_END(PF_ENGINI, dlen, 0);
 		return;
 	}
 
+	/* Allocate the matrix, or reuse the last one.  Each vector
+	 * has dlen terms and an augment term.  There are dlen pivot
+	 * rows, dlen transposed rows, up to dlen solution steps and
+	 * a work vector, a column and a counter.
+	 */
+	stride = (dlen + BMP_BIT) / BMP_BIT;
+	if(scr->mat.size < (3UL * dlen + 3UL) * stride) {
+		pmfree(scr->mat.words);
+		scr->mat.size = 0UL;
+		if(!(scr->mat.words = (bmp_t *) pmalloc((3UL * dlen + 3UL) * stride * sizeof(bmp_t))))
+			uerror("cannot allocate memory for CRC matrix");
+		scr->mat.size = (3UL * dlen + 3UL) * stride;
+	}
+	scr->mat.stride = stride;
+	rows = scr->mat.words;
+	trans = rows + dlen * stride;
+	sums = trans + dlen * stride;
+	work = sums + dlen * stride;
+	col = work + stride;
+	count = col + stride;
+	for(i = 0UL; i < (3UL * dlen + 3UL) * stride; ++i)
+		rows[i] = BMP_C(0);
+
 	/* Find the potential contribution of the bottom bit of Init */
 	palloc(&pone, 1UL);
 	piter(&pone);
@@ -348,97 +995,107 @@ engini(int *resc, model_t **result, const poly_t divisor, int flags, int args, c
 		psum(&apoly, pone, blen - alen); /* >= 1 */
 	}
 	if(plen(apoly) > dlen) {
-		mat[dlen] = pcrc(apoly, divisor, pzero, pzero, 0, 0);
+		cpoly = pcrc(apoly, divisor, pzero, pzero, 0, 0);
 		pfree(&apoly);
 	} else {
-		mat[dlen] = apoly;
+		cpoly = apoly;
 	}
+	for(i = 0UL; i < RSIZE(dlen); ++i)
+		col[i] = cpoly.bitmap[i];
+	pfree(&cpoly);
+	pfree(&pone);
 
 	/* Find the actual contribution of Init */
 	apoly = pcrc(*aptr, divisor, pzero, pzero, 0, 0);
 	bpoly = pcrc(*bptr, divisor, pzero, apoly, 0, 0);
-
-	/* Populate the matrix */
-	palloc(&apoly, 1UL);
-	for(jptr=mat; jptr<mat+dlen; ++jptr)
-		*jptr = pzero;
-	for(iptr = jptr++; jptr < mat + (dlen << 1); iptr = jptr++)
-		*jptr = pcrc(apoly, divisor, *iptr, pzero, P_MULXN, 0);
 	pfree(&apoly);
 
-	/* Transpose the matrix, augment with the Init contribution
-	 * and convert to row echelon form
-	 */
-	for(i=0UL; i<dlen; ++i) {
-		apoly = pzero;
-		iptr = mat + (dlen << 1);
-		for(j=0UL; j<dlen; ++j)
-			ppaste(&apoly, *--iptr, i, j, j + 1UL, dlen + 1UL);
-		if(ptst(apoly))
-			ppaste(&apoly, bpoly, i, dlen, dlen + 1UL, dlen + 1UL);
-		j = pfirst(apoly);
-		while(j < dlen && !pident(mat[j], pzero)) {
-			psum(&apoly, mat[j], 0UL); /* pfirst(apoly) > j */
-			j = pfirst(apoly);
-		}
-		if(j < dlen)
-			mat[j] = apoly; /* pident(mat[j], pzero) || pfirst(mat[j]) == j */
-		else
-			pfree(&apoly);
+	/* Fill the transposed matrix.  The contribution of Init bit k,
+	 * counting from the bottom, is the bottom bit's times x^k and
+	 * becomes term dlen - 1 - k of each row.
+	 */
+	for(k = 0UL; k < dlen; ++k) {
+		for(i = 0UL; i < dlen; ++i)
+			if(RBIT(col, i))
+				RFLIP(trans + i * stride, dlen - 1UL - k);
+		/* multiply the column by x, modulo the generator */
+		top = RBIT(col, 0UL);
+		for(i = 0UL; i + 1UL < stride; ++i)
+			col[i] = col[i] << 1 | col[i + 1UL] >> (BMP_BIT - 1);
+		col[i] <<= 1;
+		if(top)
+			for(i = 0UL; i < RSIZE(dlen); ++i)
+				col[i] ^= divisor.bitmap[i];
 	}
-	palloc(&bpoly, dlen + 1UL);
-	psum(&bpoly, pone, dlen);
 
-	/* Iterate through all solutions */
-	do {
-		/* Solve the matrix by Gaussian elimination.
-		 * The parity of the result, masked by each row, should be even.
-		 */
-		cy = P_EXHST;
-		apoly = pclone(bpoly);
-		jptr = mat + dlen;
-		for(i=0UL; i<dlen; ++i) {
-			/* Compute next bit of Init */
-			if(pmpar(apoly, *--jptr))
-				psum(&apoly, pone, dlen - 1UL - i);
-			/* Toggle each zero row with carry, for next iteration */
-			if(cy) {
-				if(pident(*jptr, pzero)) {
-					/* 0 to 1, no carry */
-					*jptr = bpoly;
-					cy &= flags;
-				} else if(pident(*jptr, bpoly)) {
-					/* 1 to 0, carry forward */
-					*jptr = pzero;
-				}
-			}
+	/* Augment with the Init contribution and convert to row
+	 * echelon form.  Row j, if present, has its first term at j.
+	 */
+	for(i = 0UL; i < dlen; ++i) {
+		row = trans + i * stride;
+		j = rfirst(row, dlen);
+		if(j < dlen && RBIT(bpoly.bitmap, i))
+			RFLIP(row, dlen);
+		while(j < dlen && RBIT(rows + j * stride, j)) {
+			rxor(row, rows + j * stride, stride);
+			j = rfirst(row, dlen);
 		}
+		if(j < dlen)
+			rxor(rows + j * stride, row, stride);
+	}
+	pfree(&bpoly);
 
-		/* Trim the augment mask bit */
-		praloc(&apoly, dlen);
+	/* Solve for the particular Init, with all free terms zero, and
+	 * for each free term the difference it makes, in the order the
+	 * free terms count.  sums[t] is the sum of the differences of
+	 * free terms 0 to t, so that counting through the solutions
+	 * in binary costs one vector XOR per Init.
+	 */
+	for(nfree = 0UL, k = dlen; k--; ) {
+		if(RBIT(rows + k * stride, k))
+			continue;
+		for(i = 0UL; i < stride; ++i)
+			col[i] = BMP_C(0);
+		rsolve(col, rows, dlen, stride, k);
+		if(nfree)
+			rxor(col, sums + (nfree - 1UL) * stride, stride);
+		for(i = 0UL; i < stride; ++i)
+			sums[nfree * stride + i] = col[i];
+		++nfree;
+	}
+	RFLIP(work, dlen);
+	rsolve(work, rows, dlen, stride, dlen);
+	RFLIP(work, dlen);
 
+	/* Iterate through all solutions */
+	praloc(&scr->init, dlen);
+	for(;;) {
 		/* Test the Init value and add to results if correct */
-		calout(resc, result, divisor, apoly, flags, args, argpolys);
-		pfree(&apoly);
-	} while(!cy);
-	pfree(&pone);
+		for(i = 0UL; i < RSIZE(dlen); ++i)
+			scr->init.bitmap[i] = work[i];
+		calout(scr, resc, result, divisor, scr->init, flags, args, argpolys);
 
-	/* Free the matrix. */
-	for(jptr=mat; jptr < mat + (dlen << 1); ++jptr)
-		if(pident(*jptr, bpoly))
-			*jptr = pzero;
-		else
-			pfree(jptr);
-	pfree(&bpoly);
-	free(mat);
+		/* -1 takes only the particular solution */
+		if(flags & P_EXHST)
+			break;
+		/* increment the counter; the lowest bit cleared by the
+		 * carry selects the next step
+		 */
+		for(j = 0UL; j < nfree && RBIT(count, j); ++j)
+			RFLIP(count, j);
+		if(j == nfree)
+			break;
+		RFLIP(count, j);
+		rxor(work, sums + j * stride, stride);
+	}
+	PF_END(PF_ENGINI, dlen, 0);
 }
 
 static void
-calout(int *resc, model_t **result, const poly_t divisor, const poly_t init, int flags, int args, const poly_t *argpolys) {
+calout(rscr_t *scr, int *resc, model_t **result, const poly_t divisor, const poly_t init, int flags, int args, const poly_t *argpolys) {
 	/* Calculate Xorout, check it against all the arguments and
 	 * add to results if consistent.
 	 */
-	poly_t xorout;
 	const poly_t *aptr, *iptr;
 	unsigned long alen, ilen;
 
@@ -453,29 +1110,27 @@ calout(int *resc, model_t **result, const poly_t divisor, const poly_t init, int
 		}
 	}
 
-	xorout = pcrc(*aptr, divisor, init, pzero, 0, 0);
+	pcrcto(&scr->xorout, *aptr, divisor, init, pzero, 0, 0);
 	/* On little-endian algorithms, the calculations yield
 	 * the reverse of the actual xorout: in the Williams
 	 * model, the refout stage intervenes between init and
 	 * xorout.
 	 */
 	if(flags & P_REFOUT)
-		prev(&xorout);
+		prev(&scr->xorout);
 
 	/* Submit the model to the results table.
 	 * Could skip the shortest argument but we wish to check our
 	 * calculation.
 	 */
-	chkres(resc, result, divisor, init, flags, xorout, args, argpolys);
-	pfree(&xorout);
+	chkres(scr, resc, result, divisor, init, flags, scr->xorout, args, argpolys);
 }
 
 static void
-calini(int *resc, model_t **result, const poly_t divisor, int flags, const poly_t xorout, int args, const poly_t *argpolys) {
+calini(rscr_t *scr, int *resc, model_t **result, const poly_t divisor, int flags, const poly_t xorout, int args, const poly_t *argpolys) {
 	/* Calculate Init, check it against all the arguments and add to
 	 * results if consistent.
 	 */
-	poly_t rcpdiv, rxor, arg, init;
 	const poly_t *aptr, *iptr;
 	unsigned long alen, ilen;
 
@@ -490,79 +1145,907 @@ calini(int *resc, model_t **result, const poly_t divisor, int flags, const poly_
 		}
 	}
 
-	rcpdiv = pclone(divisor);
-	prcp(&rcpdiv);
+	pcpy(&scr->rcpdiv, divisor);
+	prcp(&scr->rcpdiv);
 	/* If the algorithm is reflected, an ordinary CRC requires the
 	 * model's XorOut to be reversed, as XorOut follows the RefOut
 	 * stage.  To reverse the CRC calculation we need rxor to be the
 	 * mirror image of the forward XorOut.
 	 */
-	rxor = pclone(xorout);
+	pcpy(&scr->rxor, xorout);
 	if(~flags & P_REFOUT)
-		prev(&rxor);
-	arg = pclone(*aptr);
-	prev(&arg);
+		prev(&scr->rxor);
+	pcpy(&scr->arg, *aptr);
+	prev(&scr->arg);
 
-	init = pcrc(arg, rcpdiv, rxor, pzero, 0, 0);
-	pfree(&arg);
-	pfree(&rxor);
-	pfree(&rcpdiv);
-	prev(&init);
+	pcrcto(&scr->init, scr->arg, scr->rcpdiv, scr->rxor, pzero, 0, 0);
+	prev(&scr->init);
 
 	/* Submit the model to the results table.
 	 * Could skip the shortest argument but we wish to check our
 	 * calculation.
 	 */
-	chkres(resc, result, divisor, init, flags, xorout, args, argpolys);
-	pfree(&init);
+	chkres(scr, resc, result, divisor, scr->init, flags, xorout, args, argpolys);
 }
 
 static void
-chkres(int *resc, model_t **result, const poly_t divisor, const poly_t init, int flags, const poly_t xorout, int args, const poly_t *argpolys) {
+chkres(rscr_t *scr, int *resc, model_t **result, const poly_t divisor, const poly_t init, int flags, const poly_t xorout, int args, const poly_t *argpolys) {
 	/* Checks a model against the argument list, and adds to the
-	 * external results table if consistent.
+	 * external results table if consistent.  The caller notifies
+	 * ufound() of new models.
 	 * Extends the result array and updates the external pointer if
 	 * necessary.
 	 */
 	model_t *rptr;
-	poly_t xor, crc;
-	const poly_t *aptr = argpolys, *const eptr = argpolys + args;
+	rres_t *res = &scr->res;
+	bmp_t *ent, accu, bits, probe = ~(~BMP_C(0) >> 1);
+	unsigned long dlen = plen(divisor), j;
+	int i, cache;
+	PF_BEGIN;
 
 	/* If the algorithm is reflected, an ordinary CRC requires the
 	 * model's XorOut to be reversed, as XorOut follows the RefOut
 	 * stage.
 	 */
-	xor = pclone(xorout);
+	pcpy(&scr->xor, xorout);
 	if(flags & P_REFOUT)
-		prev(&xor);
+		prev(&scr->xor);
 
-	for(; aptr < eptr; ++aptr) {
-		crc = pcrc(*aptr, divisor, init, xor, 0, 0);
-		if(ptst(crc)) {
-			pfree(&crc);
-			break;
+	if(res->args != argpolys)
+		rsorder(res, args, argpolys);
+	cache = dlen && dlen <= BMP_BIT && plen(init) == dlen && plen(scr->xor) == dlen;
+	if(cache) {
+		if(pcmp(&res->divisor, &divisor)) {
+			pcpy(&res->divisor, divisor);
+			res->calls = 0UL;
+			for(i = 0; i < args; ++i)
+				res->ents[i * RESTR] = BMP_C(0);
+		}
+		cache = res->calls++ != 0UL;
+	}
+
+	/* Check the shortest arguments first, as they are the cheapest
+	 * and a false model fails most of them.
+	 */
+	for(i = 0; i < args; ++i) {
+		if(cache && plen(*res->order[i]) >= dlen) {
+			ent = res->ents + i * RESTR;
+			if(!*ent)
+				rsent(scr, ent, *res->order[i], divisor);
+			accu = ent[1] ^ *scr->xor.bitmap;
+			for(bits = *init.bitmap, j = 2UL; bits; bits <<= 1, ++j)
+				if(bits & probe)
+					accu ^= ent[j];
+			if(accu)
+				break;
 		} else {
-			pfree(&crc);
+			pcrcto(&scr->crc, *res->order[i], divisor, init, scr->xor, 0, 0);
+			if(ptst(scr->crc))
+				break;
 		}
 	}
-	pfree(&xor);
-	if(aptr != eptr) return;
+	if(i != args) {
+		++scr->rejects;
+		PF_END(PF_CHKRES, dlen, 0);
+		return;
+	}
 
-	if(!(*result = realloc(*result, ++*resc * sizeof(model_t))))
+	if(!(rptr = prealloc(*result, (*resc + 1) * sizeof(model_t))))
 		uerror("cannot reallocate result array");
+	*result = rptr;
 
-	rptr = *result + *resc - 1;
-	rptr->spoly  = pclone(divisor);
-	rptr->init   = pclone(init);
+	rptr += (*resc)++;
+	rptr->spoly  = pzero;
+	rptr->init   = pzero;
 	rptr->flags  = flags;
-	rptr->xorout = pclone(xorout);
+	rptr->xorout = pzero;
 	rptr->check  = pzero;
 	rptr->magic  = pzero;
 	rptr->name   = NULL;
+	/* the entry can be freed if an error interrupts the copies */
+	pcpy(&rptr->spoly, divisor);
+	pcpy(&rptr->init, init);
+	pcpy(&rptr->xorout, xorout);
 
 	/* compute check value for this model */
 	mcheck(rptr);
+	PF_END(PF_CHKRES, dlen, (*resc) * sizeof(model_t));
+}
+
+#ifdef THREADS
+static void *
+rentry(void *srch) {
+	/* Thread entry point for search workers, which enter their
+	 * storage in the ledger of the search.
+	 */
+	plset(((rsrch_t *) srch)->log);
+	rwork((rsrch_t *) srch);
+	plset(NULL);
+	return(NULL);
+}
+#endif /* THREADS */
+
+static void
+rthrds(rsrch_t *srch, int threads) {
+	/* Searches the trial factor range of srch on the calling thread
+	 * and, if THREADS is defined, on threads - 1 further workers.
+	 * If a worker cannot be started the search proceeds with fewer.
+	 */
+#ifdef THREADS
+	pthread_t *tids = NULL;
+	int i, n = 0;
 
-	/* callback to notify new model */
-	ufound(rptr);
+	if(pthread_mutex_init(&srch->lock, NULL)) {
+		/* fail as a worker would, so that the caller tidies up */
+		srch->error = "cannot initialise search lock";
+		return;
+	}
+	/* with one thread, candidates are solved as they are found */
+	srch->qmax = threads > 1 ? threads * R_QPER : 0;
+	if(threads > 1 && (tids = (pthread_t *) pmalloc((threads - 1) * sizeof(pthread_t))))
+		while(n < threads - 1 && !pthread_create(tids + n, NULL, rentry, srch))
+			++n;
+	rwork(srch);
+	for(i = 0; i < n; ++i)
+		pthread_join(tids[i], NULL);
+	pmfree(tids);
+	pthread_mutex_destroy(&srch->lock);
+#else
+	rwork(srch);
+#endif /* THREADS */
+}
+
+static void
+rwork(rsrch_t *srch) {
+	/* Solves queued candidates, and claims and searches chunks,
+	 * until the range is exhausted and the queue is empty.
+	 * A thread that queues a candidate returns to the queue before
+	 * it leaves, so every candidate is solved.
+	 * The first worker takes the OpenCL device of srch, if any, and
+	 * claims its chunks in batches with roffl().
+	 * An error stops the search and is left in srch->error.
+	 * The trap and scratch space are kept here and the work is done
+	 * by rwloop() within rwtry(), so that no local of the frame
+	 * that calls setjmp() is changed before the jump.
+	 */
+	rscr_t scr = RCZERO;
+	rtrap_t trap;
+	ocl_t *ocl;
+
+	/* the first worker here drives the device, if any */
+	LOCK(srch);
+	ocl = srch->ocl;
+	srch->ocl = NULL;
+	UNLOCK(srch);
+	rwtry(srch, &scr, &trap, ocl);
+	rsfree(&scr);
+}
+
+static void
+rwtry(rsrch_t *srch, rscr_t *scr, rtrap_t *trap, ocl_t *ocl) {
+	/* Calls rwloop() for rwork() within trap.  If an error is
+	 * thrown, stops the search and leaves the error in srch->error.
+	 */
+	rtpush(trap);
+	if(setjmp(trap->env)) {
+		if(!trap->held)
+			LOCK(srch);
+		if(!srch->error)
+			srch->error = trap->msg;
+		srch->more = 0;
+		UNLOCK(srch);
+		return;
+	}
+	rwloop(srch, scr, trap, ocl);
+	rtpop(trap);
+}
+
+static void
+rwloop(rsrch_t *srch, rscr_t *scr, rtrap_t *trap, ocl_t *ocl) {
+	/* Does the work of rwork(), which see, with the scratch space
+	 * in scr and the OpenCL device ocl, or NULL.  trap is the
+	 * caller's.
+	 */
+	rchnk_t *chunk;
+	rcand_t *cand;
+
+	for(;;) {
+		while((cand = rtake(srch, trap))) {
+			dispch(scr, srch->guess, &cand->resc, &cand->result, cand->gpoly, srch->rflags, srch->args, srch->argpolys);
+			rpost(srch, scr, trap, cand->chunk, cand);
+		}
+		if(ocl) {
+			if(!roffl(srch, scr, trap, &ocl))
+				break;
+			continue;
+		}
+		if(!(chunk = rclaim(srch, trap)))
+			break;
+		rscan(srch, scr, trap, chunk);
+		rpost(srch, scr, trap, chunk, NULL);
+	}
+}
+
+static rchnk_t *
+rclaim(rsrch_t *srch, rtrap_t *trap) {
+	/* Claims the next chunk of trial factors in this shard,
+	 * queueing it for reporting in claim order, and advances
+	 * srch->next past it.  Returns NULL if none remain or the
+	 * search has been cancelled.  trap is the caller's.
+	 */
+	rchnk_t *chunk = NULL;
+	unsigned long count, first;
+
+	LOCK(srch);
+	trap->held = 1;
+	while(srch->more && !(srch->ctx && srch->ctx->cancel)
+		&& (~srch->rflags & R_HAVEQ || pcmp(&srch->next, &srch->qqpoly) < 0)) {
+		if(srch->cidx == srch->shard) {
+			if((chunk = srch->spare))
+				srch->spare = chunk->next;
+			else if((chunk = (rchnk_t *) pmalloc(sizeof(rchnk_t))))
+				chunk->start = pzero;
+			else
+				uerror("cannot allocate memory for search chunk");
+			chunk->next = NULL;
+			pcpy(&chunk->start, srch->next);
+			chunk->spin = 0UL;
+			chunk->done = 0;
+			chunk->resc = 0;
+			chunk->result = NULL;
+			chunk->cands = chunk->ctail = NULL;
+			chunk->pending = 0;
+			chunk->divs = chunk->ncands = 0UL;
+		}
+		count = rstep(srch, &first);
+		if(++srch->cidx == srch->shards)
+			srch->cidx = 0UL;
+		if(chunk) {
+			chunk->count = count;
+			chunk->first = first;
+			/* the chunk ends at or before the range end */
+			chunk->whole = ~srch->rflags & R_HAVEQ
+				|| (srch->more && pcmp(&srch->next, &srch->qqpoly) <= 0);
+			if(srch->tail)
+				srch->tail->next = chunk;
+			else
+				srch->head = chunk;
+			srch->tail = chunk;
+			break;
+		}
+	}
+	if(!chunk)
+		srch->more = 0;
+	trap->held = 0;
+	UNLOCK(srch);
+	return(chunk);
+}
+
+static unsigned long
+rstep(rsrch_t *srch, unsigned long *first) {
+	/* Advances srch->next to the next chunk boundary, clearing
+	 * srch->more if the factor rolls over.  Returns the number of
+	 * odd factors stepped over, and sets *first to the index
+	 * within the chunk of the first of them.
+	 */
+	unsigned long len, bits, low, i;
+
+	/* Count the odd factors up to the next boundary */
+	len = plen(srch->next);
+	bits = len < R_CBITS ? len : R_CBITS;
+	for(low = 0UL, i = len - bits; i < len; ++i)
+		low = low << 1 | pcoeff(srch->next, i);
+
+	/* Step to the boundary, stopping if the factor rolls over.
+	 * A factor on a boundary is stepped in place by setting the
+	 * chunk's terms and letting piter() carry out of them.
+	 */
+	if(!low && bits == R_CBITS) {
+		psum(&srch->next, srch->ones, len - bits);
+		srch->more = piter(&srch->next);
+	} else {
+		praloc(&srch->next, len - bits);
+		srch->more = piter(&srch->next);
+		praloc(&srch->next, len);
+	}
+
+	*first = low >> 1;
+	return(((1UL << bits) - low) >> 1);
+}
+
+static void
+rscan(rsrch_t *srch, rscr_t *scr, rtrap_t *trap, rchnk_t *chunk) {
+	/* Tries each odd factor in chunk against the GCD of the
+	 * differences, collecting models in the chunk's own results.
+	 * Aligned runs of srch->lanes factors are divided at once by
+	 * pbdiv() and only those that divide the GCD are tried singly.
+	 * Single factors the parity of the GCD rules out are skipped.
+	 * trap is the caller's.
+	 */
+	const unsigned long lanes = chunk->whole ? srch->lanes : 0UL;
+	unsigned long n, j;
+	bmp_t mask;
+
+	pcpy(&scr->factor, chunk->start);
+	for(n = chunk->count; n; ) {
+		if(lanes && n >= lanes && !((chunk->first + chunk->count - n) & (lanes - 1UL))) {
+			mask = pbdiv(srch->pwork, scr->factor, lanes, &scr->regs);
+			++chunk->divs;
+			for(j = 0UL; j < lanes; ++j) {
+				piter(&scr->factor);
+				if(mask & BMP_C(1) << j)
+					rtest(srch, scr, trap, chunk);
+				piter(&scr->factor);
+			}
+			n -= lanes;
+		} else {
+			piter(&scr->factor);
+			if(srch->rflags & R_HAVEQ && pcmp(&scr->factor, &srch->qqpoly) >= 0)
+				break;
+			if(!srch->parity || !rodd(scr->factor))
+				rtest(srch, scr, trap, chunk);
+			piter(&scr->factor);
+			--n;
+		}
+	}
+	chunk->spin = chunk->count - n;
+}
+
+static int
+roffl(rsrch_t *srch, rscr_t *scr, rtrap_t *trap, ocl_t **ocl) {
+	/* Claims up to R_OBATCH chunks and divides the GCD by their
+	 * trial factors at once on the device in *ocl, then tries
+	 * those that divide it with rtest() and reports the chunks.
+	 * If the device fails, the chunks are scanned on the host and
+	 * *ocl is set to NULL.  Returns zero if no chunk remained.
+	 * trap is the caller's.
+	 */
+	rchnk_t *batch[R_OBATCH], *chunk;
+	poly_t starts[R_OBATCH];
+	const unsigned long per = 1UL << (R_CBITS - 1UL);
+	unsigned char *hits;
+	unsigned long n, i, j;
+
+	for(n = 0UL; n < R_OBATCH && (batch[n] = rclaim(srch, trap)); ++n)
+		starts[n] = batch[n]->start;
+	if(!n)
+		return(0);
+	if(!(hits = (unsigned char *) pmalloc(n * per)) || ocldiv(*ocl, starts, n, per, hits)) {
+		/* carry on without the device */
+		pmfree(hits);
+		hits = NULL;
+		*ocl = NULL;
+	}
+	for(i = 0UL; i < n; ++i) {
+		chunk = batch[i];
+		if(!hits)
+			rscan(srch, scr, trap, chunk);
+		else {
+			pcpy(&scr->factor, chunk->start);
+			for(j = 0UL; j < chunk->count; ++j) {
+				piter(&scr->factor);
+				if(srch->rflags & R_HAVEQ && pcmp(&scr->factor, &srch->qqpoly) >= 0)
+					break;
+				if(hits[i * per + j])
+					rtest(srch, scr, trap, chunk);
+				piter(&scr->factor);
+			}
+			chunk->spin = j;
+			chunk->divs += j;
+		}
+		rpost(srch, scr, trap, chunk, NULL);
+	}
+	pmfree(hits);
+	return(1);
+}
+
+static void
+rtest(rsrch_t *srch, rscr_t *scr, rtrap_t *trap, rchnk_t *chunk) {
+	/* Tries the odd factor in scr against the GCD of the
+	 * differences.  A candidate generator is queued for solving, or
+	 * with one thread solved at once into the chunk's results.
+	 * trap is the caller's.
+	 */
+	const int rflags = srch->rflags;
+	PF_BEGIN;
+
+	/* For each possible poly of this size, try
+	 * dividing the GCD of the differences.
+	 */
+	++chunk->divs;
+	if(rflags & R_SHORT) {
+		/* test whether cofactor divides the GCD */
+		pcrcto(&scr->rem, srch->pwork, scr->factor, pzero, pzero, 0, NULL);
+		if(!ptst(scr->rem)) {
+			/* repeat division to get generator polynomial
+			 * then test generator against other differences
+			 */
+			pcrcto(&scr->rem, srch->pwork, scr->factor, pzero, pzero, 0, &scr->gpoly);
+			/* chop generator and ensure + 1 term */
+			pshift(&scr->gpoly,scr->gpoly,0UL,1UL,plen(scr->gpoly) - 1UL,1UL);
+			piter(&scr->gpoly); /* plen(gpoly) >= 1 */
+		}
+	} else {
+		/* straight divide message by poly, don't multiply by x^n */
+		pcrcto(&scr->rem, srch->pwork, scr->factor, pzero, pzero, 0, 0);
+	}
+	/* If factor divides all the differences, it is a
+	 * candidate.  Search for an Init value for this
+	 * poly or if Init is known, log the result.
+	 */
+	if(!ptst(scr->rem)) {
+		/* gpoly || factor is a candidate poly */
+		++chunk->ncands;
+		if(srch->qmax)
+			rqueue(srch, scr, trap, chunk, (rflags & R_SHORT) ? scr->gpoly : scr->factor);
+		else
+			dispch(scr, srch->guess, &chunk->resc, &chunk->result, (rflags & R_SHORT) ? scr->gpoly : scr->factor, rflags, srch->args, srch->argpolys);
+	}
+	PF_END(PF_RTEST, plen(srch->pwork), 0);
+}
+
+static void
+rqueue(rsrch_t *srch, rscr_t *scr, rtrap_t *trap, rchnk_t *chunk, const poly_t gpoly) {
+	/* Records gpoly as the next candidate of chunk and queues it
+	 * for solving.  If the queue is full the candidate is solved
+	 * here with scr.  trap is the caller's.
+	 */
+	rcand_t *cand;
+	int solo = 0;
+
+	LOCK(srch);
+	trap->held = 1;
+	if((cand = srch->cspare))
+		srch->cspare = cand->next;
+	else if((cand = (rcand_t *) pmalloc(sizeof(rcand_t))))
+		cand->gpoly = pzero;
+	else
+		uerror("cannot allocate memory for search candidate");
+	cand->next = cand->qnext = NULL;
+	cand->chunk = chunk;
+	cand->resc = 0;
+	cand->result = NULL;
+	if(chunk->ctail)
+		chunk->ctail->next = cand;
+	else
+		chunk->cands = cand;
+	chunk->ctail = cand;
+	pcpy(&cand->gpoly, gpoly);
+	if(srch->queued < srch->qmax) {
+		if(srch->qtail)
+			srch->qtail->qnext = cand;
+		else
+			srch->qhead = cand;
+		srch->qtail = cand;
+		++srch->queued;
+		++chunk->pending;
+	} else
+		solo = 1;
+	trap->held = 0;
+	UNLOCK(srch);
+	if(solo)
+		dispch(scr, srch->guess, &cand->resc, &cand->result, cand->gpoly, srch->rflags, srch->args, srch->argpolys);
+}
+
+static rcand_t *
+rtake(rsrch_t *srch, rtrap_t *trap) {
+	/* Takes the oldest candidate from the queue, or returns NULL if
+	 * the queue is empty or the search has failed.  trap is the
+	 * caller's.
+	 */
+	rcand_t *cand = NULL;
+
+	LOCK(srch);
+	trap->held = 1;
+	if(!srch->error && (cand = srch->qhead)) {
+		if(!(srch->qhead = cand->qnext))
+			srch->qtail = NULL;
+		cand->qnext = NULL;
+		--srch->queued;
+	}
+	trap->held = 0;
+	UNLOCK(srch);
+	return(cand);
+}
+
+static void
+rsorder(rres_t *res, int args, const poly_t *argpolys) {
+	/* Sorts the arguments into res->order, shortest first, keeping
+	 * the order of arguments of equal length, and clears the entries.
+	 */
+	const poly_t *aptr;
+	int i, j;
+
+	pmfree(res->order);
+	pmfree(res->ents);
+	res->args = NULL;
+	res->ents = NULL;
+	if(!(res->order = (const poly_t **) pmalloc((args ? args : 1) * sizeof(const poly_t *))))
+		uerror("cannot allocate memory for argument order");
+	if(!(res->ents = (bmp_t *) pcalloc(args ? args : 1, RESTR * sizeof(bmp_t))))
+		uerror("cannot allocate memory for argument residues");
+	for(i = 0; i < args; ++i) {
+		aptr = argpolys + i;
+		for(j = i; j && plen(*res->order[j - 1]) > plen(*aptr); --j)
+			res->order[j] = res->order[j - 1];
+		res->order[j] = aptr;
+	}
+	res->args = argpolys;
+	pfree(&res->divisor);
+	res->calls = 0UL;
+}
+
+static void
+rsent(rscr_t *scr, bmp_t *ent, const poly_t arg, const poly_t divisor) {
+	/* Fills the rres_t entry ent for arg, at least as long as the
+	 * divisor, which is at most BMP_BIT terms long.
+	 */
+	unsigned long dlen = plen(divisor), j;
+	bmp_t col, probe = ~(~BMP_C(0) >> 1);
+
+	/* the CRC with zero Init and XorOut */
+	pcrcto(&scr->crc, arg, divisor, pzero, pzero, 0, 0);
+	ent[1] = *scr->crc.bitmap;
+
+	/* The last term of Init is shifted through arg less the
+	 * divisor; each term before it is shifted once more.
+	 */
+	if(plen(scr->res.unit) != dlen) {
+		palloc(&scr->res.unit, dlen);
+		*scr->res.unit.bitmap = BMP_C(1) << (BMP_BIT - dlen);
+	}
+	pcrcto(&scr->crc, arg, divisor, scr->res.unit, pzero, 0, 0);
+	col = *scr->crc.bitmap ^ ent[1];
+	for(j = dlen; j--; ) {
+		ent[2UL + j] = col;
+		col = col & probe ? col << 1 ^ *divisor.bitmap : col << 1;
+	}
+	*ent = BMP_C(1);
+}
+
+static void
+rsfree(rscr_t *scr) {
+	/* Frees the scratch polynomials in scr. */
+	pfree(&scr->factor);
+	pfree(&scr->gpoly);
+	pfree(&scr->rem);
+	pfree(&scr->regs);
+	pfree(&scr->crc);
+	pfree(&scr->xor);
+	pfree(&scr->xorout);
+	pfree(&scr->init);
+	pfree(&scr->arg);
+	pfree(&scr->rcpdiv);
+	pfree(&scr->rxor);
+	pmfree(scr->mat.words);
+	scr->mat.words = NULL;
+	scr->mat.stride = scr->mat.size = 0UL;
+	pmfree(scr->res.order);
+	pmfree(scr->res.ents);
+	scr->res.order = NULL;
+	scr->res.ents = NULL;
+	scr->res.args = NULL;
+	pfree(&scr->res.divisor);
+	pfree(&scr->res.unit);
+	scr->res.calls = 0UL;
+}
+
+static unsigned long
+rfirst(const bmp_t *vec, unsigned long len) {
+	/* Returns the index of the first nonzero term among the first
+	 * len terms of the bit vector vec, or len if there is none.
+	 */
+	unsigned long idx = 0UL, size = RSIZE(len), j;
+	bmp_t accu, probe = ~(~BMP_C(0) >> 1);
+
+	while(idx < size && !vec[idx])
+		++idx;
+	if(idx == size)
+		return(len);
+	for(accu = vec[idx], j = idx * BMP_BIT; !(accu & probe); accu <<= 1)
+		++j;
+	return(j < len ? j : len);
+}
+
+static void
+rxor(bmp_t *dest, const bmp_t *src, unsigned long stride) {
+	/* Adds the bit vector src to dest, both of stride words. */
+	unsigned long i;
+
+	for(i = 0UL; i < stride; ++i)
+		dest[i] ^= src[i];
+}
+
+static void
+rsolve(bmp_t *vec, const bmp_t *rows, unsigned long dlen, unsigned long stride, unsigned long free) {
+	/* Solves the echelon matrix rows by back-substitution into vec,
+	 * whose augment term (term dlen) must be set or clear as the
+	 * system is to be solved or made homogeneous.  Free term free
+	 * is set to 1 and the others to 0; give free = dlen to clear
+	 * them all.  The terms of vec before dlen must be clear.
+	 */
+	const bmp_t *row;
+	unsigned long k, i;
+	bmp_t par;
+	int sh;
+
+	for(k = dlen; k--; ) {
+		row = rows + k * stride;
+		if(RBIT(row, k)) {
+			/* even parity of the row masked by the terms so far */
+			for(par = BMP_C(0), i = 0UL; i < stride; ++i)
+				par ^= row[i] & vec[i];
+			for(sh = BMP_SUB; sh; sh >>= 1)
+				par ^= par >> sh;
+			if(par & BMP_C(1))
+				RFLIP(vec, k);
+		} else if(k == free)
+			RFLIP(vec, k);
+	}
+}
+
+static void
+rpost(rsrch_t *srch, rscr_t *scr, rtrap_t *trap, rchnk_t *chunk, rcand_t *cand) {
+	/* Marks chunk as searched or, if cand is not NULL, the queued
+	 * candidate cand of chunk as solved, and adds the counts in scr
+	 * to the statistics.  Then reports the models of every finished
+	 * chunk at the head of the queue, in claim order and each
+	 * candidate in turn, so that results appear as they would from
+	 * a single thread.
+	 * Progress is reported every srch->every trial factors.
+	 * trap is the caller's.
+	 */
+	model_t *rptr;
+	int i, n;
+
+	LOCK(srch);
+	trap->held = 1;
+	srch->stat.solves += scr->solves;
+	srch->stat.rejects += scr->rejects;
+	scr->solves = scr->rejects = 0UL;
+	if(cand)
+		--chunk->pending;
+	else
+		chunk->done = 1;
+	while((chunk = srch->head) && chunk->done && !chunk->pending) {
+		/* move the chunk to the spare list and its models to
+		 * the results before reporting them, so that nothing
+		 * is lost if a callback raises an error
+		 */
+		if(!(srch->head = chunk->next))
+			srch->tail = NULL;
+		chunk->next = srch->spare;
+		srch->spare = chunk;
+		i = srch->resc;
+		for(n = chunk->resc, cand = chunk->cands; cand; cand = cand->next)
+			n += cand->resc;
+		if(n) {
+			if(!(rptr = prealloc(srch->result, (srch->resc + n) * sizeof(model_t))))
+				uerror("cannot reallocate result array");
+			srch->result = rptr;
+		}
+		rmove(srch, &chunk->resc, &chunk->result);
+		while((cand = chunk->cands)) {
+			chunk->cands = cand->next;
+			rmove(srch, &cand->resc, &cand->result);
+			cand->next = srch->cspare;
+			srch->cspare = cand;
+		}
+		chunk->ctail = NULL;
+		srch->spin += chunk->spin;
+		srch->stat.divs += chunk->divs;
+		srch->stat.cands += chunk->ncands;
+		/* callback to notify new models */
+		for(; i < srch->resc; ++i)
+			rfound(srch->ctx, srch->result + i);
+		/* once the range is exhausted, srch->next has rolled over
+		 * and is no position to report
+		 */
+		if(srch->spin - srch->prog >= srch->every && (srch->head || srch->more)) {
+			srch->prog = srch->spin - (srch->spin - srch->prog) % srch->every;
+			rstats(srch, srch->head ? srch->head->start : srch->next);
+			rprog(srch->ctx, srch->head ? srch->head->start : srch->next, srch->guess->flags, srch->pseq++);
+		}
+	}
+	trap->held = 0;
+	UNLOCK(srch);
+}
+
+static void
+rstats(rsrch_t *srch, const poly_t pos) {
+	/* Brings the statistics of srch up to date, with pos the next
+	 * trial factor to be reported, and copies them to srch->ctx.
+	 * Once no chunks remain, other than by cancellation, the range
+	 * is done and pos is ignored.
+	 * The caller holds the search lock, or is the only thread.
+	 */
+	rstat_t *const stat = &srch->stat;
+	double done = 1.0;
+
+	stat->factors = srch->spin;
+	stat->models = (unsigned long) srch->resc;
+	if((srch->more || (srch->ctx && srch->ctx->cancel)) && srch->end > srch->beg)
+		done = (rpos(pos) - srch->beg) / (srch->end - srch->beg);
+	stat->done = done < 0.0 ? 0.0 : done > 1.0 ? 1.0 : done;
+	rtime(stat, R_SSRCH, srch->cpu, srch->wall);
+	if(srch->ctx)
+		srch->ctx->stat = *stat;
+}
+
+static double
+rpos(const poly_t poly) {
+	/* Returns the position of poly among the polys of its length,
+	 * from 0 to 1, from its first 64 terms.
+	 */
+	double pos = 0.0, scale = 1.0;
+	unsigned long i;
+
+	for(i = 0UL; i < plen(poly) && i < 64UL; ++i) {
+		scale *= 0.5;
+		if(pcoeff(poly, i))
+			pos += scale;
+	}
+	return(pos);
+}
+
+static int
+rodd(const poly_t poly) {
+	/* Returns nonzero if poly has an odd number of nonzero terms.
+	 * poly must be CLEAN.
+	 */
+	bmp_t fold = BMP_C(0);
+	unsigned long iter, shift;
+
+	for(iter = 0UL; iter < (poly.length + BMP_BIT - 1UL) / BMP_BIT; ++iter)
+		fold ^= poly.bitmap[iter];
+	for(shift = (unsigned long) BMP_BIT >> 1; shift; shift >>= 1)
+		fold ^= fold >> shift;
+	return((int) (fold & BMP_C(1)));
+}
+
+static void
+rtime(rstat_t *stat, int stage, clock_t cpu, time_t wall) {
+	/* Sets the times of stage to those since cpu and wall. */
+	stat->cpu[stage] = (double) (clock() - cpu) / CLOCKS_PER_SEC;
+	stat->wall[stage] = difftime(time(NULL), wall);
+}
+
+static void
+rmove(rsrch_t *srch, int *resc, model_t **result) {
+	/* Moves the models in *result to the end of srch->result, which
+	 * must have room for them, and empties *result.
+	 */
+	model_t *rptr;
+
+	for(rptr = *result; rptr < *result + *resc; ++rptr)
+		srch->result[srch->resc++] = *rptr;
+	pmfree(*result);
+	*result = NULL;
+	*resc = 0;
+}
+
+static void
+rdrop(int *resc, model_t **result) {
+	/* Frees the models in *result and empties it. */
+	model_t *rptr;
+
+	if(*result)
+		for(rptr = *result; rptr < *result + *resc; ++rptr)
+			mfree(rptr);
+	pmfree(*result);
+	*result = NULL;
+	*resc = 0;
+}
+
+static void
+rsdrop(rsrch_t *srch) {
+	/* Frees the chunks left queued in srch by an error, and all
+	 * the models found.  Spare chunks and candidates are kept,
+	 * without models.
+	 */
+	rchnk_t *chunk;
+	rcand_t *cand;
+
+	while((chunk = srch->head)) {
+		srch->head = chunk->next;
+		chunk->next = srch->spare;
+		srch->spare = chunk;
+	}
+	srch->tail = NULL;
+	srch->qhead = srch->qtail = NULL;
+	srch->queued = 0;
+	for(chunk = srch->spare; chunk; chunk = chunk->next) {
+		rdrop(&chunk->resc, &chunk->result);
+		while((cand = chunk->cands)) {
+			chunk->cands = cand->next;
+			rdrop(&cand->resc, &cand->result);
+			cand->next = srch->cspare;
+			srch->cspare = cand;
+		}
+		chunk->ctail = NULL;
+		chunk->pending = 0;
+	}
+	rdrop(&srch->resc, &srch->result);
+}
+
+static void
+rfound(const rctx_t *ctx, const model_t *model) {
+	/* Reports model through ctx, or ufound() if ctx has no callback.
+	 * Storage allocated by the callback is not entered in the
+	 * ledger.
+	 */
+	plog_t *log = plget();
+
+	plset(NULL);
+	if(ctx && ctx->found)
+		ctx->found(model, ctx->data);
+	else
+		ufound(model);
+	plset(log);
+}
+
+static void
+rprog(const rctx_t *ctx, const poly_t gpoly, int flags, unsigned long seq) {
+	/* Reports progress through ctx, or uprog() if ctx has no
+	 * callback, outside the ledger as rfound() does.
+	 */
+	plog_t *log = plget();
+
+	plset(NULL);
+	if(ctx && ctx->prog)
+		ctx->prog(gpoly, flags, seq, ctx->data);
+	else
+		uprog(gpoly, flags, seq);
+	plset(log);
+}
+
+static void
+rtpush(rtrap_t *trap) {
+	/* Makes trap the innermost error trap of the calling thread.
+	 * The caller then calls setjmp(trap->env).
+	 */
+	trap->msg = NULL;
+	trap->held = 0;
+	trap->log = NULL;
+	trap->cur = plget();
+#ifdef THREADS
+	if(pthread_once(&rtonce, rtinit) || !rtkok)
+		uerror("cannot create error trap key");
+	trap->outer = (rtrap_t *) pthread_getspecific(rtkey);
+	pthread_setspecific(rtkey, trap);
+#else
+	trap->outer = rttop;
+	rttop = trap;
+#endif /* THREADS */
+}
+
+static void
+rtpop(rtrap_t *trap) {
+	/* Removes trap, restoring the trap that encloses it. */
+#ifdef THREADS
+	pthread_setspecific(rtkey, trap->outer);
+#else
+	rttop = trap->outer;
+#endif /* THREADS */
+}
+
+static void
+rtdrop(rtrap_t *trap, rctx_t *ctx) {
+	/* Frees the storage entered in the ledger of trap, which
+	 * rtpop() or rthrow() has removed, except that of ctx->gcd.
+	 */
+	if(!trap->log)
+		return;
+	if(ctx && ctx->gcd)
+		plkeep(ctx->gcd->bitmap);
+	plclose(trap->log, 1);
+	trap->log = NULL;
+}
+
+#ifdef THREADS
+static void
+rtinit(void) {
+	/* Creates the key of each thread's innermost trap. */
+	rtkok = !pthread_key_create(&rtkey, NULL);
 }
+#endif /* THREADS */
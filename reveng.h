@@ -30,7 +30,7 @@
 #include "config.h"
 
 #ifndef BMP_T
-#  error config.h: BMP_T must be defined as unsigned long or a longer unsigned type
+#  error config.h: BMP_T must be defined as an unsigned type of at least 32 bits
 #endif
 
 #ifndef BMP_C
@@ -140,10 +140,36 @@ typedef struct {
 				/* left-justified in each word */
 } poly_t;
 
+/* A ptab_t constant representing an engine with no lookup table. */
+#define PTZERO {PZERO, (const bmp_t *) 0, (const bmp_t *) 0, (bmp_t *) 0, (bmp_t *) 0}
+
+typedef struct {
+	poly_t divisor;		/* generator with highest-order term removed */
+	const bmp_t *table;	/* byte-wise remainder table, SIZE(width) words per entry, or NULL */
+	const bmp_t *keys;	/* carry-less multiply folding constants, or NULL */
+	bmp_t *store;		/* storage allocated for table and keys, or NULL */
+	bmp_t *rtable;		/* reflected remainder tables from ptrinit(), or NULL */
+} ptab_t;
+
+/* A pstrm_t constant representing a CRC not yet begun. */
+#define PSZERO {(const ptab_t *) 0, PZERO, PZERO, 0, BMP_C(0), 0}
+
+typedef struct {
+	const ptab_t *tab;	/* engine calculating the CRC */
+	poly_t reg;		/* register after the message so far */
+	poly_t hold;		/* trailing message terms not yet divided */
+	int flags;		/* CRC model flags */
+	bmp_t rreg;		/* reflected register, if refl is set */
+	int refl;		/* nonzero while ptrupdate() runs LSB first */
+} pstrm_t;
+
 extern poly_t filtop(FILE *input, unsigned long length, int flags, int bperhx);
+extern poly_t buftop(const unsigned char *buffer, unsigned long count, int flags, int bperhx);
 extern poly_t strtop(const char *string, int flags, int bperhx);
 extern char *ptostr(const poly_t poly, int flags, int bperhx);
 extern char *pxsubs(const poly_t poly, int flags, int bperhx, unsigned long start, unsigned long end);
+extern unsigned long ptosize(const poly_t poly, int flags, int bperhx);
+extern char *ptostrto(char *dest, const poly_t poly, int flags, int bperhx);
 extern poly_t pclone(const poly_t poly);
 extern void pcpy(poly_t *dest, const poly_t src);
 extern void pcanon(poly_t *poly);
@@ -169,7 +195,22 @@ extern void prcp(poly_t *poly);
 extern void pinv(poly_t *poly);
 extern poly_t pmod(const poly_t dividend, const poly_t divisor, poly_t *quotient);
 extern poly_t pcrc(const poly_t message, const poly_t divisor, const poly_t init, const poly_t xorout, int flags, poly_t *quotient);
+extern void pcrcto(poly_t *dest, const poly_t message, const poly_t divisor, const poly_t init, const poly_t xorout, int flags, poly_t *quotient);
+extern poly_t pxpow(unsigned long power, const poly_t divisor);
+extern poly_t pcomb(const poly_t crca, const poly_t crcb, unsigned long lenb, const poly_t divisor, const poly_t init, const poly_t xorout);
+extern poly_t pmul(const poly_t a, const poly_t b);
+extern unsigned long pfactor(poly_t **dest, const poly_t poly, unsigned long maxdeg);
+extern bmp_t pbdiv(const poly_t dividend, const poly_t divisor, unsigned long lanes, poly_t *work);
 extern int piter(poly_t *poly);
+extern void ptinit(ptab_t *tab, const poly_t divisor);
+extern void ptbake(ptab_t *tab, const poly_t divisor, const bmp_t *table, const bmp_t *keys);
+extern void ptfree(ptab_t *tab);
+extern poly_t ptcrc(const poly_t message, const ptab_t *tab, const poly_t init, const poly_t xorout, int flags);
+extern void ptbegin(pstrm_t *strm, const ptab_t *tab, const poly_t init, int flags);
+extern void ptupdate(pstrm_t *strm, const poly_t chunk);
+extern poly_t ptfinal(pstrm_t *strm, const poly_t xorout);
+extern void ptrinit(ptab_t *tab);
+extern void ptrupdate(pstrm_t *strm, const unsigned char *buffer, unsigned long count);
 extern void palloc(poly_t *poly, unsigned long length);
 extern void pfree(poly_t *poly);
 extern void praloc(poly_t *poly, unsigned long length);
@@ -177,6 +218,63 @@ extern int pmpar(const poly_t poly, const poly_t mask);
 extern int pident(const poly_t a, const poly_t b);
 extern int pcoeff(const poly_t poly, unsigned long idx);
 
+typedef struct plog plog_t;	/* a ledger of storage in use */
+extern plog_t *plopen(void);
+extern void plclose(plog_t *log, int drop);
+extern plog_t *plget(void);
+extern void plset(plog_t *log);
+extern void plkeep(const void *block);
+extern void *pmalloc(size_t size);
+extern void *pcalloc(size_t count, size_t size);
+extern void *prealloc(void *block, size_t size);
+extern void pmfree(void *block);
+
+/* clmul.c */
+extern int clmcpu(void);
+extern void clmfld(bmp_t *fold, const bmp_t *keys, const bmp_t *words, unsigned long count, bmp_t init);
+extern unsigned long clmrev(bmp_t *words, unsigned long count, int bits);
+
+/* ocl.c */
+typedef struct ocl ocl_t;	/* an OpenCL device set up to divide a GCD */
+extern ocl_t *oclopen(const poly_t pwork, unsigned long flen);
+extern int ocldiv(ocl_t *ocl, const poly_t *starts, unsigned long count, unsigned long per, unsigned char *hits);
+extern void oclfree(ocl_t *ocl);
+
+/* prof.c */
+/* Primitives counted by the profile build */
+#define PF_PCRC   0	/* pcrcto() */
+#define PF_PTCRC  1	/* ptcrc() */
+#define PF_PBDIV  2	/* pbdiv() */
+#define PF_PSUM   3	/* psum() */
+#define PF_PSHIFT 4	/* pshift() */
+#define PF_PPASTE 5	/* ppaste() */
+#define PF_PALLOC 6	/* palloc() */
+#define PF_PRALOC 7	/* praloc() */
+#define PF_GETWRD 8	/* getwrd() */
+#define PF_MODPOL 9	/* modpol() */
+#define PF_RTEST  10	/* rtest() */
+#define PF_DISPCH 11	/* dispch() */
+#define PF_ENGINI 12	/* engini() */
+#define PF_CHKRES 13	/* chkres() */
+#define PF_COUNT  14	/* number of primitives counted */
+
+/* If PROFILE is defined, PF_BEGIN, written after the declarations of
+ * a primitive, reads the tick counter, and PF_END(id, bits, bytes),
+ * written before each return, adds a call, the terms processed, the
+ * bytes allocated and the ticks since PF_BEGIN to the counters of
+ * primitive id.  Otherwise they do nothing.
+ */
+#ifdef PROFILE
+#  define PF_BEGIN const unsigned long pft0 = pftick()
+#  define PF_END(id, bits, bytes) pfnote((id), (unsigned long) (bits), (unsigned long) (bytes), pft0)
+extern unsigned long pftick(void);
+extern void pfnote(int id, unsigned long bits, unsigned long bytes, unsigned long start);
+extern void pfdump(void);
+#else
+#  define PF_BEGIN (void) 0
+#  define PF_END(id, bits, bytes) (void) 0
+#endif /* PROFILE */
+
 /* model.c */
 
 /* A model_t constant representing an uninitialised model or zero-bit CRC algorithm. */
@@ -204,11 +302,22 @@ extern void mnovel(model_t *model);
 /* preset.c */
 #define M_OVERWR     1
 
+/* An mprep_t constant representing a preset not yet prepared. */
+#define MPZERO {MZERO, PZERO, PTZERO}
+
+typedef struct {
+	model_t model;		/* unpacked preset model */
+	poly_t xorout;		/* XorOut, reflected if RefOut, as pcrc() takes it */
+	ptab_t tab;		/* CRC engine for the generator */
+} mprep_t;
+
 extern int mbynam(model_t *dest, const char *key);
 extern void mbynum(model_t *dest, int num);
 extern int mcount(void);
 extern char *mnames(void);
 extern void mmatch(model_t *model, int flags);
+extern int mgroup(const mprep_t **dest, unsigned long width, int flags);
+extern int mtinit(ptab_t *tab, const poly_t spoly);
 
 /* reveng.c */
 #define R_HAVEP      1
@@ -221,7 +330,71 @@ extern void mmatch(model_t *model, int flags);
 
 #define R_SPMASK 0x7FFFFFFUL
 
-extern model_t *reveng(const model_t *guess, const poly_t qpoly, int rflags, int args, const poly_t *argpolys);
+/* status of a search, in rctx_t */
+#define R_OK         0
+#define R_CANCEL     1
+#define R_ERROR      2
+
+/* search stages, indexing the times in rstat_t */
+#define R_SGCD       0
+#define R_SSRCH      1
+#define R_SSOLV      2
+#define R_STAGES     3
+
+/* Counters and times of a search, kept in rctx_t.  reveng() brings
+ * them up to date before each progress report and on return.
+ * Processor times are those of the whole process, from clock();
+ * elapsed times have the resolution of time().
+ */
+#define RSTZERO {0UL, 0UL, 0UL, 0UL, 0UL, 0UL, 0.0, {0.0, 0.0, 0.0}, {0.0, 0.0, 0.0}}
+typedef struct {
+	unsigned long factors;	/* trial factors tested */
+	unsigned long divs;	/* divisions of the GCD, single or batched */
+	unsigned long cands;	/* candidate generators found */
+	unsigned long solves;	/* Init solutions by engini() */
+	unsigned long rejects;	/* models rejected by chkres() */
+	unsigned long models;	/* models found */
+	double done;		/* fraction of the trial factor range searched */
+	double cpu[R_STAGES];	/* processor time in each stage, in seconds */
+	double wall[R_STAGES];	/* elapsed time in each stage, in seconds */
+} rstat_t;
+
+/* Search configuration, callbacks and status.  RZERO searches the
+ * whole range on the calling thread and reports through ufound()
+ * and uprog().  If gcd is not NULL, the search resumes from an
+ * earlier one with fewer arguments: *gcd holds the GCD of the
+ * differences between the first olds arguments, only differences
+ * with the later arguments are folded into it, and on return it
+ * holds the GCD of all the differences.  If gens is not negative,
+ * the range is not searched; instead the gens generators in gpolys,
+ * those the earlier search solved, are checked against the arguments.
+ * If sieve is set and the whole range is to be searched, the
+ * generators are found by factorising the GCD instead, unless it has
+ * too many divisors of the right degree.
+ */
+#define RZERO {1, 0UL, 1UL, NULL, NULL, NULL, 0, R_OK, NULL, 0UL, RSTZERO, 0, NULL, NULL, -1, 0, 0}
+typedef struct {
+	int threads;		/* number of search threads (THREADS only) */
+	unsigned long shard;	/* index of range slice to search, from 0 */
+	unsigned long shards;	/* number of slices range is divided into */
+	void (*found)(const model_t *model, void *data);	/* reports models, or NULL */
+	void (*prog)(const poly_t gpoly, int flags, unsigned long seq, void *data); /* reports progress, or NULL */
+	void *data;		/* passed to found and prog */
+	volatile int cancel;	/* set nonzero to end the search early */
+	int status;		/* R_OK, R_CANCEL or R_ERROR on return */
+	const char *error;	/* reason for R_ERROR, or NULL */
+	unsigned long every;	/* trial factors between progress reports, or 0 for R_SPMASK + 1 */
+	rstat_t stat;		/* statistics of the search */
+	int olds;		/* arguments whose differences are in *gcd */
+	poly_t *gcd;		/* GCD carried between searches, or NULL */
+	const poly_t *gpolys;	/* generators to recheck, or NULL to search */
+	int gens;		/* number of generators in gpolys, or -1 to search */
+	int sieve;		/* nonzero to list generators by factorising the GCD */
+	int offload;		/* nonzero to divide on an OpenCL device (OPENCL only) */
+} rctx_t;
+
+extern model_t *reveng(const model_t *guess, const poly_t qpoly, int rflags, int args, const poly_t *argpolys, rctx_t *ctx);
+extern void rthrow(const char *msg);
 
 /* cli.c */
 extern int main(int argc, char *argv[]);
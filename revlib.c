@@ -0,0 +1,61 @@
+/* revlib.c
+ * agent, 14/Oct/2026
+ */
+
+/* CRC RevEng: arbitrary-precision CRC calculator and algorithm finder
+ * Copyright (C) 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018,
+ * 2019, 2020, 2021, 2022  Gregory Cook
+ *
+ * This file is part of CRC RevEng.
+ *
+ * CRC RevEng is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * CRC RevEng is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with CRC RevEng.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/* 2026-10-14: started revlib.c, user functions for the library
+ */
+
+/* This file takes the place of cli.c in the library libreveng.a.
+ * A program using the library calls reveng() with an rctx_t, whose
+ * callbacks receive the models and progress reports and whose status
+ * tells of errors.  The functions below only serve callers that
+ * give no callbacks, and errors raised outside reveng().
+ *
+ * With THREADS defined, several searches may run at once on
+ * different threads of the program.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "reveng.h"
+
+void
+ufound(const model_t *model) {
+	/* Models are returned by reveng() in any case. */
+}
+
+void
+uerror(const char *msg) {
+	/* Ends the reveng() call in progress on this thread with
+	 * R_ERROR status and msg.  Outside reveng(), prints msg and
+	 * exits.
+	 */
+	rthrow(msg);
+	fprintf(stderr, "reveng: %s\n", msg);
+	exit(EXIT_FAILURE);
+}
+
+void
+uprog(const poly_t gpoly, int flags, unsigned long seq) {
+	/* Progress is not reported without a callback. */
+}